@@ -65,6 +65,7 @@ Note that this macros are intended to be used in combination with static_assert
 Macro definitions (CPU architecture)
 ----------------------------------------------------------------------------------------------------------------------*/
 #define E_PTR_SIZE              E_PLATFORM_PTR_SIZE
+#define E_CACHE_LINE_SIZE       E_PLATFORM_CACHE_LINE_SIZE
 
 #ifdef E_PLATFORM_CPU_X86
   #define E_CPU_X86             1
@@ -74,6 +75,24 @@ Macro definitions (CPU architecture)
   #endif
 #endif
 
+#ifdef E_PLATFORM_SIMD_SSE2
+  #define E_SIMD_SSE2           1
+#endif
+#ifdef E_PLATFORM_SIMD_AVX
+  #define E_SIMD_AVX            1
+#endif
+#ifdef E_PLATFORM_SIMD_AVX2
+  #define E_SIMD_AVX2           1
+#endif
+
+#ifdef E_PLATFORM_LITTLE_ENDIAN
+  #define E_LITTLE_ENDIAN       1
+#endif
+
+#define E_BYTE_SWAP_16          E_PLATFORM_BYTE_SWAP_16
+#define E_BYTE_SWAP_32          E_PLATFORM_BYTE_SWAP_32
+#define E_BYTE_SWAP_64          E_PLATFORM_BYTE_SWAP_64
+
 /*----------------------------------------------------------------------------------------------------------------------
 Macro definitions (debug)
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -109,6 +128,7 @@ Please note that this macro has the following usage contract:
 1. The macro defines an API function to be imported unless the E_SETTING_DYNAMIC_LIBRARY macro is defined (which sets
 the API function to be exported). Only projects compiled as dynamic libraries should define E_SETTING_DYNAMIC_LIBRARY.
 ----------------------------------------------------------------------------------------------------------------------*/
+#define E_ALIGN(n)              E_PLATFORM_ALIGN(n)
 #define E_FORCE_INLINE          E_PLATFORM_FORCE_INLINE
 #define E_API                   E_PLATFORM_API
 
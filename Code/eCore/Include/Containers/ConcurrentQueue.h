@@ -0,0 +1,223 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file ConcurrentQueue.h
+This file defines the ConcurrentQueue class. ConcurrentQueue is a bounded lock-free multiple producer / multiple
+consumer queue based on the original by Dmitry Vyukov. http://www.1024cores.net
+*/
+
+#ifndef E3_CONCURRENT_QUEUE_H
+#define E3_CONCURRENT_QUEUE_H
+
+#include <Math/Comparison.h>
+#include <Memory/Memory.h>
+#include <Threads/Atomic.h>
+
+namespace E
+{
+namespace Containers
+{
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentQueue
+
+Every cell of the circular buffer stores a sequence number which tells producers and consumers whether the cell is ready
+to be written or read for the current lap around the buffer. Producers and consumers only contend on their own position
+counter (a single CAS per operation) and never on each other, while the counters live in separate cache lines to avoid
+false sharing.
+
+Please note that this class has the following usage contract:
+
+1. Size MUST be a power of two and it is fixed at construction: Push returns false when the queue is full and Pop
+returns false when the queue is empty.
+2. Push and Pop may be called concurrently from any number of threads. All the other methods are NOT thread-safe.
+3. Popped cells are reset to a default value so that releasing an element does not depend on the queue lifetime.
+4. GetCount is an approximation when the queue is being concurrently modified.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+class ConcurrentQueue
+{
+public:
+  explicit ConcurrentQueue(size_t size);
+  ~ConcurrentQueue();
+
+  // Accessors
+  const Memory::IAllocator* GetAllocator() const;
+  size_t            GetCount() const;
+  size_t            GetSize() const;
+  bool              IsEmpty() const;
+
+  // Methods
+  bool              Pop(T& value);
+  bool              Push(const T& value);
+
+private:
+  struct Cell
+  {
+    U32             sequence;
+    T               value;
+  };
+
+  Memory::IAllocator* mpAllocator;
+  Cell*             mpBuffer;
+  U32               mMask;
+  Byte              mPadding0[E_CACHE_LINE_SIZE];
+  U32               mEnqueuePosition;
+  Byte              mPadding1[E_CACHE_LINE_SIZE - sizeof(U32)];
+  U32               mDequeuePosition;
+  Byte              mPadding2[E_CACHE_LINE_SIZE - sizeof(U32)];
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(ConcurrentQueue)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentQueue initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+inline ConcurrentQueue<T>::ConcurrentQueue(size_t size)
+  : mpAllocator(Memory::Global::GetAllocator())
+  , mpBuffer(nullptr)
+  , mMask(static_cast<U32>(size - 1))
+  , mEnqueuePosition(0)
+  , mDequeuePosition(0)
+{
+  E_ASSERT_MSG(Math::IsPower2(size), E_ASSERT_MSG_MATH_POWER_OF_TWO_VALUE);
+  mpBuffer = E_NEW(Cell, size, mpAllocator, Memory::IAllocator::eTagArrayNew);
+  for (U32 i = 0; i < size; ++i) mpBuffer[i].sequence = i;
+}
+
+template <typename T>
+inline ConcurrentQueue<T>::~ConcurrentQueue()
+{
+  E_DELETE(mpBuffer, mMask + 1, mpAllocator, Memory::IAllocator::eTagArrayDelete);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentQueue accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline const Memory::IAllocator* ConcurrentQueue<T>::GetAllocator() const
+{
+  return mpAllocator;
+}
+
+template <typename T>
+inline size_t ConcurrentQueue<T>::GetCount() const
+{
+  return Threads::Impl::LoadAcquire32(const_cast<U32*>(&mEnqueuePosition)) - Threads::Impl::LoadAcquire32(const_cast<U32*>(&mDequeuePosition));
+}
+
+template <typename T>
+inline size_t ConcurrentQueue<T>::GetSize() const
+{
+  return mMask + 1;
+}
+
+template <typename T>
+inline bool ConcurrentQueue<T>::IsEmpty() const
+{
+  return GetCount() == 0;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentQueue methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------------------------------------------------
+Pop
+
+A cell can be read once its sequence equals the dequeue position plus one (the producer has written it for this lap).
+After reading, the cell sequence is advanced by the buffer size which hands the cell to the producers of the next lap.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+inline bool ConcurrentQueue<T>::Pop(T& value)
+{
+  Cell* pCell = nullptr;
+  U32 position = Threads::Impl::LoadRelaxed32(&mDequeuePosition);
+  for (;;)
+  {
+    pCell = &mpBuffer[position & mMask];
+    I32 difference = static_cast<I32>(Threads::Impl::LoadAcquire32(&pCell->sequence) - (position + 1));
+    if (difference == 0)
+    {
+      U32 original = Threads::Impl::CompareExchange32(&mDequeuePosition, position, position + 1);
+      if (original == position) break;
+      position = original;
+    }
+    else if (difference < 0)
+    {
+      return false;
+    }
+    else
+    {
+      position = Threads::Impl::LoadRelaxed32(&mDequeuePosition);
+    }
+  }
+  value = pCell->value;
+  pCell->value = T();
+  Threads::Impl::StoreRelease32(&pCell->sequence, position + mMask + 1);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Push
+
+A cell can be written once its sequence equals the enqueue position (the consumer of the previous lap has released it).
+After writing, the cell sequence is set to the enqueue position plus one which publishes the value to the consumers.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+inline bool ConcurrentQueue<T>::Push(const T& value)
+{
+  Cell* pCell = nullptr;
+  U32 position = Threads::Impl::LoadRelaxed32(&mEnqueuePosition);
+  for (;;)
+  {
+    pCell = &mpBuffer[position & mMask];
+    I32 difference = static_cast<I32>(Threads::Impl::LoadAcquire32(&pCell->sequence) - position);
+    if (difference == 0)
+    {
+      U32 original = Threads::Impl::CompareExchange32(&mEnqueuePosition, position, position + 1);
+      if (original == position) break;
+      position = original;
+    }
+    else if (difference < 0)
+    {
+      return false;
+    }
+    else
+    {
+      position = Threads::Impl::LoadRelaxed32(&mEnqueuePosition);
+    }
+  }
+  pCell->value = value;
+  Threads::Impl::StoreRelease32(&pCell->sequence, position + 1);
+
+  return true;
+}
+}
+}
+
+#endif
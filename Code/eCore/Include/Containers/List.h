@@ -100,7 +100,8 @@ Please note that this class has the following usage contract:
 13. Explicit constructor just allocates memory (in opposition to std::vector)
 14. When the list Grow if the usage GrowPercentage incurs in the same size, the size is increased by 1.
 15. Clear, PopBack, SetCount and Trim do not modify memory allocation.
-16. On resize array elements are always default initialized.
+16. On resize array elements are always default initialized. Removed elements are destroyed and default constructed 
+again, so that the list memory always holds valid elements to be assigned by the addition methods.
 17. Trim checks that given count is smaller than the current.
 18. PopBack requires that parameter count is not greater than the current count.
 19. Trim and PopBack are complementary.
@@ -193,6 +194,7 @@ private:
   size_t                    mCount;
 
   void                      Grow();
+  void                      Reconstruct(T* pData, size_t count);
 
   // Relying on default copy constructor and assignment operator
 };
@@ -379,7 +381,7 @@ List methods
 template <typename T, size_t Granularity, U8 GrowthPercentage>
 inline void List<T, Granularity, GrowthPercentage>::Clear()
 {
-  Memory::Destruct(mData.GetPtr(), mCount);
+  Reconstruct(mData.GetPtr(), mCount);
   mCount = 0;
 }
 
@@ -464,7 +466,7 @@ inline void List<T, Granularity, GrowthPercentage>::PopBack(size_t count)
 {
   E_ASSERT_MSG(mCount >= count, E_ASSERT_MSG_LIST_REMOVE_COUNT_VALUE);
   mCount -= count;
-  Memory::Destruct(GetEnd(), count);
+  Reconstruct(GetEnd(), count);
 }
 
 template <typename T, size_t Granularity, U8 GrowthPercentage>
@@ -501,7 +503,7 @@ inline void List<T, Granularity, GrowthPercentage>::Remove(Iterator it, size_t c
   E_ASSERT_MSG(mCount >= count, E_ASSERT_MSG_LIST_REMOVE_COUNT_VALUE);
   mCount -= count;
   Memory::Move(it, it + count, GetEnd() - it);
-  Memory::Destruct(GetEnd(), count);
+  Reconstruct(GetEnd(), count);
 }
 
 template <typename T, size_t Granularity, U8 GrowthPercentage>
@@ -515,7 +517,7 @@ inline void List<T, Granularity, GrowthPercentage>::RemoveFast(Iterator it)
 {
   E_ASSERT_MSG(IsValid(it), E_ASSERT_MSG_LIST_ITERATOR_VALUE);
   *it = mData[--mCount];
-  Memory::Destruct(GetEnd());
+  Reconstruct(GetEnd(), 1);
 }
 
 template <typename T, size_t Granularity, U8 GrowthPercentage>
@@ -593,6 +595,15 @@ inline void List<T, Granularity, GrowthPercentage>::Grow()
   Resize(growSize == mData.GetSize() ? growSize + 1 : growSize);
 }
 
+template <typename T, size_t Granularity, U8 GrowthPercentage>
+inline void List<T, Granularity, GrowthPercentage>::Reconstruct(T* pData, size_t count)
+{
+  // Removed elements keep living in the array memory (no-op for POD types)
+  if (count == 0) return;
+  Memory::Destruct(pData, count);
+  Memory::Construct(pData, count);
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 STD begin and end expressions for range for loop
 
@@ -584,7 +584,7 @@ struct MapHasher<KeyType*, sizeof(U64)>
 template <>
 struct MapHasher<String>
 {
-  inline static size_t  Hash(const String& key)                               { return Math::Djb2<String>::Hash(key); }
+  inline static size_t  Hash(const String& key)                               { return static_cast<size_t>(Math::XxHash64::Hash(key)); }
   inline static void    Invalidate(String& key)                               { key.Clear(); }
   inline static bool    IsEqual(const String& key1, const String& key2) { return key1 == key2; }
   inline static bool    IsValid(const String& key)                            { return key.GetLength() != 0; }
@@ -0,0 +1,180 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file RingBuffer.h
+This file defines the RingBuffer class. RingBuffer is a bounded wait-free single producer / single consumer queue.
+*/
+
+#ifndef E3_RING_BUFFER_H
+#define E3_RING_BUFFER_H
+
+#include <Math/Comparison.h>
+#include <Memory/Memory.h>
+#include <Threads/Atomic.h>
+
+namespace E
+{
+namespace Containers
+{
+/*----------------------------------------------------------------------------------------------------------------------
+RingBuffer
+
+The producer only writes the tail index and the consumer only writes the head index, hence neither Push nor Pop ever
+loop or perform interlocked operations. Each side also keeps a cached copy of the opposite index so that the shared
+cache line is only read when the cached value says the buffer is full (producer) or empty (consumer).
+
+Please note that this class has the following usage contract:
+
+1. Size MUST be a power of two and it is fixed at construction: Push returns false when the buffer is full and Pop
+returns false when the buffer is empty.
+2. Push MUST only be called from a single producer thread and Pop MUST only be called from a single consumer thread
+(which may be different from the producer thread). All the other methods are NOT thread-safe.
+3. Popped slots are reset to a default value so that releasing an element does not depend on the buffer lifetime.
+4. GetCount is an approximation when the buffer is being concurrently modified.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+class RingBuffer
+{
+public:
+  explicit RingBuffer(size_t size);
+  ~RingBuffer();
+
+  // Accessors
+  const Memory::IAllocator* GetAllocator() const;
+  size_t            GetCount() const;
+  size_t            GetSize() const;
+  bool              IsEmpty() const;
+
+  // Methods
+  bool              Pop(T& value);
+  bool              Push(const T& value);
+
+private:
+  Memory::IAllocator* mpAllocator;
+  T*                mpBuffer;
+  U32               mMask;
+  Byte              mPadding0[E_CACHE_LINE_SIZE];
+  // Consumer cache line
+  U32               mHead;
+  U32               mCachedTail;
+  Byte              mPadding1[E_CACHE_LINE_SIZE - 2 * sizeof(U32)];
+  // Producer cache line
+  U32               mTail;
+  U32               mCachedHead;
+  Byte              mPadding2[E_CACHE_LINE_SIZE - 2 * sizeof(U32)];
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(RingBuffer)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+RingBuffer initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+inline RingBuffer<T>::RingBuffer(size_t size)
+  : mpAllocator(Memory::Global::GetAllocator())
+  , mpBuffer(nullptr)
+  , mMask(static_cast<U32>(size - 1))
+  , mHead(0)
+  , mCachedTail(0)
+  , mTail(0)
+  , mCachedHead(0)
+{
+  E_ASSERT_MSG(Math::IsPower2(size), E_ASSERT_MSG_MATH_POWER_OF_TWO_VALUE);
+  mpBuffer = E_NEW(T, size, mpAllocator, Memory::IAllocator::eTagArrayNew);
+}
+
+template <typename T>
+inline RingBuffer<T>::~RingBuffer()
+{
+  E_DELETE(mpBuffer, mMask + 1, mpAllocator, Memory::IAllocator::eTagArrayDelete);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+RingBuffer accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline const Memory::IAllocator* RingBuffer<T>::GetAllocator() const
+{
+  return mpAllocator;
+}
+
+template <typename T>
+inline size_t RingBuffer<T>::GetCount() const
+{
+  return Threads::Impl::LoadAcquire32(const_cast<U32*>(&mTail)) - Threads::Impl::LoadAcquire32(const_cast<U32*>(&mHead));
+}
+
+template <typename T>
+inline size_t RingBuffer<T>::GetSize() const
+{
+  return mMask + 1;
+}
+
+template <typename T>
+inline bool RingBuffer<T>::IsEmpty() const
+{
+  return GetCount() == 0;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+RingBuffer methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline bool RingBuffer<T>::Pop(T& value)
+{
+  U32 head = mHead;
+  if (head == mCachedTail)
+  {
+    mCachedTail = Threads::Impl::LoadAcquire32(&mTail);
+    if (head == mCachedTail) return false;
+  }
+  T& slot = mpBuffer[head & mMask];
+  value = slot;
+  slot = T();
+  Threads::Impl::StoreRelease32(&mHead, head + 1);
+
+  return true;
+}
+
+template <typename T>
+inline bool RingBuffer<T>::Push(const T& value)
+{
+  U32 tail = mTail;
+  if (tail - mCachedHead > mMask)
+  {
+    mCachedHead = Threads::Impl::LoadAcquire32(&mHead);
+    if (tail - mCachedHead > mMask) return false;
+  }
+  mpBuffer[tail & mMask] = value;
+  Threads::Impl::StoreRelease32(&mTail, tail + 1);
+
+  return true;
+}
+}
+}
+
+#endif
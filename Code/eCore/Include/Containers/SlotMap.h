@@ -0,0 +1,395 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file SlotMap.h
+This file defines the SlotMap class. SlotMap is a dense sequential container addressed through stable generation-checked
+handles.
+*/
+
+#ifndef E3_SLOT_MAP_H
+#define E3_SLOT_MAP_H
+
+#include "List.h"
+
+/*----------------------------------------------------------------------------------------------------------------------
+SlotMap assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_SLOT_MAP_HANDLE_VALUE      "Handle must be valid"
+#define E_ASSERT_MSG_SLOT_MAP_COUNT_MAX_VALUE   "Slot count cannot be greater than (%d)"
+
+/*----------------------------------------------------------------------------------------------------------------------
+Macro definitions (E_INTERNAL_SETTING_SLOT_MAP_INDEX_BITS)
+
+Please note that this macro has the following usage contract:
+
+1. This macro defines the number of SlotMapHandle bits used to store the slot index. The remaining bits store the slot
+generation, so the more slots a SlotMap can address the sooner a reused slot generation wraps around.
+2. This is a global library setting macro which can be predefined by the user.
+3. This macro value MUST be an natural between 1 and 31.
+4. This macro is internal and CANNOT be defined outside the library as SlotMapHandle values are shared by all the library
+classes. You may redefine it at the beginning of Base.h instead.
+----------------------------------------------------------------------------------------------------------------------*/
+#ifndef E_INTERNAL_SETTING_SLOT_MAP_INDEX_BITS
+#define E_INTERNAL_SETTING_SLOT_MAP_INDEX_BITS 20
+#endif
+
+namespace E
+{
+namespace Containers
+{
+/*----------------------------------------------------------------------------------------------------------------------
+SlotMap types
+
+A SlotMapHandle packs a slot index (low bits) and the slot generation at the time of insertion (high bits). The handle
+value 0 is never returned by a SlotMap and can be used as an invalid handle.
+----------------------------------------------------------------------------------------------------------------------*/
+typedef U32 SlotMapHandle;
+
+/*----------------------------------------------------------------------------------------------------------------------
+SlotMap
+
+Values are stored contiguously so iteration is as fast as iterating a List. An indirection table of slots maps every
+handle to the current value position: on removal the last value is moved into the gap and its slot updated, while the
+removed slot generation is increased so that any handle still referring to it is detected as stale.
+
+Please note that this class has the following usage contract:
+
+1. Insert and Remove are O(1). Removal alters the value order (same as List::RemoveFast).
+2. Iterators and value pointers are invalidated by Insert, Remove and Clear. Handles are only invalidated by removing
+their own value (or by Clear).
+3. Find returns nullptr for stale or invalid handles while operator[] will E_ASSERT_MSG on them.
+4. The maximum number of slots is defined by E_INTERNAL_SETTING_SLOT_MAP_INDEX_BITS.
+5. Remove returns true on success and false if the handle is not valid.
+6. A slot generation wraps around after 2^(32 - E_INTERNAL_SETTING_SLOT_MAP_INDEX_BITS) - 1 reuses, after which a very
+old stale handle would be considered valid again.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+class SlotMap
+{
+public:
+  // Types
+  typedef typename T* Iterator;
+  typedef typename const T* ConstIterator;
+
+  // Constants
+  static const SlotMapHandle  kInvalidHandle = 0;
+
+  SlotMap();
+  explicit SlotMap(size_t size);
+
+  // Operators
+  const T&                  operator [] (SlotMapHandle handle) const;
+  T&                        operator [] (SlotMapHandle handle);
+
+  // Accessors
+  const Memory::IAllocator* GetAllocator() const;
+  ConstIterator             GetBegin() const;
+  Iterator                  GetBegin();
+  size_t                    GetCount() const;
+  ConstIterator             GetEnd() const;
+  Iterator                  GetEnd();
+  SlotMapHandle             GetHandle(size_t index) const;
+  const T*                  GetPtr() const;
+  T*                        GetPtr();
+  size_t                    GetSize() const;
+  bool                      IsEmpty() const;
+  bool                      IsValid(SlotMapHandle handle) const;
+  void                      SetAllocator(Memory::IAllocator* p);
+
+  // Methods
+  void                      Clear();
+  const T*                  Find(SlotMapHandle handle) const;
+  T*                        Find(SlotMapHandle handle);
+  SlotMapHandle             Insert(const T& value);
+  bool                      Remove(SlotMapHandle handle);
+  void                      Reserve(size_t size);
+
+private:
+  static const U32          kIndexBits = E_INTERNAL_SETTING_SLOT_MAP_INDEX_BITS;
+  static const U32          kIndexMask = (1u << kIndexBits) - 1;
+  static const U32          kGenerationMask = 0xffffffff >> kIndexBits;
+  static const U32          kFreeListEnd = kIndexMask;
+
+  struct Slot
+  {
+    U32                     index;      // Value index when used, next free slot index when free
+    U32                     generation;
+  };
+
+  List<T>                   mValueList;
+  List<U32>                 mValueSlotList;
+  List<Slot>                mSlotList;
+  U32                       mFreeSlot;
+
+  const Slot*               FindSlot(SlotMapHandle handle) const;
+  void                      ReleaseSlot(U32 slotIndex);
+
+  // Relying on default copy constructor and assignment operator
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+SlotMap initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+inline SlotMap<T>::SlotMap()
+  : mFreeSlot(kFreeListEnd)
+{
+  static_assert(kIndexBits > 0 && kIndexBits < 32, "E_INTERNAL_SETTING_SLOT_MAP_INDEX_BITS must be between 1 and 31");
+}
+
+template <typename T>
+inline SlotMap<T>::SlotMap(size_t size)
+  : mValueList(size)
+  , mValueSlotList(size)
+  , mSlotList(size)
+  , mFreeSlot(kFreeListEnd)
+{
+  static_assert(kIndexBits > 0 && kIndexBits < 32, "E_INTERNAL_SETTING_SLOT_MAP_INDEX_BITS must be between 1 and 31");
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SlotMap operators
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+inline const T& SlotMap<T>::operator[](SlotMapHandle handle) const
+{
+  const T* pValue = Find(handle);
+  E_ASSERT_MSG(pValue, E_ASSERT_MSG_SLOT_MAP_HANDLE_VALUE);
+  return *pValue;
+}
+
+template <typename T>
+inline T& SlotMap<T>::operator[](SlotMapHandle handle)
+{
+  return const_cast<T&>(static_cast<const SlotMap*>(this)->operator[](handle));
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SlotMap accessors
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+inline const Memory::IAllocator* SlotMap<T>::GetAllocator() const
+{
+  return mValueList.GetAllocator();
+}
+
+template <typename T>
+inline typename SlotMap<T>::ConstIterator SlotMap<T>::GetBegin() const
+{
+  return mValueList.GetBegin();
+}
+
+template <typename T>
+inline typename SlotMap<T>::Iterator SlotMap<T>::GetBegin()
+{
+  return mValueList.GetBegin();
+}
+
+template <typename T>
+inline size_t SlotMap<T>::GetCount() const
+{
+  return mValueList.GetCount();
+}
+
+template <typename T>
+inline typename SlotMap<T>::ConstIterator SlotMap<T>::GetEnd() const
+{
+  return mValueList.GetEnd();
+}
+
+template <typename T>
+inline typename SlotMap<T>::Iterator SlotMap<T>::GetEnd()
+{
+  return mValueList.GetEnd();
+}
+
+/** This method returns the handle of the value at a given position (e.g. while iterating).
+@param index the value position.
+@return the value handle.
+@throw nothing.
+*/
+template <typename T>
+inline SlotMapHandle SlotMap<T>::GetHandle(size_t index) const
+{
+  U32 slotIndex = mValueSlotList[index];
+  return (mSlotList[slotIndex].generation << kIndexBits) | slotIndex;
+}
+
+template <typename T>
+inline const T* SlotMap<T>::GetPtr() const
+{
+  return mValueList.GetPtr();
+}
+
+template <typename T>
+inline T* SlotMap<T>::GetPtr()
+{
+  return mValueList.GetPtr();
+}
+
+template <typename T>
+inline size_t SlotMap<T>::GetSize() const
+{
+  return mValueList.GetSize();
+}
+
+template <typename T>
+inline bool SlotMap<T>::IsEmpty() const
+{
+  return mValueList.IsEmpty();
+}
+
+template <typename T>
+inline bool SlotMap<T>::IsValid(SlotMapHandle handle) const
+{
+  return FindSlot(handle) != nullptr;
+}
+
+template <typename T>
+inline void SlotMap<T>::SetAllocator(Memory::IAllocator* p)
+{
+  mValueList.SetAllocator(p);
+  mValueSlotList.SetAllocator(p);
+  mSlotList.SetAllocator(p);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SlotMap methods
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+inline void SlotMap<T>::Clear()
+{
+  // Release every used slot so that all the outstanding handles become stale
+  for (size_t i = 0; i < mValueSlotList.GetCount(); ++i) ReleaseSlot(mValueSlotList[i]);
+  mValueList.Clear();
+  mValueSlotList.Clear();
+}
+
+template <typename T>
+inline const T* SlotMap<T>::Find(SlotMapHandle handle) const
+{
+  const Slot* pSlot = FindSlot(handle);
+  return pSlot ? &mValueList[pSlot->index] : nullptr;
+}
+
+template <typename T>
+inline T* SlotMap<T>::Find(SlotMapHandle handle)
+{
+  return const_cast<T*>(static_cast<const SlotMap*>(this)->Find(handle));
+}
+
+template <typename T>
+inline SlotMapHandle SlotMap<T>::Insert(const T& value)
+{
+  U32 slotIndex = mFreeSlot;
+  if (slotIndex == kFreeListEnd)
+  {
+    // No free slots: append a new one (generations start at 1 so that a handle is never 0)
+    slotIndex = static_cast<U32>(mSlotList.GetCount());
+    E_ASSERT_MSG(slotIndex < kFreeListEnd, E_ASSERT_MSG_SLOT_MAP_COUNT_MAX_VALUE, kFreeListEnd);
+    Slot slot = { 0, 1 };
+    mSlotList.PushBack(slot);
+  }
+  else
+  {
+    mFreeSlot = mSlotList[slotIndex].index;
+  }
+
+  Slot& slot = mSlotList[slotIndex];
+  slot.index = static_cast<U32>(mValueList.GetCount());
+  mValueList.PushBack(value);
+  mValueSlotList.PushBack(slotIndex);
+
+  return (slot.generation << kIndexBits) | slotIndex;
+}
+
+template <typename T>
+inline bool SlotMap<T>::Remove(SlotMapHandle handle)
+{
+  const Slot* pSlot = FindSlot(handle);
+  if (pSlot == nullptr) return false;
+
+  // Move the last value into the removed position and redirect its slot
+  U32 index = pSlot->index;
+  U32 lastSlotIndex = mValueSlotList[mValueList.GetCount() - 1];
+  mSlotList[lastSlotIndex].index = index;
+  mValueList.RemoveIndexFast(index);
+  mValueSlotList.RemoveIndexFast(index);
+  ReleaseSlot(handle & kIndexMask);
+
+  return true;
+}
+
+template <typename T>
+inline void SlotMap<T>::Reserve(size_t size)
+{
+  if (size > mValueList.GetSize())
+  {
+    mValueList.EnsureSize(size);
+    mValueSlotList.EnsureSize(size);
+    mSlotList.EnsureSize(size);
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SlotMap private methods
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+inline const typename SlotMap<T>::Slot* SlotMap<T>::FindSlot(SlotMapHandle handle) const
+{
+  U32 slotIndex = handle & kIndexMask;
+  if (slotIndex >= mSlotList.GetCount()) return nullptr;
+  const Slot& slot = mSlotList[slotIndex];
+  return (slot.generation == (handle >> kIndexBits)) ? &slot : nullptr;
+}
+
+template <typename T>
+inline void SlotMap<T>::ReleaseSlot(U32 slotIndex)
+{
+  Slot& slot = mSlotList[slotIndex];
+  slot.generation = (slot.generation + 1) & kGenerationMask;
+  if (slot.generation == 0) slot.generation = 1;
+  slot.index = mFreeSlot;
+  mFreeSlot = slotIndex;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+STD begin and end expressions for range for loop (see List.h)
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+inline typename SlotMap<T>::ConstIterator begin(const SlotMap<T>& slotMap) { return slotMap.GetBegin(); }
+
+template <typename T>
+inline typename SlotMap<T>::Iterator begin(SlotMap<T>& slotMap) { return slotMap.GetBegin(); }
+
+template <typename T>
+inline typename SlotMap<T>::ConstIterator end(const SlotMap<T>& slotMap) { return slotMap.GetEnd(); }
+
+template <typename T>
+inline typename SlotMap<T>::Iterator end(SlotMap<T>& slotMap) { return slotMap.GetEnd(); }
+}
+}
+
+#endif
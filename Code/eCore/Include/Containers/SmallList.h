@@ -0,0 +1,574 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file SmallList.h
+This file defines the SmallList class. SmallList is a List variant which stores up to InlineSize elements inside the
+instance itself and only allocates heap memory when that capacity is exceeded.
+*/
+
+#ifndef E3_SMALL_LIST_H
+#define E3_SMALL_LIST_H
+
+#include "List.h"
+
+/*----------------------------------------------------------------------------------------------------------------------
+SmallList assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_SMALL_LIST_INDEX_VALUE         "Index value (%d) must be smaller than count (%d)"
+#define E_ASSERT_MSG_SMALL_LIST_INLINE_SIZE_VALUE   "InlineSize must be greater than zero"
+#define E_ASSERT_MSG_SMALL_LIST_ITERATOR_VALUE      "SmallList iterator must be valid"
+#define E_ASSERT_MSG_SMALL_LIST_REMOVE_COUNT_VALUE  "Remove count value must be smaller or equal to the current count"
+
+namespace E
+{
+namespace Containers
+{
+/*----------------------------------------------------------------------------------------------------------------------
+SmallList
+
+Please note that this class has the following usage contract:
+
+1. SmallList is API compatible with List for the subset of methods it declares, so it can replace a List member
+without modifying the client code (iteration, PushBack, RemoveFast, SetAllocator, etc.).
+2. The first InlineSize elements are stored in the SmallList instance. Only when the count exceeds InlineSize the
+elements are moved to a heap block allocated through the list allocator (growth follows GrowthPercentage as in List).
+3. Resize / Compact to a size smaller or equal to InlineSize moves the elements back to the inline storage and
+releases the heap block.
+4. GetSize is never smaller than InlineSize.
+5. Removal methods reset removed slots to a default constructed value instead of destructing them in place, as the
+inline elements are destructed together with the SmallList instance. This prevents removed non-POD values (e.g.
+Memory::GCRef) from being kept alive by the container.
+6. SetAllocator on a spilled list moves the elements to a block allocated by the new allocator.
+7. Iterators are invalidated when the elements move from inline to heap storage or vice versa.
+
+Note: SmallList is meant for members that hold a handful of elements most of the time (e.g. object components or
+event bindings). For large element counts List is preferred, as SmallList carries the inline storage on every
+instance.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T, size_t InlineSize, U8 GrowthPercentage = E_INTERNAL_SETTING_LIST_GROWTH_PERCENTAGE>
+class SmallList
+{
+public:
+  // Types
+  typedef typename T* Iterator;
+  typedef typename const T* ConstIterator;
+
+  // Constants
+  static const size_t  kInlineSize = InlineSize;
+  static const size_t  kInvalidIndex = static_cast<size_t>(-1); // 0xffffffff
+
+  SmallList();
+  explicit SmallList(size_t size);
+  SmallList(const T* pData, size_t count);
+  SmallList(const SmallList& other);
+  ~SmallList();
+
+  // Operators
+  SmallList&                operator=(const SmallList& other);
+  const T&                  operator [] (size_t index) const;
+  T&                        operator [] (size_t index);
+
+  // Accessors
+  const Memory::IAllocator* GetAllocator() const;
+  ConstIterator             GetBack() const;
+  Iterator                  GetBack();
+  ConstIterator             GetBegin() const;
+  Iterator                  GetBegin();
+  size_t                    GetCount() const;
+  ConstIterator             GetEnd() const;
+  Iterator                  GetEnd();
+  U8                        GetGrowthPercentage() const;
+  size_t                    GetInlineSize() const;
+  const T*                  GetPtr() const;
+  T*                        GetPtr();
+  size_t                    GetSize() const;
+  bool                      HasValue(const T& value) const;
+  bool                      IsEmpty() const;
+  bool                      IsInline() const;
+  bool                      IsValid(ConstIterator cit) const;
+  bool                      IsValid(size_t index) const;
+  void                      SetAllocator(Memory::IAllocator* p);
+
+  // Methods
+  void                      Clear();
+  void                      Compact();
+  void                      EnsureSize(size_t size);
+  ConstIterator             Find(const T& value) const;
+  Iterator                  Find(const T& value);
+  size_t                    FindIndex(const T& value) const;
+  T*                        FindValue(const T& value);
+  void                      InsertAt(const T& value, size_t index);
+  void                      PopBack(size_t count = 1);
+  void                      PushBack(const T& value);
+  void                      PushBack(const T* pData, size_t count);
+  void                      PushBack(const SmallList& other);
+  void                      Remove(Iterator it, size_t count = 1);
+  void                      RemoveIndex(size_t index);
+  void                      RemoveFast(Iterator it);
+  void                      RemoveIndexFast(size_t index);
+  bool                      RemoveIf(const T& value);
+  bool                      RemoveIfFast(const T& value);
+  void                      Resize(size_t size);
+  void                      Trim(size_t count);
+
+private:
+  T                         mInlineData[InlineSize];
+  Memory::IAllocator*       mpAllocator;
+  T*                        mpPtr;
+  size_t                    mSize;
+  size_t                    mCount;
+
+  void                      Grow();
+  void                      Reallocate(size_t size);
+  void                      Reset(T* pData, size_t count);
+
+  // This class defines a copy constructor and assignment operator
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+SmallList initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline SmallList<T, InlineSize, GrowthPercentage>::SmallList()
+  : mpAllocator(Memory::Global::GetAllocator())
+  , mpPtr(mInlineData)
+  , mSize(InlineSize)
+  , mCount(0)
+{
+  static_assert(InlineSize > 0, E_ASSERT_MSG_SMALL_LIST_INLINE_SIZE_VALUE);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline SmallList<T, InlineSize, GrowthPercentage>::SmallList(size_t size)
+  : mpAllocator(Memory::Global::GetAllocator())
+  , mpPtr(mInlineData)
+  , mSize(InlineSize)
+  , mCount(0)
+{
+  static_assert(InlineSize > 0, E_ASSERT_MSG_SMALL_LIST_INLINE_SIZE_VALUE);
+  EnsureSize(size);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline SmallList<T, InlineSize, GrowthPercentage>::SmallList(const T* pData, size_t count)
+  : mpAllocator(Memory::Global::GetAllocator())
+  , mpPtr(mInlineData)
+  , mSize(InlineSize)
+  , mCount(0)
+{
+  static_assert(InlineSize > 0, E_ASSERT_MSG_SMALL_LIST_INLINE_SIZE_VALUE);
+  PushBack(pData, count);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline SmallList<T, InlineSize, GrowthPercentage>::SmallList(const SmallList& other)
+  : mpAllocator(other.mpAllocator)
+  , mpPtr(mInlineData)
+  , mSize(InlineSize)
+  , mCount(0)
+{
+  PushBack(other.mpPtr, other.mCount);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline SmallList<T, InlineSize, GrowthPercentage>::~SmallList()
+{
+  if (!IsInline()) E_DELETE(mpPtr, mSize, mpAllocator, Memory::IAllocator::eTagArrayDelete);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SmallList operators
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline SmallList<T, InlineSize, GrowthPercentage>& SmallList<T, InlineSize, GrowthPercentage>::operator=(const SmallList& other)
+{
+  if (this != &other)
+  {
+    Clear();
+    PushBack(other.mpPtr, other.mCount);
+  }
+  return *this;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline const T& SmallList<T, InlineSize, GrowthPercentage>::operator[](size_t index) const
+{
+  E_ASSERT_MSG(IsValid(index), E_ASSERT_MSG_SMALL_LIST_INDEX_VALUE, index, mCount);
+  return mpPtr[index];
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline T& SmallList<T, InlineSize, GrowthPercentage>::operator[](size_t index)
+{
+  E_ASSERT_MSG(index < mSize, E_ASSERT_MSG_SMALL_LIST_INDEX_VALUE, index, mSize);
+  return mpPtr[index];
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SmallList accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline const Memory::IAllocator* SmallList<T, InlineSize, GrowthPercentage>::GetAllocator() const
+{
+  return mpAllocator;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline typename SmallList<T, InlineSize, GrowthPercentage>::ConstIterator SmallList<T, InlineSize, GrowthPercentage>::GetBack() const
+{
+  return (mCount == 0) ? GetEnd() : ConstIterator(mpPtr + mCount - 1);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline typename SmallList<T, InlineSize, GrowthPercentage>::Iterator SmallList<T, InlineSize, GrowthPercentage>::GetBack()
+{
+  return const_cast<Iterator>(const_cast<const SmallList*>(this)->GetBack());
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline typename SmallList<T, InlineSize, GrowthPercentage>::ConstIterator SmallList<T, InlineSize, GrowthPercentage>::GetBegin() const
+{
+  return mpPtr;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline typename SmallList<T, InlineSize, GrowthPercentage>::Iterator SmallList<T, InlineSize, GrowthPercentage>::GetBegin()
+{
+  return mpPtr;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline size_t SmallList<T, InlineSize, GrowthPercentage>::GetCount() const
+{
+  return mCount;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline typename SmallList<T, InlineSize, GrowthPercentage>::ConstIterator SmallList<T, InlineSize, GrowthPercentage>::GetEnd() const
+{
+  return mpPtr + mCount;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline typename SmallList<T, InlineSize, GrowthPercentage>::Iterator SmallList<T, InlineSize, GrowthPercentage>::GetEnd()
+{
+  return mpPtr + mCount;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline U8 SmallList<T, InlineSize, GrowthPercentage>::GetGrowthPercentage() const
+{
+  return GrowthPercentage;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline size_t SmallList<T, InlineSize, GrowthPercentage>::GetInlineSize() const
+{
+  return InlineSize;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline const T* SmallList<T, InlineSize, GrowthPercentage>::GetPtr() const
+{
+  return mpPtr;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline T* SmallList<T, InlineSize, GrowthPercentage>::GetPtr()
+{
+  return mpPtr;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline size_t SmallList<T, InlineSize, GrowthPercentage>::GetSize() const
+{
+  return mSize;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline bool SmallList<T, InlineSize, GrowthPercentage>::HasValue(const T& value) const
+{
+  return (Find(value) != GetEnd());
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline bool SmallList<T, InlineSize, GrowthPercentage>::IsEmpty() const
+{
+  return (mCount == 0);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline bool SmallList<T, InlineSize, GrowthPercentage>::IsInline() const
+{
+  return (mpPtr == mInlineData);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline bool SmallList<T, InlineSize, GrowthPercentage>::IsValid(ConstIterator cit) const
+{
+  return (!(cit < GetBegin()) && cit < GetEnd());
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline bool SmallList<T, InlineSize, GrowthPercentage>::IsValid(size_t index) const
+{
+  return (index < mCount);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::SetAllocator(Memory::IAllocator* p)
+{
+  E_ASSERT_PTR(p);
+  if (p == mpAllocator) return;
+  if (!IsInline())
+  {
+    // Move the spilled elements to a block owned by the new allocator
+    T* pData = E_NEW(T, mSize, p, Memory::IAllocator::eTagArrayNew);
+    Memory::Copy(pData, mpPtr, mCount);
+    E_DELETE(mpPtr, mSize, mpAllocator, Memory::IAllocator::eTagArrayDelete);
+    mpPtr = pData;
+  }
+  mpAllocator = p;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SmallList methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::Clear()
+{
+  Reset(mpPtr, mCount);
+  mCount = 0;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::Compact()
+{
+  Resize(mCount);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::EnsureSize(size_t size)
+{
+  if (mSize < size) Reallocate(size);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline typename SmallList<T, InlineSize, GrowthPercentage>::ConstIterator SmallList<T, InlineSize, GrowthPercentage>::Find(const T& value) const
+{
+  size_t i = 0;
+  for (i; i < mCount && mpPtr[i] != value; ++i) continue;
+  return mpPtr + i;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline typename SmallList<T, InlineSize, GrowthPercentage>::Iterator SmallList<T, InlineSize, GrowthPercentage>::Find(const T& value)
+{
+  return const_cast<Iterator>(const_cast<const SmallList*>(this)->Find(value));
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline size_t SmallList<T, InlineSize, GrowthPercentage>::FindIndex(const T& value) const
+{
+  ConstIterator cit = Find(value);
+  return (cit != GetEnd()) ? static_cast<size_t>(cit - GetBegin()) : kInvalidIndex;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline T* SmallList<T, InlineSize, GrowthPercentage>::FindValue(const T& value)
+{
+  Iterator it = Find(value);
+  return (it != GetEnd()) ? &*it : nullptr;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::InsertAt(const T& value, size_t index)
+{
+  if (mCount == mSize) Grow();
+  if (index > mCount) index = mCount;
+  for (size_t i = mCount; i > index; --i) mpPtr[i] = mpPtr[i - 1];
+  mpPtr[index] = value;
+  mCount++;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::PopBack(size_t count)
+{
+  E_ASSERT_MSG(mCount >= count, E_ASSERT_MSG_SMALL_LIST_REMOVE_COUNT_VALUE);
+  mCount -= count;
+  Reset(GetEnd(), count);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::PushBack(const T& value)
+{
+  if (mCount == mSize) Grow();
+  mpPtr[mCount++] = value;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::PushBack(const T* pData, size_t count)
+{
+  EnsureSize(mCount + count);
+  Memory::Copy(mpPtr + mCount, pData, count);
+  mCount += count;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::PushBack(const SmallList& other)
+{
+  PushBack(other.mpPtr, other.mCount);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::Remove(Iterator it, size_t count /* = 1 */)
+{
+  E_ASSERT_MSG(IsValid(it), E_ASSERT_MSG_SMALL_LIST_ITERATOR_VALUE);
+  E_ASSERT_MSG(GetEnd() - it >= static_cast<ptrdiff_t>(count), E_ASSERT_MSG_SMALL_LIST_REMOVE_COUNT_VALUE);
+  Iterator itEnd = GetEnd();
+  for (Iterator itNext = it + count; itNext != itEnd; ++it, ++itNext) *it = *itNext;
+  mCount -= count;
+  Reset(GetEnd(), count);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::RemoveIndex(size_t index)
+{
+  Remove(mpPtr + index);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::RemoveFast(Iterator it)
+{
+  E_ASSERT_MSG(IsValid(it), E_ASSERT_MSG_SMALL_LIST_ITERATOR_VALUE);
+  *it = mpPtr[--mCount];
+  Reset(GetEnd(), 1);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::RemoveIndexFast(size_t index)
+{
+  RemoveFast(mpPtr + index);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline bool SmallList<T, InlineSize, GrowthPercentage>::RemoveIf(const T& value)
+{
+  Iterator it = Find(value);
+  if (it != GetEnd())
+  {
+    Remove(it);
+    return true;
+  }
+  return false;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline bool SmallList<T, InlineSize, GrowthPercentage>::RemoveIfFast(const T& value)
+{
+  Iterator it = Find(value);
+  if (it != GetEnd())
+  {
+    RemoveFast(it);
+    return true;
+  }
+  return false;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::Resize(size_t size)
+{
+  Reallocate(size);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::Trim(size_t count)
+{
+  if (count < mCount) PopBack(mCount - count);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SmallList private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::Grow()
+{
+  size_t growSize = static_cast<size_t>(mSize * (GrowthPercentage + 100) / 100);
+  Reallocate(growSize == mSize ? growSize + 1 : growSize);
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::Reallocate(size_t size)
+{
+  if (size < InlineSize) size = InlineSize;
+  if (size == mSize) return;
+
+  T* pData = (size == InlineSize) ? mInlineData : E_NEW(T, size, mpAllocator, Memory::IAllocator::eTagArrayNew);
+  size_t count = Math::Min(mCount, size);
+  Memory::Copy(pData, mpPtr, count);
+  if (IsInline())
+  {
+    // Release inline values once they have been spilled to the heap block
+    Reset(mInlineData, mCount);
+  }
+  else
+  {
+    E_DELETE(mpPtr, mSize, mpAllocator, Memory::IAllocator::eTagArrayDelete);
+  }
+  mpPtr = pData;
+  mSize = size;
+  mCount = count;
+}
+
+template <typename T, size_t InlineSize, U8 GrowthPercentage>
+inline void SmallList<T, InlineSize, GrowthPercentage>::Reset(T* pData, size_t count)
+{
+  if (PodTypeTraits<T>::value) return;
+  for (T* pEnd = pData + count; pData != pEnd; ++pData) *pData = T();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+STD begin and end expressions for range for loop (see List.h)
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T, size_t InlineSize, E::U8 GrowthPercentage>
+inline typename SmallList<T, InlineSize, GrowthPercentage>::ConstIterator begin(const SmallList<T, InlineSize, GrowthPercentage>& list) { return list.GetBegin(); }
+
+template <typename T, size_t InlineSize, E::U8 GrowthPercentage>
+inline typename SmallList<T, InlineSize, GrowthPercentage>::Iterator begin(SmallList<T, InlineSize, GrowthPercentage>& list) { return list.GetBegin(); }
+
+template <typename T, size_t InlineSize, E::U8 GrowthPercentage>
+inline typename SmallList<T, InlineSize, GrowthPercentage>::ConstIterator end(const SmallList<T, InlineSize, GrowthPercentage>& list) { return list.GetEnd(); }
+
+template <typename T, size_t InlineSize, E::U8 GrowthPercentage>
+inline typename SmallList<T, InlineSize, GrowthPercentage>::Iterator end(SmallList<T, InlineSize, GrowthPercentage>& list) { return list.GetEnd(); }
+}
+}
+
+#endif
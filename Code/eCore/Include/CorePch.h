@@ -40,7 +40,13 @@ This file defines includes all the headers required by the Utilities library for
 #include <Assertion/Exception.h>
 #include <Containers/Stack.h>
 #include <FileSystem/Archive.h>
+#include <FileSystem/AsyncIO.h>
+#include <FileSystem/DirectoryScanner.h>
 #include <FileSystem/File.h>
+#include <FileSystem/MappedFile.h>
+#include <FileSystem/PackFile.h>
+#include <FileSystem/VirtualFileSystem.h>
+#include <FileSystem/DerivedDataCache.h>
 #include <Math/Random.h>
 #include <Text/String.h>
 #include <Threads/ThreadPool.h>
@@ -83,6 +83,7 @@ Usage:
 
 #include <Base.h>
 #include <Containers/List.h>
+#include <Containers/SmallList.h>
 #include <Assertion/Assert.h>
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -154,7 +155,8 @@ private:
     EventHandler    handlerMethod;
   };
 
-  typedef Containers::List<Binding> BindingList;
+  // Most callbacks have a handful of subscribers: keep them inline to avoid a heap allocation per callback
+  typedef Containers::SmallList<Binding, 4> BindingList;
 
   template <typename EventHandlerClass, void(EventHandlerClass::*Method)(const EventClass&)>
   static void Binder(IEventHandler* pEventHandler, const EventClass& event);
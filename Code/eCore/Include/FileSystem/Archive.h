@@ -40,6 +40,12 @@ namespace FileSystem
 {
 /*----------------------------------------------------------------------------------------------------------------------
 Archive
+
+Please note that this class has the following usage contract: 
+
+1. Files are opened in binary mode (no line ending conversion).
+2. Read returns the number of characters read, which is only smaller than length at the end of the file.
+3. Write returns false if the file could not be written (e.g. the disk is full).
 ----------------------------------------------------------------------------------------------------------------------*/
 class Archive
 {
@@ -51,18 +57,18 @@ public:
     eOpenModeAppend
   };
 
-  Archive();
-  ~Archive();
+  E_API Archive();
+  E_API ~Archive();
 
   // Accessors
-  const Path&   GetPath() const;
-  bool          IsOpen() const;
+  E_API const Path& GetPath() const;
+  E_API bool        IsOpen() const;
 
   // Methods
-  void          Close();
-  bool          Open(const Path& filePath, OpenMode openMode = eOpenModeRead);
-  void          Read(char* pTarget, size_t length);
-  void          Write(const char* pSource, size_t length);
+  E_API void        Close();
+  E_API bool        Open(const Path& filePath, OpenMode openMode = eOpenModeRead);
+  E_API size_t      Read(char* pTarget, size_t length);
+  E_API bool        Write(const char* pSource, size_t length);
 
 private:
   Path          mFilePath;
@@ -0,0 +1,211 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file AsyncIO.h
+This file declares the AsyncIO class, which reads files asynchronously on dedicated I/O threads. AsyncIO uses a
+private implementation class (one per I/O thread) that will have separate implementations (depending on OS).
+*/
+
+#ifndef E3_ASYNC_IO_H
+#define E3_ASYNC_IO_H
+
+#include "Path.h"
+#include <Containers/List.h>
+#include <Containers/Map.h>
+#include <Containers/Queue.h>
+#include <EventSystem/Event.h>
+#include <Threads/ConditionVariable.h>
+#include <Threads/Mutex.h>
+
+/*----------------------------------------------------------------------------------------------------------------------
+AsyncIO assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_ASYNC_IO_REQUEST_VALUE   "Requests require a file path and a target buffer"
+#define E_ASSERT_MSG_ASYNC_IO_PRIORITY_VALUE  "Invalid request priority"
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+AsyncIO
+
+This class is thread-safe.
+
+Please note that this class has the following usage contract:
+
+1. AddRequest queues a read of size bytes at offset of a file into a caller supplied buffer, which must stay valid until
+the request completes. Reads past the end of the file complete with the available bytes (the completion size).
+2. Pending requests are served by priority (first in first out within the same priority). Requests to a file which
+already has pending requests are coalesced with them: the file is opened once, its ranges are read in offset order and
+identical ranges are read once. A coalesced group is served with the highest priority of its requests.
+3. I/O threads take several groups at once (see kBatchSize). On Linux the reads of a batch are submitted together
+through an io_uring instance per I/O thread, falling back to pread when io_uring is not available. On Windows each I/O
+thread reads its batch with synchronous ReadFile calls, so concurrency comes from the I/O thread count.
+4. A request ICompletionHandler (if any) is called on the I/O thread right after the read, so it must be thread-safe
+and short (i.e. hand the data over to another thread). The completion event callback is raised on the thread calling
+Dispatch (i.e. once per frame on the main thread), in completion order.
+5. WaitForIdle blocks until every request queued so far has completed (completion handlers included). Destruction
+waits for the pending requests but does not Dispatch their completion events.
+----------------------------------------------------------------------------------------------------------------------*/
+class AsyncIO
+{
+public:
+  typedef U64 RequestId;
+
+  enum Priority
+  {
+    ePriorityHigh,
+    ePriorityNormal,
+    ePriorityLow,
+    ePriorityCount
+  };
+
+  /*----------------------------------------------------------------------------------------------------------------------
+  AsyncIO::CompletionEvent
+  ----------------------------------------------------------------------------------------------------------------------*/
+  struct CompletionEvent
+  {
+    RequestId             id;
+    Byte*                 pBuffer;
+    void*                 pUserData;
+    size_t                size;       // Bytes read
+    bool                  succeeded;  // False when the file could not be opened or read
+  };
+
+  /*----------------------------------------------------------------------------------------------------------------------
+  AsyncIO::ICompletionHandler
+  ----------------------------------------------------------------------------------------------------------------------*/
+  class ICompletionHandler
+  {
+  public:
+    virtual ~ICompletionHandler() {}
+    virtual void OnRequestCompletion(const CompletionEvent& event) = 0;
+  };
+
+  /*----------------------------------------------------------------------------------------------------------------------
+  AsyncIO::Request
+  ----------------------------------------------------------------------------------------------------------------------*/
+  struct Request
+  {
+    Path                  filePath;
+    Byte*                 pBuffer;
+    ICompletionHandler*   pHandler;   // Called on the I/O thread (optional)
+    void*                 pUserData;
+    U64                   offset;
+    size_t                size;
+    Priority              priority;
+
+    Request()
+      : pBuffer(nullptr)
+      , pHandler(nullptr)
+      , pUserData(nullptr)
+      , offset(0)
+      , size(0)
+      , priority(ePriorityNormal) {}
+  };
+
+  typedef EventSystem::EventCallback<CompletionEvent> CompletionEventCallback;
+
+  E_API explicit AsyncIO(U32 threadCount = 0); // 0 stands for the processor count
+  E_API ~AsyncIO();
+
+  // Accessors
+  E_API CompletionEventCallback&  GetCompletionEventCallback();
+  E_API U32                       GetPendingRequestCount() const; // Gets the queued and in progress request count
+  E_API U32                       GetThreadCount() const;
+
+  // Methods
+  E_API RequestId                 AddRequest(const Request& request);
+  E_API size_t                    Dispatch();                     // Raises the completion events; returns their count
+  E_API void                      WaitForIdle();
+
+private:
+  /*----------------------------------------------------------------------------------------------------------------------
+  AsyncIO::Entry (a queued request)
+  ----------------------------------------------------------------------------------------------------------------------*/
+  struct Entry
+  {
+    RequestId             id;
+    Byte*                 pBuffer;
+    ICompletionHandler*   pHandler;
+    void*                 pUserData;
+    U64                   offset;
+    size_t                size;
+    size_t                readSize;
+    bool                  succeeded;
+    bool                  isDuplicate;  // Same range as the previous entry (read once, then copied)
+  };
+
+  /*----------------------------------------------------------------------------------------------------------------------
+  AsyncIO::Group (the queued requests to a file)
+  ----------------------------------------------------------------------------------------------------------------------*/
+  struct Group
+  {
+    Path                    filePath;
+    Containers::List<Entry> entryList;
+    U64                     pathHash;
+    Priority                priority;
+    U32                     queueReferenceCount;  // Pending queue slots referencing the group
+    bool                    isTaken;              // Taken by an I/O thread (no longer accepting requests)
+  };
+
+  class Impl;
+  class Worker;
+  friend class Impl;
+  friend class Worker;
+
+  typedef Containers::List<CompletionEvent> CompletionEventList;
+  typedef Containers::List<Group*>          GroupList;
+  typedef Containers::Queue<Group*>         GroupQueue;
+  typedef Containers::Map<U64, Group*>      GroupMap;
+  typedef Containers::List<Worker*>         WorkerList;
+
+  static const size_t             kBatchSize = 16;  // Maximum number of groups taken at once by an I/O thread
+
+  mutable Threads::Mutex          mMutex;
+  Threads::ConditionVariable      mRequestCondition;
+  Threads::ConditionVariable      mIdleCondition;
+  GroupQueue                      mPendingGroupQueues[ePriorityCount];
+  GroupMap                        mPendingGroupMap;       // Pending groups by file path hash
+  GroupList                       mFreeGroupList;         // Recycled groups
+  CompletionEventList             mCompletionEventList;   // Completion events waiting for Dispatch
+  CompletionEventList             mDispatchEventList;     // Completion events being dispatched
+  CompletionEventCallback         mCompletionEventCallback;
+  WorkerList                      mWorkerList;
+  RequestId                       mNextRequestId;
+  U32                             mPendingRequestCount;
+  bool                            mTerminationFlag;
+
+  void                            CompleteGroups(Group** ppGroups, size_t count);
+  Group*                          CreateGroup();
+  size_t                          TakeGroups(Group** ppGroups);
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(AsyncIO)
+};
+}
+}
+
+#endif
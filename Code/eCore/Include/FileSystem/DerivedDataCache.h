@@ -0,0 +1,164 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 19-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file DerivedDataCache.h
+This file declares the DerivedDataCache class, which stores processed (derived) data on disk keyed by a 64 bit hash of
+its source data and processing parameters, so expensive processing (e.g. importing meshes or compiling shaders) is only
+done once.
+*/
+
+#ifndef E3_DERIVED_DATA_CACHE_H
+#define E3_DERIVED_DATA_CACHE_H
+
+#include "File.h"
+#include <Containers/List.h>
+#include <Containers/Map.h>
+#include <Threads/Mutex.h>
+
+namespace E
+{
+namespace FileSystem
+{
+class DerivedDataCache;
+
+/*----------------------------------------------------------------------------------------------------------------------
+FileSystem::Global methods
+----------------------------------------------------------------------------------------------------------------------*/
+namespace Global
+{
+  E_API DerivedDataCache& GetDerivedDataCache();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+DerivedDataCache
+
+Please note that this class has the following usage contract:
+
+1. Entries are keyed by a content hash: GetKey hashes (64 bit xxHash) the source data together with a processing
+string that must name the processing and every parameter or version that changes its output (e.g. "Mesh|v2|lods").
+Changing the source or the processing yields another key, so entries never need invalidation, they just stop being used.
+2. Loaders query the cache with Get before doing the expensive work and store the result with Put otherwise. Get and
+Put fail (Get meaning a cache miss) while the cache is not open, so loaders can use the cache unconditionally.
+3. Every entry is a file in the cache directory ("<key>.ddc") holding a Header and the data. Get validates the header
+and the data hash, and removes the entry if it is damaged (e.g. an interrupted write), so Get never returns corrupt data.
+4. The cache size (data bytes) is bounded by the maximum size given to Open: Put evicts the least recently used entries
+(the ones that went the longest without a Get or a Put) until the cache fits.
+5. The index (entry sizes and last uses) is saved to an index file by Close (and destruction) and loaded and removed by
+Open. If the index file is missing (e.g. the cache was not closed) or invalid, Open rebuilds the index from the directory
+listing, so entries put after the last Close are still found and evicted.
+6. The class is thread-safe. Entry files are read outside the lock, but Put writes and evicts inside it.
+----------------------------------------------------------------------------------------------------------------------*/
+class DerivedDataCache
+{
+public:
+  E_API static const char kExtension[];
+
+  E_API DerivedDataCache();
+  E_API ~DerivedDataCache();
+
+  // Accessors
+  E_API size_t          GetCount() const;
+  E_API const Path&     GetDirectory() const;
+  E_API U64             GetMaxSize() const;
+  E_API U64             GetSize() const;
+  E_API bool            IsOpen() const;
+
+  // Methods
+  E_API void            Close();
+  E_API bool            Contains(U64 key) const;
+  E_API bool            Get(U64 key, Containers::List<Byte>& data);
+  E_API bool            Open(const Path& directory, U64 maxSize);
+  E_API bool            Put(U64 key, const void* pData, size_t size);
+  E_API bool            Remove(U64 key);
+
+  E_API static U64      GetKey(const void* pSourceData, size_t sourceSize, const char* pProcessing);
+
+private:
+  /*----------------------------------------------------------------------------------------------------------------------
+  DerivedDataCache::Entry (also the index file record)
+  ----------------------------------------------------------------------------------------------------------------------*/
+  struct Entry
+  {
+    U64                 key;
+    U64                 size;         // Data size (header excluded)
+    U64                 lastUse;      // Use count at the last Get or Put
+  };
+
+  /*----------------------------------------------------------------------------------------------------------------------
+  DerivedDataCache::Header (the entry file header)
+  ----------------------------------------------------------------------------------------------------------------------*/
+  struct Header
+  {
+    U32                 magic;
+    U32                 version;
+    U64                 key;
+    U64                 size;
+    U64                 dataHash;
+  };
+
+  /*----------------------------------------------------------------------------------------------------------------------
+  DerivedDataCache::IndexHeader (the index file header, followed by the entries)
+  ----------------------------------------------------------------------------------------------------------------------*/
+  struct IndexHeader
+  {
+    U32                 magic;
+    U32                 version;
+    U32                 entryCount;
+    U32                 reserved;
+    U64                 useCount;
+  };
+
+  typedef Containers::List<Entry>     EntryList;
+  typedef Containers::Map<U64, U32>   EntryMap;
+
+  static const U32      kMagic = 0x43444445;      // "EDDC"
+  static const U32      kIndexMagic = 0x49444445; // "EDDI"
+  static const U32      kVersion = 1;
+
+  mutable Threads::Mutex mMutex;
+  EntryList             mEntryList;
+  EntryMap              mEntryMap;    // Entry indices by key
+  Path                  mDirectory;
+  U64                   mMaxSize;
+  U64                   mSize;
+  U64                   mUseCount;
+  bool                  mOpen;
+
+  bool                  AddEntry(const Entry& entry);
+  void                  Evict();
+  Entry*                FindEntry(U64 key);
+  Path                  GetFilePath(U64 key) const;
+  Path                  GetIndexFilePath() const;
+  bool                  LoadIndex();
+  void                  RebuildIndex();
+  void                  RemoveEntry(U64 key);
+  bool                  SaveIndex() const;
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(DerivedDataCache)
+};
+}
+}
+
+#endif
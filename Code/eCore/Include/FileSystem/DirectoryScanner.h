@@ -0,0 +1,178 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 19-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file DirectoryScanner.h
+This file declares the DirectoryScanner class, which lists directory trees recursively in parallel. DirectoryScanner
+uses a private implementation class that will have separate implementations (depending on OS).
+*/
+
+#ifndef E3_DIRECTORY_SCANNER_H
+#define E3_DIRECTORY_SCANNER_H
+
+#include "File.h"
+#include <Containers/List.h>
+#include <Containers/Map.h>
+#include <Threads/ConditionVariable.h>
+#include <Threads/Mutex.h>
+#include <Threads/ThreadPool.h>
+
+/*----------------------------------------------------------------------------------------------------------------------
+DirectoryScanner assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_DIRECTORY_SCANNER_PATH_VALUE       "Scans require a root directory path"
+#define E_ASSERT_MSG_DIRECTORY_SCANNER_RECORD_VALUE     "Record does not belong to the current scan"
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+DirectoryScanner
+
+Please note that this class has the following usage contract:
+
+1. Scan lists the whole tree below a root directory (root excluded) and stores a Record per file and directory found.
+Directories are listed in parallel: the calling thread and up to a task per processor from the thread pool pull
+directories from a shared stack and push the subdirectories they find. Records are stored in bulk (a record list, a
+directory list and a name pool) instead of a Path per entry, and they are sorted by directory path.
+2. The last scan result is also the cache for the next scan, and it can be saved to and loaded from a cache file. A
+directory whose last write time did not change since it was cached is not listed again: its cached records are reused
+and only its subdirectories are checked. Creating, removing or renaming an entry updates the directory write time, but
+writing to an existing file does not, so the info of a revalidated file (size, times) may be stale.
+3. Cache files are plain images of the record data and they are only meant to be loaded by the same build on the same
+machine (LoadCache rejects files with another version or an invalid layout).
+4. Windows lists directories with FindFirstFileEx (basic info, large fetch) so each entry info comes with the listing.
+Linux reads directory entries in bulk through getdents64 and gets their info with statx (fstatat on other systems).
+5. Scan must not be called from a task running in the same thread pool as it waits for the tasks it adds. The class
+is not thread-safe otherwise.
+----------------------------------------------------------------------------------------------------------------------*/
+class DirectoryScanner
+{
+public:
+  /*----------------------------------------------------------------------------------------------------------------------
+  DirectoryScanner::Directory
+  ----------------------------------------------------------------------------------------------------------------------*/
+  struct Directory
+  {
+    U64                         writeTime;        // Platform specific last write time (only used for revalidation)
+    U32                         pathOffset;       // Name pool offset of the directory path
+    U32                         pathLength;
+    U32                         firstRecordIndex; // First record of the directory entries
+    U32                         recordCount;
+  };
+
+  /*----------------------------------------------------------------------------------------------------------------------
+  DirectoryScanner::Record
+  ----------------------------------------------------------------------------------------------------------------------*/
+  struct Record
+  {
+    File::Info                  info;
+    U32                         directoryIndex;   // Parent directory index
+    U32                         nameOffset;       // Name pool offset of the entry name
+    U32                         nameLength;
+  };
+
+  typedef Containers::List<Directory> DirectoryList;
+  typedef Containers::List<Record>    RecordList;
+
+  E_API explicit DirectoryScanner(Threads::ThreadPool& threadPool = Threads::Global::GetThreadPool());
+  E_API ~DirectoryScanner();
+
+  // Accessors
+  E_API const DirectoryList&    GetDirectoryList() const;
+  E_API U32                     GetListedDirectoryCount() const;  // Gets the directories listed (not revalidated) by the last scan
+  E_API const char*             GetName(const Record& record) const;
+  E_API const char*             GetPath(const Directory& directory) const;
+  E_API Path                    GetPath(const Record& record) const;
+  E_API const RecordList&       GetRecordList() const;
+
+  // Methods
+  E_API void                    Clear();
+  E_API bool                    LoadCache(const Path& filePath);
+  E_API bool                    SaveCache(const Path& filePath) const;
+  E_API bool                    Scan(const Path& rootPath);
+
+private:
+  /*----------------------------------------------------------------------------------------------------------------------
+  DirectoryScanner::Listing (the entries of a directory gathered by a task)
+  ----------------------------------------------------------------------------------------------------------------------*/
+  struct Listing
+  {
+    Path                        path;
+    U64                         writeTime;
+    Containers::List<Record>    recordList;       // Name offsets are relative to the listing name list
+    Containers::List<char>      nameList;
+  };
+
+  /*----------------------------------------------------------------------------------------------------------------------
+  DirectoryScanner::Header (the cache file header)
+  ----------------------------------------------------------------------------------------------------------------------*/
+  struct Header
+  {
+    U32                         magic;
+    U32                         version;
+    U32                         directoryCount;
+    U32                         recordCount;
+    U32                         nameCount;
+    U32                         reserved;
+  };
+
+  class Impl;
+  class Task;
+  friend class Impl;
+  friend class Task;
+
+  typedef Containers::List<char>        NameList;
+  typedef Containers::List<Listing*>    ListingList;
+  typedef Containers::List<Path>        PathStack;
+  typedef Containers::Map<U64, U32>     DirectoryMap;
+
+  static const U32              kMagic = 0x43534445;  // "EDSC"
+  static const U32              kVersion = 1;
+  static const size_t           kMaxTaskCount = 64;
+
+  Threads::ThreadPool&          mThreadPool;
+  Threads::Mutex                mMutex;
+  Threads::ConditionVariable    mDirectoryCondition;
+  PathStack                     mPendingDirectoryStack; // Directories waiting to be listed (depth first)
+  ListingList                   mListingList;           // Listings of the scan in progress
+  DirectoryMap                  mDirectoryMap;          // Directory indices by path hash
+  DirectoryList                 mDirectoryList;
+  RecordList                    mRecordList;
+  NameList                      mNameList;
+  U32                           mBusyTaskCount;
+  U32                           mListedDirectoryCount;
+
+  void                          BuildDirectoryMap();
+  bool                          ProcessDirectory(const Path& path, Listing& listing);
+  void                          ProcessDirectories();
+  void                          StoreListings();
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(DirectoryScanner)
+};
+}
+}
+
+#endif
@@ -0,0 +1,100 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file MappedFile.h
+This file declares the MappedFile class. By using a "pimpl" idiom, it delegates file mapping functionality in a
+private implementation class that will have separate implementations (depending on OS).
+*/
+
+#ifndef E3_MAPPED_FILE_H
+#define E3_MAPPED_FILE_H
+
+#include "Path.h"
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+MappedFile
+
+Please note that this class has the following usage contract:
+
+1. MappedFile maps a whole file into the process address space for read only or read write access, so its contents can
+be used in place (i.e. deserialized through a Serialization::ByteReader or handed to a graphics buffer) without being
+copied.
+2. GetPtr returns nullptr (and GetSize 0) while no file is mapped. Mapping an empty file fails, except in read write
+mode with a non zero size, which creates the file if needed and resizes it to size bytes (zero filling it when grown).
+3. Writing through GetPtr requires a read write mapping. Writes reach the file lazily (at the latest when the mapping is
+released) unless Flush is called, which writes them synchronously.
+4. The mapping is released on Close, on destruction or when opening another file. Pointers into the mapped data must
+not be used after that.
+5. SetAccessHint, Prefetch and EnableLargePages are hints which never change the mapped data and may be ignored by the
+platform. On POSIX systems they map to madvise (MADV_SEQUENTIAL / MADV_RANDOM, MADV_WILLNEED and MADV_HUGEPAGE). On
+Windows the sequential hint prefetches the whole file, Prefetch uses PrefetchVirtualMemory (Windows 8 or later, pages
+are touched otherwise) and large pages are not available for file mappings, so EnableLargePages returns false.
+----------------------------------------------------------------------------------------------------------------------*/
+class MappedFile
+{
+public:
+  enum OpenMode
+  {
+    eOpenModeRead,
+    eOpenModeReadWrite
+  };
+
+  enum AccessHint
+  {
+    eAccessHintNormal,
+    eAccessHintSequential,
+    eAccessHintRandom
+  };
+
+  E_API MappedFile();
+  E_API ~MappedFile();
+
+  // Accessors
+  E_API const Path&   GetPath() const;
+  E_API Byte*         GetPtr();
+  E_API const Byte*   GetPtr() const;
+  E_API size_t        GetSize() const;
+  E_API bool          IsOpen() const;
+
+  // Methods
+  E_API void          Close();
+  E_API bool          EnableLargePages();
+  E_API bool          Flush();
+  E_API bool          Open(const Path& filePath, OpenMode openMode = eOpenModeRead, size_t size = 0);
+  E_API void          Prefetch(size_t offset, size_t size);
+  E_API void          SetAccessHint(AccessHint accessHint);
+
+private:
+  E_PIMPL mpImpl;
+  E_DISABLE_COPY_AND_ASSSIGNMENT(MappedFile)
+};
+}
+}
+
+#endif
@@ -0,0 +1,141 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 19-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file PackFile.h
+This file declares the PackFile class, which reads (and creates) pack files: a sorted table of contents followed by the
+aligned data of the packed files, accessed through a memory mapping.
+*/
+
+#ifndef E3_PACK_FILE_H
+#define E3_PACK_FILE_H
+
+#include "File.h"
+#include "MappedFile.h"
+
+/*----------------------------------------------------------------------------------------------------------------------
+PackFile assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_PACK_FILE_ENTRY_VALUE  "Entry does not belong to the pack file"
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+PackFile
+
+Please note that this class has the following usage contract:
+
+1. Pack files store a Header, the Entry table sorted by path hash, the path pool (null terminated entry paths) and the
+entry data, each entry starting at a kAlignment boundary. Open maps the whole file and validates its layout, so the
+table and the data are used in place (no copies).
+2. Entry paths are relative to the directory the pack was created from and they are normalized (see NormalizePath):
+separators become '/', repeated separators and "./" are removed and ASCII letters are lower case, so lookups are case
+insensitive as Windows paths are.
+3. Find hashes the normalized path (64 bit xxHash) and binary searches the table, comparing paths on hash matches.
+4. Entries may be stored LZ4 compressed (LZ4 block format). Create compresses an entry only if it saves at least
+1/16th of its size, so already compressed data (e.g. PNG files) is stored as is. Data of uncompressed entries can be
+used in place through GetData; Read copies or decompresses entries into a caller supplied buffer of Entry::size bytes.
+5. Create reads every source file and builds the pack file image in memory before writing it.
+6. A PackFile can be read from several threads at once, provided Open and Close are not called meanwhile.
+----------------------------------------------------------------------------------------------------------------------*/
+class PackFile
+{
+public:
+  enum Compression
+  {
+    eCompressionNone,
+    eCompressionLz4,
+    eCompressionCount
+  };
+
+  /*----------------------------------------------------------------------------------------------------------------------
+  PackFile::Entry
+  ----------------------------------------------------------------------------------------------------------------------*/
+  struct Entry
+  {
+    U64                 pathHash;
+    U64                 offset;       // Data offset from the beginning of the file (kAlignment aligned)
+    U64                 size;         // Original size
+    U64                 storedSize;   // Size of the data in the file
+    U32                 pathOffset;   // Path pool offset
+    U16                 pathLength;
+    U8                  compression;
+    U8                  reserved;
+  };
+
+  E_API static const char kExtension[];
+  static const U32      kAlignment = 64;
+
+  E_API PackFile();
+  E_API ~PackFile();
+
+  // Accessors
+  E_API const Byte*     GetData(const Entry& entry) const;  // Gets the stored (compressed or not) entry data
+  E_API const Entry*    GetEntries() const;
+  E_API U32             GetEntryCount() const;
+  E_API const char*     GetPath(const Entry& entry) const;
+  E_API const Path&     GetPath() const;
+  E_API bool            IsOpen() const;
+
+  // Methods
+  E_API void            Close();
+  E_API const Entry*    Find(const Path& path) const;       // Returns nullptr if the path is not packed
+  E_API bool            Open(const Path& filePath);
+  E_API bool            Read(const Entry& entry, Byte* pTarget) const;
+
+  E_API static bool     Create(const Path& filePath, const Path& sourceDirectory, const PathList& pathList, bool compress = true);
+  E_API static U64      GetPathHash(const Path& normalizedPath);
+  E_API static void     NormalizePath(Path& path);
+
+private:
+  /*----------------------------------------------------------------------------------------------------------------------
+  PackFile::Header
+  ----------------------------------------------------------------------------------------------------------------------*/
+  struct Header
+  {
+    U32                 magic;
+    U32                 version;
+    U32                 entryCount;
+    U32                 pathPoolSize;
+    U64                 fileSize;
+    U32                 alignment;
+    U32                 reserved;
+  };
+
+  static const U32      kMagic = 0x4b435045;  // "EPCK"
+  static const U32      kVersion = 1;
+
+  MappedFile            mMappedFile;
+  const Entry*          mpEntries;
+  const char*           mpPathPool;
+  U32                   mEntryCount;
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(PackFile)
+};
+}
+}
+
+#endif
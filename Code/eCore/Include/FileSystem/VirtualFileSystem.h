@@ -0,0 +1,105 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 19-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file VirtualFileSystem.h
+This file declares the VirtualFileSystem class, which resolves file paths against the mounted pack files before the disk.
+*/
+
+#ifndef E3_VIRTUAL_FILE_SYSTEM_H
+#define E3_VIRTUAL_FILE_SYSTEM_H
+
+#include "PackFile.h"
+#include <Containers/List.h>
+
+namespace E
+{
+namespace FileSystem
+{
+class VirtualFileSystem;
+
+/*----------------------------------------------------------------------------------------------------------------------
+FileSystem::Global methods
+----------------------------------------------------------------------------------------------------------------------*/
+namespace Global
+{
+  E_API VirtualFileSystem& GetVirtualFileSystem();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+VirtualFileSystem
+
+Please note that this class has the following usage contract:
+
+1. Mount maps a pack file at a mount path: a file path below the mount path (e.g. "../../../Data/Textures/brick.dds"
+for a pack created from and mounted at "../../../Data") is looked up in the pack as the rest of the path
+("textures/brick.dds"). Paths are normalized before they are compared (see PackFile::NormalizePath).
+2. Lookups check the mounted packs from the last mounted to the first, so later packs override earlier ones (e.g.
+patches), and they fall back to the disk when no pack has the file.
+3. Map returns the data of uncompressed packed files in place (the pack file mapping). Read returns a copy of any file
+(decompressing packed files if required), so it is the method to use unless the data is only read while the pack stays
+mounted.
+4. Exists, IsPacked, Map and Read can be called from several threads at once, but Mount and Unmount must not be called
+meanwhile (mount packs at start up, before loading resources).
+----------------------------------------------------------------------------------------------------------------------*/
+class VirtualFileSystem
+{
+public:
+  E_API VirtualFileSystem();
+  E_API ~VirtualFileSystem();
+
+  // Accessors
+  E_API size_t        GetPackCount() const;
+  E_API bool          IsPacked(const Path& path) const;
+
+  // Methods
+  E_API bool          Exists(const Path& path) const;
+  E_API bool          Map(const Path& path, const Byte*& pData, size_t& size) const;
+  E_API bool          Mount(const Path& packFilePath, const Path& mountPath);
+  E_API bool          Read(const Path& path, Containers::List<Byte>& data) const;
+  E_API bool          Unmount(const Path& packFilePath);
+  E_API void          UnmountAll();
+
+private:
+  /*----------------------------------------------------------------------------------------------------------------------
+  VirtualFileSystem::MountPoint
+  ----------------------------------------------------------------------------------------------------------------------*/
+  struct MountPoint
+  {
+    PackFile*         pPackFile;
+    Path              path;             // Normalized mount path
+  };
+
+  typedef Containers::List<MountPoint> MountPointList;
+
+  MountPointList      mMountPointList;
+
+  const PackFile::Entry* Find(const Path& path, const PackFile*& pPackFile) const;
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(VirtualFileSystem)
+};
+}
+}
+
+#endif
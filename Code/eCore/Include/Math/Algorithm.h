@@ -32,12 +32,14 @@ This file defines some useful math algorithms.
 
 #include <Base.h>
 #include <Math/Comparison.h>
+#include <Memory/Memory.h>
 
 /*----------------------------------------------------------------------------------------------------------------------
 Memory assertion messages
 ----------------------------------------------------------------------------------------------------------------------*/
 #define E_ASSERT_MSG_ALGORITHM_ARRAY_INDICES_VALUE    "DynamicArray start index (%d) must be smaller than array end index (%d)"
 #define E_ASSERT_MSG_ALGORITHM_SORTING_NETWORK_VALUE  "Sorting network doe not support a size of (%d)"
+#define E_ASSERT_MSG_ALGORITHM_BUFFER_VALUE           "Sorting buffer must be a valid array different from the sorted one"
 
 namespace E
 {
@@ -81,6 +83,7 @@ public:
   static void         QuickSort3Way(T* ptr, size_t size);
   static void         QuickSortDualPivot(T* ptr, size_t startIndex, size_t endIndex);
   static void         QuickSortDualPivot(T* ptr, size_t size);
+  static void         SortingNetwork(T* ptr, size_t size);
 
 private:
   static const size_t kMinDistanceSize = 13;
@@ -89,8 +92,9 @@ private:
   static void         IntroSortDepth(T* ptr, size_t startIndex, size_t endIndex, size_t depth);
   static size_t       Median3(T* ptr, size_t startIndex, size_t endIndex);
   static size_t       Partition(T* ptr, size_t startIndex, size_t endIndex);
-  inline static void  Swap(T& a, T& b) { if (Comparer<T>::IsEqual(a, b)) return; T tmp = a; a = b; b = tmp; }
-  inline static void  SwapIfSmaller(T& a, T& b) { if (!Comparer<T>::IsLess(a, b)) return; T tmp = a; a = b; b = tmp; }
+  inline static void  Swap(T& a, T& b) { if (ComparerClass<T>::IsEqual(a, b)) return; T tmp = a; a = b; b = tmp; }
+  inline static void  SwapIfSmaller(T& a, T& b) { if (!ComparerClass<T>::IsLess(a, b)) return; T tmp = a; a = b; b = tmp; }
+  inline static void  SortPair(T& a, T& b) { if (!ComparerClass<T>::IsLess(b, a)) return; T tmp = a; a = b; b = tmp; }
 };
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -408,6 +412,59 @@ inline void Sorting<T, ComparerClass>::QuickSortDualPivot(T* ptr, size_t size)
   QuickSortDualPivot(ptr, 0, size - 1);
 }   
 
+/*----------------------------------------------------------------------------------------------------------------------
+SortingNetwork
+
+Optimal (minimum comparator count) sorting networks for sizes from 2 to 8 as listed by Knuth (TAOCP Vol. 3, 5.3.4).
+
+1. Networks are branch predictable and have no loop overhead. Use them to sort small fixed size arrays (e.g. 
+neighbour lists, vertex indices or per cluster values).
+2. SimdSorting implements a vectorized version for F32 and I32 arrays of up to 16 elements.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T, template<typename> class ComparerClass>
+inline void Sorting<T, ComparerClass>::SortingNetwork(T* ptr, size_t size)
+{
+  E_ASSERT_MSG(size > 1 && size <= 8, E_ASSERT_MSG_ALGORITHM_SORTING_NETWORK_VALUE, size);
+  switch (size)
+  {
+  case 2:
+    SortPair(ptr[0], ptr[1]);
+    break;
+  case 3:
+    SortPair(ptr[1], ptr[2]); SortPair(ptr[0], ptr[2]); SortPair(ptr[0], ptr[1]);
+    break;
+  case 4:
+    SortPair(ptr[0], ptr[1]); SortPair(ptr[2], ptr[3]); SortPair(ptr[0], ptr[2]); SortPair(ptr[1], ptr[3]);
+    SortPair(ptr[1], ptr[2]);
+    break;
+  case 5:
+    SortPair(ptr[0], ptr[1]); SortPair(ptr[3], ptr[4]); SortPair(ptr[2], ptr[4]); SortPair(ptr[2], ptr[3]);
+    SortPair(ptr[1], ptr[4]); SortPair(ptr[0], ptr[3]); SortPair(ptr[0], ptr[2]); SortPair(ptr[1], ptr[3]);
+    SortPair(ptr[1], ptr[2]);
+    break;
+  case 6:
+    SortPair(ptr[1], ptr[2]); SortPair(ptr[4], ptr[5]); SortPair(ptr[0], ptr[2]); SortPair(ptr[3], ptr[5]);
+    SortPair(ptr[0], ptr[1]); SortPair(ptr[3], ptr[4]); SortPair(ptr[2], ptr[5]); SortPair(ptr[0], ptr[3]);
+    SortPair(ptr[1], ptr[4]); SortPair(ptr[2], ptr[4]); SortPair(ptr[1], ptr[3]); SortPair(ptr[2], ptr[3]);
+    break;
+  case 7:
+    SortPair(ptr[1], ptr[2]); SortPair(ptr[3], ptr[4]); SortPair(ptr[5], ptr[6]); SortPair(ptr[0], ptr[2]);
+    SortPair(ptr[3], ptr[5]); SortPair(ptr[4], ptr[6]); SortPair(ptr[0], ptr[1]); SortPair(ptr[4], ptr[5]);
+    SortPair(ptr[2], ptr[6]); SortPair(ptr[0], ptr[4]); SortPair(ptr[1], ptr[5]); SortPair(ptr[0], ptr[3]);
+    SortPair(ptr[2], ptr[5]); SortPair(ptr[1], ptr[3]); SortPair(ptr[2], ptr[4]); SortPair(ptr[2], ptr[3]);
+    break;
+  case 8:
+    SortPair(ptr[0], ptr[2]); SortPair(ptr[1], ptr[3]); SortPair(ptr[4], ptr[6]); SortPair(ptr[5], ptr[7]);
+    SortPair(ptr[0], ptr[4]); SortPair(ptr[1], ptr[5]); SortPair(ptr[2], ptr[6]); SortPair(ptr[3], ptr[7]);
+    SortPair(ptr[0], ptr[1]); SortPair(ptr[2], ptr[3]); SortPair(ptr[4], ptr[5]); SortPair(ptr[6], ptr[7]);
+    SortPair(ptr[2], ptr[4]); SortPair(ptr[3], ptr[5]); SortPair(ptr[1], ptr[4]); SortPair(ptr[3], ptr[6]);
+    SortPair(ptr[1], ptr[2]); SortPair(ptr[3], ptr[4]); SortPair(ptr[5], ptr[6]);
+    break;
+  default:
+    break;
+  }
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 Sorting private methods
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -501,6 +558,394 @@ inline size_t Sorting<T, ComparerClass>::Partition(T* ptr, size_t startIndex, si
 
   return rightIndex;
 }
+
+/*----------------------------------------------------------------------------------------------------------------------
+RadixSorting
+
+Please note that this class has the following usage contract: 
+
+1. RadixSorting implements a stable LSD (least significant digit first) radix sort on 8-bit digits for integer and 
+floating point keys. Key / value overloads move a value array along with the keys (e.g. render keys and draw indices).
+2. A buffer of at least size elements is required for the keys (and values) as the algorithm is not in-place. Buffer
+content is undefined after sorting while the sorted result is always stored in the input arrays.
+3. All digit histograms are built in a single read pass. Passes where all keys share the same digit are skipped, so 
+keys using few significant bits (e.g. small indices) require less passes.
+4. Floating point keys are sorted by value using an order preserving bit transformation (-0.0 is placed before 0.0).
+NaN values are not supported.
+5. Arrays smaller than kSmallArrayLength are sorted with insertion sort.
+----------------------------------------------------------------------------------------------------------------------*/
+class RadixSorting
+{
+public:
+  static void         Sort(U32* ptr, U32* pBuffer, size_t size);
+  static void         Sort(I32* ptr, I32* pBuffer, size_t size);
+  static void         Sort(F32* ptr, F32* pBuffer, size_t size);
+  static void         Sort(U64* ptr, U64* pBuffer, size_t size);
+  template <typename V>
+  static void         Sort(U32* pKeys, V* pValues, U32* pKeyBuffer, V* pValueBuffer, size_t size);
+  template <typename V>
+  static void         Sort(I32* pKeys, V* pValues, I32* pKeyBuffer, V* pValueBuffer, size_t size);
+  template <typename V>
+  static void         Sort(F32* pKeys, V* pValues, F32* pKeyBuffer, V* pValueBuffer, size_t size);
+  template <typename V>
+  static void         Sort(U64* pKeys, V* pValues, U64* pKeyBuffer, V* pValueBuffer, size_t size);
+
+private:
+  static const size_t kDigitBits = 8;
+  static const size_t kDigitSize = 1 << kDigitBits;
+  static const size_t kDigitMask = kDigitSize - 1;
+  static const size_t kSmallArrayLength = 64;
+
+  template <typename K, typename V>
+  static void         SortKeys(K* pKeys, V* pValues, K* pKeyBuffer, V* pValueBuffer, size_t size);
+  template <typename K, typename V>
+  static void         InsertionSort(K* pKeys, V* pValues, size_t size);
+  static void         EncodeF32(U32* ptr, size_t size);
+  static void         DecodeF32(U32* ptr, size_t size);
+  static void         EncodeI32(U32* ptr, size_t size);
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+RadixSorting methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void RadixSorting::Sort(U32* ptr, U32* pBuffer, size_t size)
+{
+  SortKeys<U32, U8>(ptr, nullptr, pBuffer, nullptr, size);
+}
+
+inline void RadixSorting::Sort(I32* ptr, I32* pBuffer, size_t size)
+{
+  // Flipping the sign bit maps signed values to an ordered unsigned range
+  U32* pKeys = reinterpret_cast<U32*>(ptr);
+  EncodeI32(pKeys, size);
+  SortKeys<U32, U8>(pKeys, nullptr, reinterpret_cast<U32*>(pBuffer), nullptr, size);
+  EncodeI32(pKeys, size);
+}
+
+inline void RadixSorting::Sort(F32* ptr, F32* pBuffer, size_t size)
+{
+  U32* pKeys = reinterpret_cast<U32*>(ptr);
+  EncodeF32(pKeys, size);
+  SortKeys<U32, U8>(pKeys, nullptr, reinterpret_cast<U32*>(pBuffer), nullptr, size);
+  DecodeF32(pKeys, size);
+}
+
+inline void RadixSorting::Sort(U64* ptr, U64* pBuffer, size_t size)
+{
+  SortKeys<U64, U8>(ptr, nullptr, pBuffer, nullptr, size);
+}
+
+template <typename V>
+inline void RadixSorting::Sort(U32* pKeys, V* pValues, U32* pKeyBuffer, V* pValueBuffer, size_t size)
+{
+  SortKeys(pKeys, pValues, pKeyBuffer, pValueBuffer, size);
+}
+
+template <typename V>
+inline void RadixSorting::Sort(I32* pKeys, V* pValues, I32* pKeyBuffer, V* pValueBuffer, size_t size)
+{
+  U32* pUnsignedKeys = reinterpret_cast<U32*>(pKeys);
+  EncodeI32(pUnsignedKeys, size);
+  SortKeys(pUnsignedKeys, pValues, reinterpret_cast<U32*>(pKeyBuffer), pValueBuffer, size);
+  EncodeI32(pUnsignedKeys, size);
+}
+
+template <typename V>
+inline void RadixSorting::Sort(F32* pKeys, V* pValues, F32* pKeyBuffer, V* pValueBuffer, size_t size)
+{
+  U32* pUnsignedKeys = reinterpret_cast<U32*>(pKeys);
+  EncodeF32(pUnsignedKeys, size);
+  SortKeys(pUnsignedKeys, pValues, reinterpret_cast<U32*>(pKeyBuffer), pValueBuffer, size);
+  DecodeF32(pUnsignedKeys, size);
+}
+
+template <typename V>
+inline void RadixSorting::Sort(U64* pKeys, V* pValues, U64* pKeyBuffer, V* pValueBuffer, size_t size)
+{
+  SortKeys(pKeys, pValues, pKeyBuffer, pValueBuffer, size);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+RadixSorting private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename K, typename V>
+inline void RadixSorting::SortKeys(K* pKeys, V* pValues, K* pKeyBuffer, V* pValueBuffer, size_t size)
+{
+  E_ASSERT_MSG(size > 1, E_ASSERT_MSG_MATH_GREATER_THAN_ONE_VALUE);
+  E_ASSERT_MSG(pKeyBuffer && pKeyBuffer != pKeys, E_ASSERT_MSG_ALGORITHM_BUFFER_VALUE);
+  E_ASSERT_MSG(pValues == nullptr || (pValueBuffer && pValueBuffer != pValues), E_ASSERT_MSG_ALGORITHM_BUFFER_VALUE);
+  if (size < kSmallArrayLength)
+  {
+    InsertionSort(pKeys, pValues, size);
+    return;
+  }
+  
+  // Build all the digit histograms in a single pass
+  static const size_t kDigitCount = sizeof(K);
+  size_t histogram[kDigitCount][kDigitSize];
+  Memory::Zero(&histogram[0][0], kDigitCount * kDigitSize);
+  for (size_t i = 0; i < size; ++i)
+  {
+    K key = pKeys[i];
+    for (size_t d = 0; d < kDigitCount; ++d) histogram[d][(key >> (d * kDigitBits)) & kDigitMask]++;
+  }
+
+  K* pSourceKeys = pKeys;
+  K* pTargetKeys = pKeyBuffer;
+  V* pSourceValues = pValues;
+  V* pTargetValues = pValueBuffer;
+  for (size_t d = 0; d < kDigitCount; ++d)
+  {
+    size_t* pOffsets = histogram[d];
+    size_t shift = d * kDigitBits;
+    // Skip the pass if all keys share the same digit
+    if (pOffsets[(pSourceKeys[0] >> shift) & kDigitMask] == size) continue;
+    // Convert digit counts into target offsets (exclusive prefix sum)
+    for (size_t i = 0, offset = 0; i < kDigitSize; ++i)
+    {
+      size_t count = pOffsets[i];
+      pOffsets[i] = offset;
+      offset += count;
+    }
+    // Scatter
+    if (pValues)
+    {
+      for (size_t i = 0; i < size; ++i)
+      {
+        size_t targetIndex = pOffsets[(pSourceKeys[i] >> shift) & kDigitMask]++;
+        pTargetKeys[targetIndex] = pSourceKeys[i];
+        pTargetValues[targetIndex] = pSourceValues[i];
+      }
+    }
+    else
+    {
+      for (size_t i = 0; i < size; ++i)
+      {
+        K key = pSourceKeys[i];
+        pTargetKeys[pOffsets[(key >> shift) & kDigitMask]++] = key;
+      }
+    }
+    K* pKeysTmp = pSourceKeys; pSourceKeys = pTargetKeys; pTargetKeys = pKeysTmp;
+    V* pValuesTmp = pSourceValues; pSourceValues = pTargetValues; pTargetValues = pValuesTmp;
+  }
+  // Copy back the result if the last pass stored it in the buffer
+  if (pSourceKeys != pKeys)
+  {
+    Memory::Copy(pKeys, pSourceKeys, size);
+    if (pValues) Memory::Copy(pValues, pSourceValues, size);
+  }
+}
+
+template <typename K, typename V>
+inline void RadixSorting::InsertionSort(K* pKeys, V* pValues, size_t size)
+{
+  for (size_t i = 1; i < size; ++i)
+  {
+    K key = pKeys[i];
+    size_t j = i;
+    if (pValues)
+    {
+      V value = pValues[i];
+      for (; j > 0 && key < pKeys[j - 1]; --j) 
+      {
+        pKeys[j] = pKeys[j - 1];
+        pValues[j] = pValues[j - 1];
+      }
+      pValues[j] = value;
+    }
+    else
+    {
+      for (; j > 0 && key < pKeys[j - 1]; --j) pKeys[j] = pKeys[j - 1];
+    }
+    pKeys[j] = key;
+  }
+}
+
+inline void RadixSorting::EncodeF32(U32* ptr, size_t size)
+{
+  // Negative values flip all their bits (reversing their order) while positive values flip the sign bit only
+  for (size_t i = 0; i < size; ++i) ptr[i] ^= (0 - (ptr[i] >> 31)) | 0x80000000;
+}
+
+inline void RadixSorting::DecodeF32(U32* ptr, size_t size)
+{
+  for (size_t i = 0; i < size; ++i) ptr[i] ^= ((ptr[i] >> 31) - 1) | 0x80000000;
+}
+
+inline void RadixSorting::EncodeI32(U32* ptr, size_t size)
+{
+  for (size_t i = 0; i < size; ++i) ptr[i] ^= 0x80000000;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SimdSorting
+
+Please note that this class has the following usage contract: 
+
+1. SimdSorting sorts F32 and I32 arrays of up to kMaxSize (16) elements using a vectorized sorting network: the 
+array is loaded into four 4-wide registers, columns are sorted with a 4 element network, the registers are transposed 
+and the resulting sorted rows are combined with two in-register bitonic merge levels. There are no branches.
+2. Arrays smaller than kMaxSize are padded with the maximum type value, which is discarded after sorting.
+3. When SSE2 is not available (E_SIMD_SSE2 undefined) the array is sorted with Sorting::InsertionSort.
+4. F32 NaN values are not supported.
+----------------------------------------------------------------------------------------------------------------------*/
+class SimdSorting
+{
+public:
+  static const size_t kMaxSize = 16;
+
+  static void         Sort(F32* ptr, size_t size);
+  static void         Sort(I32* ptr, size_t size);
+
+#ifdef E_SIMD_SSE2
+private:
+  struct F32Traits
+  {
+    static __m128     Max(__m128 a, __m128 b) { return _mm_max_ps(a, b); }
+    static __m128     Min(__m128 a, __m128 b) { return _mm_min_ps(a, b); }
+  };
+
+  struct I32Traits
+  {
+    // SSE2 lacks 32-bit integer min / max (SSE4.1) so they are emulated with a compare mask
+    static __m128     Max(__m128 a, __m128 b) { return Select(a, b, _mm_cmpgt_epi32(_mm_castps_si128(a), _mm_castps_si128(b))); }
+    static __m128     Min(__m128 a, __m128 b) { return Select(b, a, _mm_cmpgt_epi32(_mm_castps_si128(a), _mm_castps_si128(b))); }
+    static __m128     Select(__m128 a, __m128 b, __m128i mask) { __m128 m = _mm_castsi128_ps(mask); return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+  };
+
+  template <typename T, typename Traits>
+  static void         SortNetwork(T* ptr, size_t size, T padding);
+  template <typename Traits>
+  static void         BitonicMerge(__m128& a, __m128& b);
+  template <typename Traits>
+  static void         BitonicSort(__m128& a, __m128& b);
+  template <typename Traits>
+  static void         SortPair(__m128& a, __m128& b);
+  static __m128       Reverse(__m128 a) { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3)); }
+#endif
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+SimdSorting methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void SimdSorting::Sort(F32* ptr, size_t size)
+{
+  E_ASSERT_MSG(size <= kMaxSize, E_ASSERT_MSG_ALGORITHM_SORTING_NETWORK_VALUE, size);
+  if (size < 2) return;
+#ifdef E_SIMD_SSE2
+  SortNetwork<F32, F32Traits>(ptr, size, std::numeric_limits<F32>::infinity());
+#else
+  Sorting<F32>::InsertionSort(ptr, size);
+#endif
+}
+
+inline void SimdSorting::Sort(I32* ptr, size_t size)
+{
+  E_ASSERT_MSG(size <= kMaxSize, E_ASSERT_MSG_ALGORITHM_SORTING_NETWORK_VALUE, size);
+  if (size < 2) return;
+#ifdef E_SIMD_SSE2
+  SortNetwork<I32, I32Traits>(ptr, size, NumericLimits<I32>::Max());
+#else
+  Sorting<I32>::InsertionSort(ptr, size);
+#endif
+}
+
+#ifdef E_SIMD_SSE2
+/*----------------------------------------------------------------------------------------------------------------------
+SimdSorting private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, typename Traits>
+inline void SimdSorting::SortNetwork(T* ptr, size_t size, T padding)
+{
+  // Load the array (padding the unused elements)
+  T values[kMaxSize];
+  Memory::Copy(values, ptr, size);
+  for (size_t i = size; i < kMaxSize; ++i) values[i] = padding;
+  F32* pValues = reinterpret_cast<F32*>(values);
+  __m128 r0 = _mm_loadu_ps(pValues);
+  __m128 r1 = _mm_loadu_ps(pValues + 4);
+  __m128 r2 = _mm_loadu_ps(pValues + 8);
+  __m128 r3 = _mm_loadu_ps(pValues + 12);
+
+  // Sort the columns (4 element network) and transpose them into sorted rows
+  SortPair<Traits>(r0, r1);
+  SortPair<Traits>(r2, r3);
+  SortPair<Traits>(r0, r2);
+  SortPair<Traits>(r1, r3);
+  SortPair<Traits>(r1, r2);
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+  // Merge the sorted rows into two sorted sequences of 8 elements (r0, r1) and (r2, r3)
+  BitonicMerge<Traits>(r0, r1);
+  BitonicMerge<Traits>(r2, r3);
+
+  // Merge both sequences: compare against the reversed second sequence and sort the resulting bitonic halves
+  __m128 t0 = Reverse(r3);
+  __m128 t1 = Reverse(r2);
+  r2 = Traits::Max(r0, t0);
+  r3 = Traits::Max(r1, t1);
+  r0 = Traits::Min(r0, t0);
+  r1 = Traits::Min(r1, t1);
+  SortPair<Traits>(r0, r1);
+  SortPair<Traits>(r2, r3);
+  BitonicSort<Traits>(r0, r1);
+  BitonicSort<Traits>(r2, r3);
+
+  // Store the result discarding the padding
+  _mm_storeu_ps(pValues, r0);
+  _mm_storeu_ps(pValues + 4, r1);
+  _mm_storeu_ps(pValues + 8, r2);
+  _mm_storeu_ps(pValues + 12, r3);
+  Memory::Copy(ptr, values, size);
+}
+
+/**
+Merges two sorted registers: a gets the lower four values and b the upper four values (both sorted).
+*/
+template <typename Traits>
+inline void SimdSorting::BitonicMerge(__m128& a, __m128& b)
+{
+  __m128 reversed = Reverse(b);
+  b = Traits::Max(a, reversed);
+  a = Traits::Min(a, reversed);
+  BitonicSort<Traits>(a, b);
+}
+
+/**
+Sorts two bitonic registers independently (two half-cleaner levels on both registers at once).
+*/
+template <typename Traits>
+inline void SimdSorting::BitonicSort(__m128& a, __m128& b)
+{
+  // Compare elements at distance 2: (a0, a1, b0, b1) against (a2, a3, b2, b3)
+  __m128 t0 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 1, 0));
+  __m128 t1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 2, 3, 2));
+  __m128 lo = Traits::Min(t0, t1);
+  __m128 hi = Traits::Max(t0, t1);
+  // Compare elements at distance 1: (la0, lb0, ha0, hb0) against (la1, lb1, ha1, hb1)
+  t0 = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+  t1 = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+  lo = Traits::Min(t0, t1);
+  hi = Traits::Max(t0, t1);
+  // Interleave the results back into a and b
+  t0 = _mm_unpacklo_ps(lo, hi);
+  t1 = _mm_unpackhi_ps(lo, hi);
+  a = _mm_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+  b = _mm_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+template <typename Traits>
+inline void SimdSorting::SortPair(__m128& a, __m128& b)
+{
+  __m128 tmp = a;
+  a = Traits::Min(tmp, b);
+  b = Traits::Max(tmp, b);
+}
+#endif
 }
 }
 
@@ -0,0 +1,676 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Batch.h
+This file defines the Batch class. Batch implements SIMD array versions of the most common F32 math operations.
+*/
+
+#ifndef E3_BATCH_H
+#define E3_BATCH_H
+
+#include "Box3.h"
+#include "Matrix4.h"
+#include "Plane.h"
+#include "Quaternion.h"
+#include "Simd.h"
+#include "Sphere.h"
+
+/*----------------------------------------------------------------------------------------------------------------------
+Assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_BATCH_AFFINE_MATRIX "Matrix must be affine"
+#define E_ASSERT_MSG_BATCH_COMPONENT_COUNT "Component count must be between 1 and 4"
+
+namespace E
+{
+namespace Math
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Batch
+
+Please note that this class has the following usage contract:
+
+1. Batch methods process whole arrays converting packed (AoS) elements to structure of arrays lanes inside the SIMD
+registers: 4 lanes with SSE2 and 8 lanes with AVX (SoA TransformPoints and matrix Multiply). Remaining elements and
+non SIMD builds use scalar code. Results are bit exact with respect to the equivalent single element methods (see
+E_SETTING_MATH_FUSED_MULTIPLY_ADD in Simd.h for the only exception).
+2. Source and result arrays must either be the same array or not overlap at all.
+3. TransformPoints and RotateVectors expect affine matrices (last column 0, 0, 0, 1). Use Matrix4::TransformPoint for
+projective transformations.
+4. GetRotation writes the whole matrix (3x3 rotation and no translation) whereas Quaternion::GetRotation only writes the
+3x3 rotation part.
+5. IntersectPlaneBoxes and IntersectPlaneSpheres set the result to true if the volume is not completely behind the
+plane (the same test as Graphics::Frustum::IsInside per plane).
+6. CullBoxes and CullSpheres test structure of arrays bounds against a convex set of planes (i.e. frustum planes with
+inward normals) and write a visibility bitmask: bit i % 32 of pResult[i / 32] is set if the bounds i are not completely
+behind any of the planes. Bits beyond count in the last word are cleared. Bounds are processed in groups of 8 (one AVX
+or two SSE2 iterations) and the remaining planes are skipped as soon as a whole group is culled.
+7. The optional plane cache of CullBoxes and CullSpheres ((count + 7) / 8 bytes, zero initialized) stores for every
+group of 8 bounds the last plane which culled the whole group. That plane is tested first on the next call, so groups
+which stay culled from frame to frame are usually rejected by a single plane test (plane coherency).
+8. ConvertToFloat and ConvertToHalf produce the same values as HalfToFloat and Half (see Comparison.h) using F16C
+when available (E_MATH_SIMD_F16C in Simd.h), 8 elements per iteration. The only exception are NaNs, which F16C
+converts to quiet NaNs. The strided ConvertToHalf converts componentCount consecutive components per element
+(i.e. packing vertex attributes into interleaved vertices); strides are in bytes.
+----------------------------------------------------------------------------------------------------------------------*/
+class Batch
+{
+public:
+  static void ConvertToFloat(F32* pResult, const U16* pSource, size_t count);
+  static void ConvertToHalf(U16* pResult, const F32* pSource, size_t count);
+  static void ConvertToHalf(U16* pResult, size_t resultStride, const F32* pSource, size_t sourceStride, U32 componentCount, size_t count);
+  static void CullBoxes(U32* pResult, const Planef* pPlanes, U32 planeCount, const F32* pCenterX, const F32* pCenterY, const F32* pCenterZ,
+    const F32* pExtentX, const F32* pExtentY, const F32* pExtentZ, size_t count, U8* pPlaneCache = nullptr);
+  static void CullSpheres(U32* pResult, const Planef* pPlanes, U32 planeCount, const F32* pX, const F32* pY, const F32* pZ,
+    const F32* pRadius, size_t count, U8* pPlaneCache = nullptr);
+  static void GetRotation(Matrix4f* pResult, const Quatf* pSource, size_t count);
+  static void IntersectPlaneBoxes(bool* pResult, const Planef& plane, const Box3f* pSource, size_t count);
+  static void IntersectPlaneSpheres(bool* pResult, const Planef& plane, const Spheref* pSource, size_t count);
+  static void Multiply(Matrix4f* pResult, const Matrix4f* pSourceA, const Matrix4f* pSourceB, size_t count);
+  static void Multiply(Matrix4f* pResult, const Matrix4f* pSource, const Matrix4f& m, size_t count);
+  static void RotateVectors(Vector3f* pResult, const Matrix4f& m, const Vector3f* pSource, size_t count);
+  static void TransformPoints(Vector3f* pResult, const Matrix4f& m, const Vector3f* pSource, size_t count);
+  static void TransformPoints(F32* pX, F32* pY, F32* pZ, const Matrix4f& m, size_t count);
+
+private:
+  static const U32    kCullGroupSize = 8;
+
+  static U32          CullBoxGroup(const Planef& plane, const F32* pCenterX, const F32* pCenterY, const F32* pCenterZ,
+                        const F32* pExtentX, const F32* pExtentY, const F32* pExtentZ, size_t laneCount, U32 visibleMask);
+  static U32          CullSphereGroup(const Planef& plane, const F32* pX, const F32* pY, const F32* pZ, const F32* pRadius, size_t laneCount, U32 visibleMask);
+  static U32          GetCullPlane(U32 index, U32 firstPlane);
+  static void         StoreCullGroup(U32* pResult, size_t group, U32 visibleMask);
+#ifdef E_SIMD_SSE2
+  static void         StoreMask(bool* pResult, __m128 mask);
+#endif
+#ifdef E_MATH_SIMD_F16C
+  static __m128       ClampToHalfRange(__m128 v);
+  static __m256       ClampToHalfRange(__m256 v);
+#endif
+#ifdef E_SIMD_AVX
+  static __m256       Broadcast(const F32* p);
+  static void         MultiplyRows(F32* pResult, const F32* pSource, __m256 r0, __m256 r1, __m256 r2, __m256 r3);
+#endif
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+Batch methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void Batch::ConvertToFloat(F32* pResult, const U16* pSource, size_t count)
+{
+  size_t i = 0;
+#if defined(E_MATH_SIMD_F16C)
+  for (; i + 8 <= count; i += 8) _mm256_storeu_ps(pResult + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + i))));
+#elif defined(E_SIMD_SSE2)
+  // Same exponent rebias as HalfToFloat
+  const __m128i exponentMantissaMask = _mm_set1_epi32(0x7FFF);
+  const __m128i infinityLimit = _mm_set1_epi32(0x7BFF);
+  const __m128i infinityExponent = _mm_set1_epi32(255 << 23);
+  const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128i half = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSource + i)), _mm_setzero_si128());
+    const __m128i exponentMantissa = _mm_and_si128(half, exponentMantissaMask);
+    const __m128i sign = _mm_slli_epi32(_mm_xor_si128(half, exponentMantissa), 16);
+    const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exponentMantissa, 13)), magic);
+    const __m128i infinity = _mm_and_si128(_mm_cmpgt_epi32(exponentMantissa, infinityLimit), infinityExponent);
+    _mm_storeu_ps(pResult + i, _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, infinity))));
+  }
+#endif
+  for (; i < count; ++i) pResult[i] = HalfToFloat(pSource[i]);
+}
+
+inline void Batch::ConvertToHalf(U16* pResult, const F32* pSource, size_t count)
+{
+  size_t i = 0;
+#ifdef E_MATH_SIMD_F16C
+  for (; i + 8 <= count; i += 8)
+  {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pResult + i), _mm256_cvtps_ph(ClampToHalfRange(_mm256_loadu_ps(pSource + i)), _MM_FROUND_TO_ZERO));
+  }
+#endif
+  for (; i < count; ++i) pResult[i] = Half(pSource[i]);
+}
+
+inline void Batch::ConvertToHalf(U16* pResult, size_t resultStride, const F32* pSource, size_t sourceStride, U32 componentCount, size_t count)
+{
+  E_ASSERT_MSG(componentCount >= 1 && componentCount <= 4, E_ASSERT_MSG_BATCH_COMPONENT_COUNT);
+  U8* pResultBytes = reinterpret_cast<U8*>(pResult);
+  const U8* pSourceBytes = reinterpret_cast<const U8*>(pSource);
+#ifdef E_MATH_SIMD_F16C
+  // One conversion per element, loading and storing exactly the element components
+  if (componentCount > 1)
+  {
+    for (size_t i = 0; i < count; ++i, pResultBytes += resultStride, pSourceBytes += sourceStride)
+    {
+      const F32* pElementSource = reinterpret_cast<const F32*>(pSourceBytes);
+      __m128 v = (componentCount == 4) ? _mm_loadu_ps(pElementSource) : _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(pElementSource)));
+      if (componentCount == 3) v = _mm_movelh_ps(v, _mm_load_ss(pElementSource + 2));
+      const __m128i half = _mm_cvtps_ph(ClampToHalfRange(v), _MM_FROUND_TO_ZERO);
+      if (componentCount == 4)
+      {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(pResultBytes), half);
+      }
+      else
+      {
+        const I32 xy = _mm_cvtsi128_si32(half);
+        std::memcpy(pResultBytes, &xy, sizeof(I32));
+        if (componentCount == 3) reinterpret_cast<U16*>(pResultBytes)[2] = static_cast<U16>(_mm_extract_epi16(half, 2));
+      }
+    }
+    return;
+  }
+#endif
+  for (size_t i = 0; i < count; ++i, pResultBytes += resultStride, pSourceBytes += sourceStride)
+  {
+    const F32* pElementSource = reinterpret_cast<const F32*>(pSourceBytes);
+    U16* pElementResult = reinterpret_cast<U16*>(pResultBytes);
+    for (U32 j = 0; j < componentCount; ++j) pElementResult[j] = Half(pElementSource[j]);
+  }
+}
+
+inline void Batch::CullBoxes(U32* pResult, const Planef* pPlanes, U32 planeCount, const F32* pCenterX, const F32* pCenterY, const F32* pCenterZ,
+  const F32* pExtentX, const F32* pExtentY, const F32* pExtentZ, size_t count, U8* pPlaneCache /* = nullptr */)
+{
+  for (size_t group = 0, i = 0; i < count; ++group, i += kCullGroupSize)
+  {
+    const size_t laneCount = Math::Min(count - i, static_cast<size_t>(kCullGroupSize));
+    const U32 firstPlane = (pPlaneCache && pPlaneCache[group] < planeCount) ? pPlaneCache[group] : 0;
+    U32 visibleMask = (1u << laneCount) - 1;
+    for (U32 j = 0; j < planeCount && visibleMask; ++j)
+    {
+      const U32 plane = GetCullPlane(j, firstPlane);
+      visibleMask = CullBoxGroup(pPlanes[plane], pCenterX + i, pCenterY + i, pCenterZ + i, pExtentX + i, pExtentY + i, pExtentZ + i, laneCount, visibleMask);
+      if (visibleMask == 0 && pPlaneCache) pPlaneCache[group] = static_cast<U8>(plane);
+    }
+    StoreCullGroup(pResult, group, visibleMask);
+  }
+}
+
+inline void Batch::CullSpheres(U32* pResult, const Planef* pPlanes, U32 planeCount, const F32* pX, const F32* pY, const F32* pZ,
+  const F32* pRadius, size_t count, U8* pPlaneCache /* = nullptr */)
+{
+  for (size_t group = 0, i = 0; i < count; ++group, i += kCullGroupSize)
+  {
+    const size_t laneCount = Math::Min(count - i, static_cast<size_t>(kCullGroupSize));
+    const U32 firstPlane = (pPlaneCache && pPlaneCache[group] < planeCount) ? pPlaneCache[group] : 0;
+    U32 visibleMask = (1u << laneCount) - 1;
+    for (U32 j = 0; j < planeCount && visibleMask; ++j)
+    {
+      const U32 plane = GetCullPlane(j, firstPlane);
+      visibleMask = CullSphereGroup(pPlanes[plane], pX + i, pY + i, pZ + i, pRadius + i, laneCount, visibleMask);
+      if (visibleMask == 0 && pPlaneCache) pPlaneCache[group] = static_cast<U8>(plane);
+    }
+    StoreCullGroup(pResult, group, visibleMask);
+  }
+}
+
+inline void Batch::GetRotation(Matrix4f* pResult, const Quatf* pSource, size_t count)
+{
+  size_t i = 0;
+#ifdef E_SIMD_SSE2
+  static_assert(sizeof(Quatf) == 4 * sizeof(F32), "Quatf must be packed");
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 two = _mm_set1_ps(2.0f);
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 lastRow = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128 x = Simd::Load(&pSource[i].x);
+    __m128 y = Simd::Load(&pSource[i + 1].x);
+    __m128 z = Simd::Load(&pSource[i + 2].x);
+    __m128 w = Simd::Load(&pSource[i + 3].x);
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+
+    // Same operations as Quaternion::GetRotation
+    const __m128 xx = _mm_mul_ps(_mm_mul_ps(x, x), two);
+    const __m128 yy = _mm_mul_ps(_mm_mul_ps(y, y), two);
+    const __m128 zz = _mm_mul_ps(_mm_mul_ps(z, z), two);
+    const __m128 xy = _mm_mul_ps(_mm_mul_ps(x, y), two);
+    const __m128 xz = _mm_mul_ps(_mm_mul_ps(x, z), two);
+    const __m128 yz = _mm_mul_ps(_mm_mul_ps(y, z), two);
+    const __m128 wx = _mm_mul_ps(_mm_mul_ps(w, x), two);
+    const __m128 wy = _mm_mul_ps(_mm_mul_ps(w, y), two);
+    const __m128 wz = _mm_mul_ps(_mm_mul_ps(w, z), two);
+
+    // Lane j of each row element belongs to the matrix i + j
+    __m128 m0 = _mm_sub_ps(one, _mm_add_ps(yy, zz));
+    __m128 m1 = _mm_add_ps(xy, wz);
+    __m128 m2 = _mm_sub_ps(xz, wy);
+    __m128 m3 = zero;
+    _MM_TRANSPOSE4_PS(m0, m1, m2, m3);
+    __m128 m4 = _mm_sub_ps(xy, wz);
+    __m128 m5 = _mm_sub_ps(one, _mm_add_ps(xx, zz));
+    __m128 m6 = _mm_add_ps(yz, wx);
+    __m128 m7 = zero;
+    _MM_TRANSPOSE4_PS(m4, m5, m6, m7);
+    __m128 m8 = _mm_add_ps(xz, wy);
+    __m128 m9 = _mm_sub_ps(yz, wx);
+    __m128 m10 = _mm_sub_ps(one, _mm_add_ps(xx, yy));
+    __m128 m11 = zero;
+    _MM_TRANSPOSE4_PS(m8, m9, m10, m11);
+
+    const __m128 rowList[4][3] = { { m0, m4, m8 }, { m1, m5, m9 }, { m2, m6, m10 }, { m3, m7, m11 } };
+    for (U32 j = 0; j < 4; ++j)
+    {
+      F32* pTarget = &pResult[i + j][0];
+      Simd::Store(pTarget, rowList[j][0]);
+      Simd::Store(pTarget + 4, rowList[j][1]);
+      Simd::Store(pTarget + 8, rowList[j][2]);
+      Simd::Store(pTarget + 12, lastRow);
+    }
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    pResult[i].SetIdentity();
+    pSource[i].GetRotation(pResult[i]);
+  }
+}
+
+inline void Batch::IntersectPlaneBoxes(bool* pResult, const Planef& plane, const Box3f* pSource, size_t count)
+{
+  const Vector3f& normal = plane.GetNormal();
+  size_t i = 0;
+#ifdef E_SIMD_SSE2
+  static_assert(sizeof(Box3f) == 6 * sizeof(F32), "Box3f must be packed");
+  const __m128 nx = _mm_set1_ps(normal.x);
+  const __m128 ny = _mm_set1_ps(normal.y);
+  const __m128 nz = _mm_set1_ps(normal.z);
+  const __m128 absNx = _mm_set1_ps(Math::Abs(normal.x));
+  const __m128 absNy = _mm_set1_ps(Math::Abs(normal.y));
+  const __m128 absNz = _mm_set1_ps(Math::Abs(normal.z));
+  const __m128 d = _mm_set1_ps(plane.GetDistance());
+  const __m128 signMask = _mm_set1_ps(-0.0f);
+  for (; i + 4 <= count; i += 4)
+  {
+    // Boxes are stored as center and extents (6 floats) so 4 boxes are loaded as 8 interleaved 3 component vectors
+    const F32* p = &pSource[i].GetCenter().x;
+    __m128 lowX, lowY, lowZ, highX, highY, highZ;
+    Simd::LoadTransposed(p, lowX, lowY, lowZ);
+    Simd::LoadTransposed(p + 12, highX, highY, highZ);
+    const __m128 centerX = _mm_shuffle_ps(lowX, highX, _MM_SHUFFLE(2, 0, 2, 0));
+    const __m128 centerY = _mm_shuffle_ps(lowY, highY, _MM_SHUFFLE(2, 0, 2, 0));
+    const __m128 centerZ = _mm_shuffle_ps(lowZ, highZ, _MM_SHUFFLE(2, 0, 2, 0));
+    const __m128 extentX = _mm_shuffle_ps(lowX, highX, _MM_SHUFFLE(3, 1, 3, 1));
+    const __m128 extentY = _mm_shuffle_ps(lowY, highY, _MM_SHUFFLE(3, 1, 3, 1));
+    const __m128 extentZ = _mm_shuffle_ps(lowZ, highZ, _MM_SHUFFLE(3, 1, 3, 1));
+
+    __m128 distance = _mm_mul_ps(centerX, nx);
+    distance = Simd::MultiplyAdd(centerY, ny, distance);
+    distance = Simd::MultiplyAdd(centerZ, nz, distance);
+    distance = _mm_add_ps(distance, d);
+    __m128 radius = _mm_mul_ps(extentX, absNx);
+    radius = Simd::MultiplyAdd(extentY, absNy, radius);
+    radius = Simd::MultiplyAdd(extentZ, absNz, radius);
+    StoreMask(pResult + i, _mm_cmpnlt_ps(distance, _mm_xor_ps(radius, signMask)));
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    const Vector3f& extents = pSource[i].GetExtents();
+    const F32 radius = extents.x * Math::Abs(normal.x) + extents.y * Math::Abs(normal.y) + extents.z * Math::Abs(normal.z);
+    pResult[i] = !(plane.GetDistanceToPoint(pSource[i].GetCenter()) < -radius);
+  }
+}
+
+inline void Batch::IntersectPlaneSpheres(bool* pResult, const Planef& plane, const Spheref* pSource, size_t count)
+{
+  size_t i = 0;
+#ifdef E_SIMD_SSE2
+  static_assert(sizeof(Spheref) == 4 * sizeof(F32), "Spheref must be packed");
+  const Vector3f& normal = plane.GetNormal();
+  const __m128 nx = _mm_set1_ps(normal.x);
+  const __m128 ny = _mm_set1_ps(normal.y);
+  const __m128 nz = _mm_set1_ps(normal.z);
+  const __m128 d = _mm_set1_ps(plane.GetDistance());
+  const __m128 signMask = _mm_set1_ps(-0.0f);
+  for (; i + 4 <= count; i += 4)
+  {
+    // Spheres are stored as origin and radius (4 floats)
+    __m128 x = Simd::Load(&pSource[i].GetOrigin().x);
+    __m128 y = Simd::Load(&pSource[i + 1].GetOrigin().x);
+    __m128 z = Simd::Load(&pSource[i + 2].GetOrigin().x);
+    __m128 radius = Simd::Load(&pSource[i + 3].GetOrigin().x);
+    _MM_TRANSPOSE4_PS(x, y, z, radius);
+    __m128 distance = _mm_mul_ps(x, nx);
+    distance = Simd::MultiplyAdd(y, ny, distance);
+    distance = Simd::MultiplyAdd(z, nz, distance);
+    distance = _mm_add_ps(distance, d);
+    StoreMask(pResult + i, _mm_cmpnlt_ps(distance, _mm_xor_ps(radius, signMask)));
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    pResult[i] = !(plane.GetDistanceToPoint(pSource[i].GetOrigin()) < -pSource[i].GetRadius());
+  }
+}
+
+inline void Batch::Multiply(Matrix4f* pResult, const Matrix4f* pSourceA, const Matrix4f* pSourceB, size_t count)
+{
+#if defined(E_SIMD_AVX)
+  for (size_t i = 0; i < count; ++i)
+  {
+    const F32* pB = &pSourceB[i][0];
+    MultiplyRows(&pResult[i][0], &pSourceA[i][0], Broadcast(pB), Broadcast(pB + 4), Broadcast(pB + 8), Broadcast(pB + 12));
+  }
+#else
+  for (size_t i = 0; i < count; ++i) pResult[i] = pSourceA[i] * pSourceB[i];
+#endif
+}
+
+inline void Batch::Multiply(Matrix4f* pResult, const Matrix4f* pSource, const Matrix4f& m, size_t count)
+{
+#if defined(E_SIMD_AVX)
+  const F32* pM = &m[0];
+  const __m256 r0 = Broadcast(pM);
+  const __m256 r1 = Broadcast(pM + 4);
+  const __m256 r2 = Broadcast(pM + 8);
+  const __m256 r3 = Broadcast(pM + 12);
+  for (size_t i = 0; i < count; ++i) MultiplyRows(&pResult[i][0], &pSource[i][0], r0, r1, r2, r3);
+#else
+  // Copy m as it could be one of the result elements
+  const Matrix4f matrix(m);
+  for (size_t i = 0; i < count; ++i) pResult[i] = pSource[i] * matrix;
+#endif
+}
+
+inline void Batch::RotateVectors(Vector3f* pResult, const Matrix4f& m, const Vector3f* pSource, size_t count)
+{
+  size_t i = 0;
+#ifdef E_SIMD_SSE2
+  static_assert(sizeof(Vector3f) == 3 * sizeof(F32), "Vector3f must be packed");
+  const __m128 m0 = _mm_set1_ps(m[0]), m1 = _mm_set1_ps(m[1]), m2 = _mm_set1_ps(m[2]);
+  const __m128 m4 = _mm_set1_ps(m[4]), m5 = _mm_set1_ps(m[5]), m6 = _mm_set1_ps(m[6]);
+  const __m128 m8 = _mm_set1_ps(m[8]), m9 = _mm_set1_ps(m[9]), m10 = _mm_set1_ps(m[10]);
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128 x, y, z;
+    Simd::LoadTransposed(&pSource[i].x, x, y, z);
+    const __m128 rx = Simd::MultiplyAdd(z, m8, Simd::MultiplyAdd(y, m4, _mm_mul_ps(x, m0)));
+    const __m128 ry = Simd::MultiplyAdd(z, m9, Simd::MultiplyAdd(y, m5, _mm_mul_ps(x, m1)));
+    const __m128 rz = Simd::MultiplyAdd(z, m10, Simd::MultiplyAdd(y, m6, _mm_mul_ps(x, m2)));
+    Simd::StoreTransposed(&pResult[i].x, rx, ry, rz);
+  }
+#endif
+  for (; i < count; ++i) pResult[i] = Matrix4f::RotateVector(m, pSource[i]);
+}
+
+inline void Batch::TransformPoints(Vector3f* pResult, const Matrix4f& m, const Vector3f* pSource, size_t count)
+{
+  E_ASSERT_MSG(m.IsAffine(), E_ASSERT_MSG_BATCH_AFFINE_MATRIX);
+  size_t i = 0;
+#ifdef E_SIMD_SSE2
+  static_assert(sizeof(Vector3f) == 3 * sizeof(F32), "Vector3f must be packed");
+  const __m128 m0 = _mm_set1_ps(m[0]), m1 = _mm_set1_ps(m[1]), m2 = _mm_set1_ps(m[2]);
+  const __m128 m4 = _mm_set1_ps(m[4]), m5 = _mm_set1_ps(m[5]), m6 = _mm_set1_ps(m[6]);
+  const __m128 m8 = _mm_set1_ps(m[8]), m9 = _mm_set1_ps(m[9]), m10 = _mm_set1_ps(m[10]);
+  const __m128 m12 = _mm_set1_ps(m[12]), m13 = _mm_set1_ps(m[13]), m14 = _mm_set1_ps(m[14]);
+  for (; i + 4 <= count; i += 4)
+  {
+    __m128 x, y, z;
+    Simd::LoadTransposed(&pSource[i].x, x, y, z);
+    const __m128 rx = _mm_add_ps(Simd::MultiplyAdd(z, m8, Simd::MultiplyAdd(y, m4, _mm_mul_ps(x, m0))), m12);
+    const __m128 ry = _mm_add_ps(Simd::MultiplyAdd(z, m9, Simd::MultiplyAdd(y, m5, _mm_mul_ps(x, m1))), m13);
+    const __m128 rz = _mm_add_ps(Simd::MultiplyAdd(z, m10, Simd::MultiplyAdd(y, m6, _mm_mul_ps(x, m2))), m14);
+    Simd::StoreTransposed(&pResult[i].x, rx, ry, rz);
+  }
+#endif
+  for (; i < count; ++i) pResult[i] = Matrix4f::TransformPoint(m, pSource[i]);
+}
+
+inline void Batch::TransformPoints(F32* pX, F32* pY, F32* pZ, const Matrix4f& m, size_t count)
+{
+  E_ASSERT_MSG(m.IsAffine(), E_ASSERT_MSG_BATCH_AFFINE_MATRIX);
+  size_t i = 0;
+#if defined(E_SIMD_AVX)
+  const __m256 m0 = _mm256_set1_ps(m[0]), m1 = _mm256_set1_ps(m[1]), m2 = _mm256_set1_ps(m[2]);
+  const __m256 m4 = _mm256_set1_ps(m[4]), m5 = _mm256_set1_ps(m[5]), m6 = _mm256_set1_ps(m[6]);
+  const __m256 m8 = _mm256_set1_ps(m[8]), m9 = _mm256_set1_ps(m[9]), m10 = _mm256_set1_ps(m[10]);
+  const __m256 m12 = _mm256_set1_ps(m[12]), m13 = _mm256_set1_ps(m[13]), m14 = _mm256_set1_ps(m[14]);
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m256 x = _mm256_loadu_ps(pX + i);
+    const __m256 y = _mm256_loadu_ps(pY + i);
+    const __m256 z = _mm256_loadu_ps(pZ + i);
+    _mm256_storeu_ps(pX + i, _mm256_add_ps(Simd::MultiplyAdd(z, m8, Simd::MultiplyAdd(y, m4, _mm256_mul_ps(x, m0))), m12));
+    _mm256_storeu_ps(pY + i, _mm256_add_ps(Simd::MultiplyAdd(z, m9, Simd::MultiplyAdd(y, m5, _mm256_mul_ps(x, m1))), m13));
+    _mm256_storeu_ps(pZ + i, _mm256_add_ps(Simd::MultiplyAdd(z, m10, Simd::MultiplyAdd(y, m6, _mm256_mul_ps(x, m2))), m14));
+  }
+#elif defined(E_SIMD_SSE2)
+  const __m128 m0 = _mm_set1_ps(m[0]), m1 = _mm_set1_ps(m[1]), m2 = _mm_set1_ps(m[2]);
+  const __m128 m4 = _mm_set1_ps(m[4]), m5 = _mm_set1_ps(m[5]), m6 = _mm_set1_ps(m[6]);
+  const __m128 m8 = _mm_set1_ps(m[8]), m9 = _mm_set1_ps(m[9]), m10 = _mm_set1_ps(m[10]);
+  const __m128 m12 = _mm_set1_ps(m[12]), m13 = _mm_set1_ps(m[13]), m14 = _mm_set1_ps(m[14]);
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128 x = Simd::Load(pX + i);
+    const __m128 y = Simd::Load(pY + i);
+    const __m128 z = Simd::Load(pZ + i);
+    Simd::Store(pX + i, _mm_add_ps(Simd::MultiplyAdd(z, m8, Simd::MultiplyAdd(y, m4, _mm_mul_ps(x, m0))), m12));
+    Simd::Store(pY + i, _mm_add_ps(Simd::MultiplyAdd(z, m9, Simd::MultiplyAdd(y, m5, _mm_mul_ps(x, m1))), m13));
+    Simd::Store(pZ + i, _mm_add_ps(Simd::MultiplyAdd(z, m10, Simd::MultiplyAdd(y, m6, _mm_mul_ps(x, m2))), m14));
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    const F32 x = pX[i];
+    const F32 y = pY[i];
+    const F32 z = pZ[i];
+    pX[i] = m[0] * x + m[4] * y + m[8]  * z + m[12];
+    pY[i] = m[1] * x + m[5] * y + m[9]  * z + m[13];
+    pZ[i] = m[2] * x + m[6] * y + m[10] * z + m[14];
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Batch private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+#ifdef E_MATH_SIMD_F16C
+/**
+Replaces the values out of the half range by infinity so that the F16C conversion (round toward zero) matches Half.
+*/
+inline __m128 Batch::ClampToHalfRange(__m128 v)
+{
+  const __m128 signMask = _mm_set1_ps(-0.0f);
+  const __m128 overflow = _mm_cmpge_ps(_mm_andnot_ps(signMask, v), _mm_set1_ps(65536.0f));
+  return _mm_blendv_ps(v, _mm_or_ps(_mm_and_ps(v, signMask), _mm_set1_ps(std::numeric_limits<F32>::infinity())), overflow);
+}
+
+inline __m256 Batch::ClampToHalfRange(__m256 v)
+{
+  const __m256 signMask = _mm256_set1_ps(-0.0f);
+  const __m256 overflow = _mm256_cmp_ps(_mm256_andnot_ps(signMask, v), _mm256_set1_ps(65536.0f), _CMP_GE_OQ);
+  return _mm256_blendv_ps(v, _mm256_or_ps(_mm256_and_ps(v, signMask), _mm256_set1_ps(std::numeric_limits<F32>::infinity())), overflow);
+}
+#endif
+
+/**
+Returns the lanes of visibleMask whose boxes are not completely behind the plane.
+*/
+inline U32 Batch::CullBoxGroup(const Planef& plane, const F32* pCenterX, const F32* pCenterY, const F32* pCenterZ,
+  const F32* pExtentX, const F32* pExtentY, const F32* pExtentZ, size_t laneCount, U32 visibleMask)
+{
+  const Vector3f& normal = plane.GetNormal();
+#if defined(E_SIMD_AVX)
+  if (laneCount == kCullGroupSize)
+  {
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 nx = _mm256_set1_ps(normal.x);
+    const __m256 ny = _mm256_set1_ps(normal.y);
+    const __m256 nz = _mm256_set1_ps(normal.z);
+    __m256 distance = _mm256_mul_ps(_mm256_loadu_ps(pCenterX), nx);
+    distance = Simd::MultiplyAdd(_mm256_loadu_ps(pCenterY), ny, distance);
+    distance = Simd::MultiplyAdd(_mm256_loadu_ps(pCenterZ), nz, distance);
+    distance = _mm256_add_ps(distance, _mm256_set1_ps(plane.GetDistance()));
+    __m256 radius = _mm256_mul_ps(_mm256_loadu_ps(pExtentX), _mm256_andnot_ps(signMask, nx));
+    radius = Simd::MultiplyAdd(_mm256_loadu_ps(pExtentY), _mm256_andnot_ps(signMask, ny), radius);
+    radius = Simd::MultiplyAdd(_mm256_loadu_ps(pExtentZ), _mm256_andnot_ps(signMask, nz), radius);
+    // Not less than (instead of greater or equal) so that NaN results match the scalar code
+    return visibleMask & static_cast<U32>(_mm256_movemask_ps(_mm256_cmp_ps(distance, _mm256_xor_ps(radius, signMask), _CMP_NLT_UQ)));
+  }
+#elif defined(E_SIMD_SSE2)
+  if (laneCount == kCullGroupSize)
+  {
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 nx = _mm_set1_ps(normal.x);
+    const __m128 ny = _mm_set1_ps(normal.y);
+    const __m128 nz = _mm_set1_ps(normal.z);
+    const __m128 absNx = _mm_andnot_ps(signMask, nx);
+    const __m128 absNy = _mm_andnot_ps(signMask, ny);
+    const __m128 absNz = _mm_andnot_ps(signMask, nz);
+    const __m128 d = _mm_set1_ps(plane.GetDistance());
+    U32 planeMask = 0;
+    for (U32 i = 0; i < kCullGroupSize; i += 4)
+    {
+      __m128 distance = _mm_mul_ps(Simd::Load(pCenterX + i), nx);
+      distance = Simd::MultiplyAdd(Simd::Load(pCenterY + i), ny, distance);
+      distance = Simd::MultiplyAdd(Simd::Load(pCenterZ + i), nz, distance);
+      distance = _mm_add_ps(distance, d);
+      __m128 radius = _mm_mul_ps(Simd::Load(pExtentX + i), absNx);
+      radius = Simd::MultiplyAdd(Simd::Load(pExtentY + i), absNy, radius);
+      radius = Simd::MultiplyAdd(Simd::Load(pExtentZ + i), absNz, radius);
+      planeMask |= static_cast<U32>(_mm_movemask_ps(_mm_cmpnlt_ps(distance, _mm_xor_ps(radius, signMask)))) << i;
+    }
+    return visibleMask & planeMask;
+  }
+#endif
+  for (size_t i = 0; i < laneCount; ++i)
+  {
+    if ((visibleMask & (1u << i)) == 0) continue;
+    const F32 radius = pExtentX[i] * Math::Abs(normal.x) + pExtentY[i] * Math::Abs(normal.y) + pExtentZ[i] * Math::Abs(normal.z);
+    if (plane.GetDistanceToPoint(Vector3f(pCenterX[i], pCenterY[i], pCenterZ[i])) < -radius) visibleMask &= ~(1u << i);
+  }
+  return visibleMask;
+}
+
+/**
+Returns the lanes of visibleMask whose spheres are not completely behind the plane.
+*/
+inline U32 Batch::CullSphereGroup(const Planef& plane, const F32* pX, const F32* pY, const F32* pZ, const F32* pRadius, size_t laneCount, U32 visibleMask)
+{
+#if defined(E_SIMD_AVX)
+  if (laneCount == kCullGroupSize)
+  {
+    const Vector3f& normal = plane.GetNormal();
+    __m256 distance = _mm256_mul_ps(_mm256_loadu_ps(pX), _mm256_set1_ps(normal.x));
+    distance = Simd::MultiplyAdd(_mm256_loadu_ps(pY), _mm256_set1_ps(normal.y), distance);
+    distance = Simd::MultiplyAdd(_mm256_loadu_ps(pZ), _mm256_set1_ps(normal.z), distance);
+    distance = _mm256_add_ps(distance, _mm256_set1_ps(plane.GetDistance()));
+    const __m256 radius = _mm256_xor_ps(_mm256_loadu_ps(pRadius), _mm256_set1_ps(-0.0f));
+    return visibleMask & static_cast<U32>(_mm256_movemask_ps(_mm256_cmp_ps(distance, radius, _CMP_NLT_UQ)));
+  }
+#elif defined(E_SIMD_SSE2)
+  if (laneCount == kCullGroupSize)
+  {
+    const Vector3f& normal = plane.GetNormal();
+    const __m128 nx = _mm_set1_ps(normal.x);
+    const __m128 ny = _mm_set1_ps(normal.y);
+    const __m128 nz = _mm_set1_ps(normal.z);
+    const __m128 d = _mm_set1_ps(plane.GetDistance());
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    U32 planeMask = 0;
+    for (U32 i = 0; i < kCullGroupSize; i += 4)
+    {
+      __m128 distance = _mm_mul_ps(Simd::Load(pX + i), nx);
+      distance = Simd::MultiplyAdd(Simd::Load(pY + i), ny, distance);
+      distance = Simd::MultiplyAdd(Simd::Load(pZ + i), nz, distance);
+      distance = _mm_add_ps(distance, d);
+      const __m128 radius = _mm_xor_ps(Simd::Load(pRadius + i), signMask);
+      planeMask |= static_cast<U32>(_mm_movemask_ps(_mm_cmpnlt_ps(distance, radius))) << i;
+    }
+    return visibleMask & planeMask;
+  }
+#endif
+  for (size_t i = 0; i < laneCount; ++i)
+  {
+    if ((visibleMask & (1u << i)) == 0) continue;
+    if (plane.GetDistanceToPoint(Vector3f(pX[i], pY[i], pZ[i])) < -pRadius[i]) visibleMask &= ~(1u << i);
+  }
+  return visibleMask;
+}
+
+/**
+Returns the plane to test in the position index: first the cached plane and then the rest in order.
+*/
+inline U32 Batch::GetCullPlane(U32 index, U32 firstPlane)
+{
+  if (index == 0) return firstPlane;
+  return (index <= firstPlane) ? index - 1 : index;
+}
+
+/**
+Stores the group bits in the bitmask (clearing the word with the first group of each word).
+*/
+inline void Batch::StoreCullGroup(U32* pResult, size_t group, U32 visibleMask)
+{
+  const size_t shift = (group % 4) * kCullGroupSize;
+  if (shift == 0) pResult[group / 4] = visibleMask;
+  else pResult[group / 4] |= visibleMask << shift;
+}
+
+#ifdef E_SIMD_SSE2
+inline void Batch::StoreMask(bool* pResult, __m128 mask)
+{
+  const I32 bits = _mm_movemask_ps(mask);
+  pResult[0] = (bits & 1) != 0;
+  pResult[1] = (bits & 2) != 0;
+  pResult[2] = (bits & 4) != 0;
+  pResult[3] = (bits & 8) != 0;
+}
+#endif
+
+#ifdef E_SIMD_AVX
+/**
+Loads a matrix row in both 128 bit lanes.
+*/
+inline __m256 Batch::Broadcast(const F32* p)
+{
+  const __m128 row = Simd::Load(p);
+  return _mm256_insertf128_ps(_mm256_castps128_ps256(row), row, 1);
+}
+
+/**
+Multiplies the matrix pSource by the matrix rows r0, r1, r2 and r3 computing two result rows per 256 bit register.
+*/
+inline void Batch::MultiplyRows(F32* pResult, const F32* pSource, __m256 r0, __m256 r1, __m256 r2, __m256 r3)
+{
+  for (U32 i = 0; i < 16; i += 8)
+  {
+    const __m256 rows = _mm256_loadu_ps(pSource + i);
+    __m256 result = _mm256_mul_ps(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(0, 0, 0, 0)), r0);
+    result = Simd::MultiplyAdd(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(1, 1, 1, 1)), r1, result);
+    result = Simd::MultiplyAdd(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(2, 2, 2, 2)), r2, result);
+    result = Simd::MultiplyAdd(_mm256_shuffle_ps(rows, rows, _MM_SHUFFLE(3, 3, 3, 3)), r3, result);
+    _mm256_storeu_ps(pResult + i, result);
+  }
+}
+#endif
+}
+}
+
+#endif
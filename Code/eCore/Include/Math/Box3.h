@@ -35,6 +35,11 @@ This file defines the Box3 class. Box3 defines an axis aligned bounding box in 3
 #include "Math.h"
 #include <Assertion/Assert.h>
 
+/*----------------------------------------------------------------------------------------------------------------------
+Assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_BOX3_MIN_MAX "Box min point must not exceed the max point"
+
 namespace E
 {
 namespace Math
@@ -61,6 +66,8 @@ public:
   Vector3<T>	GetBackBottomRight() const;
   Vector3<T>	GetBackTopLeft() const;
   Vector3<T>	GetBackTopRight() const;
+  const Vector3<T>& GetCenter() const;
+  const Vector3<T>& GetExtents() const;
   Vector3<T>	GetFrontBottomLeft() const;
   Vector3<T>	GetFrontBottomRight() const;
   Vector3<T>	GetFrontTopLeft() const;
@@ -68,6 +75,7 @@ public:
   Vector3<T>	GetMax() const;
   Vector3<T>	GetMin() const;
   bool		    IsContained(const Vector3<T>& point) const;
+  bool		    IsEmpty() const;
   bool		    IsOverlapped(const Box3& box) const;
   void        SetPoints(const Vector3<T>* pPoints, U32 count);
 
@@ -94,7 +102,7 @@ inline Box3<T>::Box3()
 template <class T>
 inline Box3<T>::Box3(const Vector3<T>& min, const Vector3<T>& max)
 {	
-  E_ASSERT_MSG(min.x <= max. x && min.y <= max.y && min.z <= max.z);
+  E_ASSERT_MSG(min.x <= max.x && min.y <= max.y && min.z <= max.z, E_ASSERT_MSG_BOX3_MIN_MAX);
   mCenter   = (max + min) * static_cast<T>(0.5);
   mExtents  = (max - min) * static_cast<T>(0.5);
 }
@@ -107,10 +115,10 @@ template <typename T>
 inline bool Box3<T>::AddBox(const Box3& other)
 {
   // If other is empty
-  if (other.mExtends.x != -1)
+  if (other.mExtents.x != -1)
   {
     // If this is empty
-    if (mExtends.x == -1)
+    if (mExtents.x == -1)
     {
       *this = other;
       return true;
@@ -120,8 +128,8 @@ inline bool Box3<T>::AddBox(const Box3& other)
       Vector3<T> max = mCenter + mExtents;
       Vector3<T> min = mCenter - mExtents;      
 
-      Vector3<T> newMax = Vector3<T>::Max(max, other.mCenter + other.mExtends);
-      Vector3<T> newMin = Vector3<T>::Max(min, other.mCenter - other.mExtends);
+      Vector3<T> newMax = Vector3<T>::Max(max, other.mCenter + other.mExtents);
+      Vector3<T> newMin = Vector3<T>::Min(min, other.mCenter - other.mExtents);
 
       mCenter   = (newMax + newMin) * static_cast<T>(0.5);
       mExtents  = (newMax - newMin) * static_cast<T>(0.5);
@@ -150,7 +158,7 @@ inline bool Box3<T>::AddPoint(const Vector3<T>& point)
     Vector3<T> min = mCenter - mExtents;      
 
     Vector3<T> newMax = Vector3<T>::Max(max, point);
-    Vector3<T> newMin = Vector3<T>::Max(min, point);
+    Vector3<T> newMin = Vector3<T>::Min(min, point);
 
     mCenter   = (newMax + newMin) * static_cast<T>(0.5);
     mExtents  = (newMax - newMin) * static_cast<T>(0.5);
@@ -183,6 +191,18 @@ inline Vector3<T> Box3<T>::GetBackTopRight() const
   return mCenter + mExtents;
 }
 
+template <class T>
+inline const Vector3<T>& Box3<T>::GetCenter() const	
+{ 
+  return mCenter;
+}
+
+template <class T>
+inline const Vector3<T>& Box3<T>::GetExtents() const	
+{ 
+  return mExtents;
+}
+
 template <class T>
 inline Vector3<T> Box3<T>::GetFrontBottomLeft() const
 { 
@@ -226,6 +246,12 @@ inline bool Box3<T>::IsContained(const Vector3<T>& point) const
   return (Math::Abs(distance.x) <= mExtents.x && Math::Abs(distance.y) <= mExtents.y && Math::Abs(distance.z) <= mExtents.z);
 }
 
+template <class T>
+inline bool Box3<T>::IsEmpty() const
+{
+  return mExtents.x == -1;
+}
+
 template <class T>
 inline bool Box3<T>::IsOverlapped(const Box3& box) const
 {
@@ -243,6 +269,7 @@ inline void Box3<T>::SetPoints(const Vector3<T>* pPoints, U32 count)
   for (U32 i = 1; i < count; ++i)
   {
     // Recalculate max min
+    const Vector3<T>& point = pPoints[i];
     if (point.x > max.x)	max.x = point.x;
     if (point.y > max.y)	max.y = point.y;
     if (point.z > max.z)	max.z = point.z;
@@ -260,17 +287,18 @@ inline void Box3<T>::SetPoints(const Vector3<T>* pPoints, U32 count)
 Box3 methods
 ----------------------------------------------------------------------------------------------------------------------*/
 
-void Transform(const Matrix4<T>& matrix)
+template <typename T>
+inline void Box3<T>::Transform(const Matrix4<T>& matrix)
 {
   Box3<T> result;
-  result.PushPoint(matrix.Transform(GetBackBottomLeft()));
-  result.PushPoint(matrix.Transform(GetBackBottomRigth()));
-  result.PushPoint(matrix.Transform(GetBackTopLeft()));
-  result.PushPoint(matrix.Transform(GetBackTopRightLeft()));
-  result.PushPoint(matrix.Transform(GetFrontBottomLeft()));
-  result.PushPoint(matrix.Transform(GetFrontBottomRigth()));
-  result.PushPoint(matrix.Transform(GetFrontTopLeft()));
-  result.PushPoint(matrix.Transform(GetFrontTopRightLeft()));
+  result.AddPoint(Matrix4<T>::TransformPoint(matrix, GetBackBottomLeft()));
+  result.AddPoint(Matrix4<T>::TransformPoint(matrix, GetBackBottomRight()));
+  result.AddPoint(Matrix4<T>::TransformPoint(matrix, GetBackTopLeft()));
+  result.AddPoint(Matrix4<T>::TransformPoint(matrix, GetBackTopRight()));
+  result.AddPoint(Matrix4<T>::TransformPoint(matrix, GetFrontBottomLeft()));
+  result.AddPoint(Matrix4<T>::TransformPoint(matrix, GetFrontBottomRight()));
+  result.AddPoint(Matrix4<T>::TransformPoint(matrix, GetFrontTopLeft()));
+  result.AddPoint(Matrix4<T>::TransformPoint(matrix, GetFrontTopRight()));
   (*this) = result;
 }
 }
@@ -0,0 +1,376 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Bvh.h
+This file defines the Bvh class. Bvh implements a bounding volume hierarchy for fast ray intersection queries.
+*/
+
+#ifndef E3_BVH_H
+#define E3_BVH_H
+
+#include <Containers/List.h>
+#include "Box3.h"
+#include "Comparison.h"
+#include "Simd.h"
+
+/*----------------------------------------------------------------------------------------------------------------------
+Assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_BVH_PRIMITIVE_INDEX_VALUE  "Primitive index (%d) is out of bounds"
+#define E_ASSERT_MSG_BVH_BOX_HIERARCHY          "Method is only available for box hierarchies"
+#define E_ASSERT_MSG_BVH_TRIANGLE_HIERARCHY     "Method is only available for triangle hierarchies"
+
+namespace E
+{
+namespace Math
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Bvh
+
+Please note that this class has the following usage contract:
+
+1. Bvh builds a binary hierarchy either over triangles (mesh hierarchy) or over boxes (world hierarchy of mesh bounds).
+Nodes are split with the surface area heuristic (SAH) evaluated over kBinCount centroid bins on every axis. Leaves
+hold kMaxLeafSize primitives at most.
+2. Primitive indices returned in Hit refer to the triangle (index triplet) or box order used in Build.
+3. Hit::lambda is both the result and the maximum distance of the query, so a Hit must be reset (or set to the desired
+maximum distance) before each query. Box hits report the ray entry distance (0 if the ray origin is inside the box).
+4. Triangle intersection is two sided and only rejects rays parallel to the triangle plane. Unlike
+IntersectRayTriangle, there is no determinant epsilon so tiny triangles are not missed regardless of the model scale.
+5. Refit updates the node bounds keeping the hierarchy topology, which is much faster than Build but degrades the
+hierarchy quality as primitives move away from their build positions. Rebuild when primitives have moved a lot.
+6. The packet Intersect traces 4 rays at a time using SSE2 (remaining rays and non SIMD builds trace one ray at a time).
+Packet results are bit exact with respect to the single ray Intersect (hits at the exact same distance may report
+different primitives).
+7. The templated Intersect traverses the hierarchy calling intersectPrimitive(primitiveIndex, lambda) for every
+primitive whose bounds are hit. The functor must return true and update lambda if the primitive is hit closer than
+lambda. This allows world hierarchies to forward the query to per mesh hierarchies.
+----------------------------------------------------------------------------------------------------------------------*/
+class Bvh
+{
+public:
+  static const U32 kInvalidIndex = 0xffffffff;
+  static const U32 kBinCount = 12;
+  static const U32 kMaxLeafSize = 4;
+
+  struct Hit
+  {
+    Hit() : lambda(NumericLimits<F32>::Max()), primitiveIndex(kInvalidIndex) {}
+
+    F32 lambda;
+    U32 primitiveIndex;
+  };
+
+  Bvh();
+
+  // Accessors
+  Box3f         GetBounds() const;
+  U32           GetDepth() const;
+  U32           GetNodeCount() const;
+  U32           GetPrimitiveCount() const;
+  bool          IsEmpty() const;
+
+  // Methods
+  E_API void    Build(const Box3f* pBoxes, U32 boxCount);
+  E_API void    Build(const Vector3f* pPositions, const U32* pIndices, U32 triangleCount);
+  E_API void    Clear();
+  E_API bool    Intersect(const Vector3f& rayOrigin, const Vector3f& rayDirection, Hit& hit) const;
+  E_API void    Intersect(const Vector3f* pRayOrigins, const Vector3f* pRayDirections, Hit* pHits, U32 rayCount) const;
+  template <class IntersectPrimitive>
+  bool          Intersect(const Vector3f& rayOrigin, const Vector3f& rayDirection, Hit& hit, IntersectPrimitive& intersectPrimitive) const;
+  E_API void    Refit(const Box3f* pBoxes);
+  E_API void    Refit(const Vector3f* pPositions, const U32* pIndices);
+  E_API void    Refit(U32 primitiveIndex, const Box3f& box);
+
+private:
+  static const U32 kMaxDepth = 64;
+  static const U32 kMaxSahDepth = 32;
+
+  // Interior nodes (count 0) store the left child index, the right child being the next one
+  struct Node
+  {
+    Vector3f  min;
+    U32       index;
+    Vector3f  max;
+    U32       count;
+  };
+
+  template <class IntersectPrimitive>
+  struct PrimitiveIntersector
+  {
+    PrimitiveIntersector(const U32* pPrimitiveIndices, IntersectPrimitive& intersectPrimitive)
+      : pPrimitiveIndices(pPrimitiveIndices), intersectPrimitive(intersectPrimitive) {}
+    bool operator()(U32 slot, const Vector3f&, const Vector3f&, F32& lambda) { return intersectPrimitive(pPrimitiveIndices[slot], lambda); }
+
+    const U32*          pPrimitiveIndices;
+    IntersectPrimitive& intersectPrimitive;
+  };
+
+  struct BoxIntersector
+  {
+    explicit BoxIntersector(const Vector3f* pBoxes) : pBoxes(pBoxes) {}
+    bool operator()(U32 slot, const Vector3f& rayOrigin, const Vector3f& rayInvDirection, F32& lambda);
+
+    const Vector3f* pBoxes;
+  };
+
+  struct TriangleIntersector
+  {
+    TriangleIntersector(const Vector3f* pTriangles, const Vector3f& rayDirection) : pTriangles(pTriangles), rayDirection(rayDirection) {}
+    bool operator()(U32 slot, const Vector3f& rayOrigin, const Vector3f& rayInvDirection, F32& lambda);
+
+    const Vector3f* pTriangles;
+    const Vector3f& rayDirection;
+  };
+
+  Containers::List<Node>      mNodeList;
+  Containers::List<U32>       mPrimitiveIndexList;  // Primitive indices in leaf order
+  Containers::List<U32>       mParentList;          // Parent node by node
+  Containers::List<U32>       mLeafList;            // Leaf node by primitive
+  Containers::List<Vector3f>  mBoxList;             // Min & max by primitive in leaf order (box hierarchies)
+  Containers::List<Vector3f>  mTriangleList;        // Vertex 0, edge 0 & edge 1 by primitive in leaf order (triangle hierarchies)
+  U32                         mDepth;
+
+  void          Build(const Vector3f* pPrimitiveMinMax, U32 primitiveCount);
+  void          RefitNodes();
+  void          SetTriangles(const Vector3f* pPositions, const U32* pIndices);
+  template <class Intersector>
+  bool          Traverse(const Vector3f& rayOrigin, const Vector3f& rayDirection, Hit& hit, Intersector& intersector) const;
+  void          UpdateLeaf(Node& node);
+
+  static F32    Max(F32 a, F32 b);
+  static F32    Min(F32 a, F32 b);
+  static bool   IntersectBox(const Vector3f& min, const Vector3f& max, const Vector3f& rayOrigin, const Vector3f& rayInvDirection, F32 lambda, F32& outNear);
+  static bool   IntersectTriangle(const Vector3f* pTriangle, const Vector3f& rayOrigin, const Vector3f& rayDirection, F32& lambda);
+#ifdef E_SIMD_SSE2
+  void          IntersectPacket(const Vector3f* pRayOrigins, const Vector3f* pRayDirections, Hit* pHits) const;
+  static __m128 IntersectBox(const Vector3f& min, const Vector3f& max, const __m128* pRayOrigin, const __m128* pRayInvDirection, __m128 lambda, __m128& outNear);
+#endif
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(Bvh)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+Bvh initialization
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline Bvh::Bvh()
+  : mDepth(0)
+{
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Bvh accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline Box3f Bvh::GetBounds() const
+{
+  return IsEmpty() ? Box3f() : Box3f(mNodeList[0].min, mNodeList[0].max);
+}
+
+inline U32 Bvh::GetDepth() const
+{
+  return mDepth;
+}
+
+inline U32 Bvh::GetNodeCount() const
+{
+  return static_cast<U32>(mNodeList.GetCount());
+}
+
+inline U32 Bvh::GetPrimitiveCount() const
+{
+  return static_cast<U32>(mPrimitiveIndexList.GetCount());
+}
+
+inline bool Bvh::IsEmpty() const
+{
+  return mNodeList.IsEmpty();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Bvh methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <class IntersectPrimitive>
+inline bool Bvh::Intersect(const Vector3f& rayOrigin, const Vector3f& rayDirection, Hit& hit, IntersectPrimitive& intersectPrimitive) const
+{
+  PrimitiveIntersector<IntersectPrimitive> intersector(mPrimitiveIndexList.GetPtr(), intersectPrimitive);
+  return Traverse(rayOrigin, rayDirection, hit, intersector);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Bvh private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <class Intersector>
+inline bool Bvh::Traverse(const Vector3f& rayOrigin, const Vector3f& rayDirection, Hit& hit, Intersector& intersector) const
+{
+  if (IsEmpty()) return false;
+
+  const Vector3f rayInvDirection(1.0f / rayDirection.x, 1.0f / rayDirection.y, 1.0f / rayDirection.z);
+  F32 nearLambda;
+  if (!IntersectBox(mNodeList[0].min, mNodeList[0].max, rayOrigin, rayInvDirection, hit.lambda, nearLambda)) return false;
+
+  // Pending nodes are stored along with their entry distance so that they can be skipped once a closer hit is found
+  U32 nodeStack[kMaxDepth];
+  F32 nearStack[kMaxDepth];
+  U32 stackCount = 1;
+  nodeStack[0] = 0;
+  nearStack[0] = nearLambda;
+  bool result = false;
+
+  while (stackCount > 0)
+  {
+    --stackCount;
+    if (nearStack[stackCount] > hit.lambda) continue;
+
+    const Node& node = mNodeList[nodeStack[stackCount]];
+    if (node.count > 0)
+    {
+      for (U32 slot = node.index; slot < node.index + node.count; ++slot)
+      {
+        if (intersector(slot, rayOrigin, rayInvDirection, hit.lambda))
+        {
+          hit.primitiveIndex = mPrimitiveIndexList[slot];
+          result = true;
+        }
+      }
+    }
+    else
+    {
+      const Node& left = mNodeList[node.index];
+      const Node& right = mNodeList[node.index + 1];
+      F32 leftNear, rightNear;
+      bool leftFlag = IntersectBox(left.min, left.max, rayOrigin, rayInvDirection, hit.lambda, leftNear);
+      bool rightFlag = IntersectBox(right.min, right.max, rayOrigin, rayInvDirection, hit.lambda, rightNear);
+
+      // The nearest child is pushed last to be traversed first
+      if (leftFlag && rightFlag && leftNear < rightNear)
+      {
+        nodeStack[stackCount] = node.index + 1;
+        nearStack[stackCount++] = rightNear;
+        rightFlag = false;
+      }
+      if (leftFlag)
+      {
+        nodeStack[stackCount] = node.index;
+        nearStack[stackCount++] = leftNear;
+      }
+      if (rightFlag)
+      {
+        nodeStack[stackCount] = node.index + 1;
+        nearStack[stackCount++] = rightNear;
+      }
+    }
+  }
+
+  return result;
+}
+
+/**
+Same NaN behaviour as _mm_max_ps and _mm_min_ps (the second operand is returned) so that scalar and SIMD traversals
+take the same decisions for axis aligned rays.
+*/
+inline F32 Bvh::Max(F32 a, F32 b)
+{
+  return a > b ? a : b;
+}
+
+inline F32 Bvh::Min(F32 a, F32 b)
+{
+  return a < b ? a : b;
+}
+
+inline bool Bvh::IntersectBox(const Vector3f& min, const Vector3f& max, const Vector3f& rayOrigin, const Vector3f& rayInvDirection, F32 lambda, F32& outNear)
+{
+  const F32 x0 = (min.x - rayOrigin.x) * rayInvDirection.x;
+  const F32 x1 = (max.x - rayOrigin.x) * rayInvDirection.x;
+  const F32 y0 = (min.y - rayOrigin.y) * rayInvDirection.y;
+  const F32 y1 = (max.y - rayOrigin.y) * rayInvDirection.y;
+  const F32 z0 = (min.z - rayOrigin.z) * rayInvDirection.z;
+  const F32 z1 = (max.z - rayOrigin.z) * rayInvDirection.z;
+  outNear = Max(Max(Max(Min(x0, x1), Min(y0, y1)), Min(z0, z1)), 0.0f);
+  const F32 farLambda = Min(Min(Min(Max(x0, x1), Max(y0, y1)), Max(z0, z1)), lambda);
+  return outNear <= farLambda;
+}
+
+/**
+Moller-Trumbore test against a triangle stored as vertex 0, edge 0 and edge 1. The operations are written explicitly
+in the same order as the SIMD packet version.
+*/
+inline bool Bvh::IntersectTriangle(const Vector3f* pTriangle, const Vector3f& rayOrigin, const Vector3f& rayDirection, F32& lambda)
+{
+  const Vector3f& x0 = pTriangle[0];
+  const Vector3f& edge0 = pTriangle[1];
+  const Vector3f& edge1 = pTriangle[2];
+
+  const F32 px = rayDirection.y * edge1.z - rayDirection.z * edge1.y;
+  const F32 py = rayDirection.z * edge1.x - rayDirection.x * edge1.z;
+  const F32 pz = rayDirection.x * edge1.y - rayDirection.y * edge1.x;
+  const F32 det = edge0.x * px + edge0.y * py + edge0.z * pz;
+  if (det == 0.0f) return false;
+
+  const F32 invDet = 1.0f / det;
+  const F32 tx = rayOrigin.x - x0.x;
+  const F32 ty = rayOrigin.y - x0.y;
+  const F32 tz = rayOrigin.z - x0.z;
+  const F32 u = (tx * px + ty * py + tz * pz) * invDet;
+  if (!(u >= 0.0f && u <= 1.0f)) return false;
+
+  const F32 qx = ty * edge0.z - tz * edge0.y;
+  const F32 qy = tz * edge0.x - tx * edge0.z;
+  const F32 qz = tx * edge0.y - ty * edge0.x;
+  const F32 v = (rayDirection.x * qx + rayDirection.y * qy + rayDirection.z * qz) * invDet;
+  if (!(v >= 0.0f && u + v <= 1.0f)) return false;
+
+  const F32 t = (edge1.x * qx + edge1.y * qy + edge1.z * qz) * invDet;
+  if (!(t >= 0.0f && t < lambda)) return false;
+
+  lambda = t;
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Bvh intersector methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline bool Bvh::BoxIntersector::operator()(U32 slot, const Vector3f& rayOrigin, const Vector3f& rayInvDirection, F32& lambda)
+{
+  F32 nearLambda;
+  if (!IntersectBox(pBoxes[slot * 2], pBoxes[slot * 2 + 1], rayOrigin, rayInvDirection, lambda, nearLambda) || !(nearLambda < lambda)) return false;
+
+  lambda = nearLambda;
+  return true;
+}
+
+inline bool Bvh::TriangleIntersector::operator()(U32 slot, const Vector3f& rayOrigin, const Vector3f&, F32& lambda)
+{
+  return IntersectTriangle(&pTriangles[slot * 3], rayOrigin, rayDirection, lambda);
+}
+}
+}
+
+#endif
@@ -117,8 +117,11 @@ Please note that these methods have the following contract:
 
 1. Half performs a IEEE 754 conformant floating point conversion from  32- bit to 16-bit.
 2. Half assumes U32 to be same size as F32.
+3. Half truncates the mantissa (round toward zero) and converts values out of the 16-bit range to infinity.
+4. HalfToFloat performs the exact conversion from 16-bit to 32-bit, including denormals, infinities and NaNs.
 ----------------------------------------------------------------------------------------------------------------------*/
 U16         Half(F32 value);
+F32         HalfToFloat(U16 value);
 
 template<typename T>
 inline bool IsEqual(T a, T b, T epsilon = Epsilon<T>::Get()) { return Math::Abs(a - b) <= epsilon; }
@@ -229,6 +232,29 @@ inline U16 Half(F32 value)
   return (kBaseTable[bits >> 23] + static_cast<U16>((bits & 0x7FFFFF) >> kShiftTable[bits >> 23]));
 }
 
+/**
+Half to float implementation based on: half_to_float_fast5 by Fabian Giesen. The exponent is rebiased with an exact
+multiplication which also normalizes the denormals.
+*/
+inline F32 HalfToFloat(U16 value)
+{
+  static_assert(std::numeric_limits<F32>::is_iec559, E_STATIC_ASSERT_MSG_MATH_IEEE_754_F32_VALUE);
+  const U32 kMagicBits = (254 - 15) << 23;
+  F32 magic;
+  std::memcpy(&magic, &kMagicBits, sizeof(F32));
+
+  U32 bits = static_cast<U32>(value & 0x7FFF) << 13;
+  F32 result;
+  std::memcpy(&result, &bits, sizeof(F32));
+  result *= magic;
+  std::memcpy(&bits, &result, sizeof(F32));
+  // Infinity & NaN keep the maximum exponent
+  if ((value & 0x7FFF) > 0x7BFF) bits |= 255 << 23;
+  bits |= static_cast<U32>(value & 0x8000) << 16;
+  std::memcpy(&result, &bits, sizeof(F32));
+  return result;
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 Math methods specializations
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -24,13 +24,15 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 // $Author: $
 
 /** @file Hash.h
-This file defines the several utility hash functions for 32 and 64 bit values as well as strings.
+This file defines the several utility hash functions for 32 and 64 bit values, strings and byte ranges.
 */
 
 #ifndef E3_HASH_H
 #define E3_HASH_H
 
 #include <Base.h>
+#include <Math/Comparison.h>
+#include <Memory/Memory.h>
 #include <Text/String.h>
 
 namespace E
@@ -60,6 +62,9 @@ Murmur3
 
 General hash-based lookup hash function with good random distribution of keys
 Implementation based on: http://code.google.com/p/smhasher/wiki/MurmurHash3
+
+Specializations also offer a batch Hash method computing the hashes of a key array using SIMD instructions when 
+available (SSE2 / AVX2 for U32 keys, AVX2 for U64 keys). Batch results are identical to the single key ones.
 ----------------------------------------------------------------------------------------------------------------------*/
 template <typename IntegerType>
 struct Murmur3 { static IntegerType Hash(IntegerType key); };
@@ -82,6 +87,60 @@ multipliers (2654435761U).
 template <typename IntegerType>
 struct SimpleHash { static IntegerType Hash(IntegerType key); };
 
+/*----------------------------------------------------------------------------------------------------------------------
+XxHash64
+
+Fast non-cryptographic 64-bit hash function for byte ranges (XXH64 by Yann Collet, see http://www.xxhash.com). Input 
+is processed in 32 byte stripes using four independent accumulators, reaching memory bandwidth speeds on big buffers 
+(vertex data, serialized blobs) while still performing well on short strings (paths, shader names).
+
+Please note that this class has the following usage contract: 
+
+1. The static Hash methods compute the hash of a single byte range. 
+2. XxHash64 objects compute the hash of a byte range received in several chunks (streaming). The result of GetHash
+is identical to the static Hash result of the concatenated chunks and can be queried at any time.
+3. The hash depends on the byte order, therefore values are only comparable across little-endian platforms.
+----------------------------------------------------------------------------------------------------------------------*/
+class XxHash64
+{
+public:
+  explicit XxHash64(U64 seed = 0);
+
+  // Accessors
+  U64         GetHash() const;
+
+  // Methods
+  void        Reset(U64 seed = 0);
+  void        Update(const void* pData, size_t size);
+
+  static U64  Hash(const void* pData, size_t size, U64 seed = 0);
+  static U64  Hash(const String& key, U64 seed = 0);
+
+private:
+  static const size_t kStripeSize = 32;
+  static const U64    kPrime1 = 11400714785074694791ULL;
+  static const U64    kPrime2 = 14029467366897019727ULL;
+  static const U64    kPrime3 = 1609587929392839161ULL;
+  static const U64    kPrime4 = 9650029242287828579ULL;
+  static const U64    kPrime5 = 2870177450012600261ULL;
+
+  U64         mAccumulators[4];
+  U64         mSeed;
+  U64         mTotalSize;
+  U8          mBuffer[kStripeSize];
+  size_t      mBufferSize;
+
+  static U64  Finalize(U64 hash, const U8* pData, size_t size);
+  static U64  MergeAccumulators(const U64* pAccumulators);
+  static U64  Read32(const U8* pData) { return *reinterpret_cast<const U32*>(pData); }
+  static U64  Read64(const U8* pData) { return *reinterpret_cast<const U64*>(pData); }
+  static U64  RotateLeft(U64 x, U32 bits) { return (x << bits) | (x >> (64 - bits)); }
+  static U64  Round(U64 accumulator, U64 input) { return RotateLeft(accumulator + input * kPrime2, 31) * kPrime1; }
+  static void UpdateStripes(U64* pAccumulators, const U8* pData, size_t stripeCount);
+
+  // Relying on default copy constructor and assignment operator
+};
+
 /*----------------------------------------------------------------------------------------------------------------------
 Djb2 specializations
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -128,6 +187,51 @@ struct Murmur3<U32>
     key ^= key >> 16;
     return key;
   }
+
+  static void Hash(const U32* pKeys, U32* pHashes, size_t count)
+  {
+    size_t i = 0;
+#ifdef E_SIMD_AVX2
+    const __m256i wideC1 = _mm256_set1_epi32(0x85ebca6b);
+    const __m256i wideC2 = _mm256_set1_epi32(0xc2b2ae35);
+    for (; i + 8 <= count; i += 8)
+    {
+      __m256i key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pKeys + i));
+      key = _mm256_xor_si256(key, _mm256_srli_epi32(key, 16));
+      key = _mm256_mullo_epi32(key, wideC1);
+      key = _mm256_xor_si256(key, _mm256_srli_epi32(key, 13));
+      key = _mm256_mullo_epi32(key, wideC2);
+      key = _mm256_xor_si256(key, _mm256_srli_epi32(key, 16));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(pHashes + i), key);
+    }
+#endif
+#ifdef E_SIMD_SSE2
+    const __m128i c1 = _mm_set1_epi32(0x85ebca6b);
+    const __m128i c2 = _mm_set1_epi32(0xc2b2ae35);
+    for (; i + 4 <= count; i += 4)
+    {
+      __m128i key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pKeys + i));
+      key = _mm_xor_si128(key, _mm_srli_epi32(key, 16));
+      key = Multiply(key, c1);
+      key = _mm_xor_si128(key, _mm_srli_epi32(key, 13));
+      key = Multiply(key, c2);
+      key = _mm_xor_si128(key, _mm_srli_epi32(key, 16));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(pHashes + i), key);
+    }
+#endif
+    for (; i < count; ++i) pHashes[i] = Hash(pKeys[i]);
+  }
+
+#ifdef E_SIMD_SSE2
+private:
+  // SSE2 lacks a 32-bit low multiplication (SSE4.1) so it is computed from the even and odd 64-bit products
+  static __m128i Multiply(__m128i a, __m128i b)
+  {
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+  }
+#endif
 };
 
 template <>
@@ -142,6 +246,38 @@ struct Murmur3<U64>
     key ^= key >> 33;
     return key;
   }
+
+  static void Hash(const U64* pKeys, U64* pHashes, size_t count)
+  {
+    size_t i = 0;
+#ifdef E_SIMD_AVX2
+    const __m256i c1 = _mm256_set1_epi64x(0xff51afd7ed558ccd);
+    const __m256i c2 = _mm256_set1_epi64x(0xc4ceb9fe1a85ec53);
+    for (; i + 4 <= count; i += 4)
+    {
+      __m256i key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pKeys + i));
+      key = _mm256_xor_si256(key, _mm256_srli_epi64(key, 33));
+      key = Multiply(key, c1);
+      key = _mm256_xor_si256(key, _mm256_srli_epi64(key, 33));
+      key = Multiply(key, c2);
+      key = _mm256_xor_si256(key, _mm256_srli_epi64(key, 33));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(pHashes + i), key);
+    }
+#endif
+    // Note that SSE2 64-bit multiplication emulation is slower than the scalar one
+    for (; i < count; ++i) pHashes[i] = Hash(pKeys[i]);
+  }
+
+#ifdef E_SIMD_AVX2
+private:
+  // AVX2 lacks a 64-bit low multiplication (AVX-512) so it is computed from 32-bit products
+  static __m256i Multiply(__m256i a, __m256i b)
+  {
+    __m256i low = _mm256_mul_epu32(a, b);
+    __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+    return _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32));
+  }
+#endif
 };
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -165,6 +301,134 @@ struct SimpleHash<U64>
     return key * 2654435761U;
   }
 };
+
+/*----------------------------------------------------------------------------------------------------------------------
+XxHash64 initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline XxHash64::XxHash64(U64 seed /* = 0 */)
+{
+  Reset(seed);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+XxHash64 accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline U64 XxHash64::GetHash() const
+{
+  U64 hash = (mTotalSize >= kStripeSize) ? MergeAccumulators(mAccumulators) : mSeed + kPrime5;
+  return Finalize(hash + mTotalSize, mBuffer, mBufferSize);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+XxHash64 methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void XxHash64::Reset(U64 seed /* = 0 */)
+{
+  mAccumulators[0] = seed + kPrime1 + kPrime2;
+  mAccumulators[1] = seed + kPrime2;
+  mAccumulators[2] = seed;
+  mAccumulators[3] = seed - kPrime1;
+  mSeed = seed;
+  mTotalSize = 0;
+  mBufferSize = 0;
+}
+
+inline void XxHash64::Update(const void* pData, size_t size)
+{
+  const U8* pBytes = static_cast<const U8*>(pData);
+  mTotalSize += size;
+  // Complete a pending stripe
+  if (mBufferSize > 0)
+  {
+    size_t copySize = Math::Min(kStripeSize - mBufferSize, size);
+    Memory::Copy(mBuffer + mBufferSize, pBytes, copySize);
+    mBufferSize += copySize;
+    pBytes += copySize;
+    size -= copySize;
+    if (mBufferSize < kStripeSize) return;
+    UpdateStripes(mAccumulators, mBuffer, 1);
+    mBufferSize = 0;
+  }
+  // Process full stripes directly from the source and keep the remaining bytes
+  size_t stripeCount = size / kStripeSize;
+  UpdateStripes(mAccumulators, pBytes, stripeCount);
+  mBufferSize = size - stripeCount * kStripeSize;
+  Memory::Copy(mBuffer, pBytes + stripeCount * kStripeSize, mBufferSize);
+}
+
+inline U64 XxHash64::Hash(const void* pData, size_t size, U64 seed /* = 0 */)
+{
+  const U8* pBytes = static_cast<const U8*>(pData);
+  U64 hash = seed + kPrime5;
+  if (size >= kStripeSize)
+  {
+    U64 accumulators[4] = { seed + kPrime1 + kPrime2, seed + kPrime2, seed, seed - kPrime1 };
+    size_t stripeCount = size / kStripeSize;
+    UpdateStripes(accumulators, pBytes, stripeCount);
+    hash = MergeAccumulators(accumulators);
+    pBytes += stripeCount * kStripeSize;
+  }
+  return Finalize(hash + size, pBytes, size % kStripeSize);
+}
+
+inline U64 XxHash64::Hash(const String& key, U64 seed /* = 0 */)
+{
+  return Hash(key.GetPtr(), key.GetLength(), seed);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+XxHash64 private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline U64 XxHash64::Finalize(U64 hash, const U8* pData, size_t size)
+{
+  // Process the remaining (less than a stripe) bytes
+  for (; size >= 8; size -= 8, pData += 8) hash = RotateLeft(hash ^ Round(0, Read64(pData)), 27) * kPrime1 + kPrime4;
+  if (size >= 4)
+  {
+    hash = RotateLeft(hash ^ (Read32(pData) * kPrime1), 23) * kPrime2 + kPrime3;
+    size -= 4;
+    pData += 4;
+  }
+  for (; size > 0; --size, ++pData) hash = RotateLeft(hash ^ (*pData * kPrime5), 11) * kPrime1;
+  // Avalanche
+  hash ^= hash >> 33;
+  hash *= kPrime2;
+  hash ^= hash >> 29;
+  hash *= kPrime3;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+inline U64 XxHash64::MergeAccumulators(const U64* pAccumulators)
+{
+  U64 hash = RotateLeft(pAccumulators[0], 1) + RotateLeft(pAccumulators[1], 7) + RotateLeft(pAccumulators[2], 12) + RotateLeft(pAccumulators[3], 18);
+  for (U32 i = 0; i < 4; ++i) hash = (hash ^ Round(0, pAccumulators[i])) * kPrime1 + kPrime4;
+  return hash;
+}
+
+inline void XxHash64::UpdateStripes(U64* pAccumulators, const U8* pData, size_t stripeCount)
+{
+  // Local accumulators allow the compiler to keep them in registers (4 independent dependency chains)
+  U64 a0 = pAccumulators[0];
+  U64 a1 = pAccumulators[1];
+  U64 a2 = pAccumulators[2];
+  U64 a3 = pAccumulators[3];
+  for (size_t i = 0; i < stripeCount; ++i, pData += kStripeSize)
+  {
+    a0 = Round(a0, Read64(pData));
+    a1 = Round(a1, Read64(pData + 8));
+    a2 = Round(a2, Read64(pData + 16));
+    a3 = Round(a3, Read64(pData + 24));
+  }
+  pAccumulators[0] = a0;
+  pAccumulators[1] = a1;
+  pAccumulators[2] = a2;
+  pAccumulators[3] = a3;
+}
 }
 }
 
@@ -0,0 +1,567 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file LooseOctree.h
+This file defines the LooseOctree class. LooseOctree is a dynamic spatial index of bounded values.
+*/
+
+#ifndef E3_LOOSE_OCTREE_H
+#define E3_LOOSE_OCTREE_H
+
+#include <Containers/SlotMap.h>
+#include "Box3.h"
+#include "Comparison.h"
+#include "Plane.h"
+#include "Sphere.h"
+
+/*----------------------------------------------------------------------------------------------------------------------
+Assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_LOOSE_OCTREE_DEPTH_VALUE     "Depth cannot be greater than (%d)"
+#define E_ASSERT_MSG_LOOSE_OCTREE_HALF_SIZE_VALUE "Half size must be greater than 0"
+#define E_ASSERT_MSG_LOOSE_OCTREE_HANDLE_VALUE    "Handle must be valid"
+
+namespace E
+{
+namespace Math
+{
+/*----------------------------------------------------------------------------------------------------------------------
+LooseOctree
+
+Every node bounds are twice the size of its cell (loose factor 2) so a value is stored in the deepest node whose cell
+contains the value bounds center and whose half size is at least twice the value bounds largest extent. Hence a value
+is placed in O(depth) and only changes node when it crosses a cell or changes scale noticeably. Nodes are only split
+once they hold more than kSplitCount values, so sparse regions are not subdivided.
+
+Please note that this class has the following usage contract:
+
+1. The root cell is defined by its center, half size and the maximum node depth (up to kMaxDepth). Values whose center
+lies outside the root cell are stored in the root node, which is always visited by queries.
+2. Insert returns a handle which remains valid until the value is removed (or Clear is called). Handles are
+Containers::SlotMap handles so stale handles are detected.
+3. Update must be called whenever the bounds of a value change. It returns true if the value moved to another node.
+4. Queries append the values whose bounds overlap the query volume to the result list (the result list is not
+cleared). Plane queries return the values which are not completely behind any of the planes (i.e. Frustum planes with
+inward normals), so like any bounds based culling it may report values which are not inside the convex volume.
+5. Nodes are created on demand and are only released by Clear (or Reset).
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+class LooseOctree
+{
+public:
+  // Constants
+  static const U32                  kMaxDepth = 16;
+  static const U32                  kSplitCount = 16;
+
+  LooseOctree();
+  LooseOctree(const Vector3f& center, F32 halfSize, U32 depth);
+
+  // Operators
+  const T&                          operator [] (Containers::SlotMapHandle handle) const;
+  T&                                operator [] (Containers::SlotMapHandle handle);
+
+  // Accessors
+  Box3f                             GetBounds(Containers::SlotMapHandle handle) const;
+  size_t                            GetCount() const;
+  U32                               GetDepth() const;
+  size_t                            GetNodeCount() const;
+  bool                              IsEmpty() const;
+  bool                              IsValid(Containers::SlotMapHandle handle) const;
+
+  // Methods
+  void                              Clear();
+  Containers::SlotMapHandle         Insert(const T& value, const Box3f& bounds);
+  void                              Query(const Box3f& box, Containers::List<T>& result) const;
+  void                              Query(const Spheref& sphere, Containers::List<T>& result) const;
+  void                              Query(const Planef* pPlanes, U32 planeCount, Containers::List<T>& result) const;
+  bool                              Remove(Containers::SlotMapHandle handle);
+  void                              Reset(const Vector3f& center, F32 halfSize, U32 depth);
+  bool                              Update(Containers::SlotMapHandle handle, const Box3f& bounds);
+
+private:
+  static const U32                  kStackSize = 7 * kMaxDepth + 8;
+
+  enum Overlap
+  {
+    eOverlapNone,
+    eOverlapPartial,
+    eOverlapFull
+  };
+
+  struct Item
+  {
+    Vector3f                        center;
+    Vector3f                        extents;
+    T                               value;
+    Containers::SlotMapHandle       handle;
+  };
+
+  struct Location
+  {
+    U32                             node;
+    U32                             index;
+  };
+
+  struct Node
+  {
+    Vector3f                        center;
+    F32                             halfSize;
+    U32                             depth;
+    U32                             firstChild; // 0 if the node has no children (the root is never a child)
+    Containers::List<Item>          itemList;
+  };
+
+  struct BoxOverlap
+  {
+    Vector3f                        center;
+    Vector3f                        extents;
+
+    Overlap                         GetNodeOverlap(const Vector3f& nodeCenter, F32 nodeExtent) const;
+    bool                            IsOverlapped(const Item& item) const;
+  };
+
+  struct SphereOverlap
+  {
+    Vector3f                        center;
+    F32                             radius;
+
+    Overlap                         GetNodeOverlap(const Vector3f& nodeCenter, F32 nodeExtent) const;
+    bool                            IsOverlapped(const Item& item) const;
+  };
+
+  struct PlaneOverlap
+  {
+    const Planef*                   pPlanes;
+    U32                             planeCount;
+
+    Overlap                         GetNodeOverlap(const Vector3f& nodeCenter, F32 nodeExtent) const;
+    bool                            IsOverlapped(const Item& item) const;
+  };
+
+  Containers::List<Node>            mNodeList;
+  Containers::SlotMap<Location>     mLocationMap;
+  U32                               mDepth;
+
+  void                              AddItem(U32 nodeIndex, const Item& item);
+  void                              AddNode(U32 nodeIndex, Containers::List<T>& result) const;
+  U32                               FindNode(const Vector3f& center, const Vector3f& extents) const;
+  template <typename Overlapper>
+  void                              QueryNodes(const Overlapper& overlapper, Containers::List<T>& result) const;
+  void                              RemoveItem(const Location& location);
+  void                              Split(U32 nodeIndex);
+
+  // Relying on default copy constructor and assignment operator
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+LooseOctree initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+inline LooseOctree<T>::LooseOctree()
+  : mDepth(0)
+{
+  Reset(Vector3f(), 1.0f, 0);
+}
+
+template <typename T>
+inline LooseOctree<T>::LooseOctree(const Vector3f& center, F32 halfSize, U32 depth)
+  : mDepth(0)
+{
+  Reset(center, halfSize, depth);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+LooseOctree operators
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+inline const T& LooseOctree<T>::operator[](Containers::SlotMapHandle handle) const
+{
+  const Location& location = mLocationMap[handle];
+  return mNodeList[location.node].itemList[location.index].value;
+}
+
+template <typename T>
+inline T& LooseOctree<T>::operator[](Containers::SlotMapHandle handle)
+{
+  return const_cast<T&>(static_cast<const LooseOctree*>(this)->operator[](handle));
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+LooseOctree accessors
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+inline Box3f LooseOctree<T>::GetBounds(Containers::SlotMapHandle handle) const
+{
+  const Location& location = mLocationMap[handle];
+  const Item& item = mNodeList[location.node].itemList[location.index];
+  return Box3f(item.center - item.extents, item.center + item.extents);
+}
+
+template <typename T>
+inline size_t LooseOctree<T>::GetCount() const
+{
+  return mLocationMap.GetCount();
+}
+
+template <typename T>
+inline U32 LooseOctree<T>::GetDepth() const
+{
+  return mDepth;
+}
+
+template <typename T>
+inline size_t LooseOctree<T>::GetNodeCount() const
+{
+  return mNodeList.GetCount();
+}
+
+template <typename T>
+inline bool LooseOctree<T>::IsEmpty() const
+{
+  return mLocationMap.IsEmpty();
+}
+
+template <typename T>
+inline bool LooseOctree<T>::IsValid(Containers::SlotMapHandle handle) const
+{
+  return mLocationMap.IsValid(handle);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+LooseOctree methods
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+inline void LooseOctree<T>::Clear()
+{
+  Vector3f center = mNodeList[0].center;
+  F32 halfSize = mNodeList[0].halfSize;
+  Reset(center, halfSize, mDepth);
+}
+
+template <typename T>
+inline Containers::SlotMapHandle LooseOctree<T>::Insert(const T& value, const Box3f& bounds)
+{
+  Item item;
+  item.center = bounds.GetCenter();
+  item.extents = bounds.GetExtents();
+  item.value = value;
+
+  Location location = { 0, 0 };
+  item.handle = mLocationMap.Insert(location);
+  AddItem(FindNode(item.center, item.extents), item);
+
+  return item.handle;
+}
+
+template <typename T>
+inline void LooseOctree<T>::Query(const Box3f& box, Containers::List<T>& result) const
+{
+  BoxOverlap overlapper = { box.GetCenter(), box.GetExtents() };
+  QueryNodes(overlapper, result);
+}
+
+template <typename T>
+inline void LooseOctree<T>::Query(const Spheref& sphere, Containers::List<T>& result) const
+{
+  SphereOverlap overlapper = { sphere.GetOrigin(), sphere.GetRadius() };
+  QueryNodes(overlapper, result);
+}
+
+template <typename T>
+inline void LooseOctree<T>::Query(const Planef* pPlanes, U32 planeCount, Containers::List<T>& result) const
+{
+  PlaneOverlap overlapper = { pPlanes, planeCount };
+  QueryNodes(overlapper, result);
+}
+
+template <typename T>
+inline bool LooseOctree<T>::Remove(Containers::SlotMapHandle handle)
+{
+  const Location* pLocation = mLocationMap.Find(handle);
+  if (pLocation == nullptr) return false;
+
+  RemoveItem(*pLocation);
+  mLocationMap.Remove(handle);
+
+  return true;
+}
+
+template <typename T>
+inline void LooseOctree<T>::Reset(const Vector3f& center, F32 halfSize, U32 depth)
+{
+  E_ASSERT_MSG(halfSize > 0.0f, E_ASSERT_MSG_LOOSE_OCTREE_HALF_SIZE_VALUE);
+  E_ASSERT_MSG(depth <= kMaxDepth, E_ASSERT_MSG_LOOSE_OCTREE_DEPTH_VALUE, kMaxDepth);
+
+  mNodeList.Clear();
+  mLocationMap.Clear();
+  mDepth = depth;
+
+  Node root;
+  root.center = center;
+  root.halfSize = halfSize;
+  root.depth = 0;
+  root.firstChild = 0;
+  mNodeList.PushBack(root);
+}
+
+template <typename T>
+inline bool LooseOctree<T>::Update(Containers::SlotMapHandle handle, const Box3f& bounds)
+{
+  Location* pLocation = mLocationMap.Find(handle);
+  E_ASSERT_MSG(pLocation, E_ASSERT_MSG_LOOSE_OCTREE_HANDLE_VALUE);
+
+  U32 nodeIndex = FindNode(bounds.GetCenter(), bounds.GetExtents());
+  if (nodeIndex == pLocation->node)
+  {
+    // Same node: only the bounds need to be refreshed
+    Item& item = mNodeList[nodeIndex].itemList[pLocation->index];
+    item.center = bounds.GetCenter();
+    item.extents = bounds.GetExtents();
+    return false;
+  }
+
+  Item item = mNodeList[pLocation->node].itemList[pLocation->index];
+  item.center = bounds.GetCenter();
+  item.extents = bounds.GetExtents();
+  RemoveItem(*pLocation);
+  AddItem(nodeIndex, item);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+LooseOctree private methods
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+inline void LooseOctree<T>::AddItem(U32 nodeIndex, const Item& item)
+{
+  Location& location = mLocationMap[item.handle];
+  location.node = nodeIndex;
+  location.index = static_cast<U32>(mNodeList[nodeIndex].itemList.GetCount());
+  mNodeList[nodeIndex].itemList.PushBack(item);
+
+  const Node& node = mNodeList[nodeIndex];
+  if (node.firstChild == 0 && node.depth < mDepth && node.itemList.GetCount() > kSplitCount) Split(nodeIndex);
+}
+
+template <typename T>
+inline void LooseOctree<T>::AddNode(U32 nodeIndex, Containers::List<T>& result) const
+{
+  // The node bounds are inside the query volume: add the whole subtree without further overlap tests
+  U32 stack[kStackSize];
+  U32 stackCount = 0;
+  stack[stackCount++] = nodeIndex;
+
+  while (stackCount > 0)
+  {
+    const Node& node = mNodeList[stack[--stackCount]];
+    for (size_t i = 0; i < node.itemList.GetCount(); ++i) result.PushBack(node.itemList[i].value);
+    if (node.firstChild != 0) for (U32 i = 0; i < 8; ++i) stack[stackCount++] = node.firstChild + i;
+  }
+}
+
+template <typename T>
+inline U32 LooseOctree<T>::FindNode(const Vector3f& center, const Vector3f& extents) const
+{
+  F32 extent = Math::Max(extents.x, Math::Max(extents.y, extents.z));
+
+  // Values centered outside the root cell are kept in the root
+  const Node& root = mNodeList[0];
+  if (Math::Abs(center.x - root.center.x) > root.halfSize ||
+      Math::Abs(center.y - root.center.y) > root.halfSize ||
+      Math::Abs(center.z - root.center.z) > root.halfSize) return 0;
+
+  U32 nodeIndex = 0;
+  for (;;)
+  {
+    const Node& node = mNodeList[nodeIndex];
+    if (node.firstChild == 0 || extent > node.halfSize * 0.5f) return nodeIndex;
+
+    nodeIndex = node.firstChild +
+      (center.x >= node.center.x ? 1 : 0) +
+      (center.y >= node.center.y ? 2 : 0) +
+      (center.z >= node.center.z ? 4 : 0);
+  }
+}
+
+template <typename T>
+template <typename Overlapper>
+inline void LooseOctree<T>::QueryNodes(const Overlapper& overlapper, Containers::List<T>& result) const
+{
+  U32 stack[kStackSize];
+  U32 stackCount = 0;
+
+  // The root may hold values outside its cell so its own values are always tested
+  const Node& root = mNodeList[0];
+  for (size_t i = 0; i < root.itemList.GetCount(); ++i)
+  {
+    if (overlapper.IsOverlapped(root.itemList[i])) result.PushBack(root.itemList[i].value);
+  }
+  if (root.firstChild != 0) for (U32 i = 0; i < 8; ++i) stack[stackCount++] = root.firstChild + i;
+
+  while (stackCount > 0)
+  {
+    U32 nodeIndex = stack[--stackCount];
+    const Node& node = mNodeList[nodeIndex];
+
+    // Loose node bounds extend half a cell beyond the cell on every side
+    Overlap overlap = overlapper.GetNodeOverlap(node.center, node.halfSize * 2.0f);
+    if (overlap == eOverlapNone) continue;
+    if (overlap == eOverlapFull)
+    {
+      AddNode(nodeIndex, result);
+      continue;
+    }
+
+    for (size_t i = 0; i < node.itemList.GetCount(); ++i)
+    {
+      if (overlapper.IsOverlapped(node.itemList[i])) result.PushBack(node.itemList[i].value);
+    }
+    if (node.firstChild != 0) for (U32 i = 0; i < 8; ++i) stack[stackCount++] = node.firstChild + i;
+  }
+}
+
+template <typename T>
+inline void LooseOctree<T>::RemoveItem(const Location& location)
+{
+  // Move the last node item into the removed position and redirect its location
+  Containers::List<Item>& itemList = mNodeList[location.node].itemList;
+  U32 lastIndex = static_cast<U32>(itemList.GetCount() - 1);
+  if (location.index != lastIndex) mLocationMap[itemList[lastIndex].handle].index = location.index;
+  itemList.RemoveIndexFast(location.index);
+}
+
+template <typename T>
+inline void LooseOctree<T>::Split(U32 nodeIndex)
+{
+  U32 firstChild = static_cast<U32>(mNodeList.GetCount());
+  Vector3f center = mNodeList[nodeIndex].center;
+  F32 halfSize = mNodeList[nodeIndex].halfSize * 0.5f;
+  U32 depth = mNodeList[nodeIndex].depth + 1;
+
+  for (U32 i = 0; i < 8; ++i)
+  {
+    Node child;
+    child.center.x = center.x + ((i & 1) ? halfSize : -halfSize);
+    child.center.y = center.y + ((i & 2) ? halfSize : -halfSize);
+    child.center.z = center.z + ((i & 4) ? halfSize : -halfSize);
+    child.halfSize = halfSize;
+    child.depth = depth;
+    child.firstChild = 0;
+    mNodeList.PushBack(child);
+  }
+  mNodeList[nodeIndex].firstChild = firstChild;
+
+  // Move down the node values fitting in a child (AddItem may split the children in turn)
+  Containers::List<Item> itemList(mNodeList[nodeIndex].itemList);
+  mNodeList[nodeIndex].itemList.Clear();
+  for (size_t i = 0; i < itemList.GetCount(); ++i) AddItem(FindNode(itemList[i].center, itemList[i].extents), itemList[i]);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+LooseOctree overlap functors
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+inline typename LooseOctree<T>::Overlap LooseOctree<T>::BoxOverlap::GetNodeOverlap(const Vector3f& nodeCenter, F32 nodeExtent) const
+{
+  F32 dx = Math::Abs(nodeCenter.x - center.x);
+  F32 dy = Math::Abs(nodeCenter.y - center.y);
+  F32 dz = Math::Abs(nodeCenter.z - center.z);
+  if (dx > extents.x + nodeExtent || dy > extents.y + nodeExtent || dz > extents.z + nodeExtent) return eOverlapNone;
+  if (dx + nodeExtent <= extents.x && dy + nodeExtent <= extents.y && dz + nodeExtent <= extents.z) return eOverlapFull;
+  return eOverlapPartial;
+}
+
+template <typename T>
+inline bool LooseOctree<T>::BoxOverlap::IsOverlapped(const Item& item) const
+{
+  return
+    Math::Abs(item.center.x - center.x) <= extents.x + item.extents.x &&
+    Math::Abs(item.center.y - center.y) <= extents.y + item.extents.y &&
+    Math::Abs(item.center.z - center.z) <= extents.z + item.extents.z;
+}
+
+template <typename T>
+inline typename LooseOctree<T>::Overlap LooseOctree<T>::SphereOverlap::GetNodeOverlap(const Vector3f& nodeCenter, F32 nodeExtent) const
+{
+  F32 dx = Math::Abs(nodeCenter.x - center.x);
+  F32 dy = Math::Abs(nodeCenter.y - center.y);
+  F32 dz = Math::Abs(nodeCenter.z - center.z);
+
+  // Closest box point distance decides the overlap, farthest box corner distance decides the containment
+  F32 ex = Math::Max(dx - nodeExtent, 0.0f);
+  F32 ey = Math::Max(dy - nodeExtent, 0.0f);
+  F32 ez = Math::Max(dz - nodeExtent, 0.0f);
+  F32 radiusSquared = radius * radius;
+  if (ex * ex + ey * ey + ez * ez > radiusSquared) return eOverlapNone;
+
+  dx += nodeExtent;
+  dy += nodeExtent;
+  dz += nodeExtent;
+  return (dx * dx + dy * dy + dz * dz <= radiusSquared) ? eOverlapFull : eOverlapPartial;
+}
+
+template <typename T>
+inline bool LooseOctree<T>::SphereOverlap::IsOverlapped(const Item& item) const
+{
+  F32 ex = Math::Max(Math::Abs(item.center.x - center.x) - item.extents.x, 0.0f);
+  F32 ey = Math::Max(Math::Abs(item.center.y - center.y) - item.extents.y, 0.0f);
+  F32 ez = Math::Max(Math::Abs(item.center.z - center.z) - item.extents.z, 0.0f);
+  return ex * ex + ey * ey + ez * ez <= radius * radius;
+}
+
+template <typename T>
+inline typename LooseOctree<T>::Overlap LooseOctree<T>::PlaneOverlap::GetNodeOverlap(const Vector3f& nodeCenter, F32 nodeExtent) const
+{
+  Overlap overlap = eOverlapFull;
+  for (U32 i = 0; i < planeCount; ++i)
+  {
+    const Vector3f& normal = pPlanes[i].GetNormal();
+    F32 distance = pPlanes[i].GetDistanceToPoint(nodeCenter);
+    F32 radius = nodeExtent * (Math::Abs(normal.x) + Math::Abs(normal.y) + Math::Abs(normal.z));
+    if (distance < -radius) return eOverlapNone;
+    if (distance < radius) overlap = eOverlapPartial;
+  }
+  return overlap;
+}
+
+template <typename T>
+inline bool LooseOctree<T>::PlaneOverlap::IsOverlapped(const Item& item) const
+{
+  for (U32 i = 0; i < planeCount; ++i)
+  {
+    const Vector3f& normal = pPlanes[i].GetNormal();
+    F32 radius =
+      Math::Abs(normal.x) * item.extents.x +
+      Math::Abs(normal.y) * item.extents.y +
+      Math::Abs(normal.z) * item.extents.z;
+    if (pPlanes[i].GetDistanceToPoint(item.center) < -radius) return false;
+  }
+  return true;
+}
+}
+}
+
+#endif
@@ -33,6 +33,18 @@ This file defines basic mathematic utility functions.
 #include <Base.h>
 #include <cmath>
 
+/*----------------------------------------------------------------------------------------------------------------------
+Macro definitions (E_SETTING_MATH_LOW_PRECISION)
+
+Please note that this macro has the following usage contract:
+
+1. When this macro is defined the F32 versions of SinCos and InvSqrt use the FastSinCos and FastInvSqrt approximations.
+These are the functions used by the quaternion rotation setters and the vector and quaternion Normalize methods, hence
+the whole object transformation path trades precision (about 1e-6 for sine and cosine and 1e-5 relative error for 
+normalization) for speed.
+2. This is a global library setting macro which can be predefined by the user.
+----------------------------------------------------------------------------------------------------------------------*/
+
 namespace E
 {
 namespace Math
@@ -93,13 +105,69 @@ inline T Normalize180(T deg) { deg = Normalize360(deg); return (deg > 180.0f) ?
 template<typename T>
 inline T Normalize360(T deg) { deg = std::fmod(deg, 360.0f); return (deg < 0.0f) ? deg + 360.0f : deg; }
 template<typename T>
+inline T InvSqrt(T v) { return static_cast<T>(1) / std::sqrt(v); }
+template<typename T>
 inline T Rad(T deg)   { return deg * static_cast<T>(kPiDiv180); }
 template<typename T>
 inline T Sin(T v)     { return std::sin(v); }
 template<typename T>
+inline void SinCos(T v, T& sin, T& cos) { sin = std::sin(v); cos = std::cos(v); }
+template<typename T>
 inline T Sqrt(T v)    { return std::sqrt(v); }
 template<typename T>
 inline T Tan(T v)     { return std::tan(v); }
+
+/*----------------------------------------------------------------------------------------------------------------------
+Math (fast approximations)
+
+Please note that these functions have the following usage contract: 
+
+1. FastSinCos reduces the angle to [-Pi/4, Pi/4] and evaluates minimax polynomials. The absolute error is below 1e-6 for
+angles within [-1e4, 1e4] radians and grows with the angle magnitude.
+2. FastInvSqrt refines the SSE reciprocal square root estimate with a Newton-Raphson step (about 1e-5 relative error).
+Non SIMD builds use the exact division.
+----------------------------------------------------------------------------------------------------------------------*/
+inline F32 FastInvSqrt(F32 v)
+{
+#ifdef E_SIMD_SSE2
+  const __m128 value = _mm_set_ss(v);
+  const __m128 estimate = _mm_rsqrt_ss(value);
+  // estimate * (1.5 - 0.5 * v * estimate^2)
+  const __m128 halfValue = _mm_mul_ss(value, _mm_set_ss(0.5f));
+  const __m128 correction = _mm_sub_ss(_mm_set_ss(1.5f), _mm_mul_ss(halfValue, _mm_mul_ss(estimate, estimate)));
+  return _mm_cvtss_f32(_mm_mul_ss(estimate, correction));
+#else
+  return 1.0f / std::sqrt(v);
+#endif
+}
+
+inline void FastSinCos(F32 v, F32& sin, F32& cos)
+{
+  // Quadrant index (rounded to nearest) and remainder (Pi/2 split in three parts to keep the reduction exact)
+  const I32 quadrant = static_cast<I32>(v * (2.0f / kPif) + (v >= 0.0f ? 0.5f : -0.5f));
+  const F32 q = static_cast<F32>(quadrant);
+  F32 r = v - q * 1.5703125f;
+  r -= q * 4.837512969970703125e-4f;
+  r -= q * 7.54978995489188216e-8f;
+
+  const F32 r2 = r * r;
+  const F32 s = r + r * r2 * (-1.6666654611e-1f + r2 * (8.3321608736e-3f + r2 * -1.9515295891e-4f));
+  const F32 c = 1.0f - 0.5f * r2 + r2 * r2 * (4.166664568298827e-2f + r2 * (-1.388731625493765e-3f + r2 * 2.443315711809948e-5f));
+
+  // Select and negate by quadrant without branches
+  const F32 sinValue = (quadrant & 1) ? c : s;
+  const F32 cosValue = (quadrant & 1) ? s : c;
+  sin = (quadrant & 2) ? -sinValue : sinValue;
+  cos = ((quadrant + 1) & 2) ? -cosValue : cosValue;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Math (precision dependent F32 overloads)
+----------------------------------------------------------------------------------------------------------------------*/
+#ifdef E_SETTING_MATH_LOW_PRECISION
+inline F32  InvSqrt(F32 v)                      { return FastInvSqrt(v); }
+inline void SinCos(F32 v, F32& sin, F32& cos)   { FastSinCos(v, sin, cos); }
+#endif
 }
 }
 
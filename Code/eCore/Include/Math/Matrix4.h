@@ -30,6 +30,7 @@ This file defines a 4x4 matrix class.
 #ifndef E_MATRIX4_H
 #define E_MATRIX4_H
 
+#include "Simd.h"
 #include "Vector3.h"
 
 namespace E
@@ -58,6 +59,9 @@ M = ( Rx  Ux  Fx )
     ( Rz  Uz  Fz )
 
 7. Operator *= does NOT perform a matrix multiplication but a matrix element per element multiplication.
+8. Matrix4 data is 16 byte aligned. When SSE2 is available the F32 version uses SIMD specializations for the matrix
+arithmetic, inversion, transposition and point / vector transformation methods. Results are bit exact with respect to
+the generic version (see E_SETTING_MATH_FUSED_MULTIPLY_ADD in Simd.h for the only exception).
 ----------------------------------------------------------------------------------------------------------------------*/
 template <typename T>
 class Matrix4
@@ -135,7 +139,7 @@ public:
   static Matrix4    Transpose(const Matrix4& m);
 
 private:
-  T m[16];
+  E_ALIGN(16) T m[16];
 
   // Relying on default copy constructor and assignment operator
 };
@@ -908,6 +912,220 @@ inline Matrix4<T> Matrix4<T>::Transpose(const Matrix4& m)
     m[2], m[6], m[10], m[14],
     m[3], m[7], m[11], m[15]);
 }
+
+#ifdef E_SIMD_SSE2
+/*----------------------------------------------------------------------------------------------------------------------
+Matrix4 F32 SIMD specializations
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <>
+inline Matrix4<F32> Matrix4<F32>::operator+(const Matrix4& other) const
+{
+  Matrix4<F32> result;
+  for (U32 i = 0; i < 16; i += 4) Simd::Store(&result.m[i], _mm_add_ps(Simd::Load(&m[i]), Simd::Load(&other.m[i])));
+  return result;
+}
+
+template <>
+inline Matrix4<F32> Matrix4<F32>::operator-() const
+{
+  const __m128 signMask = _mm_set1_ps(-0.0f);
+  Matrix4<F32> result;
+  for (U32 i = 0; i < 16; i += 4) Simd::Store(&result.m[i], _mm_xor_ps(Simd::Load(&m[i]), signMask));
+  return result;
+}
+
+template <>
+inline Matrix4<F32> Matrix4<F32>::operator-(const Matrix4& other) const
+{
+  Matrix4<F32> result;
+  for (U32 i = 0; i < 16; i += 4) Simd::Store(&result.m[i], _mm_sub_ps(Simd::Load(&m[i]), Simd::Load(&other.m[i])));
+  return result;
+}
+
+template <>
+inline Matrix4<F32> Matrix4<F32>::operator*(const Matrix4& other) const
+{
+  const __m128 r0 = Simd::Load(&other.m[0]);
+  const __m128 r1 = Simd::Load(&other.m[4]);
+  const __m128 r2 = Simd::Load(&other.m[8]);
+  const __m128 r3 = Simd::Load(&other.m[12]);
+  Matrix4<F32> result;
+  for (U32 i = 0; i < 16; i += 4) Simd::Store(&result.m[i], Simd::Transform(Simd::Load(&m[i]), r0, r1, r2, r3));
+  return result;
+}
+
+template <>
+inline Matrix4<F32> Matrix4<F32>::operator*(F32 scalar) const
+{
+  const __m128 s = _mm_set1_ps(scalar);
+  Matrix4<F32> result;
+  for (U32 i = 0; i < 16; i += 4) Simd::Store(&result.m[i], _mm_mul_ps(Simd::Load(&m[i]), s));
+  return result;
+}
+
+template <>
+inline Matrix4<F32>& Matrix4<F32>::operator*=(const Matrix4& other)
+{
+  for (U32 i = 0; i < 16; i += 4) Simd::Store(&m[i], _mm_mul_ps(Simd::Load(&m[i]), Simd::Load(&other.m[i])));
+  return (*this);
+}
+
+template <>
+inline Matrix4<F32>& Matrix4<F32>::operator*=(F32 scalar)
+{
+  const __m128 s = _mm_set1_ps(scalar);
+  for (U32 i = 0; i < 16; i += 4) Simd::Store(&m[i], _mm_mul_ps(Simd::Load(&m[i]), s));
+  return (*this);
+}
+
+template <>
+inline void Matrix4<F32>::Transpose()
+{
+  __m128 r0 = Simd::Load(&m[0]);
+  __m128 r1 = Simd::Load(&m[4]);
+  __m128 r2 = Simd::Load(&m[8]);
+  __m128 r3 = Simd::Load(&m[12]);
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+  Simd::Store(&m[0], r0);
+  Simd::Store(&m[4], r1);
+  Simd::Store(&m[8], r2);
+  Simd::Store(&m[12], r3);
+}
+
+template <>
+inline void Matrix4<F32>::AffineInvert()
+{
+  // Transpose the rotation part and compute the negative of the inverse rotated translation part (last row)
+  __m128 r0 = Simd::Load(&m[0]);
+  __m128 r1 = Simd::Load(&m[4]);
+  __m128 r2 = Simd::Load(&m[8]);
+  __m128 r3 = Simd::Load(&m[12]);
+  const __m128 translation = r3;
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+  const __m128 rotationMask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+  r0 = _mm_and_ps(r0, rotationMask);
+  r1 = _mm_and_ps(r1, rotationMask);
+  r2 = _mm_and_ps(r2, rotationMask);
+  r3 = _mm_mul_ps(Simd::Splat<0>(translation), r0);
+  r3 = Simd::MultiplyAdd(Simd::Splat<1>(translation), r1, r3);
+  r3 = Simd::MultiplyAdd(Simd::Splat<2>(translation), r2, r3);
+  r3 = _mm_or_ps(_mm_and_ps(_mm_xor_ps(r3, _mm_set1_ps(-0.0f)), rotationMask), _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
+  Simd::Store(&m[0], r0);
+  Simd::Store(&m[4], r1);
+  Simd::Store(&m[8], r2);
+  Simd::Store(&m[12], r3);
+}
+
+template <>
+inline void Matrix4<F32>::AffineInvertTranspose()
+{
+  // The transpose of the affine inverse
+  AffineInvert();
+  Transpose();
+}
+
+template <>
+inline Matrix4<F32> Matrix4<F32>::Invert(const Matrix4& m)
+{ 
+  // Vectorized version of the generic method keeping its operation order
+  const __m128 r0 = Simd::Load(&m.m[0]);
+  const __m128 r1 = Simd::Load(&m.m[4]);
+  const __m128 r2 = Simd::Load(&m.m[8]);
+  const __m128 r3 = Simd::Load(&m.m[12]);
+
+  // 2x2 sub-determinants (a0, a1, a2, a3), (a4, a5) of the upper rows and (b0, b1, b2, b3), (b4, b5) of the lower ones
+  const __m128 a = _mm_sub_ps(
+    _mm_mul_ps(_mm_shuffle_ps(r0, r0, _MM_SHUFFLE(1, 0, 0, 0)), _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(2, 3, 2, 1))),
+    _mm_mul_ps(_mm_shuffle_ps(r0, r0, _MM_SHUFFLE(2, 3, 2, 1)), _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(1, 0, 0, 0))));
+  const __m128 a45 = _mm_sub_ps(
+    _mm_mul_ps(_mm_shuffle_ps(r0, r0, _MM_SHUFFLE(2, 1, 2, 1)), _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(3, 3, 3, 3))),
+    _mm_mul_ps(_mm_shuffle_ps(r0, r0, _MM_SHUFFLE(3, 3, 3, 3)), _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(2, 1, 2, 1))));
+  const __m128 b = _mm_sub_ps(
+    _mm_mul_ps(_mm_shuffle_ps(r2, r2, _MM_SHUFFLE(1, 0, 0, 0)), _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(2, 3, 2, 1))),
+    _mm_mul_ps(_mm_shuffle_ps(r2, r2, _MM_SHUFFLE(2, 3, 2, 1)), _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(1, 0, 0, 0))));
+  const __m128 b45 = _mm_sub_ps(
+    _mm_mul_ps(_mm_shuffle_ps(r2, r2, _MM_SHUFFLE(2, 1, 2, 1)), _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(3, 3, 3, 3))),
+    _mm_mul_ps(_mm_shuffle_ps(r2, r2, _MM_SHUFFLE(3, 3, 3, 3)), _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(2, 1, 2, 1))));
+
+  F32 aList[6], bList[6];
+  Simd::Store(aList, a);
+  _mm_storel_pi(reinterpret_cast<__m64*>(aList + 4), a45);
+  Simd::Store(bList, b);
+  _mm_storel_pi(reinterpret_cast<__m64*>(bList + 4), b45);
+  F32 det = aList[0] * bList[5] - aList[1] * bList[4] + aList[2] * bList[3] + aList[3] * bList[2] - aList[4] * bList[1] + aList[5] * bList[0];
+
+  // See the generic version comments
+  if (det == 0.0f)
+  {
+    E_ASSERT_ALWAYS(E_ASSERT_MSG_MATH_NON_ZERO_VALUE);
+    return m;
+  }
+
+  // Columns arranged as (m[4 + i], m[i], m[12 + i], m[8 + i]) and sub-determinant pairs as (bi, bi, ai, ai)
+  const __m128 lowUpper = _mm_unpacklo_ps(r1, r0);
+  const __m128 highUpper = _mm_unpackhi_ps(r1, r0);
+  const __m128 lowLower = _mm_unpacklo_ps(r3, r2);
+  const __m128 highLower = _mm_unpackhi_ps(r3, r2);
+  const __m128 c0 = _mm_movelh_ps(lowUpper, lowLower);
+  const __m128 c1 = _mm_movehl_ps(lowLower, lowUpper);
+  const __m128 c2 = _mm_movelh_ps(highUpper, highLower);
+  const __m128 c3 = _mm_movehl_ps(highLower, highUpper);
+  const __m128 k0 = _mm_shuffle_ps(b, a, _MM_SHUFFLE(0, 0, 0, 0));
+  const __m128 k1 = _mm_shuffle_ps(b, a, _MM_SHUFFLE(1, 1, 1, 1));
+  const __m128 k2 = _mm_shuffle_ps(b, a, _MM_SHUFFLE(2, 2, 2, 2));
+  const __m128 k3 = _mm_shuffle_ps(b, a, _MM_SHUFFLE(3, 3, 3, 3));
+  const __m128 k4 = _mm_shuffle_ps(b45, a45, _MM_SHUFFLE(0, 0, 0, 0));
+  const __m128 k5 = _mm_shuffle_ps(b45, a45, _MM_SHUFFLE(1, 1, 1, 1));
+  const __m128 evenSign = _mm_castsi128_ps(_mm_set_epi32(0x80000000, 0, 0x80000000, 0));
+  const __m128 oddSign = _mm_castsi128_ps(_mm_set_epi32(0, 0x80000000, 0, 0x80000000));
+  const __m128 invDet = _mm_set1_ps(1 / det);
+
+  Matrix4<F32> inverse;
+  __m128 row = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(c1, k5), _mm_mul_ps(c2, k4)), _mm_mul_ps(c3, k3));
+  Simd::Store(&inverse.m[0], _mm_mul_ps(_mm_xor_ps(row, evenSign), invDet));
+  row = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(c0, k5), _mm_mul_ps(c2, k2)), _mm_mul_ps(c3, k1));
+  Simd::Store(&inverse.m[4], _mm_mul_ps(_mm_xor_ps(row, oddSign), invDet));
+  row = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(c0, k4), _mm_mul_ps(c1, k2)), _mm_mul_ps(c3, k0));
+  Simd::Store(&inverse.m[8], _mm_mul_ps(_mm_xor_ps(row, evenSign), invDet));
+  row = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(c0, k3), _mm_mul_ps(c1, k1)), _mm_mul_ps(c2, k0));
+  Simd::Store(&inverse.m[12], _mm_mul_ps(_mm_xor_ps(row, oddSign), invDet));
+  return inverse;
+}
+
+template <>
+inline Vector3<F32> Matrix4<F32>::RotateVector(const Matrix4& m, const Vector3<F32>& v)
+{
+  __m128 result = _mm_mul_ps(_mm_set1_ps(v.x), Simd::Load(&m.m[0]));
+  result = Simd::MultiplyAdd(_mm_set1_ps(v.y), Simd::Load(&m.m[4]), result);
+  result = Simd::MultiplyAdd(_mm_set1_ps(v.z), Simd::Load(&m.m[8]), result);
+  E_ALIGN(16) F32 resultList[4];
+  _mm_store_ps(resultList, result);
+  return Vector3<F32>(resultList[0], resultList[1], resultList[2]);
+}
+
+template <>
+inline Vector3<F32> Matrix4<F32>::TransformPoint(const Matrix4& m, const Vector3<F32>& p)
+{
+  __m128 result = _mm_mul_ps(_mm_set1_ps(p.x), Simd::Load(&m.m[0]));
+  result = Simd::MultiplyAdd(_mm_set1_ps(p.y), Simd::Load(&m.m[4]), result);
+  result = Simd::MultiplyAdd(_mm_set1_ps(p.z), Simd::Load(&m.m[8]), result);
+  result = _mm_add_ps(result, Simd::Load(&m.m[12]));
+  E_ALIGN(16) F32 resultList[4];
+  _mm_store_ps(resultList, result);
+  const F32 w = resultList[3];
+  const F32 invW = IsEqual(w, 0.0f) ? 1.0f : 1.0f / w;
+  return Vector3<F32>(resultList[0] * invW, resultList[1] * invW, resultList[2] * invW);
+}
+
+template <>
+inline Matrix4<F32> Matrix4<F32>::Transpose(const Matrix4& m)
+{
+  Matrix4<F32> result(m);
+  result.Transpose();
+  return result;
+}
+#endif
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,121 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+
+/** @file MeshOptimizer.h
+This file defines the MeshOptimizer class. MeshOptimizer reorders indexed triangle lists for vertex cache, overdraw and
+vertex fetch efficiency and simplifies them for level of detail generation.
+*/
+
+#ifndef E3_MESH_OPTIMIZER_H
+#define E3_MESH_OPTIMIZER_H
+
+#include <Base.h>
+#include "Vector3.h"
+
+/*----------------------------------------------------------------------------------------------------------------------
+Assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_MESH_OPTIMIZER_INDEX_COUNT     "Index count (%d) must be a multiple of 3"
+#define E_ASSERT_MSG_MESH_OPTIMIZER_INDEX_VALUE     "Vertex index (%d) is out of bounds"
+#define E_ASSERT_MSG_MESH_OPTIMIZER_IN_PLACE        "Vertex remapping cannot be done in place"
+
+namespace E
+{
+namespace Math
+{
+/*----------------------------------------------------------------------------------------------------------------------
+MeshOptimizer
+
+Please note that this class has the following usage contract:
+
+1. MeshOptimizer works on triangle lists given as raw index and vertex arrays so it can be used with any vertex layout
+and without a graphics device. The expected pipeline is: GenerateVertexRemap (weld), OptimizeVertexCache,
+OptimizeOverdraw and finally OptimizeVertexFetch.
+2. Remap tables map old vertex indices to new ones (pRemap[oldIndex] = newIndex). Vertices which are not referenced
+by the index array are mapped to kInvalidIndex. RemapVertices does not work in place (pResult must not be the source
+array) while RemapIndices and the index optimization methods do support pResult == pIndices.
+3. GenerateVertexRemap welds vertices whose vertexSize bytes are bitwise identical (so -0.0f and 0.0f are different
+values). New indices are assigned in first use order, so the result is also fetch ordered. A null pIndices welds a non
+indexed mesh (every vertex is referenced once in order).
+4. OptimizeVertexCache implements Tipsify (Sander, Nehab & Barczak, "Fast Triangle Reordering for Vertex Locality and
+Reduced Overdraw", 2007), which runs in linear time and targets a FIFO cache of cacheSize entries.
+5. OptimizeOverdraw expects a vertex cache optimized index array. It splits the triangles into clusters which do not
+increase the ACMR more than the supplied threshold (1.05f allows 5% more cache misses) and sorts them so that
+outward facing clusters on the mesh silhouette are drawn first.
+6. AnalyzeVertexCache simulates a FIFO cache and reports the ACMR (average cache miss ratio, transformed vertices per
+triangle: 0.5 is optimal for large regular meshes, 3 is the worst case) and the ATVR (average transformed vertex
+ratio, transformed vertices per referenced vertex: 1 is optimal).
+7. Simplify implements quadric error metric edge collapse (Garland & Heckbert, "Surface Simplification Using Quadric
+Error Metrics", 1997) collapsing vertices onto existing ones, so every simplified index array references the source
+vertex array (a LOD chain only adds indices). Errors are relative to the mesh extent (largest bounding box side), so
+a targetError of 0.01f allows 1% deviation. Open boundary vertices and vertices sharing their position with other
+vertices (attribute seams) are never removed, although other vertices can collapse onto them. Simplify stops when
+the index count reaches targetIndexCount, when the next collapse exceeds targetError or when no valid collapse is
+left, and returns the resulting index count (pResult requires room for indexCount indices).
+----------------------------------------------------------------------------------------------------------------------*/
+class MeshOptimizer
+{
+public:
+  static const U32 kInvalidIndex = 0xffffffff;
+  static const U32 kDefaultCacheSize = 16;
+
+  struct VertexCacheStatistics
+  {
+    VertexCacheStatistics() : transformedVertexCount(0), acmr(0.0f), atvr(0.0f) {}
+
+    U32 transformedVertexCount;
+    F32 acmr;
+    F32 atvr;
+  };
+
+  E_API static VertexCacheStatistics  AnalyzeVertexCache(const U32* pIndices, U32 indexCount, U32 vertexCount, U32 cacheSize = kDefaultCacheSize);
+  E_API static U32                    GenerateVertexRemap(U32* pRemap, const U32* pIndices, U32 indexCount, const void* pVertices, U32 vertexCount, size_t vertexSize);
+  E_API static void                   OptimizeOverdraw(U32* pResult, const U32* pIndices, U32 indexCount, const Vector3f* pPositions, U32 vertexCount, F32 threshold = 1.05f, U32 cacheSize = kDefaultCacheSize);
+  E_API static void                   OptimizeVertexCache(U32* pResult, const U32* pIndices, U32 indexCount, U32 vertexCount, U32 cacheSize = kDefaultCacheSize);
+  E_API static U32                    OptimizeVertexFetch(U32* pRemap, const U32* pIndices, U32 indexCount, U32 vertexCount);
+  E_API static void                   RemapIndices(U32* pResult, const U32* pIndices, U32 indexCount, const U32* pRemap);
+  E_API static U32                    Simplify(U32* pResult, const U32* pIndices, U32 indexCount, const Vector3f* pPositions, U32 vertexCount, U32 targetIndexCount, F32 targetError = 1.0f, F32* pResultError = nullptr);
+  template <typename T>
+  static void                         RemapVertices(T* pResult, const T* pVertices, U32 vertexCount, const U32* pRemap);
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+MeshOptimizer methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+void MeshOptimizer::RemapVertices(T* pResult, const T* pVertices, U32 vertexCount, const U32* pRemap)
+{
+  E_ASSERT_MSG(pResult != pVertices, E_ASSERT_MSG_MESH_OPTIMIZER_IN_PLACE);
+  for (U32 i = 0; i < vertexCount; ++i)
+  {
+    if (pRemap[i] != kInvalidIndex) pResult[pRemap[i]] = pVertices[i];
+  }
+}
+}
+}
+
+#endif
@@ -0,0 +1,256 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file ParallelSorting.h
+This file defines the ParallelSorting class. ParallelSorting implements a parallel merge sort on top of the thread pool.
+*/
+
+#ifndef E3_PARALLEL_SORTING_H
+#define E3_PARALLEL_SORTING_H
+
+#include <Math/Algorithm.h>
+#include <Threads/ThreadPool.h>
+#include <Threads/Thread.h>
+
+namespace E
+{
+namespace Math
+{
+/*----------------------------------------------------------------------------------------------------------------------
+ParallelSorting
+
+Please note that this class has the following usage contract:
+
+1. ParallelSorting splits the array in as many blocks as processors (up to kMaxTaskCount), sorts each block in a
+thread pool task using Sorting::IntroSort and merges the sorted blocks pairwise in log2(block count) rounds. Each merge
+is in turn split into independent output ranges (merge path partitioning) so all tasks are kept busy until the last
+round.
+2. A buffer of at least size elements is required as the merge is not in-place. Buffer content is undefined after
+sorting while the sorted result is always stored in the input array.
+3. Arrays smaller than kMinParallelSize (or single processor systems) are sorted in the calling thread.
+4. The calling thread blocks until the array is sorted. Therefore Sort must not be called from a task running in the
+same thread pool as it could wait forever for tasks that can not be scheduled.
+5. Blocks are sorted with an unstable algorithm so the sort is not stable (merges are).
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T, template<typename = T> class ComparerClass = Comparer>
+class ParallelSorting
+{
+public:
+  static void         Sort(T* ptr, T* pBuffer, size_t size, Threads::ThreadPool& threadPool = Threads::Global::GetThreadPool());
+
+private:
+  static const size_t kMaxTaskCount = 64;
+  static const size_t kMinParallelSize = 1 << 16;
+  static const size_t kMinTaskSize = 1 << 14;
+
+  class SortTask : public Threads::IRunnable
+  {
+  public:
+    T*                ptr;
+    size_t            size;
+
+    I32               Run();
+  };
+
+  class MergeTask : public Threads::IRunnable
+  {
+  public:
+    const T*          pSourceA;
+    const T*          pSourceB;
+    T*                pTarget;
+    size_t            sizeA;
+    size_t            sizeB;
+    size_t            startIndex;
+    size_t            endIndex;
+
+    I32               Run();
+  };
+
+  static size_t       FindMergePath(const T* pSourceA, size_t sizeA, const T* pSourceB, size_t sizeB, size_t index);
+  static void         RunTasks(Threads::IRunnable** pTaskList, size_t taskCount, Threads::ThreadPool& threadPool);
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+ParallelSorting methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, template<typename> class ComparerClass>
+inline void ParallelSorting<T, ComparerClass>::Sort(T* ptr, T* pBuffer, size_t size, Threads::ThreadPool& threadPool /* = Threads::Global::GetThreadPool() */)
+{
+  E_ASSERT_MSG(size > 1, E_ASSERT_MSG_MATH_GREATER_THAN_ONE_VALUE);
+  E_ASSERT_MSG(pBuffer && pBuffer != ptr, E_ASSERT_MSG_ALGORITHM_BUFFER_VALUE);
+  // Compute the task count as the greatest power of 2 not exceeding the processor count and the task limits
+  size_t maxTaskCount = Math::Min<size_t>(Math::Min<size_t>(Threads::Thread::GetProcessorCount(), kMaxTaskCount), size / kMinTaskSize);
+  size_t taskCount = 1;
+  while (taskCount * 2 <= maxTaskCount) taskCount *= 2;
+  if (size < kMinParallelSize || taskCount < 2)
+  {
+    Sorting<T, ComparerClass>::IntroSort(ptr, size);
+    return;
+  }
+
+  Threads::IRunnable* taskPtrList[kMaxTaskCount];
+  size_t blockIndexList[kMaxTaskCount + 1];
+  for (size_t i = 0; i < taskCount; ++i) blockIndexList[i] = (size / taskCount) * i;
+  blockIndexList[taskCount] = size;
+
+  // Sort blocks
+  SortTask sortTaskList[kMaxTaskCount];
+  for (size_t i = 0; i < taskCount; ++i)
+  {
+    sortTaskList[i].ptr = ptr + blockIndexList[i];
+    sortTaskList[i].size = blockIndexList[i + 1] - blockIndexList[i];
+    taskPtrList[i] = &sortTaskList[i];
+  }
+  RunTasks(taskPtrList, taskCount, threadPool);
+
+  // Merge blocks pairwise splitting each merge into taskCount / mergeCount tasks
+  MergeTask mergeTaskList[kMaxTaskCount];
+  T* pSource = ptr;
+  T* pTarget = pBuffer;
+  for (size_t blockStep = 1; blockStep < taskCount; blockStep *= 2)
+  {
+    size_t mergeCount = taskCount / (blockStep * 2);
+    size_t mergeTaskCount = taskCount / mergeCount;
+    for (size_t i = 0; i < mergeCount; ++i)
+    {
+      size_t startIndex = blockIndexList[i * blockStep * 2];
+      size_t middleIndex = blockIndexList[i * blockStep * 2 + blockStep];
+      size_t endIndex = blockIndexList[(i + 1) * blockStep * 2];
+      size_t mergeSize = endIndex - startIndex;
+      for (size_t j = 0; j < mergeTaskCount; ++j)
+      {
+        MergeTask& task = mergeTaskList[i * mergeTaskCount + j];
+        task.pSourceA = pSource + startIndex;
+        task.pSourceB = pSource + middleIndex;
+        task.pTarget = pTarget + startIndex;
+        task.sizeA = middleIndex - startIndex;
+        task.sizeB = endIndex - middleIndex;
+        task.startIndex = (mergeSize / mergeTaskCount) * j;
+        task.endIndex = (j + 1 == mergeTaskCount) ? mergeSize : (mergeSize / mergeTaskCount) * (j + 1);
+        taskPtrList[i * mergeTaskCount + j] = &task;
+      }
+    }
+    RunTasks(taskPtrList, taskCount, threadPool);
+    T* pTmp = pSource; pSource = pTarget; pTarget = pTmp;
+  }
+
+  // Copy back the result if the last round stored it in the buffer (merging with an empty block is a parallel copy)
+  if (pSource != ptr)
+  {
+    for (size_t i = 0; i < taskCount; ++i)
+    {
+      MergeTask& task = mergeTaskList[i];
+      task.pSourceA = pSource + blockIndexList[i];
+      task.pSourceB = pSource + blockIndexList[i + 1];
+      task.pTarget = ptr + blockIndexList[i];
+      task.sizeA = blockIndexList[i + 1] - blockIndexList[i];
+      task.sizeB = 0;
+      task.startIndex = 0;
+      task.endIndex = task.sizeA;
+    }
+    RunTasks(taskPtrList, taskCount, threadPool);
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ParallelSorting private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/**
+Finds the number of elements taken from A in the first index elements of the stable merge of A and B.
+*/
+template <typename T, template<typename> class ComparerClass>
+inline size_t ParallelSorting<T, ComparerClass>::FindMergePath(const T* pSourceA, size_t sizeA, const T* pSourceB, size_t sizeB, size_t index)
+{
+  size_t lowIndex = (index > sizeB) ? index - sizeB : 0;
+  size_t highIndex = (index < sizeA) ? index : sizeA;
+  while (lowIndex < highIndex)
+  {
+    size_t middleIndex = (lowIndex + highIndex) / 2;
+    // Elements from A go first on equality
+    if (ComparerClass<T>::IsLess(pSourceB[index - middleIndex - 1], pSourceA[middleIndex]))
+      highIndex = middleIndex;
+    else
+      lowIndex = middleIndex + 1;
+  }
+  return lowIndex;
+}
+
+template <typename T, template<typename> class ComparerClass>
+inline void ParallelSorting<T, ComparerClass>::RunTasks(Threads::IRunnable** pTaskList, size_t taskCount, Threads::ThreadPool& threadPool)
+{
+  // The last task is run by the calling thread (or any task the thread pool can not accept)
+  bool addedTaskList[kMaxTaskCount];
+  for (size_t i = 0; i < taskCount; ++i)
+  {
+    addedTaskList[i] = (i + 1 < taskCount) && threadPool.AddItem(pTaskList[i]);
+    if (!addedTaskList[i]) pTaskList[i]->Run();
+  }
+  for (size_t i = 0; i < taskCount; ++i)
+  {
+    if (addedTaskList[i]) threadPool.WaitForItem(pTaskList[i]);
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ParallelSorting::SortTask methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, template<typename> class ComparerClass>
+inline I32 ParallelSorting<T, ComparerClass>::SortTask::Run()
+{
+  if (size > 1) Sorting<T, ComparerClass>::IntroSort(ptr, size);
+  return 0;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ParallelSorting::MergeTask methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, template<typename> class ComparerClass>
+inline I32 ParallelSorting<T, ComparerClass>::MergeTask::Run()
+{
+  // Locate the source ranges producing the [startIndex, endIndex) target range
+  size_t indexA = FindMergePath(pSourceA, sizeA, pSourceB, sizeB, startIndex);
+  size_t endIndexA = FindMergePath(pSourceA, sizeA, pSourceB, sizeB, endIndex);
+  size_t indexB = startIndex - indexA;
+  size_t endIndexB = endIndex - endIndexA;
+  T* pTargetIt = pTarget + startIndex;
+  while (indexA < endIndexA && indexB < endIndexB)
+  {
+    if (ComparerClass<T>::IsLess(pSourceB[indexB], pSourceA[indexA]))
+      *pTargetIt++ = pSourceB[indexB++];
+    else
+      *pTargetIt++ = pSourceA[indexA++];
+  }
+  while (indexA < endIndexA) *pTargetIt++ = pSourceA[indexA++];
+  while (indexB < endIndexB) *pTargetIt++ = pSourceB[indexB++];
+  return 0;
+}
+}
+}
+
+#endif
@@ -91,7 +91,7 @@ inline Plane<T>::Plane(T a, T b, T c, T d)
 template <typename T> 
 inline Plane<T>::Plane(const Vector3<T>& normal, T distance)
   : mNormal(normal.x, normal.y, normal.z)
-  , mDistance(d)
+  , mDistance(distance)
 {}
 
 // Normal and point in plane constructor
@@ -100,7 +100,7 @@ inline Plane<T>::Plane(const Vector3<T>& normal, const Vector3<T>& pointInPlane)
   : mNormal(normal.x, normal.y, normal.z)
   , mDistance(0)
 {
-  mDistance = -Vector3<T>::DotProduct(mNormal, Vector3<T>(pointInPlane.x, pointInPlane.y, pointInPlane.z));
+  mDistance = -Vector3<T>::Dot(mNormal, Vector3<T>(pointInPlane.x, pointInPlane.y, pointInPlane.z));
 }
 
 // 3 plane points constructor
@@ -112,7 +112,7 @@ inline Plane<T>::Plane(const Vector3<T>& pointInPlaneA, const Vector3<T>& pointI
     pointInPlaneA.x - pointInPlaneB.x,
     pointInPlaneA.y - pointInPlaneB.y,
     pointInPlaneA.z - pointInPlaneB.z);
-  Vector3<T> v2>(
+  Vector3<T> v2(
     pointInPlaneC.x - pointInPlaneB.x,
     pointInPlaneC.y - pointInPlaneB.y,
     pointInPlaneC.z - pointInPlaneB.z);
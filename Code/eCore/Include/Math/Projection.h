@@ -24,7 +24,8 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 // $Author: $
 
 /** @file Projection.h
-This file defines utility functions for computing orthographic and perspective projection matrices.
+This file defines utility functions for computing orthographic and perspective projection matrices and projected
+sizes.
 */
 #ifndef E3_PROJECTION_H
 #define E3_PROJECTION_H
@@ -41,6 +42,9 @@ Math (projection)
 Please note that Math conversion functions have the following usage contract: 
 
 1. BuildPerspectiveLH and BuildPerspectiveRH fov argument value must be expressed in degrees.
+2. GetProjectedSize returns the projected height of a sphere of the given radius at the given view distance as a 
+fraction of the viewport height (1.0f fills the viewport). Perspective matrices are detected by a zero [15] element. 
+Spheres containing the eye are clamped to their radius distance.
 ----------------------------------------------------------------------------------------------------------------------*/
 static const U32 kMaxFieldOfView = 120;
 static const U32 kMinFieldOfView = 10;
@@ -49,6 +53,7 @@ Matrix4f	BuildOrthographicLH(U32 width, U32 height, F32 nearZ, F32 farZ);
 Matrix4f	BuildOrthographicRH(U32 width, U32 height, F32 nearZ, F32 farZ);
 Matrix4f	BuildPerspectiveLH(U32 fov, F32 aspectRatio, F32 nearZ, F32 farZ);
 Matrix4f	BuildPerspectiveRH(U32 fov, F32 aspectRatio, F32 nearZ, F32 farZ);
+F32       GetProjectedSize(const Matrix4f& projectionMatrix, F32 radius, F32 distance);
 
 /*----------------------------------------------------------------------------------------------------------------------
 Math methods (projection)
@@ -185,6 +190,17 @@ inline Matrix4f BuildPerspectiveRH(U32 fov, F32 aspectRatio, F32 nearZ, F32 farZ
 
   return projectionMatrix;
 }
+
+inline F32 GetProjectedSize(const Matrix4f& projectionMatrix, F32 radius, F32 distance)
+{
+  // The y scale maps the view space height to [-1, 1] so the sphere diameter covers radius * yScale of the viewport
+  F32 projectedSize = radius * projectionMatrix[5];
+
+  // Perspective matrices divide by the view distance (w)
+  if (projectionMatrix[15] == 0.0f) projectedSize /= Math::Max(distance, radius);
+
+  return projectedSize;
+}
 }
 }
 
@@ -49,6 +49,10 @@ Please note that this class has the following usage contract:
 2. The two vectors version of SetRotation requires unit vectors.
 3. The chosen rotation order for Euler angles is Roll Pitch Yaw (Z, X, Y) which is the same as in the DirectX SDK 
 function D3DXQuaternionRotationYawPitchRoll.
+4. GetTransform builds the whole scale * rotation * translation matrix (SRT) in a single pass, whereas GetRotation only
+writes the 3x3 rotation part. Both expect a unit quaternion.
+5. The rotation setters and Normalize use Math::SinCos and Math::InvSqrt, hence they use fast approximations when
+E_SETTING_MATH_LOW_PRECISION is defined.
 
 Note: quaternions do not have handness although to be consistent with Matrix4 rotations, a rotation order must be 
 used consistently for Euler angles.
@@ -81,6 +85,7 @@ struct Quaternion
   T                 GetLength() const;
   T                 GetLengthSquared() const;
   void              GetRotation(Matrix4<T>& m) const;
+  void              GetTransform(Matrix4<T>& m, const Vector3<T>& scale, const Vector3<T>& translation) const;
   bool              IsIdentity() const;
   void              Set(T x, T y, T z, T w);
   void              SetIdentity();
@@ -322,6 +327,44 @@ inline void Quaternion<T>::GetRotation(Matrix4<T>& m) const
   m[10] = static_cast<T>(1) - (xx + yy);
 }
 
+// Gets the equivalent scale * rotation * translation matrix.
+template <class T>
+inline void Quaternion<T>::GetTransform(Matrix4<T>& m, const Vector3<T>& scale, const Vector3<T>& translation) const
+{
+  // Same products as GetRotation
+  const T s = static_cast<T>(2);
+  const T xx = x * x * s;
+  const T yy = y * y * s;
+  const T zz = z * z * s;
+  const T xy = x * y * s;
+  const T xz = x * z * s;
+  const T yz = y * z * s;
+  const T wx = w * x * s;
+  const T wy = w * y * s;
+  const T wz = w * z * s;
+
+  // Each rotation row is scaled by its axis scale factor (Matrix4::Scale)
+  m[0]  = (static_cast<T>(1) - (yy + zz)) * scale.x;
+  m[1]  = (xy + wz) * scale.x;
+  m[2]  = (xz - wy) * scale.x;
+  m[3]  = static_cast<T>(0);
+
+  m[4]  = (xy - wz) * scale.y;
+  m[5]  = (static_cast<T>(1) - (xx + zz)) * scale.y;
+  m[6]  = (yz + wx) * scale.y;
+  m[7]  = static_cast<T>(0);
+
+  m[8]  = (xz + wy) * scale.z;
+  m[9]  = (yz - wx) * scale.z;
+  m[10] = (static_cast<T>(1) - (xx + yy)) * scale.z;
+  m[11] = static_cast<T>(0);
+
+  m[12] = translation.x;
+  m[13] = translation.y;
+  m[14] = translation.z;
+  m[15] = static_cast<T>(1);
+}
+
 template <typename T>
 inline bool Quaternion<T>::IsIdentity() const
 {
@@ -392,12 +435,10 @@ inline void Quaternion<T>::SetRotation(T pitch, T yaw, T roll)
   const T hx = static_cast<T> (0.5 * pitch);
   const T hy = static_cast<T> (0.5 * yaw);
   const T hz = static_cast<T> (0.5 * roll);
-  const T sinR = Math::Sin(hz);
-  const T cosR = Math::Cos(hz);
-  const T sinY = Math::Sin(hy);
-  const T cosY = Math::Cos(hy);
-  const T sinP = Math::Sin(hx);
-  const T cosP = Math::Cos(hx);
+  T sinR, cosR, sinY, cosY, sinP, cosP;
+  Math::SinCos(hz, sinR, cosR);
+  Math::SinCos(hy, sinY, cosY);
+  Math::SinCos(hx, sinP, cosP);
   /*
   // Pitch Yaw Roll
   x = sinP * cosY * cosR + cosP * sinY * sinR;
@@ -422,11 +463,12 @@ template <class T>
 inline void Quaternion<T>::SetRotation(T radians, const Vector3<T>& axis)
 {
   const T halfa = radians * static_cast<T>(0.5);
-  const T s = Math::Sin(halfa);
+  T s, c;
+  Math::SinCos(halfa, s, c);
   x = axis.x * s;
   y = axis.y * s;
   z = axis.z * s;
-  w = Math::Cos(halfa);
+  w = c;
 }
 
 // Sets the shortest rotation between between two vectors
@@ -452,12 +494,12 @@ Quaternion methods
 template <class T>
 inline void Quaternion<T>::Normalize()
 {
-  T length = GetLength();
-  E_ASSERT_MSG(!IsEqual(length, static_cast<T>(0)), E_ASSERT_MSG_MATH_EQUAL_TO_ZERO_VALUE);
-  if (IsEqual(length, static_cast<T>(1))) 
+  T lengthSquared = GetLengthSquared();
+  E_ASSERT_MSG(!IsEqual(lengthSquared, static_cast<T>(0)), E_ASSERT_MSG_MATH_EQUAL_TO_ZERO_VALUE);
+  if (IsEqual(lengthSquared, static_cast<T>(1))) 
     return;
 
-  (*this) *= static_cast<T>(1) / length;
+  (*this) *= Math::InvSqrt(lengthSquared);
 }
 
 template <typename T>
@@ -24,7 +24,8 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 // $Author: $
 
 /** @file RandomNumberGenerator.h
-This file declares the RandomNumberGenerator class for random number generation.
+This file declares the RandomNumberGenerator class for random number generation and the RandomStream class for fast 
+per thread random number generation.
 */
 
 #ifndef E3_RANDOM_H
@@ -32,7 +33,7 @@ This file declares the RandomNumberGenerator class for random number generation.
 
 #include <Base.h>
 #include <Time/Time.h>
-#include <Base.h>
+#include "Comparison.h"
 
 namespace E 
 {
@@ -54,6 +55,13 @@ RandomNumberGenerator
 
 RandomNumberGenerator implements the Mersenne Twister pseudo-random number generator developed in 1997 by Makoto 
 Matsumoto and Takuji Nishimura. More info at: http:// en.wikipedia.org/wiki/Mersenne_twister
+
+Please note that this class has the following usage contract:
+
+1. The array versions of GetF32 and GetU32 produce the same sequence as the equivalent number of single calls. They
+regenerate the state vector and temper the numbers 4 words at a time with SSE2.
+2. RandomNumberGenerator is not thread safe (neither is the Global::GetRandom instance). Use a RandomStream per thread
+when numbers are generated from several threads.
 ----------------------------------------------------------------------------------------------------------------------*/
 class RandomNumberGenerator
 {
@@ -64,8 +72,10 @@ public:
   bool	GetBool();
   F32		GetF32();
   F32		GetF32(F32 min, F32 max);
+  void  GetF32(F32* pResult, size_t count, F32 min, F32 max);
   I32		GetI32(I32 min, I32 max);
   U32		GetU32(U32 range);
+  void  GetU32(U32* pResult, size_t count, U32 range);
   void	SetSeed(U32 v);
   U32		GetSeed() const;
 
@@ -76,24 +86,79 @@ private:
   static const U32 kN = 624;
   static const U32 kM = 397;
   static const U32 kUndefinedIndexValue = 625;
-  static const U64 kMatrixA = 0x9908b0df;         // Constant vector a
-  static const U64 kUpperMask = 0x80000000;       // Most significant w-r bits
-  static const U64 kLowerMask = 0x7fffffff;       // Least significant r bits 
-  static const U64 kTemperingMaskB = 0x9d2c5680;  // Most significant w-r bits
-  static const U64 kTemperingMaskC = 0xefc60000;  // Least significant r bits
-  static const U64 kMaxValue = 0xffffffff; 
-  static const U64 kOne = 0x1; 
-  static const U64 kZero = 0x0; 
+  static const U32 kMatrixA = 0x9908b0df;         // Constant vector a
+  static const U32 kUpperMask = 0x80000000;       // Most significant w-r bits
+  static const U32 kLowerMask = 0x7fffffff;       // Least significant r bits 
+  static const U32 kTemperingMaskB = 0x9d2c5680;  // Most significant w-r bits
+  static const U32 kTemperingMaskC = 0xefc60000;  // Least significant r bits
+  static const U32 kMaxValue = 0xffffffff; 
   static const U32 kDefaultInitialSeed = 4357;
   static const U32 kDefaultSeedFactor = 69069;
+  static const U32 kBlockSize = 64;
 
-  U64 	mMt[624];	// the Mersenne twister state vector
+  U32 	mMt[624];	// the Mersenne twister state vector
   I32		mMtIndex;	// the Mersenne twister state vector index
   U32		mSeed;
 
+  void  GetTempered(U32* pResult, size_t count);
+  void  Regenerate();
+  U32   Temper(U32 y) const;
+  void  Twist(U32 index, U32 nextIndex, U32 sourceIndex);
+#ifdef E_SIMD_SSE2
+  void  Twist4(U32 index, U32 sourceIndex);
+#endif
+
   E_DISABLE_COPY_AND_ASSSIGNMENT(RandomNumberGenerator)
 };
 
+/*----------------------------------------------------------------------------------------------------------------------
+RandomStream
+
+RandomStream implements the xoshiro256** pseudo-random number generator developed in 2018 by David Blackman and 
+Sebastiano Vigna. More info at: http://prng.di.unimi.it
+
+Please note that this class has the following usage contract:
+
+1. RandomStream is a small copyable value (256 bits of state) intended to be owned by a single thread. It is much 
+faster than RandomNumberGenerator and has a period of 2^256 - 1.
+2. Jump advances the stream 2^128 numbers and LongJump 2^192 numbers. The constructor and SetSeed apply streamIndex jumps
+so that RandomStream(seed, i) gives non overlapping streams for up to 2^128 threads or tasks sharing the same seed.
+3. GetU32(range) and GetI32 use an unbiased multiply and shift range reduction instead of modulo. A range of 0 returns 0
+without advancing the stream.
+4. GetF32() returns a value in [0, 1) and GetI32 a value in [min, max).
+5. The array versions of GetF32 and GetU32 produce the same sequence as the equivalent number of single calls.
+----------------------------------------------------------------------------------------------------------------------*/
+class RandomStream
+{
+public:
+  static const U64 kDefaultSeed = 4357;
+
+  explicit RandomStream(U64 seed = kDefaultSeed, U32 streamIndex = 0);
+
+  // Accessors
+  bool  GetBool();
+  F32   GetF32();
+  F32   GetF32(F32 min, F32 max);
+  void  GetF32(F32* pResult, size_t count, F32 min, F32 max);
+  I32   GetI32(I32 min, I32 max);
+  U32   GetU32(U32 range);
+  void  GetU32(U32* pResult, size_t count, U32 range);
+  U64   GetU64();
+  U64   GetSeed() const;
+  void  SetSeed(U64 seed, U32 streamIndex = 0);
+
+  // Methods
+  void  Jump();
+  void  LongJump();
+
+private:
+  U64   mState[4];
+  U64   mSeed;
+
+  void        Jump(const U64* pPolynomial);
+  static U64  RotateLeft(U64 x, U32 bits) { return (x << bits) | (x >> (64 - bits)); }
+};
+
 /*----------------------------------------------------------------------------------------------------------------------
 RandomNumberGenerator initialization & finalization
 ----------------------------------------------------------------------------------------------------------------------*/	
@@ -126,6 +191,45 @@ inline F32 RandomNumberGenerator::GetF32(F32 min, F32 max)
   return random;
 }
 
+/** Generates count F32 random numbers between min and max (the same as count GetF32(min, max) calls).
+@param pResult the result array.
+@param count the number of random numbers.
+@param min the minimum value.
+@param max the maximum value.
+@throw nothing.
+*/
+inline void RandomNumberGenerator::GetF32(F32* pResult, size_t count, F32 min, F32 max)
+{
+  const F32 kScale = 1.0f / static_cast<F32>(kMaxValue);
+  const F32 range = max - min;
+  U32 block[kBlockSize];
+
+  for (size_t i = 0; i < count; i += kBlockSize)
+  {
+    const size_t blockCount = Math::Min(count - i, static_cast<size_t>(kBlockSize));
+    GetTempered(block, blockCount);
+    size_t j = 0;
+#ifdef E_SIMD_SSE2
+    const __m128i lowMask = _mm_set1_epi32(0xFFFF);
+    const __m128 high = _mm_set1_ps(65536.0f);
+    for (; j + 4 <= blockCount; j += 4)
+    {
+      // GetU32(kMaxValue) maps the maximum value to 0, then an exact unsigned conversion using two signed 16-bit halves
+      __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + j));
+      y = _mm_andnot_si128(_mm_cmpeq_epi32(y, _mm_set1_epi32(-1)), y);
+      const __m128 value = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(y, 16)), high), _mm_cvtepi32_ps(_mm_and_si128(y, lowMask)));
+      const __m128 random = _mm_mul_ps(value, _mm_set1_ps(kScale));
+      _mm_storeu_ps(pResult + i + j, _mm_add_ps(_mm_set1_ps(min), _mm_mul_ps(random, _mm_set1_ps(range))));
+    }
+#endif
+    for (; j < blockCount; ++j)
+    {
+      const F32 random = static_cast<F32>(block[j] % kMaxValue) / kMaxValue;
+      pResult[i + j] = min + random * range;
+    }
+  }
+}
+
 inline bool RandomNumberGenerator::GetBool()
 {
   return (GetU32(2) == 1);
@@ -143,70 +247,295 @@ inline I32 RandomNumberGenerator::GetI32(I32 min, I32 max)
 */
 inline U32 RandomNumberGenerator::GetU32(U32 range)
 {
-  U32 random = 0;
+  if (range == 0) return 0;
+  if (mMtIndex >= kN) Regenerate();
+
+  return Temper(mMt[mMtIndex++]) % range;
+}
+
+/** Generates count U32 random numbers between 0 and the specified value (the same as count GetU32(range) calls).
+@param pResult the result array.
+@param count the number of random numbers.
+@param range the specified random number generation range.
+@throw nothing.
+*/
+inline void RandomNumberGenerator::GetU32(U32* pResult, size_t count, U32 range)
+{
+  if (range == 0)
+  {
+    for (size_t i = 0; i < count; ++i) pResult[i] = 0;
+    return;
+  }
 
-  if (range != 0)
+  GetTempered(pResult, count);
+  if (Math::IsPower2(range))
   {
-    U64 y = 0;
-    static U64 mag01[2] = {kZero, kMatrixA}; // mag01[x] = x * kMatrixA
+    for (size_t i = 0; i < count; ++i) pResult[i] &= range - 1;
+  }
+  else
+  {
+    for (size_t i = 0; i < count; ++i) pResult[i] %= range;
+  }
+}
+
+inline U32 RandomNumberGenerator::GetSeed() const
+{
+  return mSeed;
+}
 
-    if (mMtIndex >= kN) 
-    { 
-      I32 kk;
+inline void RandomNumberGenerator::SetSeed(U32 v) 
+{
+  mMt[0] = v;
+  for (mMtIndex = 1; mMtIndex < kN; ++ mMtIndex)
+    mMt[mMtIndex] = kDefaultSeedFactor * mMt[mMtIndex - 1];
 
-      if (mMtIndex == kUndefinedIndexValue)
-        SetSeed(kDefaultInitialSeed);
+  mSeed = v;
+}
 
-      for (kk = 0; kk < kN - kM; ++kk) 
-      {
-        y = (mMt[kk] & kUpperMask) | (mMt[kk + 1] & kLowerMask);
-        mMt[kk] = mMt[kk + kM] ^ (y >> 1) ^ mag01[y & kOne];
-      }
-      for (; kk < kN - 1; ++kk)
-      {
-        y = (mMt[kk] & kUpperMask) | (mMt[kk + 1] & kLowerMask);
-        mMt[kk] = mMt[kk + (kM - kN)] ^ (y >> 1) ^ mag01[y & kOne];
-      }
+/*----------------------------------------------------------------------------------------------------------------------
+RandomNumberGenerator methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void RandomNumberGenerator::RandomizeSeed()
+{
+  SetSeed(static_cast<U32>(Time::GetCurrentTime().GetMilliseconds()));
+}
 
-      y = (mMt[kN - 1] & kUpperMask) | (mMt[0] & kLowerMask);
-      mMt[kN - 1] = mMt[kM - 1] ^ (y >> 1) ^ mag01[y & kOne];
+/*----------------------------------------------------------------------------------------------------------------------
+RandomNumberGenerator private methods
+----------------------------------------------------------------------------------------------------------------------*/
 
-      mMtIndex = 0;
+/** Copies count tempered words of the state vector, regenerating it when needed.
+*/
+inline void RandomNumberGenerator::GetTempered(U32* pResult, size_t count)
+{
+  for (size_t i = 0; i < count;)
+  {
+    if (mMtIndex >= kN) Regenerate();
+    const size_t blockCount = Math::Min(count - i, static_cast<size_t>(kN - mMtIndex));
+    const U32* pSource = mMt + mMtIndex;
+    size_t j = 0;
+#ifdef E_SIMD_SSE2
+    const __m128i maskB = _mm_set1_epi32(static_cast<I32>(kTemperingMaskB));
+    const __m128i maskC = _mm_set1_epi32(static_cast<I32>(kTemperingMaskC));
+    for (; j + 4 <= blockCount; j += 4)
+    {
+      __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSource + j));
+      y = _mm_xor_si128(y, _mm_srli_epi32(y, 11));
+      y = _mm_xor_si128(y, _mm_and_si128(_mm_slli_epi32(y, 7), maskB));
+      y = _mm_xor_si128(y, _mm_and_si128(_mm_slli_epi32(y, 15), maskC));
+      y = _mm_xor_si128(y, _mm_srli_epi32(y, 18));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(pResult + i + j), y);
     }
+#endif
+    for (; j < blockCount; ++j) pResult[i + j] = Temper(pSource[j]);
+    mMtIndex += static_cast<I32>(blockCount);
+    i += blockCount;
+  }
+}
 
-    y = mMt[mMtIndex++];
-    y ^= (y >> 11);
-    y ^= (y << 7) & kTemperingMaskB;
-    y ^= (y << 15) & kTemperingMaskC;
-    y ^= (y >> 18);
+/** Regenerates the whole state vector (initializing it with the default seed if no seed has been set).
+*/
+inline void RandomNumberGenerator::Regenerate()
+{
+  if (mMtIndex == kUndefinedIndexValue)
+    SetSeed(kDefaultInitialSeed);
+
+  U32 kk = 0;
+#ifdef E_SIMD_SSE2
+  // The words read by a block of 4 (kk + 1 and the source word) are never written by the same block
+  for (; kk + 4 <= kN - kM; kk += 4) Twist4(kk, kk + kM);
+  for (; kk < kN - kM; ++kk) Twist(kk, kk + 1, kk + kM);
+  for (; kk + 4 <= kN - 1; kk += 4) Twist4(kk, kk + kM - kN);
+#endif
+  for (; kk < kN - kM; ++kk) Twist(kk, kk + 1, kk + kM);
+  for (; kk < kN - 1; ++kk) Twist(kk, kk + 1, kk + kM - kN);
+  Twist(kN - 1, 0, kM - 1);
 
-    random = (y % range);
+  mMtIndex = 0;
+}
+
+inline U32 RandomNumberGenerator::Temper(U32 y) const
+{
+  y ^= (y >> 11);
+  y ^= (y << 7) & kTemperingMaskB;
+  y ^= (y << 15) & kTemperingMaskC;
+  y ^= (y >> 18);
+
+  return y;
+}
+
+inline void RandomNumberGenerator::Twist(U32 index, U32 nextIndex, U32 sourceIndex)
+{
+  const U32 y = (mMt[index] & kUpperMask) | (mMt[nextIndex] & kLowerMask);
+  mMt[index] = mMt[sourceIndex] ^ (y >> 1) ^ ((y & 1) ? kMatrixA : 0);
+}
+
+#ifdef E_SIMD_SSE2
+inline void RandomNumberGenerator::Twist4(U32 index, U32 sourceIndex)
+{
+  const __m128i current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mMt + index));
+  const __m128i next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mMt + index + 1));
+  const __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mMt + sourceIndex));
+  const __m128i y = _mm_or_si128(
+    _mm_and_si128(current, _mm_set1_epi32(static_cast<I32>(kUpperMask))), 
+    _mm_and_si128(next, _mm_set1_epi32(static_cast<I32>(kLowerMask))));
+  // (y & 1) * kMatrixA: 0 - (y & 1) is either 0 or all bits set
+  const __m128i matrixA = _mm_and_si128(
+    _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(y, _mm_set1_epi32(1))), 
+    _mm_set1_epi32(static_cast<I32>(kMatrixA)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(mMt + index), _mm_xor_si128(_mm_xor_si128(source, _mm_srli_epi32(y, 1)), matrixA));
+}
+#endif
+
+/*----------------------------------------------------------------------------------------------------------------------
+RandomStream initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/	
+
+inline RandomStream::RandomStream(U64 seed /* = kDefaultSeed */, U32 streamIndex /* = 0 */)
+{
+  SetSeed(seed, streamIndex);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+RandomStream accessors
+----------------------------------------------------------------------------------------------------------------------*/	
+
+inline bool RandomStream::GetBool()
+{
+  return (GetU64() >> 63) != 0;
+}
+
+inline F32 RandomStream::GetF32()
+{
+  // 24 bits (the F32 mantissa precision) so that every value is exact and 1 is never reached
+  return static_cast<F32>(GetU64() >> 40) * (1.0f / 16777216.0f);
+}
+
+inline F32 RandomStream::GetF32(F32 min, F32 max)
+{
+  return min + GetF32() * (max - min);
+}
+
+inline void RandomStream::GetF32(F32* pResult, size_t count, F32 min, F32 max)
+{
+  const F32 range = max - min;
+  for (size_t i = 0; i < count; ++i) pResult[i] = min + GetF32() * range;
+}
+
+inline I32 RandomStream::GetI32(I32 min, I32 max)
+{
+  if (max <= min) return min;
+  return static_cast<I32>(static_cast<I64>(min) + GetU32(static_cast<U32>(static_cast<I64>(max) - static_cast<I64>(min))));
+}
+
+/** Generates an U32 random number between 0 and the specified value (not included).
+Implementation based on: Fast Random Integer Generation in an Interval by Daniel Lemire (2019).
+@param range the specified random number generation range.
+@return an U32.
+@throw nothing.
+*/
+inline U32 RandomStream::GetU32(U32 range)
+{
+  if (range == 0) return 0;
+
+  U64 m = (GetU64() >> 32) * range;
+  U32 low = static_cast<U32>(m);
+  if (low < range)
+  {
+    // Reject the values which would make some results more likely than others
+    const U32 threshold = (0u - range) % range;
+    while (low < threshold)
+    {
+      m = (GetU64() >> 32) * range;
+      low = static_cast<U32>(m);
+    }
   }
 
-  return random;
+  return static_cast<U32>(m >> 32);
 }
 
-inline U32 RandomNumberGenerator::GetSeed() const
+inline void RandomStream::GetU32(U32* pResult, size_t count, U32 range)
+{
+  for (size_t i = 0; i < count; ++i) pResult[i] = GetU32(range);
+}
+
+inline U64 RandomStream::GetU64()
+{
+  const U64 result = RotateLeft(mState[1] * 5, 7) * 9;
+  const U64 t = mState[1] << 17;
+
+  mState[2] ^= mState[0];
+  mState[3] ^= mState[1];
+  mState[1] ^= mState[2];
+  mState[0] ^= mState[3];
+  mState[2] ^= t;
+  mState[3] = RotateLeft(mState[3], 45);
+
+  return result;
+}
+
+inline U64 RandomStream::GetSeed() const
 {
   return mSeed;
 }
 
-inline void RandomNumberGenerator::SetSeed(U32 v) 
+/** Sets the seed. The state is initialized with the SplitMix64 generator (as recommended by the authors) so that any
+seed value, including 0, gives a valid state.
+@param seed the seed.
+@param streamIndex the number of jumps to apply.
+@throw nothing.
+*/
+inline void RandomStream::SetSeed(U64 seed, U32 streamIndex /* = 0 */)
 {
-  mMt[0] = v & kMaxValue;
-  for (mMtIndex = 1; mMtIndex < kN; ++ mMtIndex)
-    mMt[mMtIndex] = (kDefaultSeedFactor * mMt[mMtIndex - 1]) & kMaxValue;
+  U64 x = seed;
+  for (U32 i = 0; i < 4; ++i)
+  {
+    U64 z = (x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    mState[i] = z ^ (z >> 31);
+  }
+  for (U32 i = 0; i < streamIndex; ++i) Jump();
 
-  mSeed = v;
+  mSeed = seed;
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
-RandomNumberGenerator methods
+RandomStream methods
 ----------------------------------------------------------------------------------------------------------------------*/
 
-inline void RandomNumberGenerator::RandomizeSeed()
+inline void RandomStream::Jump()
 {
-  SetSeed(static_cast<U32>(Time::GetCurrentTime().GetMilliseconds()));
+  static const U64 kJump[] = { 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+  Jump(kJump);
+}
+
+inline void RandomStream::LongJump()
+{
+  static const U64 kLongJump[] = { 0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL, 0x77710069854EE241ULL, 0x39109BB02ACBE635ULL };
+  Jump(kLongJump);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+RandomStream private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void RandomStream::Jump(const U64* pPolynomial)
+{
+  U64 state[4] = { 0, 0, 0, 0 };
+  for (U32 i = 0; i < 4; ++i)
+  {
+    for (U32 b = 0; b < 64; ++b)
+    {
+      if (pPolynomial[i] & (1ULL << b))
+      {
+        for (U32 j = 0; j < 4; ++j) state[j] ^= mState[j];
+      }
+      GetU64();
+    }
+  }
+  for (U32 j = 0; j < 4; ++j) mState[j] = state[j];
 }
 }
 }
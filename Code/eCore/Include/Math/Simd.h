@@ -0,0 +1,161 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Simd.h
+This file defines the SSE helper functions shared by the F32 math specializations.
+*/
+
+#ifndef E3_SIMD_H
+#define E3_SIMD_H
+
+#include <Base.h>
+
+/*----------------------------------------------------------------------------------------------------------------------
+Macro definitions (E_SETTING_MATH_FUSED_MULTIPLY_ADD)
+
+Please note that this macro has the following usage contract:
+
+1. When this macro is defined and AVX2 code generation is enabled (/arch:AVX2) SIMD multiply-add operations are fused
+(FMA3). Fused operations are faster but round only once, so the results are no longer bit exact with respect to the
+scalar versions.
+2. This is a global library setting macro which can be predefined by the user.
+----------------------------------------------------------------------------------------------------------------------*/
+#if defined(E_SETTING_MATH_FUSED_MULTIPLY_ADD) && defined(E_SIMD_AVX2)
+#define E_MATH_SIMD_FMA 1
+#endif
+
+/*----------------------------------------------------------------------------------------------------------------------
+Macro definitions (F16C)
+
+Please note that this macro has the following usage contract:
+
+1. Half precision conversions use the F16C instructions when AVX2 code generation is enabled. Every AVX2 CPU supports
+F16C whereas some AVX CPUs do not, so /arch:AVX alone keeps the table based conversion.
+----------------------------------------------------------------------------------------------------------------------*/
+#ifdef E_SIMD_AVX2
+#define E_MATH_SIMD_F16C 1
+#endif
+
+#ifdef E_SIMD_SSE2
+
+namespace E
+{
+namespace Math
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Simd
+
+Please note that this namespace has the following usage contract:
+
+1. Simd functions operate on four F32 lanes (__m128) and are only available when E_SIMD_SSE2 is defined.
+2. Load and Store do not require aligned memory. Math classes are stored within containers and heap objects whose
+alignment can not be guaranteed on 32 bit platforms, and unaligned access to aligned memory has no penalty on any
+SSE2 CPU released since 2008.
+3. MultiplyAdd and Transform evaluate the operations in the same order as the scalar code (left to right) so that SIMD
+results are bit exact unless E_SETTING_MATH_FUSED_MULTIPLY_ADD is enabled.
+----------------------------------------------------------------------------------------------------------------------*/
+namespace Simd
+{
+E_FORCE_INLINE __m128 Load(const F32* p)
+{
+  return _mm_loadu_ps(p);
+}
+
+E_FORCE_INLINE void Store(F32* p, __m128 a)
+{
+  _mm_storeu_ps(p, a);
+}
+
+template <int Lane>
+E_FORCE_INLINE __m128 Splat(__m128 a)
+{
+  return _mm_shuffle_ps(a, a, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+}
+
+/**
+Returns a * b + c.
+*/
+E_FORCE_INLINE __m128 MultiplyAdd(__m128 a, __m128 b, __m128 c)
+{
+#ifdef E_MATH_SIMD_FMA
+  return _mm_fmadd_ps(a, b, c);
+#else
+  return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+#ifdef E_SIMD_AVX
+E_FORCE_INLINE __m256 MultiplyAdd(__m256 a, __m256 b, __m256 c)
+{
+#ifdef E_MATH_SIMD_FMA
+  return _mm256_fmadd_ps(a, b, c);
+#else
+  return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
+#endif
+
+/**
+Loads 4 packed 3 component vectors (12 floats) as x, y and z lanes.
+*/
+E_FORCE_INLINE void LoadTransposed(const F32* p, __m128& x, __m128& y, __m128& z)
+{
+  const __m128 a = Load(p);     // x0 y0 z0 x1
+  const __m128 b = Load(p + 4); // y1 z1 x2 y2
+  const __m128 c = Load(p + 8); // z2 x3 y3 z3
+  x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+  y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+  z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+/**
+Stores x, y and z lanes as 4 packed 3 component vectors (12 floats).
+*/
+E_FORCE_INLINE void StoreTransposed(F32* p, __m128 x, __m128 y, __m128 z)
+{
+  const __m128 xyLow = _mm_unpacklo_ps(x, y);
+  const __m128 xyHigh = _mm_unpackhi_ps(x, y);
+  Store(p, _mm_shuffle_ps(xyLow, _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)));
+  Store(p + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), xyHigh, _MM_SHUFFLE(1, 0, 2, 0)));
+  Store(p + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+/**
+Returns the row vector v (x, y, z, w) multiplied by the matrix rows r0, r1, r2 and r3.
+*/
+E_FORCE_INLINE __m128 Transform(__m128 v, __m128 r0, __m128 r1, __m128 r2, __m128 r3)
+{
+  __m128 result = _mm_mul_ps(Splat<0>(v), r0);
+  result = MultiplyAdd(Splat<1>(v), r1, result);
+  result = MultiplyAdd(Splat<2>(v), r2, result);
+  return MultiplyAdd(Splat<3>(v), r3, result);
+}
+}
+}
+}
+
+#endif
+
+#endif
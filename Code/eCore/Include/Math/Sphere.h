@@ -95,7 +95,7 @@ inline bool Sphere<T>::AddPoint(const Vector3<T>& point)
 {
   if (mRadius < 0)
   {
-    mOrigin = v;
+    mOrigin = point;
     mRadius = 0;
     return true;
   }
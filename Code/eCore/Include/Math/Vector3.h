@@ -377,12 +377,12 @@ Vector3 methods
 template <typename T>
 inline void Vector3<T>::Normalize()								
 {			
-  T length = GetLength();
-  E_ASSERT_MSG(!IsEqual(length, static_cast<T>(0)), E_ASSERT_MSG_MATH_NON_ZERO_VALUE);
-  if (IsEqual(length, static_cast<T>(1))) 
+  T lengthSquared = GetLengthSquared();
+  E_ASSERT_MSG(!IsEqual(lengthSquared, static_cast<T>(0)), E_ASSERT_MSG_MATH_NON_ZERO_VALUE);
+  if (IsEqual(lengthSquared, static_cast<T>(1))) 
     return;
 
-  (*this) *= static_cast<T>(1) / length;
+  (*this) *= Math::InvSqrt(lengthSquared);
 }
 
 template <typename T>
@@ -31,6 +31,7 @@ This file defines the Vector4 class.
 #define E_VECTOR4_H
 
 #include "Comparison.h"
+#include "Simd.h"
 #include <Assertion/Assert.h>
 
 namespace E
@@ -45,6 +46,10 @@ Please note that this class has the following usage contract:
 1. Floating point types are expected to be used with this class: F32, D64.
 2. GetLength and Normalize are not supported on the I32 version.
 3. MaxMin count must be greater than 0.
+4. When SSE2 is available the F32 version uses SIMD specializations for the arithmetic operators, Max, Min and MinMax
+methods. Results are bit exact with respect to the generic version (MinMax may return either zero sign). Dot is kept
+scalar as a horizontal SIMD sum in the same order is slower. Take into account that the data layout is not changed (no
+padding or alignment requirements) so Vector4 can still be used within vertex formats.
 ----------------------------------------------------------------------------------------------------------------------*/
 template <typename T>
 struct Vector4
@@ -486,6 +491,198 @@ inline Vector4<T> Vector4<T>::ZeroVector()
   static Vector4<T> sZeroVector;
   return sZeroVector;
 }
+
+#ifdef E_SIMD_SSE2
+/*----------------------------------------------------------------------------------------------------------------------
+Vector4 F32 SIMD specializations
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator+(const Vector4& other) const
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, _mm_add_ps(Simd::Load(&x), Simd::Load(&other.x)));
+  return result;
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator+(F32 scalar) const
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, _mm_add_ps(Simd::Load(&x), _mm_set1_ps(scalar)));
+  return result;
+}
+
+template <>
+inline Vector4<F32>& Vector4<F32>::operator+=(const Vector4& other)
+{
+  Simd::Store(&x, _mm_add_ps(Simd::Load(&x), Simd::Load(&other.x)));
+  return (*this);
+}
+
+template <>
+inline Vector4<F32>& Vector4<F32>::operator+=(F32 scalar)
+{
+  Simd::Store(&x, _mm_add_ps(Simd::Load(&x), _mm_set1_ps(scalar)));
+  return (*this);
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator-() const
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, _mm_xor_ps(Simd::Load(&x), _mm_set1_ps(-0.0f)));
+  return result;
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator-(const Vector4& other) const
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, _mm_sub_ps(Simd::Load(&x), Simd::Load(&other.x)));
+  return result;
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator-(F32 scalar) const
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, _mm_sub_ps(Simd::Load(&x), _mm_set1_ps(scalar)));
+  return result;
+}
+
+template <>
+inline Vector4<F32>& Vector4<F32>::operator-=(const Vector4& other)
+{
+  Simd::Store(&x, _mm_sub_ps(Simd::Load(&x), Simd::Load(&other.x)));
+  return (*this);
+}
+
+template <>
+inline Vector4<F32>& Vector4<F32>::operator-=(F32 scalar)
+{
+  Simd::Store(&x, _mm_sub_ps(Simd::Load(&x), _mm_set1_ps(scalar)));
+  return (*this);
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator*(const Vector4& other) const
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, _mm_mul_ps(Simd::Load(&x), Simd::Load(&other.x)));
+  return result;
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator*(F32 scalar) const
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, _mm_mul_ps(Simd::Load(&x), _mm_set1_ps(scalar)));
+  return result;
+}
+
+template <>
+inline Vector4<F32>& Vector4<F32>::operator*=(const Vector4& other)
+{
+  Simd::Store(&x, _mm_mul_ps(Simd::Load(&x), Simd::Load(&other.x)));
+  return (*this);
+}
+
+template <>
+inline Vector4<F32>& Vector4<F32>::operator*=(F32 scalar)
+{
+  Simd::Store(&x, _mm_mul_ps(Simd::Load(&x), _mm_set1_ps(scalar)));
+  return (*this);
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator/(const Vector4& other) const
+{
+  E_ASSERT_MSG(
+    !IsEqual(other.x, 0.0f) && 
+    !IsEqual(other.y, 0.0f) && 
+    !IsEqual(other.z, 0.0f) &&
+    !IsEqual(other.w, 0.0f), E_ASSERT_MSG_MATH_NON_ZERO_VALUE);
+  Vector4<F32> result;
+  Simd::Store(&result.x, _mm_div_ps(Simd::Load(&x), Simd::Load(&other.x)));
+  return result;
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator/(F32 scalar) const
+{
+  E_ASSERT_MSG(!IsEqual(scalar, 0.0f), E_ASSERT_MSG_MATH_NON_ZERO_VALUE);
+  Vector4<F32> result;
+  Simd::Store(&result.x, _mm_div_ps(Simd::Load(&x), _mm_set1_ps(scalar)));
+  return result;
+}
+
+template <>
+inline Vector4<F32>& Vector4<F32>::operator/=(const Vector4& other)
+{
+  E_ASSERT_MSG(
+    !IsEqual(other.x, 0.0f) && 
+    !IsEqual(other.y, 0.0f) && 
+    !IsEqual(other.z, 0.0f) &&
+    !IsEqual(other.w, 0.0f), E_ASSERT_MSG_MATH_NON_ZERO_VALUE);
+  Simd::Store(&x, _mm_div_ps(Simd::Load(&x), Simd::Load(&other.x)));
+  return (*this);
+}
+
+template <>
+inline Vector4<F32>& Vector4<F32>::operator/=(F32 scalar)
+{
+  E_ASSERT_MSG(!IsEqual(scalar, 0.0f), E_ASSERT_MSG_MATH_NON_ZERO_VALUE);
+  Simd::Store(&x, _mm_div_ps(Simd::Load(&x), _mm_set1_ps(scalar)));
+  return (*this);
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::Max(const Vector4& a, const Vector4& b)
+{
+  // maxps returns the second operand on equality (a.x > b.x ? a.x : b.x)
+  Vector4<F32> result;
+  Simd::Store(&result.x, _mm_max_ps(Simd::Load(&a.x), Simd::Load(&b.x)));
+  return result;
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::Min(const Vector4& a, const Vector4& b)
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, _mm_min_ps(Simd::Load(&a.x), Simd::Load(&b.x)));
+  return result;
+}
+
+template <>
+inline void Vector4<F32>::MinMax(Vector4& min, Vector4& max, const Vector4<F32>* pSource, const U32 count)
+{
+  E_ASSERT_MSG(count > 0, E_ASSERT_MSG_MATH_GREATER_THAN_ZERO_VALUE);
+  // Two accumulator pairs hide the min / max latency
+  __m128 minA = Simd::Load(&pSource[0].x);
+  __m128 maxA = minA;
+  __m128 minB = minA;
+  __m128 maxB = minA;
+  U32 i = 1;
+  for (; i + 1 < count; i += 2)
+  {
+    const __m128 a = Simd::Load(&pSource[i].x);
+    const __m128 b = Simd::Load(&pSource[i + 1].x);
+    minA = _mm_min_ps(a, minA);
+    maxA = _mm_max_ps(a, maxA);
+    minB = _mm_min_ps(b, minB);
+    maxB = _mm_max_ps(b, maxB);
+  }
+  if (i < count)
+  {
+    const __m128 a = Simd::Load(&pSource[i].x);
+    minA = _mm_min_ps(a, minA);
+    maxA = _mm_max_ps(a, maxA);
+  }
+  Simd::Store(&min.x, _mm_min_ps(minA, minB));
+  Simd::Store(&max.x, _mm_max_ps(maxA, maxB));
+}
+#endif
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
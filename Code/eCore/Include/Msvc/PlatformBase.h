@@ -88,12 +88,51 @@ Platform detection (32 or 64 bit)
   #endif
 #endif
 
+#define E_PLATFORM_CACHE_LINE_SIZE 64
+
+/*----------------------------------------------------------------------------------------------------------------------
+Platform detection (byte order)
+
+Both x86 and x64 are little endian.
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_PLATFORM_LITTLE_ENDIAN 1
+
+/*----------------------------------------------------------------------------------------------------------------------
+Platform detection (SIMD instruction sets)
+
+SSE2 is always available on x64 and on x86 when compiling with /arch:SSE2 (default since Visual Studio 2012). AVX and 
+AVX2 require the /arch:AVX and /arch:AVX2 compiler options.
+----------------------------------------------------------------------------------------------------------------------*/
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define E_PLATFORM_SIMD_SSE2 1
+#endif
+#ifdef __AVX__
+  #define E_PLATFORM_SIMD_AVX 1
+#endif
+#ifdef __AVX2__
+  #define E_PLATFORM_SIMD_AVX2 1
+#endif
+
+/*----------------------------------------------------------------------------------------------------------------------
+Macro definitions (alignment)
+----------------------------------------------------------------------------------------------------------------------*/
+
+#define E_PLATFORM_ALIGN(n) __declspec(align(n))
+
 /*----------------------------------------------------------------------------------------------------------------------
 Macro definitions (null pointer)
 ----------------------------------------------------------------------------------------------------------------------*/
 
 #define E_PLATFORM_FORCE_INLINE __forceinline
 
+/*----------------------------------------------------------------------------------------------------------------------
+Macro definitions (byte swap intrinsics)
+----------------------------------------------------------------------------------------------------------------------*/
+
+#define E_PLATFORM_BYTE_SWAP_16(v) _byteswap_ushort(v)
+#define E_PLATFORM_BYTE_SWAP_32(v) _byteswap_ulong(v)
+#define E_PLATFORM_BYTE_SWAP_64(v) _byteswap_uint64(v)
+
 /*----------------------------------------------------------------------------------------------------------------------
 Macro definitions (API export / import)
 
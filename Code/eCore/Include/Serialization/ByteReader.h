@@ -0,0 +1,506 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file ByteReader.h
+This file defines the ByteReader class for basic type value deserialization from an external raw byte buffer.
+ByteReader implements the ISerializer interface.
+*/
+
+#ifndef E3_BYTE_READER_H
+#define E3_BYTE_READER_H
+
+#include "ISerializer.h"
+#include <Base.h>
+#include <Assertion/Assert.h>
+#include <Memory/Memory.h>
+
+/*----------------------------------------------------------------------------------------------------------------------
+ByteReader assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_BYTE_READER_READ_ONLY  "ByteReader is read only"
+#define E_ASSERT_MSG_BYTE_READER_READ_SIZE  "Read size (%d) exceeds the remaining buffer length (%d)"
+
+namespace E
+{
+namespace Serialization
+{
+/*----------------------------------------------------------------------------------------------------------------------
+ByteReader
+
+Please note that this class has the following usage contract: 
+
+1. ByteReader decodes the ByteSerializer format (big endian values, size_t prefixed strings) in place from a buffer it
+does not own, such as a memory mapped file or a ByteSerializer buffer. The buffer must outlive the reader and must not
+be modified while being read.
+2. ByteReader is read only: ISerializer write operators and methods assert.
+3. The remaining length is checked once per read call (operator, array or block) rather than per byte.
+4. ReadBlock(size) returns a pointer to the next size bytes of the buffer without copying them. The pointer is not
+aligned in general, so it should be used for byte data or copied before being reinterpreted.
+5. SetBuffer replaces the buffer and keeps the read position (ByteSerializer uses it to follow its growing buffer).
+Use SetBegin to read a new buffer from the beginning.
+----------------------------------------------------------------------------------------------------------------------*/
+class ByteReader : public ISerializer
+{
+public:
+  ByteReader();
+  ByteReader(const void* pData, size_t length);
+
+  // Operators
+  ISerializer&  operator<<(bool v);
+  ISerializer&  operator<<(I8 v);
+  ISerializer&  operator<<(U8 v);
+  ISerializer&  operator<<(I16 v);
+  ISerializer&  operator<<(U16 v);
+  ISerializer&  operator<<(I32 v);
+  ISerializer&  operator<<(U32 v);
+  ISerializer&  operator<<(I64 v);
+  ISerializer&  operator<<(U64 v);
+  ISerializer&  operator<<(F32 v);
+  ISerializer&  operator<<(D64 v);
+  ISerializer&  operator<<(const StringBuffer& v);
+  ISerializer&  operator<<(const String& v);
+  ISerializer&  operator<<(const char* pTr);
+
+  void          operator>>(bool& v);
+  void          operator>>(I8& v);
+  void          operator>>(U8& v);
+  void          operator>>(I16& v);
+  void          operator>>(U16& v);
+  void          operator>>(I32& v);
+  void          operator>>(U32& v);
+  void          operator>>(I64& v);
+  void          operator>>(U64& v);
+  void          operator>>(F32& v);
+  void          operator>>(D64& v);
+  void          operator>>(StringBuffer& v);
+  void          operator>>(String& v);
+
+  // Serialization
+  void          Read(U16* pData, size_t count);
+  void          Read(U32* pData, size_t count);
+  void          Read(U64* pData, size_t count);
+  void          Read(F32* pData, size_t count);
+  void          Read(D64* pData, size_t count);
+  void          ReadBlock(void* pData, size_t size);
+  const Byte*   ReadBlock(size_t size);
+  void          Write(const U16* pData, size_t count);
+  void          Write(const U32* pData, size_t count);
+  void          Write(const U64* pData, size_t count);
+  void          Write(const F32* pData, size_t count);
+  void          Write(const D64* pData, size_t count);
+  void          WriteBlock(const void* pData, size_t size);
+
+  // Accessors
+  size_t        GetLength() const;
+  size_t        GetPosition() const;
+  const Byte*   GetPtr() const;
+  size_t        GetRemainingLength() const;
+  bool          IsEnd() const;
+  void          SetBegin();
+  void          SetBuffer(const void* pData, size_t length);
+
+  // Methods
+  void          BeginTag(const StringBuffer& name);
+  void          EndTag();
+  void          Ignore(U32 v = 1);
+
+  static U16    SwapBytes(U16 v);
+  static U32    SwapBytes(U32 v);
+  static U64    SwapBytes(U64 v);
+
+private:
+  const Byte*   mpBuffer;
+  size_t        mBufferLength;
+  size_t        mBufferPosition;
+
+  const Byte*   Consume(size_t size);
+  template <typename T>
+  void          ReadValues(T* pData, size_t count);
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(ByteReader)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+ByteReader initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline ByteReader::ByteReader()
+  : mpBuffer(nullptr)
+  , mBufferLength(0)
+  , mBufferPosition(0)
+{
+}
+
+inline ByteReader::ByteReader(const void* pData, size_t length)
+  : mpBuffer(static_cast<const Byte*>(pData))
+  , mBufferLength(length)
+  , mBufferPosition(0)
+{
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ByteReader operators
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline ISerializer& ByteReader::operator<<(bool)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+  return *this;
+}
+
+inline ISerializer& ByteReader::operator<<(I8)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+  return *this;
+}
+
+inline ISerializer& ByteReader::operator<<(U8)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+  return *this;
+}
+
+inline ISerializer& ByteReader::operator<<(I16)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+  return *this;
+}
+
+inline ISerializer& ByteReader::operator<<(U16)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+  return *this;
+}
+
+inline ISerializer& ByteReader::operator<<(I32)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+  return *this;
+}
+
+inline ISerializer& ByteReader::operator<<(U32)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+  return *this;
+}
+
+inline ISerializer& ByteReader::operator<<(I64)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+  return *this;
+}
+
+inline ISerializer& ByteReader::operator<<(U64)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+  return *this;
+}
+
+inline ISerializer& ByteReader::operator<<(F32)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+  return *this;
+}
+
+inline ISerializer& ByteReader::operator<<(D64)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+  return *this;
+}
+
+inline ISerializer& ByteReader::operator<<(const StringBuffer&)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+  return *this;
+}
+
+inline ISerializer& ByteReader::operator<<(const String&)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+  return *this;
+}
+
+inline ISerializer& ByteReader::operator<<(const char*)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+  return *this;
+}
+
+inline void ByteReader::operator>>(bool& v)
+{
+  U8 uv;
+  operator>>(uv);
+  v = (uv == 1) ? true : false;
+}
+
+inline void ByteReader::operator>>(I8& v)
+{
+  U8 uv;
+  operator>>(uv);
+  v = uv;
+}
+
+inline void ByteReader::operator>>(U8& v)
+{
+  v = *Consume(1);
+}
+
+inline void ByteReader::operator>>(I16& v)
+{
+  U16 uv;
+  operator>>(uv);
+  v = uv;
+}
+
+inline void ByteReader::operator>>(U16& v)
+{
+  ReadValues(&v, 1);
+}
+
+inline void ByteReader::operator>>(I32& v)
+{
+  U32 uv;
+  operator>>(uv);
+  v = uv;
+}
+
+inline void ByteReader::operator>>(U32& v)
+{
+  ReadValues(&v, 1);
+}
+
+inline void ByteReader::operator>>(I64& v)
+{
+  U64 uv;
+  operator>>(uv);
+  v = uv;
+}
+
+inline void ByteReader::operator>>(U64& v)
+{
+  ReadValues(&v, 1);
+}
+
+inline void ByteReader::operator>>(F32& v)
+{
+  U32 uv;
+  operator>>(uv);
+  v = *((F32*)&uv);
+}
+
+inline void ByteReader::operator>>(D64& v)
+{
+  U64 uv;
+  operator>>(uv);
+  v = *((D64*)&uv);
+}
+
+inline void ByteReader::operator>>(StringBuffer& v)
+{
+  size_t length;
+  operator>>(length);
+  v = StringBuffer(reinterpret_cast<const StringBuffer::CharType*>(Consume(length)), length);
+}
+
+inline void ByteReader::operator>>(String& v)
+{
+  size_t length;
+  operator>>(length);
+  v = String(reinterpret_cast<const StringBuffer::CharType*>(Consume(length)), length);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ByteReader serialization
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void ByteReader::Read(U16* pData, size_t count)
+{
+  ReadValues(pData, count);
+}
+
+inline void ByteReader::Read(U32* pData, size_t count)
+{
+  ReadValues(pData, count);
+}
+
+inline void ByteReader::Read(U64* pData, size_t count)
+{
+  ReadValues(pData, count);
+}
+
+inline void ByteReader::Read(F32* pData, size_t count)
+{
+  ReadValues(reinterpret_cast<U32*>(pData), count);
+}
+
+inline void ByteReader::Read(D64* pData, size_t count)
+{
+  ReadValues(reinterpret_cast<U64*>(pData), count);
+}
+
+inline void ByteReader::ReadBlock(void* pData, size_t size)
+{
+  if (size) Memory::Copy(static_cast<Byte*>(pData), Consume(size), size);
+}
+
+inline const Byte* ByteReader::ReadBlock(size_t size)
+{
+  return Consume(size);
+}
+
+inline void ByteReader::Write(const U16*, size_t)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+}
+
+inline void ByteReader::Write(const U32*, size_t)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+}
+
+inline void ByteReader::Write(const U64*, size_t)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+}
+
+inline void ByteReader::Write(const F32*, size_t)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+}
+
+inline void ByteReader::Write(const D64*, size_t)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+}
+
+inline void ByteReader::WriteBlock(const void*, size_t)
+{
+  E_ASSERT_MSG(false, E_ASSERT_MSG_BYTE_READER_READ_ONLY);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ByteReader accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline size_t ByteReader::GetLength() const
+{
+  return mBufferLength;
+}
+
+inline size_t ByteReader::GetPosition() const
+{
+  return mBufferPosition;
+}
+
+inline const Byte* ByteReader::GetPtr() const
+{
+  return mpBuffer;
+}
+
+inline size_t ByteReader::GetRemainingLength() const
+{
+  return mBufferLength - mBufferPosition;
+}
+
+inline bool ByteReader::IsEnd() const
+{
+  return mBufferPosition >= mBufferLength;
+}
+
+inline void ByteReader::SetBegin()
+{
+  mBufferPosition = 0;
+}
+
+inline void ByteReader::SetBuffer(const void* pData, size_t length)
+{
+  mpBuffer = static_cast<const Byte*>(pData);
+  mBufferLength = length;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ByteReader methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void ByteReader::BeginTag(const StringBuffer&)
+{
+}
+
+inline void ByteReader::EndTag()
+{
+}
+
+inline void ByteReader::Ignore(U32 v)
+{
+  mBufferPosition += v;
+}
+
+inline U16 ByteReader::SwapBytes(U16 v)
+{
+  return E_BYTE_SWAP_16(v);
+}
+
+inline U32 ByteReader::SwapBytes(U32 v)
+{
+  return E_BYTE_SWAP_32(v);
+}
+
+inline U64 ByteReader::SwapBytes(U64 v)
+{
+  return E_BYTE_SWAP_64(v);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ByteReader private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline const Byte* ByteReader::Consume(size_t size)
+{
+  E_ASSERT_MSG(size <= mBufferLength - mBufferPosition, E_ASSERT_MSG_BYTE_READER_READ_SIZE, size, mBufferLength - mBufferPosition);
+  const Byte* pBytes = mpBuffer + mBufferPosition;
+  mBufferPosition += size;
+  return pBytes;
+}
+
+template <typename T>
+inline void ByteReader::ReadValues(T* pData, size_t count)
+{
+  if (count == 0) return;
+  const Byte* pBytes = Consume(count * sizeof(T));
+#ifdef E_LITTLE_ENDIAN
+  for (size_t i = 0; i < count; ++i, pBytes += sizeof(T))
+  {
+    T v;
+    Memory::Copy(reinterpret_cast<Byte*>(&v), pBytes, sizeof(T));
+    pData[i] = SwapBytes(v);
+  }
+#else
+  Memory::Copy(reinterpret_cast<Byte*>(pData), pBytes, count * sizeof(T));
+#endif
+}
+}
+}
+
+#endif
@@ -32,6 +32,7 @@ ByteSerializer implements the ISerializer interface.
 #define E3_BYTE_SERIALIZER_H
 
 #include "ISerializer.h"
+#include "ByteReader.h"
 #include <Containers/List.h>
 #include <Base.h>
 
@@ -41,6 +42,16 @@ namespace Serialization
 {
 /*----------------------------------------------------------------------------------------------------------------------
 ByteSerializer
+
+Please note that this class has the following usage contract: 
+
+1. Values are serialized in big endian byte order regardless of the platform byte order. On little endian platforms
+Write and Read swap the values of a whole array in a single pass over a buffer grown once, while on big endian
+platforms they reduce to a memory copy. WriteBlock and ReadBlock always reduce to a memory copy.
+2. The buffer grows geometrically (see List::GetGrowthPercentage) so that serializing many small values does not
+reallocate the buffer on every operation.
+3. Deserialization is delegated to a ByteReader over the buffer. To deserialize external data (i.e. a file) without
+copying it into a ByteSerializer use ByteReader directly.
 ----------------------------------------------------------------------------------------------------------------------*/
 class ByteSerializer : public ISerializer
 {
@@ -77,6 +88,20 @@ public:
   void          operator>>(StringBuffer& v);
   void          operator>>(String& v);
 
+  // Serialization
+  void          Read(U16* pData, size_t count);
+  void          Read(U32* pData, size_t count);
+  void          Read(U64* pData, size_t count);
+  void          Read(F32* pData, size_t count);
+  void          Read(D64* pData, size_t count);
+  void          ReadBlock(void* pData, size_t size);
+  void          Write(const U16* pData, size_t count);
+  void          Write(const U32* pData, size_t count);
+  void          Write(const U64* pData, size_t count);
+  void          Write(const F32* pData, size_t count);
+  void          Write(const D64* pData, size_t count);
+  void          WriteBlock(const void* pData, size_t size);
+
   // Accessors
   size_t	      GetLength() const;
   const Byte*   GetPtr() const;
@@ -91,7 +116,12 @@ public:
 
 private:
   Containers::List<Byte>  mBuffer;
-  size_t                  mBufferPosition;
+  ByteReader              mReader;
+
+  Byte*                   Append(size_t size);
+  ByteReader&             GetReader();
+  template <typename T>
+  void                    WriteValues(const T* pData, size_t count);
 
   E_DISABLE_COPY_AND_ASSSIGNMENT(ByteSerializer)
 };
@@ -101,7 +131,6 @@ ByteSerializer initialization & finalization
 ----------------------------------------------------------------------------------------------------------------------*/
 
 inline ByteSerializer::ByteSerializer()
-  : mBufferPosition(0)
 {
 }
 
@@ -121,7 +150,7 @@ inline ISerializer& ByteSerializer::operator<<(I8 v)
 
 inline ISerializer& ByteSerializer::operator<<(U8 v)
 {
-  mBuffer.PushBack(static_cast<Byte>(v));
+  *Append(1) = static_cast<Byte>(v);
   return *this;
 }
 
@@ -132,8 +161,7 @@ inline ISerializer& ByteSerializer::operator<<(I16 v)
 
 inline ISerializer& ByteSerializer::operator<<(U16 v)
 {
-  mBuffer.PushBack(static_cast<Byte>(v >> 8));
-  mBuffer.PushBack(static_cast<Byte>(v));
+  WriteValues(&v, 1);
   return *this;
 }
 
@@ -144,10 +172,7 @@ inline ISerializer& ByteSerializer::operator<<(I32 v)
 
 inline ISerializer& ByteSerializer::operator<<(U32 v)
 {
-  mBuffer.PushBack(static_cast<Byte>(v >> 24));
-  mBuffer.PushBack(static_cast<Byte>(v >> 16));
-  mBuffer.PushBack(static_cast<Byte>(v >> 8));
-  mBuffer.PushBack(static_cast<Byte>(v));
+  WriteValues(&v, 1);
   return *this;
 }
 
@@ -158,14 +183,7 @@ inline ISerializer& ByteSerializer::operator<<(I64 v)
 
 inline ISerializer& ByteSerializer::operator<<(U64 v)
 {
-  mBuffer.PushBack(static_cast<Byte>(v >> 56));
-  mBuffer.PushBack(static_cast<Byte>(v >> 48));
-  mBuffer.PushBack(static_cast<Byte>(v >> 40));
-  mBuffer.PushBack(static_cast<Byte>(v >> 32));
-  mBuffer.PushBack(static_cast<Byte>(v >> 24));
-  mBuffer.PushBack(static_cast<Byte>(v >> 16));
-  mBuffer.PushBack(static_cast<Byte>(v >> 8));
-  mBuffer.PushBack(static_cast<Byte>(v));
+  WriteValues(&v, 1);
   return *this;
 }
 
@@ -184,16 +202,14 @@ inline ISerializer& ByteSerializer::operator<<(D64 v)
 inline ISerializer& ByteSerializer::operator<<(const StringBuffer& v)
 {
   operator<<(v.GetLength());
-  const Byte* pBytes = reinterpret_cast<const Byte*>(v.GetPtr());
-  mBuffer.PushBack(pBytes, v.GetLength());
+  WriteBlock(v.GetPtr(), v.GetLength());
   return *this;
 }
 
 inline ISerializer& ByteSerializer::operator<<(const String& v)
 {
   operator<<(v.GetLength());
-  const Byte* pBytes = reinterpret_cast<const Byte*>(v.GetPtr());
-  mBuffer.PushBack(pBytes, v.GetLength());
+  WriteBlock(v.GetPtr(), v.GetLength());
   return *this;
 }
 
@@ -201,110 +217,137 @@ inline ISerializer& ByteSerializer::operator<<(const char* pStr)
 {
   size_t strLength = Text::GetLength(pStr);
   operator<<(strLength);
-  mBuffer.PushBack(reinterpret_cast<const Byte*>(pStr), strLength);
+  WriteBlock(pStr, strLength);
   return *this;
 }
 
 inline void ByteSerializer::operator>>(bool& v)
 {
-  U8 uv;
-  operator>>(uv);
-  v = (uv == 1) ? true : false;
+  GetReader() >> v;
 }
 
 inline void ByteSerializer::operator>>(I8& v)
 {
-  U8 uv;
-  operator>>(uv);
-  v = uv;
+  GetReader() >> v;
 }
 
 inline void ByteSerializer::operator>>(U8& v)
 {
-  v = mBuffer[mBufferPosition++];
+  GetReader() >> v;
 }
 
 inline void ByteSerializer::operator>>(I16& v)
 {
-  U16 uv;
-  operator>>(uv);
-  v = uv;
+  GetReader() >> v;
 }
 
 inline void ByteSerializer::operator>>(U16& v)
 {
-  v =
-    (mBuffer[mBufferPosition    ] << 8) |
-    (mBuffer[mBufferPosition + 1]);
-  mBufferPosition += 2;
+  GetReader() >> v;
 }
 
 inline void ByteSerializer::operator>>(I32& v)
 {
-  U32 uv;
-  operator>>(uv);
-  v = uv;
+  GetReader() >> v;
 }
 
 inline void ByteSerializer::operator>>(U32& v)
 {
-  v =
-    (mBuffer[mBufferPosition    ] << 24) |
-    (mBuffer[mBufferPosition + 1] << 16) |
-    (mBuffer[mBufferPosition + 2] << 8) |
-    (mBuffer[mBufferPosition + 3]);
-   mBufferPosition += 4;
+  GetReader() >> v;
 }
 
 inline void ByteSerializer::operator>>(I64& v)
 {
-  U64 uv;
-  operator>>(uv);
-  v = uv;
+  GetReader() >> v;
 }
 
 inline void ByteSerializer::operator>>(U64& v)
 {
-  v = 
-    (static_cast<U64>(mBuffer[mBufferPosition    ]) << 56) |
-    (static_cast<U64>(mBuffer[mBufferPosition + 1]) << 48) |
-    (static_cast<U64>(mBuffer[mBufferPosition + 2]) << 40) |
-    (static_cast<U64>(mBuffer[mBufferPosition + 3]) << 32) |
-    (static_cast<U64>(mBuffer[mBufferPosition + 4]) << 24) |
-    (static_cast<U64>(mBuffer[mBufferPosition + 5]) << 16) |
-    (static_cast<U64>(mBuffer[mBufferPosition + 6]) << 8) |
-    (static_cast<U64>(mBuffer[mBufferPosition + 7]));
-  mBufferPosition += 8;
+  GetReader() >> v;
 }
 
 inline void ByteSerializer::operator>>(F32& v)
 {
-  U32 uv;
-  operator>>(uv);
-  v = *((F32*)&uv);
+  GetReader() >> v;
 }
 
 inline void ByteSerializer::operator>>(D64& v)
 {
-  U64 uv;
-  operator>>(uv);
-  v = *((D64*)&uv);
+  GetReader() >> v;
 }
 
 inline void ByteSerializer::operator>>(StringBuffer& v)
 {
-  size_t length;
-  operator>>(length);
-  v = StringBuffer(reinterpret_cast<StringBuffer::CharType*>(&mBuffer[mBufferPosition]), length);
-  mBufferPosition += length;
+  GetReader() >> v;
 }
 
 inline void ByteSerializer::operator>>(String& v)
 {
-  size_t length;
-  operator>>(length);
-  v = String(reinterpret_cast<StringBuffer::CharType*>(&mBuffer[mBufferPosition]), length);
-  mBufferPosition += length;
+  GetReader() >> v;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ByteSerializer serialization
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void ByteSerializer::Read(U16* pData, size_t count)
+{
+  GetReader().Read(pData, count);
+}
+
+inline void ByteSerializer::Read(U32* pData, size_t count)
+{
+  GetReader().Read(pData, count);
+}
+
+inline void ByteSerializer::Read(U64* pData, size_t count)
+{
+  GetReader().Read(pData, count);
+}
+
+inline void ByteSerializer::Read(F32* pData, size_t count)
+{
+  GetReader().Read(pData, count);
+}
+
+inline void ByteSerializer::Read(D64* pData, size_t count)
+{
+  GetReader().Read(pData, count);
+}
+
+inline void ByteSerializer::ReadBlock(void* pData, size_t size)
+{
+  GetReader().ReadBlock(pData, size);
+}
+
+inline void ByteSerializer::Write(const U16* pData, size_t count)
+{
+  WriteValues(pData, count);
+}
+
+inline void ByteSerializer::Write(const U32* pData, size_t count)
+{
+  WriteValues(pData, count);
+}
+
+inline void ByteSerializer::Write(const U64* pData, size_t count)
+{
+  WriteValues(pData, count);
+}
+
+inline void ByteSerializer::Write(const F32* pData, size_t count)
+{
+  WriteValues(reinterpret_cast<const U32*>(pData), count);
+}
+
+inline void ByteSerializer::Write(const D64* pData, size_t count)
+{
+  WriteValues(reinterpret_cast<const U64*>(pData), count);
+}
+
+inline void ByteSerializer::WriteBlock(const void* pData, size_t size)
+{
+  if (size) Memory::Copy(Append(size), static_cast<const Byte*>(pData), size);
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -328,7 +371,7 @@ inline size_t ByteSerializer::GetSize() const
 
 inline void ByteSerializer::SetBegin()
 {
-  mBufferPosition = 0;
+  mReader.SetBegin();
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -342,7 +385,8 @@ inline void ByteSerializer::BeginTag(const StringBuffer&)
 inline void ByteSerializer::Clear()
 {
   mBuffer.Clear();
-  mBufferPosition = 0;
+  mReader.SetBuffer(nullptr, 0);
+  mReader.SetBegin();
 }
 
 inline void ByteSerializer::EndTag()
@@ -351,7 +395,46 @@ inline void ByteSerializer::EndTag()
 
 inline void ByteSerializer::Ignore(U32 v)
 {
-  mBufferPosition += v;
+  mReader.Ignore(v);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ByteSerializer private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline Byte* ByteSerializer::Append(size_t size)
+{
+  size_t count = mBuffer.GetCount();
+  if (count + size > mBuffer.GetSize())
+  {
+    size_t grownSize = mBuffer.GetSize() * (100 + mBuffer.GetGrowthPercentage()) / 100;
+    mBuffer.EnsureSize((count + size > grownSize) ? count + size : grownSize);
+  }
+  mBuffer.SetCount(count + size);
+  return mBuffer.GetPtr() + count;
+}
+
+inline ByteReader& ByteSerializer::GetReader()
+{
+  // The buffer may have been reallocated since the last read
+  mReader.SetBuffer(mBuffer.GetPtr(), mBuffer.GetCount());
+  return mReader;
+}
+
+template <typename T>
+inline void ByteSerializer::WriteValues(const T* pData, size_t count)
+{
+  if (count == 0) return;
+  Byte* pBytes = Append(count * sizeof(T));
+#ifdef E_LITTLE_ENDIAN
+  for (size_t i = 0; i < count; ++i, pBytes += sizeof(T))
+  {
+    T v = ByteReader::SwapBytes(pData[i]);
+    Memory::Copy(pBytes, reinterpret_cast<const Byte*>(&v), sizeof(T));
+  }
+#else
+  Memory::Copy(pBytes, reinterpret_cast<const Byte*>(pData), count * sizeof(T));
+#endif
 }
 }
 }
@@ -25,7 +25,8 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 
 /** @file ISerializer.h
 This file defines the ISerializer interface serialization. The interface defines operators for basic
-types and two tag methods for serialization structuring when necessary.
+types, bulk methods for arrays of basic types and raw byte blocks and two tag methods for serialization structuring
+when necessary.
 */
 
 #ifndef E3_ISERIALIZER_H
@@ -64,6 +65,14 @@ const char*, the compiler will find that the boolean operator would be a better
 raw string input due to its pointer nature (evaluating const char* == 0).
 
 2. No WStringBuffer operator is added intentionally as Utf8 is assumed to be the default string encoding format.
+
+3. Write and Read serialize count contiguous values at once and are the preferred way to serialize large arrays, as
+implementations can avoid the per value overhead of the operators. The count is not serialized: it must be known (or
+serialized beforehand) to read the values back. Signed and unsigned values of the same size share the same encoding
+so signed arrays may be serialized through the unsigned version (i.e. Write(reinterpret_cast<const U32*>(pI32), n)).
+
+4. WriteBlock and ReadBlock serialize size raw bytes which are written as they are, without any byte order
+conversion. They are intended for data which is already in its final binary layout.
 ----------------------------------------------------------------------------------------------------------------------*/	
 class ISerializer
 {
@@ -99,6 +108,19 @@ public:
   virtual void          operator>>(StringBuffer& v) = 0;
   virtual void          operator>>(String& v) = 0;
 
+  virtual void          Read(U16* pData, size_t count) = 0;
+  virtual void          Read(U32* pData, size_t count) = 0;
+  virtual void          Read(U64* pData, size_t count) = 0;
+  virtual void          Read(F32* pData, size_t count) = 0;
+  virtual void          Read(D64* pData, size_t count) = 0;
+  virtual void          ReadBlock(void* pData, size_t size) = 0;
+  virtual void          Write(const U16* pData, size_t count) = 0;
+  virtual void          Write(const U32* pData, size_t count) = 0;
+  virtual void          Write(const U64* pData, size_t count) = 0;
+  virtual void          Write(const F32* pData, size_t count) = 0;
+  virtual void          Write(const D64* pData, size_t count) = 0;
+  virtual void          WriteBlock(const void* pData, size_t size) = 0;
+
   virtual void          BeginTag(const StringBuffer& name) = 0;
   virtual void          EndTag() = 0;
 };
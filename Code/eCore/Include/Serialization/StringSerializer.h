@@ -34,15 +34,16 @@ std::StringSerializer.
 
 #include "ISerializer.h"
 #include <Text/CharList.h>
+#include <Text/StringUtil.h>
 #include <Base.h>
 #include <Assertion/Assert.h>
-#include <sstream>
-#include <iomanip>
 
 /*----------------------------------------------------------------------------------------------------------------------
 StringSerializer assertion messages
 ----------------------------------------------------------------------------------------------------------------------*/
 #define E_ASSERT_MSG_STRING_SERIALIZER_DELIMITER  "StringBuffer stream delimiter expected"
+#define E_ASSERT_MSG_STRING_SERIALIZER_BLOCK      "Hexadecimal block digit expected"
+#define E_ASSERT_MSG_STRING_SERIALIZER_NUMBER     "Number expected"
 
 namespace E
 {
@@ -56,6 +57,11 @@ Please note that this class has the following usage contract:
 1. A token delimiter character ' ' is used to differentiate serialized values.
 2. StringBuffer values include an additional delimiter character '"' to deserialize this type correctly,
 therefore StringBuffer values cannot contain this character.
+3. Write produces the same tokens as the equivalent sequence of operator calls (so arrays may be read back value by
+value). Raw byte blocks are serialized as a single hexadecimal token (two digits per byte).
+4. Numbers are formatted and parsed by Text::FormatNumber and Text::ParseNumber (see StringUtil.h): the output does not
+depend on the current locale and floating point values are written with the shortest representation that reads back to
+the same value. I8 and U8 values are serialized as single characters.
 ----------------------------------------------------------------------------------------------------------------------*/
 class StringSerializer : public ISerializer
 {
@@ -91,6 +97,20 @@ public:
   void              operator>>(D64& v);
   void              operator>>(StringBuffer& v);
   void              operator>>(String& v);
+
+  // Serialization
+  void              Read(U16* pData, size_t count);
+  void              Read(U32* pData, size_t count);
+  void              Read(U64* pData, size_t count);
+  void              Read(F32* pData, size_t count);
+  void              Read(D64* pData, size_t count);
+  void              ReadBlock(void* pData, size_t size);
+  void              Write(const U16* pData, size_t count);
+  void              Write(const U32* pData, size_t count);
+  void              Write(const U64* pData, size_t count);
+  void              Write(const F32* pData, size_t count);
+  void              Write(const D64* pData, size_t count);
+  void              WriteBlock(const void* pData, size_t size);
   
   // Accessors
   size_t            GetLength() const;
@@ -111,6 +131,15 @@ private:
   StringBuffer      mBuffer;
   size_t            mBufferPosition;
 
+  template <typename T>
+  void              ReadNumber(T& v);
+  template <typename NumberType, typename T>
+  void              ReadValues(T* pData, size_t count);
+  template <typename T>
+  void              WriteNumber(T v);
+  template <typename NumberType, typename T>
+  void              WriteValues(const T* pData, size_t count);
+
   E_DISABLE_COPY_AND_ASSSIGNMENT(StringSerializer)
 };
 
@@ -166,33 +195,25 @@ inline ISerializer& StringSerializer::operator<<(U32 v)
 
 inline ISerializer& StringSerializer::operator<<(I64 v)
 {
-  std::ostringstream oss;
-  oss << v << kTokenSeparator;
-  mBuffer << oss.str().c_str();
+  WriteNumber(v);
   return *this;
 }
 
 inline ISerializer& StringSerializer::operator<<(U64 v)
 {
-  std::ostringstream oss;
-  oss << v << kTokenSeparator;
-  mBuffer << oss.str().c_str();
+  WriteNumber(v);
   return *this;
 }
 
 inline ISerializer& StringSerializer::operator<<(F32 v)
 {
-  std::ostringstream oss;
-  oss << std::fixed << std::setprecision(5) << v << kTokenSeparator;
-  mBuffer << oss.str().c_str();
+  WriteNumber(v);
   return *this;
 }
 
 inline ISerializer& StringSerializer::operator<<(D64 v)
 {
-  std::ostringstream oss;
-  oss << std::fixed << std::setprecision(7) << v << kTokenSeparator;
-  mBuffer << oss.str().c_str();
+  WriteNumber(v);
   return *this;
 }
 
@@ -226,79 +247,69 @@ inline ISerializer& StringSerializer::operator<<(const char* pStr)
 
 inline void StringSerializer::operator>>(bool& v)
 {
-  std::istringstream iss(std::string(&mBuffer[mBufferPosition], mBuffer.GetLength() - mBufferPosition));
-  iss >> v;
-  mBufferPosition += static_cast<size_t>(iss.tellg()) + 1;
+  U64 value;
+  ReadNumber(value);
+  v = value != 0;
 }
 
 inline void StringSerializer::operator>>(I8& v)
 {
-  std::istringstream iss(std::string(&mBuffer[mBufferPosition], mBuffer.GetLength() - mBufferPosition));
-  iss >> v;
-  mBufferPosition += static_cast<size_t>(iss.tellg()) + 1;
+  v = static_cast<I8>(mBuffer[mBufferPosition]);
+  mBufferPosition += 2; // Skip the token delimiter
 }
 
 inline void StringSerializer::operator>>(U8& v)
 {
-  std::istringstream iss(std::string(&mBuffer[mBufferPosition], mBuffer.GetLength() - mBufferPosition));
-  iss >> v;
-  mBufferPosition += static_cast<size_t>(iss.tellg()) + 1;
+  v = static_cast<U8>(mBuffer[mBufferPosition]);
+  mBufferPosition += 2; // Skip the token delimiter
 }
 
 inline void StringSerializer::operator>>(I16& v)
 {
-  std::istringstream iss(std::string(&mBuffer[mBufferPosition], mBuffer.GetLength() - mBufferPosition));
-  iss >> v;
-  mBufferPosition += static_cast<size_t>(iss.tellg()) + 1;
+  I64 value;
+  ReadNumber(value);
+  v = static_cast<I16>(value);
 }
 
 inline void StringSerializer::operator>>(U16& v)
 {
-  std::istringstream iss(std::string(&mBuffer[mBufferPosition], mBuffer.GetLength() - mBufferPosition));
-  iss >> v;
-  mBufferPosition += static_cast<size_t>(iss.tellg()) + 1;
+  U64 value;
+  ReadNumber(value);
+  v = static_cast<U16>(value);
 }
 
 inline void StringSerializer::operator>>(I32& v)
 {
-  std::istringstream iss(std::string(&mBuffer[mBufferPosition], mBuffer.GetLength() - mBufferPosition));
-  iss >> v;
-  mBufferPosition += static_cast<size_t>(iss.tellg()) + 1;
+  I64 value;
+  ReadNumber(value);
+  v = static_cast<I32>(value);
 }
 
 inline void StringSerializer::operator>>(U32& v)
 {
-  std::istringstream iss(std::string(&mBuffer[mBufferPosition], mBuffer.GetLength() - mBufferPosition));
-  iss >> v;
-  mBufferPosition += static_cast<size_t>(iss.tellg()) + 1;
+  U64 value;
+  ReadNumber(value);
+  v = static_cast<U32>(value);
 }
 
 inline void StringSerializer::operator>>(I64& v)
 {
-  std::istringstream iss(std::string(&mBuffer[mBufferPosition], mBuffer.GetLength() - mBufferPosition));
-  iss >> v;
-  mBufferPosition += static_cast<size_t>(iss.tellg()) + 1;
+  ReadNumber(v);
 }
 
 inline void StringSerializer::operator>>(U64& v)
 {
-  std::istringstream iss(std::string(&mBuffer[mBufferPosition], mBuffer.GetLength() - mBufferPosition));
-  iss >> v;
-  mBufferPosition += static_cast<size_t>(iss.tellg()) + 1;
+  ReadNumber(v);
 }
 
 inline void StringSerializer::operator>>(F32& v)
 {
-  std::istringstream iss(std::string(&mBuffer[mBufferPosition], mBuffer.GetLength() - mBufferPosition));
-  iss >> v;
-  mBufferPosition += static_cast<size_t>(iss.tellg()) + 1;
+  ReadNumber(v);
 }
 
 inline void StringSerializer::operator>>(D64& v)
 {
-  std::istringstream iss(std::string(&mBuffer[mBufferPosition], mBuffer.GetLength() - mBufferPosition));
-  iss >> v;
-  mBufferPosition += static_cast<size_t>(iss.tellg()) + 1;
+  ReadNumber(v);
 }
 
 inline void StringSerializer::operator>>(StringBuffer& v)
@@ -317,6 +328,89 @@ inline void StringSerializer::operator>>(String& v)
   v = String(&mBuffer[strBegin], mBufferPosition++ - strBegin - 1); // Increment mBufferPosition to include the token delimiter
 }
 
+/*----------------------------------------------------------------------------------------------------------------------
+StringSerializer serialization
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void StringSerializer::Read(U16* pData, size_t count)
+{
+  ReadValues<U64>(pData, count);
+}
+
+inline void StringSerializer::Read(U32* pData, size_t count)
+{
+  ReadValues<U64>(pData, count);
+}
+
+inline void StringSerializer::Read(U64* pData, size_t count)
+{
+  ReadValues<U64>(pData, count);
+}
+
+inline void StringSerializer::Read(F32* pData, size_t count)
+{
+  ReadValues<F32>(pData, count);
+}
+
+inline void StringSerializer::Read(D64* pData, size_t count)
+{
+  ReadValues<D64>(pData, count);
+}
+
+inline void StringSerializer::ReadBlock(void* pData, size_t size)
+{
+  Byte* pBytes = static_cast<Byte*>(pData);
+  for (size_t i = 0; i < size; ++i)
+  {
+    U8 v = 0;
+    for (U32 j = 0; j < 2; ++j)
+    {
+      char c = mBuffer[mBufferPosition++];
+      E_ASSERT_MSG((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'), E_ASSERT_MSG_STRING_SERIALIZER_BLOCK);
+      v = static_cast<U8>((v << 4) | ((c <= '9') ? c - '0' : c - 'a' + 10));
+    }
+    pBytes[i] = v;
+  }
+  mBufferPosition++; // Skip the token delimiter
+}
+
+inline void StringSerializer::Write(const U16* pData, size_t count)
+{
+  WriteValues<U64>(pData, count);
+}
+
+inline void StringSerializer::Write(const U32* pData, size_t count)
+{
+  WriteValues<U64>(pData, count);
+}
+
+inline void StringSerializer::Write(const U64* pData, size_t count)
+{
+  WriteValues<U64>(pData, count);
+}
+
+inline void StringSerializer::Write(const F32* pData, size_t count)
+{
+  WriteValues<F32>(pData, count);
+}
+
+inline void StringSerializer::Write(const D64* pData, size_t count)
+{
+  WriteValues<D64>(pData, count);
+}
+
+inline void StringSerializer::WriteBlock(const void* pData, size_t size)
+{
+  static const char kHexDigits[] = "0123456789abcdef";
+  const Byte* pBytes = static_cast<const Byte*>(pData);
+  for (size_t i = 0; i < size; ++i)
+  {
+    mBuffer << kHexDigits[pBytes[i] >> 4];
+    mBuffer << kHexDigits[pBytes[i] & 0xf];
+  }
+  mBuffer << kTokenSeparator;
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 StringSerializer accessors
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -363,6 +457,44 @@ inline void StringSerializer::Ignore(U32 v)
 {
   mBufferPosition += v;
 }
+
+/*----------------------------------------------------------------------------------------------------------------------
+StringSerializer private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline void StringSerializer::ReadNumber(T& v)
+{
+  const size_t length = Text::ParseNumber(v, mBuffer.GetPtr() + mBufferPosition, mBuffer.GetLength() - mBufferPosition);
+  E_ASSERT_MSG(length != 0, E_ASSERT_MSG_STRING_SERIALIZER_NUMBER);
+  mBufferPosition += length + 1; // Skip the token delimiter
+}
+
+template <typename NumberType, typename T>
+inline void StringSerializer::ReadValues(T* pData, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    NumberType v;
+    ReadNumber(v);
+    pData[i] = static_cast<T>(v);
+  }
+}
+
+template <typename T>
+inline void StringSerializer::WriteNumber(T v)
+{
+  char buffer[Text::kMaxNumberLength];
+  const size_t length = Text::FormatNumber(buffer, v);
+  mBuffer.Append(buffer, length);
+  mBuffer << kTokenSeparator;
+}
+
+template <typename NumberType, typename T>
+inline void StringSerializer::WriteValues(const T* pData, size_t count)
+{
+  for (size_t i = 0; i < count; ++i) WriteNumber(static_cast<NumberType>(pData[i]));
+}
 }
 }
 
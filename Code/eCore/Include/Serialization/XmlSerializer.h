@@ -31,6 +31,7 @@ This file declares the XmlSerializer class.
 #define E3_XML_SERIALIZER_H
 
 #include "ISerializer.h"
+#include <FileSystem/Archive.h>
 #include <Base.h>
 
 namespace E
@@ -39,10 +40,32 @@ namespace Serialization
 {
 /*----------------------------------------------------------------------------------------------------------------------
 XmlSerializer
+
+Please note that this class has the following usage contract: 
+
+1. Each value is stored as a "value" attribute of the current tag. Write stores a whole array as a single attribute
+holding the values separated by spaces, and WriteBlock stores a raw byte block as a single hexadecimal attribute (two
+digits per byte). Arrays must therefore be read back with Read, and blocks with ReadBlock.
+2. By default the serializer works on an in memory document (DOM) which is written by Save and read by Load. BeginStream
+switches to a streaming mode on an open Archive until EndStream: the write mode emits the XML text as tags and values
+are serialized through a fixed size buffer and the read mode pulls tags from the Archive through a fixed size buffer
+without building a document, so memory usage does not depend on the document size. The Archive must stay open until
+EndStream, which closes the tags left open and flushes the write buffer.
+3. Streaming is forward only. When writing, values must be serialized right after their BeginTag (before any child tag)
+and tags with the same name are not merged. When reading, tags must be requested in document order (BeginTag skips the
+preceding sibling tags with other names) and each read consumes the next value attribute of the current tag, so values
+are read back in the order they were written. Missing tags and values read as zero or empty values, and a missing tag
+skips the rest of the current tag. Empty arrays and blocks are neither written nor read.
 ----------------------------------------------------------------------------------------------------------------------*/
 class XmlSerializer : public ISerializer
 {
 public:	
+  enum StreamMode
+  {
+    eStreamModeRead,
+    eStreamModeWrite
+  };
+
   E_API XmlSerializer();
   E_API ~XmlSerializer();
 
@@ -76,10 +99,27 @@ public:
   E_API void          operator>>(StringBuffer& v);
   E_API void          operator>>(String& v);
 
+  // Serialization
+  E_API void          Read(U16* pData, size_t count);
+  E_API void          Read(U32* pData, size_t count);
+  E_API void          Read(U64* pData, size_t count);
+  E_API void          Read(F32* pData, size_t count);
+  E_API void          Read(D64* pData, size_t count);
+  E_API void          ReadBlock(void* pData, size_t size);
+  E_API void          Write(const U16* pData, size_t count);
+  E_API void          Write(const U32* pData, size_t count);
+  E_API void          Write(const U64* pData, size_t count);
+  E_API void          Write(const F32* pData, size_t count);
+  E_API void          Write(const D64* pData, size_t count);
+  E_API void          WriteBlock(const void* pData, size_t size);
+
   // Methods
+  E_API void          BeginStream(FileSystem::Archive& archive, StreamMode streamMode);
   E_API void          BeginTag(const StringBuffer& name);
   E_API void          Clear();
+  E_API void          EndStream();
   E_API void          EndTag();
+  E_API bool          Load(const StringBuffer& fileName);
   E_API void          Save(const StringBuffer& fileName);
 
 private:
@@ -49,6 +49,8 @@ Please note that this class has the following usage contract:
 it is not intended as a serialization class as it does not allow to recover the original type value. For string based 
 serialization use the ISerializer based class StringSerializer.
 3. EnsureSize preserves existing context while Reserve just ensures memory allocation (content is not preserved).
+4. Appending grows the memory allocation geometrically (as List::PushBack does) so building a string by appending is
+linear in its length.
 ----------------------------------------------------------------------------------------------------------------------*/
 template <typename T>
 class CharList
@@ -123,6 +125,7 @@ private:
   template<typename U>  
   void                AppendValue(U v);
   void                AppendEnding();
+  void                Grow(size_t size);
 
   // Relying on default copy constructor and assignment operator
   // Note that copy construction is allowed through CharList(const T* pStr)
@@ -267,7 +270,7 @@ template <typename T>
 inline CharList<T>& CharList<T>::operator<<(T c)
 {
   // Ensure current count + 1 + null terminator
-  mList.EnsureSize(mList.GetCount() + 2);
+  Grow(mList.GetCount() + 2);
   mList.PushBack(c);
   AppendEnding();
   return *this;
@@ -380,7 +383,7 @@ template <typename T>
 inline void CharList<T>::Append(const T* pStr, size_t length)
 {
   // Ensure current count + length + null terminator
-  mList.EnsureSize(mList.GetCount() + length + 1);
+  Grow(mList.GetCount() + length + 1);
   mList.Copy(pStr, length, mList.GetCount());
   AppendEnding();
 }
@@ -439,6 +442,16 @@ inline void CharList<T>::AppendEnding()
   mList.PushBack(0);
   mList.PopBack();
 }
+
+template <typename T>
+inline void CharList<T>::Grow(size_t size)
+{
+  if (mList.GetSize() < size)
+  {
+    const size_t growSize = mList.GetSize() * (E_INTERNAL_SETTING_LIST_GROWTH_PERCENTAGE + 100) / 100;
+    mList.EnsureSize(Math::Max(size, growSize));
+  }
+}
 }
 }
 
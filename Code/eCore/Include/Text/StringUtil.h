@@ -27,7 +27,7 @@ DEALINGS IN THE SOFTWARE.
 // $Author: $
 
 /** @file StringUtil.h
-This file declares Utf8 string conversion functions.
+This file declares locale independent number formatting and parsing functions.
 */
 
 #ifndef E3_STRING_UTIL_H
@@ -37,7 +37,36 @@ This file declares Utf8 string conversion functions.
 
 namespace E
 {
+/*----------------------------------------------------------------------------------------------------------------------
+Text (numbers)
+
+Please note that this functions have the following usage contract:
+
+1. FormatNumber writes the value to pTarget (which must host kMaxNumberLength characters) without null-terminating it
+and returns the formatted length. It neither allocates memory nor depends on the current locale.
+2. Floating point values are formatted with Grisu2, which always parses back to the same value and yields the shortest
+digit sequence for all but about 1 in 1000 values (which get one extra digit). Fixed notation is used for decimal
+exponents in [-6, 21) and scientific notation otherwise (e.g. 0.1, 1.5e-7, 1e21). Non finite values are formatted as
+nan, inf and -inf.
+3. ParseNumber parses a number at the beginning of pSource (up to length characters) and returns the parsed length, or
+0 if there is no valid number (leading white space is not skipped). Integer overflows are considered invalid numbers.
+Floating point values are correctly rounded: the cases the fast paths cannot decide (subnormal values, decimal
+exponents out of [-64, 64], more than 19 significant digits and a few values close to a rounding tie) are parsed by a
+classic locale stream.
+----------------------------------------------------------------------------------------------------------------------*/
+namespace Text
+{
+static const size_t kMaxNumberLength = 32;
 
+E_API size_t  FormatNumber(char* pTarget, I64 v);
+E_API size_t  FormatNumber(char* pTarget, U64 v);
+E_API size_t  FormatNumber(char* pTarget, F32 v);
+E_API size_t  FormatNumber(char* pTarget, D64 v);
+E_API size_t  ParseNumber(I64& v, const char* pSource, size_t length);
+E_API size_t  ParseNumber(U64& v, const char* pSource, size_t length);
+E_API size_t  ParseNumber(F32& v, const char* pSource, size_t length);
+E_API size_t  ParseNumber(D64& v, const char* pSource, size_t length);
+}
 }
 
 #endif
@@ -43,9 +43,13 @@ namespace E
 
       inline U32  AddRelaxed32(U32* pObject, I32 operand) { return _InterlockedExchangeAdd((long *) pObject, operand); }
       U64         AddRelaxed64(U64* pObject, I64 operand);
+      inline U32  CompareExchange32(U32* pObject, U32 expected, U32 operand) { return _InterlockedCompareExchange((long *) pObject, operand, expected); }
+      // x86 / x64 never reorder loads with loads nor stores with stores, so acquire / release only need a compiler barrier
+      inline U32  LoadAcquire32(U32* pObject) { U32 result = *(volatile U32 *) pObject; _ReadWriteBarrier(); return result; }
       inline U32  LoadRelaxed32(U32* pObject) { return *pObject; }
       U64         LoadRelaxed64(U64* pObject);             
       inline void StoreRelaxed32(U32* pObject, U32 operand) { *pObject = operand; }
+      inline void StoreRelease32(U32* pObject, U32 operand) { _ReadWriteBarrier(); *(volatile U32 *) pObject = operand; }
       void        StoreRelaxed64(U64* pObject, U64 operand);
     }
 	}
@@ -56,6 +56,11 @@ Archive::~Archive()
 Archive accessors
 ----------------------------------------------------------------------------------------------------------------------*/	
 
+const Path& Archive::GetPath() const
+{
+  return mFilePath;
+}
+
 bool Archive::IsOpen() const
 {
   return mFileStream.is_open();
@@ -76,28 +81,32 @@ bool Archive::Open(const Path& filePath, OpenMode openMode /* = eOpenModeRead */
   E_ASSERT(filePath.GetLength());
   if (openMode == eOpenModeRead)
   {
-    mFileStream.open(filePath.GetPtr(), std::ios::in);
+    mFileStream.open(filePath.GetPtr(), std::ios::in | std::ios::binary);
   }
   else if (openMode == eOpenModeWrite)
   {
-    mFileStream.open(filePath.GetPtr(), std::ios::out);
+    mFileStream.open(filePath.GetPtr(), std::ios::out | std::ios::binary);
   }
   else
   {
-    mFileStream.open(filePath.GetPtr(), std::ios::app);
+    mFileStream.open(filePath.GetPtr(), std::ios::app | std::ios::binary);
   }
+  if (!mFileStream.is_open()) return false;
 
-  return mFileStream.is_open();
+  mFilePath = filePath;
+  return true;
 }
 
-void Archive::Read(char* pTarget, size_t length)
+size_t Archive::Read(char* pTarget, size_t length)
 {
   mFileStream.read(pTarget, length);
+  return static_cast<size_t>(mFileStream.gcount());
 }
 
-void Archive::Write(const char* pSource, size_t length)
+bool Archive::Write(const char* pSource, size_t length)
 {
   mFileStream.write(pSource, length);
+  return !mFileStream.fail();
 }
 }
 }
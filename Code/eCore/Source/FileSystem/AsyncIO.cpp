@@ -0,0 +1,353 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file AsyncIO.cpp
+This file defines the AsyncIO class.
+*/
+
+#include <CorePch.h>
+#include <Math/Algorithm.h>
+#ifdef WIN32
+#include "Win32/AsyncIOImpl.h"
+#else
+#include "Posix/AsyncIOImpl.h"
+#endif
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+AsyncIO auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Orders group entries by range so the file is read forward and identical ranges are adjacent
+template <typename T>
+struct AsyncIOEntryComparer
+{
+  inline static bool IsEqual(const T& a, const T& b) { return a.offset == b.offset && a.size == b.size; }
+  inline static bool IsLess(const T& a, const T& b) { return a.offset < b.offset || (a.offset == b.offset && a.size < b.size); }
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+AsyncIO::Worker
+
+An I/O thread. Each worker owns a platform implementation instance, so implementations need no synchronization.
+----------------------------------------------------------------------------------------------------------------------*/
+class AsyncIO::Worker : public Threads::IRunnable, public Memory::ProxyAllocated
+{
+public:
+                    explicit Worker(AsyncIO& asyncIO);
+                    ~Worker();
+
+private:
+  AsyncIO&          mAsyncIO;
+  Impl              mImpl;
+  Threads::Thread   mThread;
+
+  void              Prepare(Group& group);
+  I32               Run();
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(Worker)
+};
+
+// Known warning: passing this in the initializer list. The Thread member gets a reference to this as a IRunnable object
+// (whose Run method is executed in Thread::Start).
+#pragma warning(push)
+#pragma warning (disable:4355)
+AsyncIO::Worker::Worker(AsyncIO& asyncIO)
+  : mAsyncIO(asyncIO)
+  , mThread(*this)
+{
+  mThread.Start();
+}
+#pragma warning(pop)
+
+AsyncIO::Worker::~Worker()
+{
+  mThread.WaitForTermination();
+}
+
+void AsyncIO::Worker::Prepare(Group& group)
+{
+  const size_t entryCount = group.entryList.GetCount();
+  Entry* pEntries = group.entryList.GetPtr();
+  Math::Sorting<Entry, AsyncIOEntryComparer>::IntroSort(pEntries, entryCount);
+  for (size_t i = 0; i < entryCount; ++i)
+  {
+    pEntries[i].readSize = 0;
+    pEntries[i].succeeded = false;
+    pEntries[i].isDuplicate = (i > 0 && AsyncIOEntryComparer<Entry>::IsEqual(pEntries[i - 1], pEntries[i]));
+  }
+}
+
+I32 AsyncIO::Worker::Run()
+{
+  Group* pGroups[kBatchSize];
+  for (;;)
+  {
+    const size_t groupCount = mAsyncIO.TakeGroups(pGroups);
+    // No groups are only returned on termination
+    if (groupCount == 0) break;
+    for (size_t i = 0; i < groupCount; ++i) Prepare(*pGroups[i]);
+    mImpl.Read(pGroups, groupCount);
+    mAsyncIO.CompleteGroups(pGroups, groupCount);
+  }
+  return 0;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+AsyncIO initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+AsyncIO::AsyncIO(U32 threadCount /* = 0 */)
+  : mNextRequestId(0)
+  , mPendingRequestCount(0)
+  , mTerminationFlag(false)
+{
+  if (threadCount == 0) threadCount = Math::Max(Threads::Thread::GetProcessorCount(), 1U);
+  for (U32 i = 0; i < threadCount; ++i) mWorkerList.PushBack(new Worker(*this));
+}
+
+AsyncIO::~AsyncIO()
+{
+  WaitForIdle();
+  // [Critical section]
+  {
+    Threads::Lock l(mMutex);
+    mTerminationFlag = true;
+    mRequestCondition.Broadcast();
+  }
+  // Worker destruction waits for the thread termination
+  for (auto it = begin(mWorkerList); it != end(mWorkerList); ++it) delete *it;
+  for (auto it = begin(mFreeGroupList); it != end(mFreeGroupList); ++it) E_DELETE(*it);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+AsyncIO accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+AsyncIO::CompletionEventCallback& AsyncIO::GetCompletionEventCallback()
+{
+  return mCompletionEventCallback;
+}
+
+U32 AsyncIO::GetPendingRequestCount() const
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  return mPendingRequestCount;
+}
+
+U32 AsyncIO::GetThreadCount() const
+{
+  return static_cast<U32>(mWorkerList.GetCount());
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+AsyncIO methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+AsyncIO::RequestId AsyncIO::AddRequest(const Request& request)
+{
+  E_ASSERT_MSG(request.filePath.GetLength() && (request.pBuffer || request.size == 0), E_ASSERT_MSG_ASYNC_IO_REQUEST_VALUE);
+  E_ASSERT_MSG(request.priority < ePriorityCount, E_ASSERT_MSG_ASYNC_IO_PRIORITY_VALUE);
+  const U64 pathHash = Math::XxHash64::Hash(request.filePath.GetPtr(), request.filePath.GetLength());
+
+  // [Critical section]
+  Threads::Lock l(mMutex);
+
+  Entry entry;
+  entry.id = mNextRequestId++;
+  entry.pBuffer = request.pBuffer;
+  entry.pHandler = request.pHandler;
+  entry.pUserData = request.pUserData;
+  entry.offset = request.offset;
+  entry.size = request.size;
+  entry.readSize = 0;
+  entry.succeeded = false;
+  entry.isDuplicate = false;
+
+  // Coalesce the request with the pending group of the same file (if any)
+  GroupMap::Pair* pPair = mPendingGroupMap.FindPair(pathHash);
+  Group* pGroup = (pPair && pPair->second->filePath == request.filePath) ? pPair->second : nullptr;
+  if (pGroup == nullptr)
+  {
+    pGroup = CreateGroup();
+    pGroup->filePath = request.filePath;
+    pGroup->pathHash = pathHash;
+    pGroup->priority = request.priority;
+    // On a (very unlikely) hash collision the new group is just not coalesced
+    if (pPair == nullptr) mPendingGroupMap.Insert(pathHash, pGroup);
+    mPendingGroupQueues[request.priority].Push(pGroup);
+    ++pGroup->queueReferenceCount;
+  }
+  else if (request.priority < pGroup->priority)
+  {
+    // Promote the group: the lower priority queue slot is discarded when popped
+    pGroup->priority = request.priority;
+    mPendingGroupQueues[request.priority].Push(pGroup);
+    ++pGroup->queueReferenceCount;
+  }
+  pGroup->entryList.PushBack(entry);
+  ++mPendingRequestCount;
+  mRequestCondition.Signal();
+
+  return entry.id;
+}
+
+size_t AsyncIO::Dispatch()
+{
+  // [Critical section]
+  {
+    Threads::Lock l(mMutex);
+    mDispatchEventList.PushBack(mCompletionEventList);
+    mCompletionEventList.Clear();
+  }
+  // Events are raised out of the critical section so handlers can add new requests
+  const size_t eventCount = mDispatchEventList.GetCount();
+  for (size_t i = 0; i < eventCount; ++i) mCompletionEventCallback.Raise(mDispatchEventList[i]);
+  mDispatchEventList.Clear();
+
+  return eventCount;
+}
+
+void AsyncIO::WaitForIdle()
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  while (mPendingRequestCount) mIdleCondition.Wait(mMutex);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+AsyncIO private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void AsyncIO::CompleteGroups(Group** ppGroups, size_t count)
+{
+  U32 requestCount = 0;
+  for (size_t i = 0; i < count; ++i)
+  {
+    Group& group = *ppGroups[i];
+    const size_t entryCount = group.entryList.GetCount();
+    for (size_t j = 0; j < entryCount; ++j)
+    {
+      Entry& entry = group.entryList[j];
+      if (entry.isDuplicate)
+      {
+        const Entry& sourceEntry = group.entryList[j - 1];
+        if (sourceEntry.readSize) Memory::Copy(entry.pBuffer, sourceEntry.pBuffer, sourceEntry.readSize);
+        entry.readSize = sourceEntry.readSize;
+        entry.succeeded = sourceEntry.succeeded;
+      }
+      if (entry.pHandler)
+      {
+        CompletionEvent event = { entry.id, entry.pBuffer, entry.pUserData, entry.readSize, entry.succeeded };
+        entry.pHandler->OnRequestCompletion(event);
+      }
+    }
+    requestCount += static_cast<U32>(entryCount);
+  }
+
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  for (size_t i = 0; i < count; ++i)
+  {
+    Group* pGroup = ppGroups[i];
+    const size_t entryCount = pGroup->entryList.GetCount();
+    for (size_t j = 0; j < entryCount; ++j)
+    {
+      const Entry& entry = pGroup->entryList[j];
+      CompletionEvent event = { entry.id, entry.pBuffer, entry.pUserData, entry.readSize, entry.succeeded };
+      mCompletionEventList.PushBack(event);
+    }
+    pGroup->entryList.Clear();
+    // Groups still referenced by a pending queue slot are recycled when the slot is popped
+    if (pGroup->queueReferenceCount == 0) mFreeGroupList.PushBack(pGroup);
+  }
+  mPendingRequestCount -= requestCount;
+  if (mPendingRequestCount == 0) mIdleCondition.Broadcast();
+}
+
+AsyncIO::Group* AsyncIO::CreateGroup()
+{
+  Group* pGroup = nullptr;
+  if (mFreeGroupList.IsEmpty())
+  {
+    pGroup = E_NEW(Group);
+  }
+  else
+  {
+    pGroup = *mFreeGroupList.GetBack();
+    mFreeGroupList.PopBack();
+  }
+  pGroup->queueReferenceCount = 0;
+  pGroup->isTaken = false;
+  return pGroup;
+}
+
+size_t AsyncIO::TakeGroups(Group** ppGroups)
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+
+  size_t groupCount = 0;
+  while (groupCount == 0)
+  {
+    bool isQueueEmpty = true;
+    for (U32 i = 0; i < ePriorityCount && isQueueEmpty; ++i) isQueueEmpty = mPendingGroupQueues[i].IsEmpty();
+    if (isQueueEmpty)
+    {
+      if (mTerminationFlag) break;
+      mRequestCondition.Wait(mMutex);
+      continue;
+    }
+
+    for (U32 i = 0; i < ePriorityCount && groupCount < kBatchSize; ++i)
+    {
+      GroupQueue& groupQueue = mPendingGroupQueues[i];
+      while (!groupQueue.IsEmpty() && groupCount < kBatchSize)
+      {
+        Group* pGroup = groupQueue.GetFront();
+        groupQueue.Pop();
+        --pGroup->queueReferenceCount;
+        if (pGroup->isTaken)
+        {
+          // Slot left behind by a promotion
+          if (pGroup->queueReferenceCount == 0 && pGroup->entryList.IsEmpty()) mFreeGroupList.PushBack(pGroup);
+          continue;
+        }
+        pGroup->isTaken = true;
+        GroupMap::Pair* pPair = mPendingGroupMap.FindPair(pGroup->pathHash);
+        if (pPair && pPair->second == pGroup) mPendingGroupMap.RemovePair(pPair);
+        ppGroups[groupCount++] = pGroup;
+      }
+    }
+  }
+
+  return groupCount;
+}
+}
+}
@@ -0,0 +1,429 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 19-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file DerivedDataCache.cpp
+This file defines the DerivedDataCache class.
+*/
+
+#include <CorePch.h>
+#include <Math/Algorithm.h>
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+FileSystem::Global methods
+
+Please note that these methods must be defined in a source file instead of inline to guarantee a unique global instance
+across DLLs as static variables are local to the compilation unit.
+----------------------------------------------------------------------------------------------------------------------*/
+DerivedDataCache& Global::GetDerivedDataCache()
+{
+  return Singleton<DerivedDataCache>::GetInstance();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+DerivedDataCache auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+
+static const char   kDerivedDataCacheIndexFileName[] = "index.ddi";
+static const size_t kDerivedDataCacheKeyLength = 16;  // Hexadecimal digits of a key
+
+// Orders index entries by last use so the least recently used entries are evicted first
+template <typename T>
+struct DerivedDataCacheEntryComparer
+{
+  inline static bool IsEqual(const T& a, const T& b) { return a.lastUse == b.lastUse; }
+  inline static bool IsLess(const T& a, const T& b) { return a.lastUse < b.lastUse; }
+};
+
+static bool DerivedDataCacheParseKey(const char* pFileName, U64& key)
+{
+  // Entry file names are the key in hexadecimal followed by the extension
+  if (strlen(pFileName) != kDerivedDataCacheKeyLength + strlen(DerivedDataCache::kExtension) ||
+      strcmp(pFileName + kDerivedDataCacheKeyLength, DerivedDataCache::kExtension) != 0) return false;
+
+  key = 0;
+  for (size_t i = 0; i < kDerivedDataCacheKeyLength; ++i)
+  {
+    const char c = pFileName[i];
+    U64 digit;
+    if (c >= '0' && c <= '9') digit = c - '0';
+    else if (c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+    else return false;
+    key = (key << 4) | digit;
+  }
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+DerivedDataCache initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+const char DerivedDataCache::kExtension[] = ".ddc";
+
+DerivedDataCache::DerivedDataCache()
+  : mMaxSize(0)
+  , mSize(0)
+  , mUseCount(0)
+  , mOpen(false)
+{}
+
+DerivedDataCache::~DerivedDataCache()
+{
+  Close();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+DerivedDataCache accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+size_t DerivedDataCache::GetCount() const
+{
+  Threads::Lock l(mMutex);
+  return mEntryList.GetCount();
+}
+
+const Path& DerivedDataCache::GetDirectory() const
+{
+  return mDirectory;
+}
+
+U64 DerivedDataCache::GetMaxSize() const
+{
+  return mMaxSize;
+}
+
+U64 DerivedDataCache::GetSize() const
+{
+  Threads::Lock l(mMutex);
+  return mSize;
+}
+
+bool DerivedDataCache::IsOpen() const
+{
+  return mOpen;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+DerivedDataCache methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void DerivedDataCache::Close()
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  if (!mOpen) return;
+
+  SaveIndex();
+  mEntryList.Clear();
+  mEntryMap.Clear();
+  mSize = 0;
+  mUseCount = 0;
+  mOpen = false;
+}
+
+bool DerivedDataCache::Contains(U64 key) const
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  return mOpen && mEntryMap.FindPair(key) != nullptr;
+}
+
+bool DerivedDataCache::Get(U64 key, Containers::List<Byte>& data)
+{
+  Path filePath;
+  {
+    // [Critical section]
+    Threads::Lock l(mMutex);
+    if (!mOpen || mEntryMap.FindPair(key) == nullptr) return false;
+    filePath = GetFilePath(key);
+  }
+
+  bool valid = false;
+  {
+    MappedFile entryFile;
+    if (entryFile.Open(filePath) && entryFile.GetSize() >= sizeof(Header))
+    {
+      const Header& header = *reinterpret_cast<const Header*>(entryFile.GetPtr());
+      const Byte* pData = entryFile.GetPtr() + sizeof(Header);
+      const size_t size = entryFile.GetSize() - sizeof(Header);
+      valid = header.magic == kMagic && header.version == kVersion && header.key == key && header.size == size &&
+        header.dataHash == Math::XxHash64::Hash(pData, size);
+      if (valid)
+      {
+        data.EnsureSize(size);
+        data.SetCount(size);
+        Memory::Copy(data.GetPtr(), pData, size);
+      }
+    }
+  }
+
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  if (!valid)
+  {
+    // Damaged (or concurrently evicted) entries are dropped so the caller processes and puts the data again
+    if (mOpen) RemoveEntry(key);
+    return false;
+  }
+  Entry* pEntry = mOpen ? FindEntry(key) : nullptr;
+  if (pEntry) pEntry->lastUse = ++mUseCount;
+  return true;
+}
+
+bool DerivedDataCache::Open(const Path& directory, U64 maxSize)
+{
+  Close();
+
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  File::Info directoryInfo;
+  if (File::GetInfo(directory, directoryInfo))
+  {
+    if ((directoryInfo.flags & File::eFlagDirectory) == 0) return false;
+  }
+  else if (!Directory::Create(directory)) return false;
+
+  mDirectory = directory;
+  mMaxSize = maxSize;
+  if (!LoadIndex()) RebuildIndex();
+  mOpen = true;
+  Evict();
+  return true;
+}
+
+bool DerivedDataCache::Put(U64 key, const void* pData, size_t size)
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  if (!mOpen || size > mMaxSize) return false;
+
+  Header header;
+  header.magic = kMagic;
+  header.version = kVersion;
+  header.key = key;
+  header.size = size;
+  header.dataHash = Math::XxHash64::Hash(pData, size);
+  const Path filePath = GetFilePath(key);
+  bool written;
+  {
+    Archive entryFile;
+    if (!entryFile.Open(filePath, Archive::eOpenModeWrite)) return false;
+    written = entryFile.Write(reinterpret_cast<const char*>(&header), sizeof(Header)) &&
+      entryFile.Write(static_cast<const char*>(pData), size);
+  }
+  if (!written)
+  {
+    // The partial file replaced any previous entry of the key, so both are dropped
+    RemoveEntry(key);
+    File::Destroy(filePath);
+    return false;
+  }
+
+  Entry* pEntry = FindEntry(key);
+  if (pEntry)
+  {
+    mSize -= pEntry->size;
+    mSize += size;
+    pEntry->size = size;
+    pEntry->lastUse = ++mUseCount;
+  }
+  else
+  {
+    Entry entry;
+    entry.key = key;
+    entry.size = size;
+    entry.lastUse = ++mUseCount;
+    AddEntry(entry);
+  }
+  Evict();
+  return true;
+}
+
+bool DerivedDataCache::Remove(U64 key)
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  if (!mOpen || mEntryMap.FindPair(key) == nullptr) return false;
+
+  RemoveEntry(key);
+  return true;
+}
+
+U64 DerivedDataCache::GetKey(const void* pSourceData, size_t sourceSize, const char* pProcessing)
+{
+  // The processing string length is hashed first so the source and processing bytes can not be mistaken for each other
+  const U64 processingLength = strlen(pProcessing);
+  Math::XxHash64 hash;
+  hash.Update(&processingLength, sizeof(processingLength));
+  hash.Update(pProcessing, static_cast<size_t>(processingLength));
+  hash.Update(pSourceData, sourceSize);
+  // All ones is the invalid key of the entry map
+  const U64 key = hash.GetHash();
+  return key == U64(-1) ? 0 : key;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+DerivedDataCache private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool DerivedDataCache::AddEntry(const Entry& entry)
+{
+  if (entry.key == U64(-1) || mEntryMap.FindPair(entry.key)) return false;
+
+  mEntryMap.Insert(entry.key, static_cast<U32>(mEntryList.GetCount()));
+  mEntryList.PushBack(entry);
+  mSize += entry.size;
+  return true;
+}
+
+void DerivedDataCache::Evict()
+{
+  if (mSize <= mMaxSize) return;
+
+  EntryList entryList(mEntryList.GetPtr(), mEntryList.GetCount());
+  const size_t entryCount = entryList.GetCount();
+  if (entryCount > 1) Math::Sorting<Entry, DerivedDataCacheEntryComparer>::IntroSort(entryList.GetPtr(), entryCount);
+  for (size_t i = 0; i < entryCount && mSize > mMaxSize; ++i) RemoveEntry(entryList[i].key);
+}
+
+DerivedDataCache::Entry* DerivedDataCache::FindEntry(U64 key)
+{
+  const EntryMap::Pair* pPair = mEntryMap.FindPair(key);
+  return pPair ? &mEntryList[pPair->second] : nullptr;
+}
+
+Path DerivedDataCache::GetFilePath(U64 key) const
+{
+  static const char kDigits[] = "0123456789abcdef";
+  Path filePath(mDirectory);
+  filePath += '/';
+  for (size_t i = kDerivedDataCacheKeyLength; i > 0; --i) filePath += kDigits[(key >> ((i - 1) * 4)) & 0xf];
+  filePath += kExtension;
+  return filePath;
+}
+
+Path DerivedDataCache::GetIndexFilePath() const
+{
+  Path filePath(mDirectory);
+  filePath += '/';
+  filePath += kDerivedDataCacheIndexFileName;
+  return filePath;
+}
+
+bool DerivedDataCache::LoadIndex()
+{
+  const Path indexFilePath = GetIndexFilePath();
+  {
+    MappedFile indexFile;
+    if (!indexFile.Open(indexFilePath) || indexFile.GetSize() < sizeof(IndexHeader)) return false;
+
+    const IndexHeader& header = *reinterpret_cast<const IndexHeader*>(indexFile.GetPtr());
+    if (header.magic != kIndexMagic || header.version != kVersion ||
+        indexFile.GetSize() != sizeof(IndexHeader) + static_cast<U64>(header.entryCount) * sizeof(Entry)) return false;
+
+    const Entry* pEntries = reinterpret_cast<const Entry*>(indexFile.GetPtr() + sizeof(IndexHeader));
+    mEntryList.Clear();
+    mEntryMap.Clear();
+    mSize = 0;
+    for (U32 i = 0; i < header.entryCount; ++i) AddEntry(pEntries[i]);
+    mUseCount = header.useCount;
+  }
+  // The index is only valid until the cache changes: it is removed once loaded and saved again by Close, so a cache
+  // that is not closed (e.g. a crash) is rebuilt from the directory listing by the next Open
+  File::Destroy(indexFilePath);
+  return true;
+}
+
+void DerivedDataCache::RebuildIndex()
+{
+  mEntryList.Clear();
+  mEntryMap.Clear();
+  mSize = 0;
+  mUseCount = 0;
+
+  PathList pathList;
+  Directory::GetChildren(mDirectory, pathList, File::eFlagFile);
+  for (size_t i = 0; i < pathList.GetCount(); ++i)
+  {
+    const Path& filePath = pathList[i];
+    size_t nameOffset = filePath.GetLength();
+    while (nameOffset > 0 && filePath[nameOffset - 1] != '/' && filePath[nameOffset - 1] != '\\') --nameOffset;
+
+    U64 key;
+    File::Info fileInfo;
+    if (!DerivedDataCacheParseKey(filePath.GetPtr() + nameOffset, key) || !File::GetInfo(filePath, fileInfo)) continue;
+    if (fileInfo.byteSize < sizeof(Header))
+    {
+      File::Destroy(filePath);
+      continue;
+    }
+    // Entries found this way are the least recently used ones (their data is validated by Get as usual)
+    Entry entry;
+    entry.key = key;
+    entry.size = fileInfo.byteSize - sizeof(Header);
+    entry.lastUse = 0;
+    AddEntry(entry);
+  }
+}
+
+void DerivedDataCache::RemoveEntry(U64 key)
+{
+  EntryMap::Pair* pPair = mEntryMap.FindPair(key);
+  if (pPair == nullptr) return;
+
+  // The last entry takes the place of the removed one
+  const U32 index = pPair->second;
+  File::Destroy(GetFilePath(key));
+  mSize -= mEntryList[index].size;
+  mEntryMap.RemovePair(pPair);
+  const size_t lastIndex = mEntryList.GetCount() - 1;
+  if (index != lastIndex)
+  {
+    mEntryList[index] = mEntryList[lastIndex];
+    mEntryMap.FindPair(mEntryList[index].key)->second = index;
+  }
+  mEntryList.PopBack();
+}
+
+bool DerivedDataCache::SaveIndex() const
+{
+  Archive indexFile;
+  if (!indexFile.Open(GetIndexFilePath(), Archive::eOpenModeWrite)) return false;
+
+  IndexHeader header;
+  header.magic = kIndexMagic;
+  header.version = kVersion;
+  header.entryCount = static_cast<U32>(mEntryList.GetCount());
+  header.reserved = 0;
+  header.useCount = mUseCount;
+  indexFile.Write(reinterpret_cast<const char*>(&header), sizeof(IndexHeader));
+  indexFile.Write(reinterpret_cast<const char*>(mEntryList.GetPtr()), mEntryList.GetCount() * sizeof(Entry));
+  return true;
+}
+}
+}
@@ -0,0 +1,388 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 19-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file DirectoryScanner.cpp
+This file defines the DirectoryScanner class.
+*/
+
+#include <CorePch.h>
+#include <Math/Algorithm.h>
+#ifdef WIN32
+#include "Win32/DirectoryScannerImpl.h"
+#else
+#include "Posix/DirectoryScannerImpl.h"
+#endif
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+DirectoryScanner auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Orders listings by directory path so scans of the same tree store their records in the same order
+template <typename T>
+struct DirectoryScannerListingComparer
+{
+  inline static bool IsEqual(const T& a, const T& b) { return strcmp(a->path.GetPtr(), b->path.GetPtr()) == 0; }
+  inline static bool IsLess(const T& a, const T& b) { return strcmp(a->path.GetPtr(), b->path.GetPtr()) < 0; }
+};
+
+inline U64 DirectoryScannerGetPathHash(const char* pPath, size_t length)
+{
+  return Math::XxHash64::Hash(pPath, length);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+DirectoryScanner::Task
+
+A scanning task. Every task runs ProcessDirectories until the whole tree has been listed.
+----------------------------------------------------------------------------------------------------------------------*/
+class DirectoryScanner::Task : public Threads::IRunnable
+{
+public:
+  DirectoryScanner* pScanner;
+
+  I32               Run();
+};
+
+I32 DirectoryScanner::Task::Run()
+{
+  pScanner->ProcessDirectories();
+  return 0;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+DirectoryScanner initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+DirectoryScanner::DirectoryScanner(Threads::ThreadPool& threadPool /* = Threads::Global::GetThreadPool() */)
+  : mThreadPool(threadPool)
+  , mBusyTaskCount(0)
+  , mListedDirectoryCount(0) {}
+
+DirectoryScanner::~DirectoryScanner() {}
+
+/*----------------------------------------------------------------------------------------------------------------------
+DirectoryScanner accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+const DirectoryScanner::DirectoryList& DirectoryScanner::GetDirectoryList() const
+{
+  return mDirectoryList;
+}
+
+U32 DirectoryScanner::GetListedDirectoryCount() const
+{
+  return mListedDirectoryCount;
+}
+
+const char* DirectoryScanner::GetName(const Record& record) const
+{
+  E_ASSERT_MSG(record.nameOffset + record.nameLength < mNameList.GetCount(), E_ASSERT_MSG_DIRECTORY_SCANNER_RECORD_VALUE);
+  return mNameList.GetPtr() + record.nameOffset;
+}
+
+const char* DirectoryScanner::GetPath(const Directory& directory) const
+{
+  E_ASSERT_MSG(directory.pathOffset + directory.pathLength < mNameList.GetCount(), E_ASSERT_MSG_DIRECTORY_SCANNER_RECORD_VALUE);
+  return mNameList.GetPtr() + directory.pathOffset;
+}
+
+Path DirectoryScanner::GetPath(const Record& record) const
+{
+  E_ASSERT_MSG(record.directoryIndex < mDirectoryList.GetCount(), E_ASSERT_MSG_DIRECTORY_SCANNER_RECORD_VALUE);
+  Path path(GetPath(mDirectoryList[record.directoryIndex]));
+  path += Impl::kSeparatorCharacter;
+  path += GetName(record);
+  return path;
+}
+
+const DirectoryScanner::RecordList& DirectoryScanner::GetRecordList() const
+{
+  return mRecordList;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+DirectoryScanner methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void DirectoryScanner::Clear()
+{
+  mDirectoryMap.Clear();
+  mDirectoryList.Clear();
+  mRecordList.Clear();
+  mNameList.Clear();
+  mListedDirectoryCount = 0;
+}
+
+bool DirectoryScanner::LoadCache(const Path& filePath)
+{
+  MappedFile cacheFile;
+  if (!cacheFile.Open(filePath) || cacheFile.GetSize() < sizeof(Header)) return false;
+
+  const Byte* pData = cacheFile.GetPtr();
+  const Header& header = *reinterpret_cast<const Header*>(pData);
+  const U64 dataSize = sizeof(Header) +
+    static_cast<U64>(header.directoryCount) * sizeof(Directory) +
+    static_cast<U64>(header.recordCount) * sizeof(Record) +
+    header.nameCount;
+  if (header.magic != kMagic || header.version != kVersion || dataSize != cacheFile.GetSize()) return false;
+
+  const Directory* pDirectories = reinterpret_cast<const Directory*>(pData + sizeof(Header));
+  const Record* pRecords = reinterpret_cast<const Record*>(pDirectories + header.directoryCount);
+  const char* pNames = reinterpret_cast<const char*>(pRecords + header.recordCount);
+  // Validate the layout so accessors can trust it (ranges in bounds and null terminated names)
+  for (U32 i = 0; i < header.directoryCount; ++i)
+  {
+    const Directory& directory = pDirectories[i];
+    if (directory.firstRecordIndex > header.recordCount ||
+        directory.recordCount > header.recordCount - directory.firstRecordIndex ||
+        directory.pathOffset >= header.nameCount ||
+        directory.pathLength >= header.nameCount - directory.pathOffset ||
+        pNames[directory.pathOffset + directory.pathLength] != '\0') return false;
+  }
+  for (U32 i = 0; i < header.recordCount; ++i)
+  {
+    const Record& record = pRecords[i];
+    if (record.directoryIndex >= header.directoryCount ||
+        record.nameOffset >= header.nameCount ||
+        record.nameLength >= header.nameCount - record.nameOffset ||
+        pNames[record.nameOffset + record.nameLength] != '\0') return false;
+  }
+
+  Clear();
+  mDirectoryList.EnsureSize(header.directoryCount);
+  mDirectoryList.SetCount(header.directoryCount);
+  mRecordList.EnsureSize(header.recordCount);
+  mRecordList.SetCount(header.recordCount);
+  mNameList.EnsureSize(header.nameCount);
+  mNameList.SetCount(header.nameCount);
+  Memory::Copy(mDirectoryList.GetPtr(), pDirectories, header.directoryCount);
+  Memory::Copy(mRecordList.GetPtr(), pRecords, header.recordCount);
+  Memory::Copy(mNameList.GetPtr(), pNames, header.nameCount);
+  BuildDirectoryMap();
+  return true;
+}
+
+bool DirectoryScanner::SaveCache(const Path& filePath) const
+{
+  Archive cacheFile;
+  if (!cacheFile.Open(filePath, Archive::eOpenModeWrite)) return false;
+
+  Header header;
+  header.magic = kMagic;
+  header.version = kVersion;
+  header.directoryCount = static_cast<U32>(mDirectoryList.GetCount());
+  header.recordCount = static_cast<U32>(mRecordList.GetCount());
+  header.nameCount = static_cast<U32>(mNameList.GetCount());
+  header.reserved = 0;
+  cacheFile.Write(reinterpret_cast<const char*>(&header), sizeof(Header));
+  cacheFile.Write(reinterpret_cast<const char*>(mDirectoryList.GetPtr()), mDirectoryList.GetCount() * sizeof(Directory));
+  cacheFile.Write(reinterpret_cast<const char*>(mRecordList.GetPtr()), mRecordList.GetCount() * sizeof(Record));
+  cacheFile.Write(mNameList.GetPtr(), mNameList.GetCount());
+  return true;
+}
+
+bool DirectoryScanner::Scan(const Path& rootPath)
+{
+  E_ASSERT_MSG(rootPath.GetLength(), E_ASSERT_MSG_DIRECTORY_SCANNER_PATH_VALUE);
+  // Trailing separators would be repeated in every path
+  Path path(rootPath);
+  while (path.GetLength() > 1 && path[path.GetLength() - 1] == Impl::kSeparatorCharacter) path.SetLength(path.GetLength() - 1);
+  U64 writeTime;
+  if (!Impl::GetWriteTime(path, writeTime)) return false;
+
+  mPendingDirectoryStack.PushBack(path);
+  mBusyTaskCount = 0;
+  mListedDirectoryCount = 0;
+
+  // The last task is run by the calling thread (or any task the thread pool can not accept)
+  const size_t taskCount = Math::Min<size_t>(Math::Max(Threads::Thread::GetProcessorCount(), 1U), kMaxTaskCount);
+  Task taskList[kMaxTaskCount];
+  bool addedTaskList[kMaxTaskCount];
+  for (size_t i = 0; i < taskCount; ++i)
+  {
+    taskList[i].pScanner = this;
+    addedTaskList[i] = (i + 1 < taskCount) && mThreadPool.AddItem(&taskList[i]);
+    if (!addedTaskList[i]) taskList[i].Run();
+  }
+  for (size_t i = 0; i < taskCount; ++i)
+  {
+    if (addedTaskList[i]) mThreadPool.WaitForItem(&taskList[i]);
+  }
+
+  StoreListings();
+  BuildDirectoryMap();
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+DirectoryScanner private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void DirectoryScanner::BuildDirectoryMap()
+{
+  mDirectoryMap.Clear();
+  for (size_t i = 0; i < mDirectoryList.GetCount(); ++i)
+  {
+    const Directory& directory = mDirectoryList[i];
+    mDirectoryMap.Insert(DirectoryScannerGetPathHash(GetPath(directory), directory.pathLength), static_cast<U32>(i));
+  }
+}
+
+/**
+Gathers the entries of a directory, reusing the cached ones when the directory write time did not change. Returns true
+if the directory had to be listed.
+*/
+bool DirectoryScanner::ProcessDirectory(const Path& path, Listing& listing)
+{
+  listing.path = path;
+  listing.writeTime = 0;
+
+  // Cached directories are only accessed for reading while scanning
+  const DirectoryMap::Pair* pPair = mDirectoryMap.FindPair(DirectoryScannerGetPathHash(path.GetPtr(), path.GetLength()));
+  if (pPair)
+  {
+    const Directory& directory = mDirectoryList[pPair->second];
+    if (Impl::GetWriteTime(path, listing.writeTime) &&
+        listing.writeTime == directory.writeTime &&
+        directory.pathLength == path.GetLength() &&
+        strcmp(GetPath(directory), path.GetPtr()) == 0)
+    {
+      listing.recordList.EnsureSize(directory.recordCount);
+      listing.recordList.SetCount(directory.recordCount);
+      const Record* pRecords = mRecordList.GetPtr() + directory.firstRecordIndex;
+      for (U32 i = 0; i < directory.recordCount; ++i)
+      {
+        Record& record = listing.recordList[i];
+        record = pRecords[i];
+        record.nameOffset = static_cast<U32>(listing.nameList.GetCount());
+        listing.nameList.PushBack(GetName(pRecords[i]), pRecords[i].nameLength + 1);
+      }
+      return false;
+    }
+  }
+
+  Impl::List(path, listing);
+  return true;
+}
+
+void DirectoryScanner::ProcessDirectories()
+{
+  Listing* pListing = nullptr;
+  bool isListed = false;
+  Path path;
+  for (;;)
+  {
+    // [Critical section]
+    {
+      Threads::Lock l(mMutex);
+      // Store the previous listing and push its subdirectories
+      if (pListing)
+      {
+        mListingList.PushBack(pListing);
+        if (isListed) ++mListedDirectoryCount;
+        const size_t pathLength = pListing->path.GetLength();
+        bool hasSubdirectories = false;
+        for (size_t i = 0; i < pListing->recordList.GetCount(); ++i)
+        {
+          const Record& record = pListing->recordList[i];
+          // Subdirectories exceeding the maximum path length are recorded but not listed
+          if (!(record.info.flags & File::eFlagDirectory) ||
+              pathLength + 1 + record.nameLength >= E_INTERNAL_SETTING_PATH_SIZE) continue;
+          path = pListing->path;
+          path += Impl::kSeparatorCharacter;
+          path += pListing->nameList.GetPtr() + record.nameOffset;
+          mPendingDirectoryStack.PushBack(path);
+          hasSubdirectories = true;
+        }
+        --mBusyTaskCount;
+        if (hasSubdirectories || (mBusyTaskCount == 0 && mPendingDirectoryStack.IsEmpty())) mDirectoryCondition.Broadcast();
+      }
+      // The scan is over when no directories are pending and no task can push more
+      while (mPendingDirectoryStack.IsEmpty() && mBusyTaskCount) mDirectoryCondition.Wait(mMutex);
+      if (mPendingDirectoryStack.IsEmpty()) break;
+      path = mPendingDirectoryStack[mPendingDirectoryStack.GetCount() - 1];
+      mPendingDirectoryStack.PopBack();
+      ++mBusyTaskCount;
+    }
+    pListing = E_NEW(Listing);
+    isListed = ProcessDirectory(path, *pListing);
+  }
+}
+
+/**
+Replaces the stored records with the listings of the last scan, which are merged in path order.
+*/
+void DirectoryScanner::StoreListings()
+{
+  const size_t directoryCount = mListingList.GetCount();
+  if (directoryCount > 1) Math::Sorting<Listing*, DirectoryScannerListingComparer>::IntroSort(mListingList.GetPtr(), directoryCount);
+
+  size_t recordCount = 0;
+  size_t nameCount = 0;
+  for (size_t i = 0; i < directoryCount; ++i)
+  {
+    recordCount += mListingList[i]->recordList.GetCount();
+    nameCount += mListingList[i]->path.GetLength() + 1 + mListingList[i]->nameList.GetCount();
+  }
+  mDirectoryList.EnsureSize(directoryCount);
+  mDirectoryList.SetCount(directoryCount);
+  mRecordList.EnsureSize(recordCount);
+  mRecordList.SetCount(recordCount);
+  mNameList.EnsureSize(nameCount);
+  mNameList.SetCount(nameCount);
+
+  U32 recordIndex = 0;
+  U32 nameOffset = 0;
+  for (size_t i = 0; i < directoryCount; ++i)
+  {
+    Listing* pListing = mListingList[i];
+    Directory& directory = mDirectoryList[i];
+    directory.writeTime = pListing->writeTime;
+    directory.pathOffset = nameOffset;
+    directory.pathLength = static_cast<U32>(pListing->path.GetLength());
+    directory.firstRecordIndex = recordIndex;
+    directory.recordCount = static_cast<U32>(pListing->recordList.GetCount());
+    Memory::Copy(mNameList.GetPtr() + nameOffset, pListing->path.GetPtr(), directory.pathLength + 1);
+    nameOffset += directory.pathLength + 1;
+
+    for (U32 j = 0; j < directory.recordCount; ++j)
+    {
+      Record& record = mRecordList[recordIndex++];
+      record = pListing->recordList[j];
+      record.directoryIndex = static_cast<U32>(i);
+      record.nameOffset += nameOffset;
+    }
+    if (!pListing->nameList.IsEmpty()) Memory::Copy(mNameList.GetPtr() + nameOffset, pListing->nameList.GetPtr(), pListing->nameList.GetCount());
+    nameOffset += static_cast<U32>(pListing->nameList.GetCount());
+    E_DELETE(pListing);
+  }
+  mListingList.Clear();
+}
+}
+}
@@ -0,0 +1,113 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file MappedFile.cpp
+This file defines the MappedFile class.
+*/
+
+#include <CorePch.h>
+#ifdef WIN32
+#include "Win32/MappedFileImpl.h"
+#else
+#include "Posix/MappedFileImpl.h"
+#endif
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+MappedFile initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+MappedFile::MappedFile()
+  : mpImpl(new Impl()) {}
+
+MappedFile::~MappedFile() {}
+
+/*----------------------------------------------------------------------------------------------------------------------
+MappedFile accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+const Path& MappedFile::GetPath() const
+{
+  return mpImpl->GetPath();
+}
+
+Byte* MappedFile::GetPtr()
+{
+  return mpImpl->GetPtr();
+}
+
+const Byte* MappedFile::GetPtr() const
+{
+  return mpImpl->GetPtr();
+}
+
+size_t MappedFile::GetSize() const
+{
+  return mpImpl->GetSize();
+}
+
+bool MappedFile::IsOpen() const
+{
+  return mpImpl->IsOpen();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+MappedFile methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void MappedFile::Close()
+{
+  mpImpl->Close();
+}
+
+bool MappedFile::EnableLargePages()
+{
+  return mpImpl->EnableLargePages();
+}
+
+bool MappedFile::Flush()
+{
+  return mpImpl->Flush();
+}
+
+bool MappedFile::Open(const Path& filePath, OpenMode openMode /* = eOpenModeRead */, size_t size /* = 0 */)
+{
+  return mpImpl->Open(filePath, openMode, size);
+}
+
+void MappedFile::Prefetch(size_t offset, size_t size)
+{
+  mpImpl->Prefetch(offset, size);
+}
+
+void MappedFile::SetAccessHint(AccessHint accessHint)
+{
+  mpImpl->SetAccessHint(accessHint);
+}
+}
+}
@@ -0,0 +1,505 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 19-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file PackFile.cpp
+This file defines the PackFile class.
+*/
+
+#include <CorePch.h>
+#include <Math/Algorithm.h>
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+PackFile auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Orders entries by path hash so lookups can binary search the table
+template <typename T>
+struct PackFileEntryComparer
+{
+  inline static bool IsEqual(const T& a, const T& b) { return a.pathHash == b.pathHash; }
+  inline static bool IsLess(const T& a, const T& b) { return a.pathHash < b.pathHash; }
+};
+
+static const size_t kPackFileLz4MinMatch = 4;
+static const size_t kPackFileLz4LastLiterals = 5;   // The last 5 bytes of a block are always literals
+static const size_t kPackFileLz4MatchLimit = 12;    // The last match starts at least 12 bytes before the block end
+static const size_t kPackFileLz4MaxOffset = 65535;
+static const U32    kPackFileLz4HashBits = 12;
+
+inline U32 PackFileRead32(const Byte* p)
+{
+  U32 v;
+  memcpy(&v, p, sizeof(U32));
+  return v;
+}
+
+inline U32 PackFileGetLz4Hash(U32 v)
+{
+  return (v * 2654435761U) >> (32 - kPackFileLz4HashBits);
+}
+
+inline size_t PackFileGetLz4Bound(size_t size)
+{
+  return size + size / 255 + 16;
+}
+
+// Writes a length extension (the part of a literal or match length that does not fit in its token nibble)
+inline Byte* PackFileWriteLz4Length(Byte* pTarget, size_t length)
+{
+  for (; length >= 255; length -= 255) *pTarget++ = 255;
+  *pTarget++ = static_cast<Byte>(length);
+  return pTarget;
+}
+
+// Compresses a block in the LZ4 block format (greedy parsing, single probe hash table). Returns the compressed size or 0
+// if the target capacity (at least PackFileGetLz4Bound) is not enough.
+static size_t PackFileCompress(const Byte* pSource, size_t size, Byte* pTarget, size_t capacity)
+{
+  if (capacity < PackFileGetLz4Bound(size)) return 0;
+
+  Byte* pOutput = pTarget;
+  size_t anchor = 0;
+  if (size > kPackFileLz4MatchLimit)
+  {
+    U32 hashTable[1 << kPackFileLz4HashBits];
+    memset(hashTable, 0, sizeof(hashTable));
+    const size_t matchLimit = size - kPackFileLz4MatchLimit;
+    const size_t extensionLimit = size - kPackFileLz4LastLiterals;
+    size_t i = 0;
+    while (i <= matchLimit)
+    {
+      const U32 sequence = PackFileRead32(pSource + i);
+      const U32 hash = PackFileGetLz4Hash(sequence);
+      const size_t candidate = hashTable[hash];
+      hashTable[hash] = static_cast<U32>(i);
+      if (candidate >= i || i - candidate > kPackFileLz4MaxOffset || PackFileRead32(pSource + candidate) != sequence)
+      {
+        ++i;
+        continue;
+      }
+
+      size_t matchLength = kPackFileLz4MinMatch;
+      while (i + matchLength < extensionLimit && pSource[i + matchLength] == pSource[candidate + matchLength]) ++matchLength;
+
+      // Sequence: token, literal length, literals, offset and match length
+      const size_t literalLength = i - anchor;
+      Byte* pToken = pOutput++;
+      *pToken = static_cast<Byte>(Math::Min<size_t>(literalLength, 15) << 4);
+      if (literalLength >= 15) pOutput = PackFileWriteLz4Length(pOutput, literalLength - 15);
+      memcpy(pOutput, pSource + anchor, literalLength);
+      pOutput += literalLength;
+      const size_t offset = i - candidate;
+      *pOutput++ = static_cast<Byte>(offset);
+      *pOutput++ = static_cast<Byte>(offset >> 8);
+      const size_t matchCode = matchLength - kPackFileLz4MinMatch;
+      *pToken |= static_cast<Byte>(Math::Min<size_t>(matchCode, 15));
+      if (matchCode >= 15) pOutput = PackFileWriteLz4Length(pOutput, matchCode - 15);
+
+      i += matchLength;
+      anchor = i;
+    }
+  }
+
+  // Last literals
+  const size_t literalLength = size - anchor;
+  *pOutput++ = static_cast<Byte>(Math::Min<size_t>(literalLength, 15) << 4);
+  if (literalLength >= 15) pOutput = PackFileWriteLz4Length(pOutput, literalLength - 15);
+  memcpy(pOutput, pSource + anchor, literalLength);
+  pOutput += literalLength;
+  return static_cast<size_t>(pOutput - pTarget);
+}
+
+// Decompresses an LZ4 block. Every read and write is bounds checked, so corrupt data fails instead of overrunning.
+static bool PackFileDecompress(const Byte* pSource, size_t sourceSize, Byte* pTarget, size_t targetSize)
+{
+  const Byte* pInput = pSource;
+  const Byte* pInputEnd = pSource + sourceSize;
+  Byte* pOutput = pTarget;
+  Byte* pOutputEnd = pTarget + targetSize;
+
+  while (pInput < pInputEnd)
+  {
+    const Byte token = *pInput++;
+    size_t literalLength = token >> 4;
+    if (literalLength == 15)
+    {
+      Byte b;
+      do
+      {
+        if (pInput == pInputEnd) return false;
+        b = *pInput++;
+        literalLength += b;
+      } while (b == 255);
+    }
+    if (literalLength > static_cast<size_t>(pInputEnd - pInput) || literalLength > static_cast<size_t>(pOutputEnd - pOutput)) return false;
+    // Short literal runs far from the block ends are copied in 16 byte chunks (writing past the run is harmless there)
+    if (literalLength <= 16 && pInputEnd - pInput >= 16 && pOutputEnd - pOutput >= 16) memcpy(pOutput, pInput, 16);
+    else memcpy(pOutput, pInput, literalLength);
+    pInput += literalLength;
+    pOutput += literalLength;
+    // The last sequence has no match
+    if (pInput == pInputEnd) break;
+
+    if (pInputEnd - pInput < 2) return false;
+    const size_t offset = pInput[0] | (static_cast<size_t>(pInput[1]) << 8);
+    pInput += 2;
+    if (offset == 0 || offset > static_cast<size_t>(pOutput - pTarget)) return false;
+    size_t matchLength = token & 15;
+    if (matchLength == 15)
+    {
+      Byte b;
+      do
+      {
+        if (pInput == pInputEnd) return false;
+        b = *pInput++;
+        matchLength += b;
+      } while (b == 255);
+    }
+    matchLength += kPackFileLz4MinMatch;
+    if (matchLength > static_cast<size_t>(pOutputEnd - pOutput)) return false;
+    // Matches are copied in 8 byte chunks unless they are close to the block end or they overlap their own output by
+    // less than a chunk (offset < 8), in which case they are copied byte by byte
+    const Byte* pMatch = pOutput - offset;
+    if (offset >= 8 && static_cast<size_t>(pOutputEnd - pOutput) >= matchLength + 8)
+    {
+      for (size_t i = 0; i < matchLength; i += 8) memcpy(pOutput + i, pMatch + i, 8);
+    }
+    else for (size_t i = 0; i < matchLength; ++i) pOutput[i] = pMatch[i];
+    pOutput += matchLength;
+  }
+  return pOutput == pOutputEnd;
+}
+
+// Grows lists geometrically (List::EnsureSize allocates the exact size requested)
+template <typename T>
+inline void PackFileEnsureSize(Containers::List<T>& list, size_t size)
+{
+  if (list.GetSize() < size) list.EnsureSize(Math::Max(size, list.GetSize() * 2));
+}
+
+static bool PackFileReadSource(const Path& filePath, Containers::List<Byte>& data)
+{
+  File::Info fileInfo;
+  Archive sourceFile;
+  if (!File::GetInfo(filePath, fileInfo) || !sourceFile.Open(filePath)) return false;
+
+  const size_t size = fileInfo.byteSize;
+  data.EnsureSize(size);
+  data.SetCount(size);
+  size_t readSize = 0;
+  while (readSize < size)
+  {
+    const size_t chunkSize = sourceFile.Read(reinterpret_cast<char*>(data.GetPtr()) + readSize, size - readSize);
+    if (chunkSize == 0) return false;
+    readSize += chunkSize;
+  }
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+PackFile initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+const char PackFile::kExtension[] = ".epk";
+
+PackFile::PackFile()
+  : mpEntries(nullptr)
+  , mpPathPool(nullptr)
+  , mEntryCount(0) {}
+
+PackFile::~PackFile() {}
+
+/*----------------------------------------------------------------------------------------------------------------------
+PackFile accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+const Byte* PackFile::GetData(const Entry& entry) const
+{
+  E_ASSERT_MSG(&entry >= mpEntries && &entry < mpEntries + mEntryCount, E_ASSERT_MSG_PACK_FILE_ENTRY_VALUE);
+  return mMappedFile.GetPtr() + entry.offset;
+}
+
+const PackFile::Entry* PackFile::GetEntries() const
+{
+  return mpEntries;
+}
+
+U32 PackFile::GetEntryCount() const
+{
+  return mEntryCount;
+}
+
+const char* PackFile::GetPath(const Entry& entry) const
+{
+  E_ASSERT_MSG(&entry >= mpEntries && &entry < mpEntries + mEntryCount, E_ASSERT_MSG_PACK_FILE_ENTRY_VALUE);
+  return mpPathPool + entry.pathOffset;
+}
+
+const Path& PackFile::GetPath() const
+{
+  return mMappedFile.GetPath();
+}
+
+bool PackFile::IsOpen() const
+{
+  return mMappedFile.IsOpen();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+PackFile methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void PackFile::Close()
+{
+  mMappedFile.Close();
+  mpEntries = nullptr;
+  mpPathPool = nullptr;
+  mEntryCount = 0;
+}
+
+const PackFile::Entry* PackFile::Find(const Path& path) const
+{
+  Path normalizedPath(path);
+  NormalizePath(normalizedPath);
+  const U64 pathHash = GetPathHash(normalizedPath);
+
+  // Lower bound of the hash, then compare the paths of every entry with the same hash
+  size_t first = 0;
+  size_t last = mEntryCount;
+  while (first < last)
+  {
+    const size_t middle = first + (last - first) / 2;
+    if (mpEntries[middle].pathHash < pathHash) first = middle + 1;
+    else last = middle;
+  }
+  for (; first < mEntryCount && mpEntries[first].pathHash == pathHash; ++first)
+  {
+    const Entry& entry = mpEntries[first];
+    if (entry.pathLength == normalizedPath.GetLength() && strcmp(mpPathPool + entry.pathOffset, normalizedPath.GetPtr()) == 0) return &entry;
+  }
+  return nullptr;
+}
+
+bool PackFile::Open(const Path& filePath)
+{
+  Close();
+  if (!mMappedFile.Open(filePath)) return false;
+  if (mMappedFile.GetSize() < sizeof(Header))
+  {
+    Close();
+    return false;
+  }
+
+  const size_t fileSize = mMappedFile.GetSize();
+  const Byte* pData = mMappedFile.GetPtr();
+  const Header& header = *reinterpret_cast<const Header*>(pData);
+  const U64 tableSize = sizeof(Header) + static_cast<U64>(header.entryCount) * sizeof(Entry) + header.pathPoolSize;
+  if (header.magic != kMagic ||
+      header.version != kVersion ||
+      header.alignment != kAlignment ||
+      header.fileSize != fileSize ||
+      tableSize > fileSize ||
+      (header.pathPoolSize && pData[tableSize - 1] != '\0'))
+  {
+    Close();
+    return false;
+  }
+
+  // Validate the layout so lookups and reads can trust it (sorted hashes, paths and data in bounds)
+  const Entry* pEntries = reinterpret_cast<const Entry*>(pData + sizeof(Header));
+  const char* pPathPool = reinterpret_cast<const char*>(pEntries + header.entryCount);
+  for (U32 i = 0; i < header.entryCount; ++i)
+  {
+    const Entry& entry = pEntries[i];
+    if ((i && entry.pathHash < pEntries[i - 1].pathHash) ||
+        entry.pathOffset >= header.pathPoolSize ||
+        entry.pathLength >= header.pathPoolSize - entry.pathOffset ||
+        pPathPool[entry.pathOffset + entry.pathLength] != '\0' ||
+        entry.offset < tableSize ||
+        entry.offset % kAlignment ||
+        entry.offset > fileSize ||
+        entry.storedSize > fileSize - entry.offset ||
+        entry.compression >= eCompressionCount ||
+        (entry.compression == eCompressionNone && entry.storedSize != entry.size))
+    {
+      Close();
+      return false;
+    }
+  }
+
+  mpEntries = pEntries;
+  mpPathPool = pPathPool;
+  mEntryCount = header.entryCount;
+  return true;
+}
+
+bool PackFile::Read(const Entry& entry, Byte* pTarget) const
+{
+  const Byte* pData = GetData(entry);
+  switch (entry.compression)
+  {
+  case eCompressionNone:
+    Memory::Copy(pTarget, pData, static_cast<size_t>(entry.size));
+    return true;
+  case eCompressionLz4:
+    return PackFileDecompress(pData, static_cast<size_t>(entry.storedSize), pTarget, static_cast<size_t>(entry.size));
+  default:
+    return false;
+  }
+}
+
+bool PackFile::Create(const Path& filePath, const Path& sourceDirectory, const PathList& pathList, bool compress /* = true */)
+{
+  const size_t entryCount = pathList.GetCount();
+  Containers::List<Entry> entryList;
+  Containers::List<char> pathPool;
+  entryList.EnsureSize(entryCount);
+  entryList.SetCount(entryCount);
+
+  // Table of contents (entry offsets hold the path list index until the data is stored)
+  for (size_t i = 0; i < entryCount; ++i)
+  {
+    Path normalizedPath(pathList[i]);
+    NormalizePath(normalizedPath);
+    if (normalizedPath.GetLength() == 0) return false;
+
+    Entry& entry = entryList[i];
+    entry.pathHash = GetPathHash(normalizedPath);
+    entry.offset = i;
+    entry.size = 0;
+    entry.storedSize = 0;
+    entry.pathOffset = static_cast<U32>(pathPool.GetCount());
+    entry.pathLength = static_cast<U16>(normalizedPath.GetLength());
+    entry.compression = eCompressionNone;
+    entry.reserved = 0;
+    PackFileEnsureSize(pathPool, pathPool.GetCount() + normalizedPath.GetLength() + 1);
+    pathPool.PushBack(normalizedPath.GetPtr(), normalizedPath.GetLength() + 1);
+  }
+  if (entryCount > 1) Math::Sorting<Entry, PackFileEntryComparer>::IntroSort(entryList.GetPtr(), entryCount);
+  for (size_t i = 1; i < entryCount; ++i)
+  {
+    for (size_t j = i; j > 0 && entryList[j - 1].pathHash == entryList[i].pathHash; --j)
+    {
+      // Duplicate paths would make lookups ambiguous
+      if (strcmp(pathPool.GetPtr() + entryList[j - 1].pathOffset, pathPool.GetPtr() + entryList[i].pathOffset) == 0) return false;
+    }
+  }
+
+  // Image: header, table, path pool and aligned data
+  const size_t tableSize = sizeof(Header) + entryCount * sizeof(Entry) + pathPool.GetCount();
+  Containers::List<Byte> image;
+  image.EnsureSize(tableSize);
+  image.SetCount(tableSize);
+
+  Containers::List<Byte> sourceData;
+  Containers::List<Byte> compressedData;
+  for (size_t i = 0; i < entryCount; ++i)
+  {
+    Entry& entry = entryList[i];
+    Path sourcePath(sourceDirectory);
+    sourcePath += '/';
+    sourcePath += pathList[static_cast<size_t>(entry.offset)];
+    if (!PackFileReadSource(sourcePath, sourceData)) return false;
+
+    const Byte* pStoredData = sourceData.GetPtr();
+    entry.size = sourceData.GetCount();
+    entry.storedSize = entry.size;
+    if (compress && entry.size)
+    {
+      const size_t capacity = PackFileGetLz4Bound(sourceData.GetCount());
+      compressedData.EnsureSize(capacity);
+      compressedData.SetCount(capacity);
+      const size_t compressedSize = PackFileCompress(sourceData.GetPtr(), sourceData.GetCount(), compressedData.GetPtr(), capacity);
+      if (compressedSize && compressedSize <= entry.size - entry.size / 16)
+      {
+        pStoredData = compressedData.GetPtr();
+        entry.storedSize = compressedSize;
+        entry.compression = eCompressionLz4;
+      }
+    }
+
+    const size_t paddingOffset = image.GetCount();
+    const size_t offset = (paddingOffset + kAlignment - 1) & ~static_cast<size_t>(kAlignment - 1);
+    PackFileEnsureSize(image, offset + static_cast<size_t>(entry.storedSize));
+    image.SetCount(offset + static_cast<size_t>(entry.storedSize));
+    memset(image.GetPtr() + paddingOffset, 0, offset - paddingOffset);
+    entry.offset = offset;
+    if (entry.storedSize) Memory::Copy(image.GetPtr() + offset, pStoredData, static_cast<size_t>(entry.storedSize));
+  }
+
+  Header& header = *reinterpret_cast<Header*>(image.GetPtr());
+  header.magic = kMagic;
+  header.version = kVersion;
+  header.entryCount = static_cast<U32>(entryCount);
+  header.pathPoolSize = static_cast<U32>(pathPool.GetCount());
+  header.fileSize = image.GetCount();
+  header.alignment = kAlignment;
+  header.reserved = 0;
+  if (entryCount) Memory::Copy(image.GetPtr() + sizeof(Header), reinterpret_cast<const Byte*>(entryList.GetPtr()), entryCount * sizeof(Entry));
+  if (pathPool.GetCount()) Memory::Copy(image.GetPtr() + sizeof(Header) + entryCount * sizeof(Entry), reinterpret_cast<const Byte*>(pathPool.GetPtr()), pathPool.GetCount());
+
+  Archive packFile;
+  if (!packFile.Open(filePath, Archive::eOpenModeWrite)) return false;
+  packFile.Write(reinterpret_cast<const char*>(image.GetPtr()), image.GetCount());
+  return true;
+}
+
+U64 PackFile::GetPathHash(const Path& normalizedPath)
+{
+  return Math::XxHash64::Hash(normalizedPath.GetPtr(), normalizedPath.GetLength());
+}
+
+void PackFile::NormalizePath(Path& path)
+{
+  // In place: the normalized path is never longer than the source one
+  const size_t sourceLength = path.GetLength();
+  size_t length = 0;
+  for (size_t i = 0; i < sourceLength; ++i)
+  {
+    char c = path[i];
+    if (c == '\\') c = '/';
+    else if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+
+    if (c == '/')
+    {
+      // Leading and repeated separators
+      if (length == 0 || path[length - 1] == '/') continue;
+    }
+    else if (c == '.' && (length == 0 || path[length - 1] == '/') && (i + 1 == sourceLength || path[i + 1] == '/' || path[i + 1] == '\\'))
+    {
+      // "." segments (the separator that follows is skipped as a repeated one)
+      continue;
+    }
+    path[length++] = c;
+  }
+  if (length && path[length - 1] == '/') --length;
+  path.SetLength(length);
+}
+}
+}
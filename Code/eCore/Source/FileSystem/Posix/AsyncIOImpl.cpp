@@ -0,0 +1,290 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file AsyncIOImpl.cpp
+This file defines the POSIX version of the AsyncIO::Impl class.
+*/
+
+#include <CorePch.h>
+
+#ifndef WIN32
+
+#include "AsyncIOImpl.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+AsyncIO::Impl initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+AsyncIO::Impl::Impl()
+  : mRingDescriptor(-1)
+  , mpSubmissionRing(nullptr)
+  , mpCompletionRing(nullptr)
+  , mpSubmissionEntries(nullptr)
+  , mSubmissionRingSize(0)
+  , mCompletionRingSize(0)
+  , mSubmissionEntriesSize(0)
+  , mpSubmissionHead(nullptr)
+  , mpSubmissionTail(nullptr)
+  , mpSubmissionArray(nullptr)
+  , mpCompletionHead(nullptr)
+  , mpCompletionTail(nullptr)
+  , mpCompletionEntries(nullptr)
+  , mSubmissionMask(0)
+  , mCompletionMask(0)
+{
+  OpenRing();
+}
+
+AsyncIO::Impl::~Impl()
+{
+  CloseRing();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+AsyncIO::Impl methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void AsyncIO::Impl::Read(Group** ppGroups, size_t count)
+{
+  int fileDescriptors[kBatchSize];
+  for (size_t i = 0; i < count; ++i) fileDescriptors[i] = ::open(ppGroups[i]->filePath.GetPtr(), O_RDONLY | O_CLOEXEC);
+
+  if (mRingDescriptor != -1)
+  {
+    ReadRing(fileDescriptors, ppGroups, count);
+  }
+  else
+  {
+    for (size_t i = 0; i < count; ++i)
+    {
+      if (fileDescriptors[i] == -1) continue;
+      Group& group = *ppGroups[i];
+      const size_t entryCount = group.entryList.GetCount();
+      for (size_t j = 0; j < entryCount; ++j)
+      {
+        if (!group.entryList[j].isDuplicate) Read(fileDescriptors[i], group.entryList[j]);
+      }
+    }
+  }
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (fileDescriptors[i] != -1) ::close(fileDescriptors[i]);
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+AsyncIO::Impl private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void AsyncIO::Impl::CloseRing()
+{
+#ifdef __linux__
+  if (mpSubmissionEntries) ::munmap(mpSubmissionEntries, mSubmissionEntriesSize);
+  if (mpCompletionRing && mpCompletionRing != mpSubmissionRing) ::munmap(mpCompletionRing, mCompletionRingSize);
+  if (mpSubmissionRing) ::munmap(mpSubmissionRing, mSubmissionRingSize);
+#endif
+  if (mRingDescriptor != -1) ::close(mRingDescriptor);
+  mRingDescriptor = -1;
+  mpSubmissionRing = nullptr;
+  mpCompletionRing = nullptr;
+  mpSubmissionEntries = nullptr;
+}
+
+void AsyncIO::Impl::OpenRing()
+{
+#ifdef __linux__
+  io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  mRingDescriptor = static_cast<int>(::syscall(__NR_io_uring_setup, kRingSize, &params));
+  if (mRingDescriptor < 0)
+  {
+    mRingDescriptor = -1;
+    return;
+  }
+
+  // Map the submission and completion rings (a single mapping when supported) and the submission entries
+  mSubmissionRingSize = params.sq_off.array + params.sq_entries * sizeof(U32);
+  mCompletionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  mSubmissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+  const bool isSingleMapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if (isSingleMapping) mSubmissionRingSize = mCompletionRingSize = Math::Max(mSubmissionRingSize, mCompletionRingSize);
+
+  void* pSubmissionRing = ::mmap(nullptr, mSubmissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingDescriptor, IORING_OFF_SQ_RING);
+  if (pSubmissionRing == MAP_FAILED)
+  {
+    CloseRing();
+    return;
+  }
+  mpSubmissionRing = static_cast<Byte*>(pSubmissionRing);
+  void* pCompletionRing = isSingleMapping ? pSubmissionRing :
+    ::mmap(nullptr, mCompletionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingDescriptor, IORING_OFF_CQ_RING);
+  if (pCompletionRing == MAP_FAILED)
+  {
+    CloseRing();
+    return;
+  }
+  mpCompletionRing = static_cast<Byte*>(pCompletionRing);
+  void* pSubmissionEntries = ::mmap(nullptr, mSubmissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingDescriptor, IORING_OFF_SQES);
+  if (pSubmissionEntries == MAP_FAILED)
+  {
+    CloseRing();
+    return;
+  }
+  mpSubmissionEntries = pSubmissionEntries;
+
+  mpSubmissionHead = reinterpret_cast<U32*>(mpSubmissionRing + params.sq_off.head);
+  mpSubmissionTail = reinterpret_cast<U32*>(mpSubmissionRing + params.sq_off.tail);
+  mpSubmissionArray = reinterpret_cast<U32*>(mpSubmissionRing + params.sq_off.array);
+  mSubmissionMask = *reinterpret_cast<U32*>(mpSubmissionRing + params.sq_off.ring_mask);
+  mpCompletionHead = reinterpret_cast<U32*>(mpCompletionRing + params.cq_off.head);
+  mpCompletionTail = reinterpret_cast<U32*>(mpCompletionRing + params.cq_off.tail);
+  mpCompletionEntries = mpCompletionRing + params.cq_off.cqes;
+  mCompletionMask = *reinterpret_cast<U32*>(mpCompletionRing + params.cq_off.ring_mask);
+#endif
+}
+
+void AsyncIO::Impl::Read(int fileDescriptor, Entry& entry)
+{
+  // Continues from the current read size (short ring reads)
+  entry.succeeded = true;
+  while (entry.readSize < entry.size)
+  {
+    const ssize_t readSize = ::pread(fileDescriptor, entry.pBuffer + entry.readSize, entry.size - entry.readSize, static_cast<off_t>(entry.offset + entry.readSize));
+    if (readSize < 0)
+    {
+      if (errno == EINTR) continue;
+      entry.succeeded = false;
+      return;
+    }
+    if (readSize == 0) return;
+    entry.readSize += static_cast<size_t>(readSize);
+  }
+}
+
+void AsyncIO::Impl::ReadRing(const int* pFileDescriptors, Group** ppGroups, size_t count)
+{
+#ifdef __linux__
+  io_uring_sqe* pSubmissionEntries = static_cast<io_uring_sqe*>(mpSubmissionEntries);
+  const io_uring_cqe* pCompletionEntries = static_cast<const io_uring_cqe*>(mpCompletionEntries);
+  size_t groupIndex = 0;
+  size_t entryIndex = 0;
+  for (;;)
+  {
+    // Fill the submission queue with the next reads (the ring is empty at this point)
+    U32 submissionTail = *mpSubmissionTail;
+    U32 submissionCount = 0;
+    while (submissionCount < kRingSize && groupIndex < count)
+    {
+      Group& group = *ppGroups[groupIndex];
+      if (pFileDescriptors[groupIndex] == -1 || entryIndex == group.entryList.GetCount())
+      {
+        ++groupIndex;
+        entryIndex = 0;
+        continue;
+      }
+      Entry& entry = group.entryList[entryIndex++];
+      if (entry.isDuplicate) continue;
+      if (entry.size == 0)
+      {
+        entry.succeeded = true;
+        continue;
+      }
+      const U32 index = submissionTail & mSubmissionMask;
+      io_uring_sqe& submissionEntry = pSubmissionEntries[index];
+      memset(&submissionEntry, 0, sizeof(submissionEntry));
+      submissionEntry.opcode = IORING_OP_READ;
+      submissionEntry.fd = pFileDescriptors[groupIndex];
+      submissionEntry.addr = reinterpret_cast<U64>(entry.pBuffer);
+      submissionEntry.len = static_cast<U32>(Math::Min<size_t>(entry.size, 0x40000000));
+      submissionEntry.off = entry.offset;
+      submissionEntry.user_data = (static_cast<U64>(groupIndex) << 32) | (entryIndex - 1);
+      mpSubmissionArray[index] = index;
+      ++submissionTail;
+      ++submissionCount;
+    }
+    if (submissionCount == 0) break;
+    __atomic_store_n(mpSubmissionTail, submissionTail, __ATOMIC_RELEASE);
+
+    // Submit the reads and wait for all of them
+    U32 completionCount = 0;
+    while (completionCount < submissionCount)
+    {
+      const U32 pendingSubmissionCount = submissionTail - __atomic_load_n(mpSubmissionHead, __ATOMIC_ACQUIRE);
+      const U32 waitCount = submissionCount - completionCount;
+      if (::syscall(__NR_io_uring_enter, mRingDescriptor, pendingSubmissionCount, waitCount, IORING_ENTER_GETEVENTS, nullptr, 0) < 0 &&
+          errno != EINTR && errno != EAGAIN && errno != EBUSY)
+      {
+        // The ring is unusable: release it (which waits for the reads in flight) and read what is left with pread
+        CloseRing();
+        for (size_t i = 0; i < count; ++i)
+        {
+          if (pFileDescriptors[i] == -1) continue;
+          Group& group = *ppGroups[i];
+          for (size_t j = 0; j < group.entryList.GetCount(); ++j)
+          {
+            Entry& entry = group.entryList[j];
+            if (entry.isDuplicate || entry.succeeded) continue;
+            entry.readSize = 0;
+            Read(pFileDescriptors[i], entry);
+          }
+        }
+        return;
+      }
+
+      U32 completionHead = *mpCompletionHead;
+      const U32 completionTail = __atomic_load_n(mpCompletionTail, __ATOMIC_ACQUIRE);
+      for (; completionHead != completionTail; ++completionHead, ++completionCount)
+      {
+        const io_uring_cqe& completionEntry = pCompletionEntries[completionHead & mCompletionMask];
+        const size_t completedGroupIndex = static_cast<size_t>(completionEntry.user_data >> 32);
+        Entry& entry = ppGroups[completedGroupIndex]->entryList[static_cast<size_t>(completionEntry.user_data & 0xffffffff)];
+        if (completionEntry.res > 0) entry.readSize = static_cast<size_t>(completionEntry.res);
+        // Errors (including the read operation not being supported) and short reads are completed with pread
+        if (completionEntry.res < 0 || (completionEntry.res > 0 && entry.readSize < entry.size)) Read(pFileDescriptors[completedGroupIndex], entry);
+        else entry.succeeded = true;
+      }
+      __atomic_store_n(mpCompletionHead, completionHead, __ATOMIC_RELEASE);
+    }
+  }
+#endif
+}
+}
+}
+
+#endif
@@ -0,0 +1,87 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file AsyncIOImpl.h
+This file declares the POSIX version of the AsyncIO::Impl class.
+*/
+
+#ifndef E3_ASYNC_IO_IMPL_H
+#define E3_ASYNC_IO_IMPL_H
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+AsyncIO::Impl
+
+Please note that this class has the following usage contract:
+
+1. Each AsyncIO I/O thread owns an Impl instance, and on Linux each instance sets up its own io_uring instance (with
+kRingSize entries) through the raw system calls, so no liburing dependency is required.
+2. Read opens the files of all the groups and submits the reads of every entry (except the duplicated ones) to the
+ring at once, then waits for their completion. Short reads are completed with pread.
+3. When io_uring is not available (other POSIX systems, kernels older than 5.6 or disabled by the system policy) the
+reads are performed with pread, one after the other.
+----------------------------------------------------------------------------------------------------------------------*/
+class AsyncIO::Impl : public Memory::ProxyAllocated
+{
+public:
+                Impl();
+                ~Impl();
+
+  // Methods
+  void          Read(Group** ppGroups, size_t count);
+
+private:
+  static const U32  kRingSize = 256;
+
+  int           mRingDescriptor;          // io_uring file descriptor (-1 when not available)
+  Byte*         mpSubmissionRing;
+  Byte*         mpCompletionRing;
+  void*         mpSubmissionEntries;
+  size_t        mSubmissionRingSize;
+  size_t        mCompletionRingSize;
+  size_t        mSubmissionEntriesSize;
+  U32*          mpSubmissionHead;
+  U32*          mpSubmissionTail;
+  U32*          mpSubmissionArray;
+  U32*          mpCompletionHead;
+  U32*          mpCompletionTail;
+  void*         mpCompletionEntries;
+  U32           mSubmissionMask;
+  U32           mCompletionMask;
+
+  void          CloseRing();
+  void          OpenRing();
+  void          Read(int fileDescriptor, Entry& entry);
+  void          ReadRing(const int* pFileDescriptors, Group** ppGroups, size_t count);
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(Impl)
+};
+}
+}
+
+#endif
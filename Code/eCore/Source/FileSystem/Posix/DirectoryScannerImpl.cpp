@@ -0,0 +1,184 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 19-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file DirectoryScannerImpl.cpp
+This file defines the POSIX version of the DirectoryScanner::Impl class.
+*/
+
+#include <CorePch.h>
+
+#ifndef WIN32
+
+#include "DirectoryScannerImpl.h"
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+DirectoryScanner::Impl auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+
+#ifdef __linux__
+// getdents64 record layout (not exposed by the C library headers)
+struct DirectoryScannerLinuxDirent
+{
+  U64             ino;
+  I64             off;
+  unsigned short  reclen;
+  unsigned char   type;
+  char            name[1];
+};
+#endif
+
+void DirectoryScannerGetDate(I64 seconds, I64 nanoseconds, Time::Date& date)
+{
+  const time_t t = static_cast<time_t>(seconds);
+  struct tm localTime;
+  ::localtime_r(&t, &localTime);
+
+  date.year = static_cast<U16>(localTime.tm_year + 1900);
+  date.month = static_cast<U16>(localTime.tm_mon + 1);
+  date.day = static_cast<U16>(localTime.tm_mday);
+  date.weekDay = static_cast<U16>(localTime.tm_wday);
+  date.hour = static_cast<U16>(localTime.tm_hour);
+  date.minute = static_cast<U16>(localTime.tm_min);
+  date.second = static_cast<U16>(localTime.tm_sec);
+  date.millisecond = static_cast<U16>(nanoseconds / 1000000);
+}
+
+inline bool DirectoryScannerIsDotEntry(const char* pName)
+{
+  return pName[0] == '.' && (pName[1] == '\0' || (pName[1] == '.' && pName[2] == '\0'));
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+DirectoryScanner::Impl methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool DirectoryScanner::Impl::GetWriteTime(const Path& path, U64& writeTime)
+{
+  struct stat fileStatus;
+  if (::stat(path.GetPtr(), &fileStatus) != 0 || !S_ISDIR(fileStatus.st_mode)) return false;
+
+  writeTime = static_cast<U64>(fileStatus.st_mtim.tv_sec) * 1000000000 + fileStatus.st_mtim.tv_nsec;
+  return true;
+}
+
+bool DirectoryScanner::Impl::List(const Path& path, Listing& listing)
+{
+  const int directoryDescriptor = ::open(path.GetPtr(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+  if (directoryDescriptor == -1) return false;
+
+  // Get the write time before listing so changes made while listing invalidate the cached listing
+  struct stat directoryStatus;
+  if (::fstat(directoryDescriptor, &directoryStatus) != 0)
+  {
+    ::close(directoryDescriptor);
+    return false;
+  }
+  listing.writeTime = static_cast<U64>(directoryStatus.st_mtim.tv_sec) * 1000000000 + directoryStatus.st_mtim.tv_nsec;
+
+#ifdef __linux__
+  // Read the entries in blocks (the stack buffer is 8 byte aligned as required by the record layout)
+  U64 buffer[kBufferSize / sizeof(U64)];
+  for (;;)
+  {
+    const long size = ::syscall(SYS_getdents64, directoryDescriptor, buffer, sizeof(buffer));
+    if (size <= 0) break;
+    for (long offset = 0; offset < size;)
+    {
+      const DirectoryScannerLinuxDirent* pEntry = reinterpret_cast<const DirectoryScannerLinuxDirent*>(reinterpret_cast<const Byte*>(buffer) + offset);
+      if (!DirectoryScannerIsDotEntry(pEntry->name)) AddRecord(listing, directoryDescriptor, pEntry->name);
+      offset += pEntry->reclen;
+    }
+  }
+  ::close(directoryDescriptor);
+#else
+  // fdopendir takes ownership of the descriptor
+  DIR* pDirectory = ::fdopendir(directoryDescriptor);
+  if (pDirectory == nullptr)
+  {
+    ::close(directoryDescriptor);
+    return false;
+  }
+  while (const struct dirent* pEntry = ::readdir(pDirectory))
+  {
+    if (!DirectoryScannerIsDotEntry(pEntry->d_name)) AddRecord(listing, directoryDescriptor, pEntry->d_name);
+  }
+  ::closedir(pDirectory);
+#endif
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+DirectoryScanner::Impl private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void DirectoryScanner::Impl::AddRecord(Listing& listing, int directoryDescriptor, const char* pName)
+{
+  Record record;
+#if defined(__linux__) && defined(STATX_BASIC_STATS)
+  struct statx fileStatus;
+  if (::statx(directoryDescriptor, pName, AT_SYMLINK_NOFOLLOW | AT_NO_AUTOMOUNT, STATX_TYPE | STATX_MODE | STATX_SIZE | STATX_ATIME | STATX_MTIME | STATX_BTIME, &fileStatus) != 0) return;
+  // Creation times are not supported by every file system (the status change time is used instead)
+  const struct statx_timestamp& creationTime = (fileStatus.stx_mask & STATX_BTIME) ? fileStatus.stx_btime : fileStatus.stx_ctime;
+  DirectoryScannerGetDate(creationTime.tv_sec, creationTime.tv_nsec, record.info.creationTime);
+  DirectoryScannerGetDate(fileStatus.stx_atime.tv_sec, fileStatus.stx_atime.tv_nsec, record.info.lastAccessTime);
+  DirectoryScannerGetDate(fileStatus.stx_mtime.tv_sec, fileStatus.stx_mtime.tv_nsec, record.info.lastWriteTime);
+  const mode_t mode = fileStatus.stx_mode;
+  record.info.byteSize = static_cast<size_t>(fileStatus.stx_size);
+#else
+  struct stat fileStatus;
+  if (::fstatat(directoryDescriptor, pName, &fileStatus, AT_SYMLINK_NOFOLLOW) != 0) return;
+  DirectoryScannerGetDate(fileStatus.st_ctim.tv_sec, fileStatus.st_ctim.tv_nsec, record.info.creationTime);
+  DirectoryScannerGetDate(fileStatus.st_atim.tv_sec, fileStatus.st_atim.tv_nsec, record.info.lastAccessTime);
+  DirectoryScannerGetDate(fileStatus.st_mtim.tv_sec, fileStatus.st_mtim.tv_nsec, record.info.lastWriteTime);
+  const mode_t mode = fileStatus.st_mode;
+  record.info.byteSize = static_cast<size_t>(fileStatus.st_size);
+#endif
+  record.info.flags = static_cast<U8>(S_ISDIR(mode) ? File::eFlagDirectory : File::eFlagFile);
+  if (!(mode & S_IWUSR)) record.info.flags |= File::eFlagReadOnly;
+  if (pName[0] == '.') record.info.flags |= File::eFlagHidden;
+
+  const size_t nameLength = strlen(pName);
+  record.directoryIndex = 0;
+  record.nameOffset = static_cast<U32>(listing.nameList.GetCount());
+  record.nameLength = static_cast<U32>(nameLength);
+  listing.recordList.PushBack(record);
+  listing.nameList.PushBack(pName, nameLength + 1);
+}
+}
+}
+
+#endif
@@ -0,0 +1,66 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 19-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file DirectoryScannerImpl.h
+This file declares the POSIX version of the DirectoryScanner::Impl class.
+*/
+
+#ifndef E3_DIRECTORY_SCANNER_IMPL_H
+#define E3_DIRECTORY_SCANNER_IMPL_H
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+DirectoryScanner::Impl
+
+Please note that this class has the following usage contract:
+
+1. Impl is stateless and its methods are called concurrently by the scanning tasks.
+2. On Linux List reads the directory entries in kBufferSize blocks through the getdents64 system call and gets the
+entry info with statx relative to the directory descriptor (so paths are not resolved again). Other POSIX systems use
+readdir and fstatat.
+3. Symbolic links are not followed (they are recorded as files). Entries whose name starts with a dot are flagged as
+hidden, and entries the user can not write are flagged as read only.
+4. Write times are the directory modification times in nanoseconds.
+----------------------------------------------------------------------------------------------------------------------*/
+class DirectoryScanner::Impl
+{
+public:
+  static const char   kSeparatorCharacter = '/';
+
+  static bool         GetWriteTime(const Path& path, U64& writeTime);
+  static bool         List(const Path& path, Listing& listing);
+
+private:
+  static const size_t kBufferSize = 32768;
+
+  static void         AddRecord(Listing& listing, int directoryDescriptor, const char* pName);
+};
+}
+}
+
+#endif
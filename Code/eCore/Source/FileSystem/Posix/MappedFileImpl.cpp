@@ -0,0 +1,182 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file MappedFileImpl.cpp
+This file defines the POSIX version of the MappedFile::Impl class.
+*/
+
+#include <CorePch.h>
+
+#ifndef WIN32
+
+#include "MappedFileImpl.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+MappedFile::Impl initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+MappedFile::Impl::Impl()
+  : mFileDescriptor(-1)
+  , mpData(nullptr)
+  , mSize(0) {}
+
+MappedFile::Impl::~Impl()
+{
+  Close();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+MappedFile::Impl accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+const Path& MappedFile::Impl::GetPath() const
+{
+  return mFilePath;
+}
+
+Byte* MappedFile::Impl::GetPtr() const
+{
+  return mpData;
+}
+
+size_t MappedFile::Impl::GetSize() const
+{
+  return mSize;
+}
+
+bool MappedFile::Impl::IsOpen() const
+{
+  return mpData != nullptr;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+MappedFile::Impl methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void MappedFile::Impl::Close()
+{
+  if (mpData) ::munmap(mpData, mSize);
+  if (mFileDescriptor != -1) ::close(mFileDescriptor);
+  mFileDescriptor = -1;
+  mpData = nullptr;
+  mSize = 0;
+  mFilePath.Clear();
+}
+
+bool MappedFile::Impl::EnableLargePages()
+{
+#ifdef MADV_HUGEPAGE
+  // Transparent huge pages for file mappings depend on the kernel configuration and the file system
+  return mpData && ::madvise(mpData, mSize, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
+bool MappedFile::Impl::Flush()
+{
+  return mpData && ::msync(mpData, mSize, MS_SYNC) == 0;
+}
+
+bool MappedFile::Impl::Open(const Path& filePath, OpenMode openMode, size_t size)
+{
+  E_ASSERT(filePath.GetLength());
+  Close();
+
+  const bool isWritable = (openMode == eOpenModeReadWrite);
+  int flags = isWritable ? O_RDWR : O_RDONLY;
+  if (isWritable && size) flags |= O_CREAT;
+  mFileDescriptor = ::open(filePath.GetPtr(), flags, 0644);
+  if (mFileDescriptor == -1) return false;
+
+  struct stat fileStatus;
+  if (::fstat(mFileDescriptor, &fileStatus) != 0)
+  {
+    Close();
+    return false;
+  }
+  U64 fileSize = static_cast<U64>(fileStatus.st_size);
+  // Read write mappings with a size resize the file
+  if (isWritable && size && fileSize != size)
+  {
+    if (::ftruncate(mFileDescriptor, static_cast<off_t>(size)) != 0)
+    {
+      Close();
+      return false;
+    }
+    fileSize = size;
+  }
+  // Empty files cannot be mapped and files larger than the address space cannot be mapped at once
+  if (fileSize == 0 || fileSize > static_cast<size_t>(-1))
+  {
+    Close();
+    return false;
+  }
+
+  const int protection = isWritable ? PROT_READ | PROT_WRITE : PROT_READ;
+  void* pData = ::mmap(nullptr, static_cast<size_t>(fileSize), protection, MAP_SHARED, mFileDescriptor, 0);
+  if (pData == MAP_FAILED)
+  {
+    Close();
+    return false;
+  }
+  mpData = static_cast<Byte*>(pData);
+  mSize = static_cast<size_t>(fileSize);
+  mFilePath = filePath;
+  return true;
+}
+
+void MappedFile::Impl::Prefetch(size_t offset, size_t size)
+{
+  if (offset >= mSize) return;
+  size = Math::Min(size, mSize - offset);
+
+  // madvise ranges must start at a page boundary
+  const size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+  const size_t pageOffset = offset - offset % pageSize;
+  ::madvise(mpData + pageOffset, size + offset - pageOffset, MADV_WILLNEED);
+}
+
+void MappedFile::Impl::SetAccessHint(AccessHint accessHint)
+{
+  if (mpData == nullptr) return;
+
+  int advice = MADV_NORMAL;
+  if (accessHint == eAccessHintSequential) advice = MADV_SEQUENTIAL;
+  else if (accessHint == eAccessHintRandom) advice = MADV_RANDOM;
+  ::madvise(mpData, mSize, advice);
+}
+}
+}
+
+#endif
@@ -0,0 +1,198 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 19-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file VirtualFileSystem.cpp
+This file defines the VirtualFileSystem class.
+*/
+
+#include <CorePch.h>
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+FileSystem::Global methods
+
+Please note that these methods must be defined in a source file instead of inline to guarantee a unique global instance
+across DLLs as static variables are local to the compilation unit.
+----------------------------------------------------------------------------------------------------------------------*/
+VirtualFileSystem& Global::GetVirtualFileSystem()
+{
+  return Singleton<VirtualFileSystem>::GetInstance();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+VirtualFileSystem auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+
+static bool VirtualFileSystemReadFile(const Path& filePath, Containers::List<Byte>& data)
+{
+  File::Info fileInfo;
+  Archive file;
+  if (!File::GetInfo(filePath, fileInfo) || (fileInfo.flags & File::eFlagDirectory) || !file.Open(filePath)) return false;
+
+  const size_t size = fileInfo.byteSize;
+  data.EnsureSize(size);
+  data.SetCount(size);
+  size_t readSize = 0;
+  while (readSize < size)
+  {
+    const size_t chunkSize = file.Read(reinterpret_cast<char*>(data.GetPtr()) + readSize, size - readSize);
+    if (chunkSize == 0) return false;
+    readSize += chunkSize;
+  }
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+VirtualFileSystem initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+VirtualFileSystem::VirtualFileSystem() {}
+
+VirtualFileSystem::~VirtualFileSystem()
+{
+  UnmountAll();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+VirtualFileSystem accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+size_t VirtualFileSystem::GetPackCount() const
+{
+  return mMountPointList.GetCount();
+}
+
+bool VirtualFileSystem::IsPacked(const Path& path) const
+{
+  const PackFile* pPackFile;
+  return Find(path, pPackFile) != nullptr;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+VirtualFileSystem methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool VirtualFileSystem::Exists(const Path& path) const
+{
+  return IsPacked(path) || File::Exists(path);
+}
+
+bool VirtualFileSystem::Map(const Path& path, const Byte*& pData, size_t& size) const
+{
+  const PackFile* pPackFile;
+  const PackFile::Entry* pEntry = Find(path, pPackFile);
+  if (pEntry == nullptr || pEntry->compression != PackFile::eCompressionNone) return false;
+
+  pData = pPackFile->GetData(*pEntry);
+  size = static_cast<size_t>(pEntry->size);
+  return true;
+}
+
+bool VirtualFileSystem::Mount(const Path& packFilePath, const Path& mountPath)
+{
+  PackFile* pPackFile = E_NEW(PackFile);
+  if (!pPackFile->Open(packFilePath))
+  {
+    E_DELETE(pPackFile);
+    return false;
+  }
+
+  MountPoint mountPoint;
+  mountPoint.pPackFile = pPackFile;
+  mountPoint.path = mountPath;
+  PackFile::NormalizePath(mountPoint.path);
+  mMountPointList.PushBack(mountPoint);
+  return true;
+}
+
+bool VirtualFileSystem::Read(const Path& path, Containers::List<Byte>& data) const
+{
+  const PackFile* pPackFile;
+  const PackFile::Entry* pEntry = Find(path, pPackFile);
+  if (pEntry == nullptr) return VirtualFileSystemReadFile(path, data);
+
+  const size_t size = static_cast<size_t>(pEntry->size);
+  data.EnsureSize(size);
+  data.SetCount(size);
+  return pPackFile->Read(*pEntry, data.GetPtr());
+}
+
+bool VirtualFileSystem::Unmount(const Path& packFilePath)
+{
+  for (size_t i = mMountPointList.GetCount(); i > 0; --i)
+  {
+    PackFile* pPackFile = mMountPointList[i - 1].pPackFile;
+    if (pPackFile->GetPath() == packFilePath)
+    {
+      E_DELETE(pPackFile);
+      mMountPointList.RemoveIndex(i - 1);
+      return true;
+    }
+  }
+  return false;
+}
+
+void VirtualFileSystem::UnmountAll()
+{
+  for (size_t i = 0; i < mMountPointList.GetCount(); ++i) E_DELETE(mMountPointList[i].pPackFile);
+  mMountPointList.Clear();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+VirtualFileSystem private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+const PackFile::Entry* VirtualFileSystem::Find(const Path& path, const PackFile*& pPackFile) const
+{
+  if (mMountPointList.IsEmpty()) return nullptr;
+
+  Path normalizedPath(path);
+  PackFile::NormalizePath(normalizedPath);
+  for (size_t i = mMountPointList.GetCount(); i > 0; --i)
+  {
+    // The mount path must be a whole path prefix ("data" mounts "data/a.dds" but not "database/a.dds")
+    const MountPoint& mountPoint = mMountPointList[i - 1];
+    const size_t mountPathLength = mountPoint.path.GetLength();
+    if (mountPathLength)
+    {
+      if (normalizedPath.GetLength() <= mountPathLength ||
+          normalizedPath[mountPathLength] != '/' ||
+          strncmp(normalizedPath.GetPtr(), mountPoint.path.GetPtr(), mountPathLength) != 0) continue;
+    }
+
+    const PackFile::Entry* pEntry = mountPoint.pPackFile->Find(mountPathLength ? normalizedPath.GetPtr() + mountPathLength + 1 : normalizedPath.GetPtr());
+    if (pEntry)
+    {
+      pPackFile = mountPoint.pPackFile;
+      return pEntry;
+    }
+  }
+  return nullptr;
+}
+}
+}
@@ -0,0 +1,96 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file AsyncIOImpl.cpp
+This file defines the Windows version of the AsyncIO::Impl class.
+*/
+
+#include <CorePch.h>
+#include "AsyncIOImpl.h"
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+AsyncIO::Impl initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+AsyncIO::Impl::Impl() {}
+
+AsyncIO::Impl::~Impl() {}
+
+/*----------------------------------------------------------------------------------------------------------------------
+AsyncIO::Impl methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void AsyncIO::Impl::Read(Group** ppGroups, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    Group& group = *ppGroups[i];
+    WFilePath wfilePath;
+    Text::Utf8ToWide(wfilePath, group.filePath);
+    // Entries are sorted by offset, so the file is read forward
+    HANDLE fileHandle = ::CreateFileW(wfilePath.GetPtr(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) continue;
+
+    const size_t entryCount = group.entryList.GetCount();
+    for (size_t j = 0; j < entryCount; ++j)
+    {
+      if (!group.entryList[j].isDuplicate) Read(fileHandle, group.entryList[j]);
+    }
+    ::CloseHandle(fileHandle);
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+AsyncIO::Impl private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void AsyncIO::Impl::Read(HANDLE fileHandle, Entry& entry)
+{
+  entry.succeeded = true;
+  while (entry.readSize < entry.size)
+  {
+    // ReadFile sizes are 32 bit
+    const DWORD chunkSize = static_cast<DWORD>(Math::Min<size_t>(entry.size - entry.readSize, 0x40000000));
+    const U64 offset = entry.offset + entry.readSize;
+    OVERLAPPED overlapped = {};
+    overlapped.Offset = static_cast<DWORD>(offset);
+    overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    DWORD readSize = 0;
+    if (!::ReadFile(fileHandle, entry.pBuffer + entry.readSize, chunkSize, &readSize, &overlapped))
+    {
+      // Reading at the end of the file is not an error (the read size is just smaller)
+      entry.succeeded = (::GetLastError() == ERROR_HANDLE_EOF);
+      return;
+    }
+    if (readSize == 0) return;
+    entry.readSize += readSize;
+  }
+}
+}
+}
@@ -0,0 +1,63 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file AsyncIOImpl.h
+This file declares the Windows version of the AsyncIO::Impl class.
+*/
+
+#ifndef E3_ASYNC_IO_IMPL_H
+#define E3_ASYNC_IO_IMPL_H
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+AsyncIO::Impl
+
+Please note that this class has the following usage contract:
+
+1. Each AsyncIO I/O thread owns an Impl instance.
+2. Read reads the entries of each group (except the duplicated ones) with synchronous positional ReadFile calls, opening
+each file once.
+----------------------------------------------------------------------------------------------------------------------*/
+class AsyncIO::Impl : public Memory::ProxyAllocated
+{
+public:
+                Impl();
+                ~Impl();
+
+  // Methods
+  void          Read(Group** ppGroups, size_t count);
+
+private:
+  void          Read(HANDLE fileHandle, Entry& entry);
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(Impl)
+};
+}
+}
+
+#endif
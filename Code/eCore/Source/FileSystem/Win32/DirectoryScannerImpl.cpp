@@ -0,0 +1,129 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 19-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file DirectoryScannerImpl.cpp
+This file defines the Windows version of the DirectoryScanner::Impl class.
+*/
+
+#include <CorePch.h>
+#include "DirectoryScannerImpl.h"
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+DirectoryScanner::Impl auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+
+static const WString kDirectoryScannerSelectAllTokenWstr(L"\\*");
+
+inline U64 DirectoryScannerGetFileTime(const FILETIME& ft)
+{
+  return (static_cast<U64>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+}
+
+void DirectoryScannerGetDate(const FILETIME& ft, Time::Date& date)
+{
+  FILETIME localFt;
+  ::FileTimeToLocalFileTime(&ft, &localFt);
+
+  SYSTEMTIME st;
+  ::FileTimeToSystemTime(&localFt, &st);
+
+  date.year = st.wYear;
+  date.month = st.wMonth;
+  date.day = st.wDay;
+  date.weekDay = st.wDayOfWeek;
+  date.hour = st.wHour;
+  date.minute = st.wMinute;
+  date.second = st.wSecond;
+  date.millisecond = st.wMilliseconds;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+DirectoryScanner::Impl methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool DirectoryScanner::Impl::GetWriteTime(const Path& path, U64& writeTime)
+{
+  WFilePath wfilePath;
+  Text::Utf8ToWide(wfilePath, path);
+  WIN32_FILE_ATTRIBUTE_DATA fileData;
+  if (::GetFileAttributesExW(wfilePath.GetPtr(), GetFileExInfoStandard, &fileData) == 0 ||
+      !(fileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) return false;
+
+  writeTime = DirectoryScannerGetFileTime(fileData.ftLastWriteTime);
+  return true;
+}
+
+bool DirectoryScanner::Impl::List(const Path& path, Listing& listing)
+{
+  WFilePath wfilePath;
+  Text::Utf8ToWide(wfilePath, path);
+  if (wfilePath.GetLength() + kDirectoryScannerSelectAllTokenWstr.GetLength() >= E_INTERNAL_SETTING_PATH_SIZE) return false;
+
+  // Get the write time before listing so changes made while listing invalidate the cached listing
+  WIN32_FILE_ATTRIBUTE_DATA directoryData;
+  if (::GetFileAttributesExW(wfilePath.GetPtr(), GetFileExInfoStandard, &directoryData) == 0) return false;
+  listing.writeTime = DirectoryScannerGetFileTime(directoryData.ftLastWriteTime);
+
+  wfilePath += kDirectoryScannerSelectAllTokenWstr;
+  WIN32_FIND_DATAW fileData;
+  HANDLE handle = ::FindFirstFileExW(wfilePath.GetPtr(), FindExInfoBasic, &fileData, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+  if (handle == INVALID_HANDLE_VALUE) return false;
+
+  Path name;
+  do
+  {
+    const wchar_t* pName = fileData.cFileName;
+    if (pName[0] == L'.' && (pName[1] == L'\0' || (pName[1] == L'.' && pName[2] == L'\0'))) continue;
+
+    name.SetLength(Text::WideToUtf8(&name[0], pName, wcslen(pName)));
+    Record record;
+    DirectoryScannerGetDate(fileData.ftCreationTime, record.info.creationTime);
+    DirectoryScannerGetDate(fileData.ftLastAccessTime, record.info.lastAccessTime);
+    DirectoryScannerGetDate(fileData.ftLastWriteTime, record.info.lastWriteTime);
+#ifdef E_CPU_X64
+    record.info.byteSize = (static_cast<size_t>(fileData.nFileSizeHigh) << 32) | fileData.nFileSizeLow;
+#else
+    record.info.byteSize = fileData.nFileSizeLow;
+#endif
+    record.info.flags = static_cast<U8>((fileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? File::eFlagDirectory : File::eFlagFile);
+    if (fileData.dwFileAttributes & FILE_ATTRIBUTE_READONLY) record.info.flags |= File::eFlagReadOnly;
+    if (fileData.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN) record.info.flags |= File::eFlagHidden;
+    record.directoryIndex = 0;
+    record.nameOffset = static_cast<U32>(listing.nameList.GetCount());
+    record.nameLength = static_cast<U32>(name.GetLength());
+    listing.recordList.PushBack(record);
+    listing.nameList.PushBack(name.GetPtr(), name.GetLength() + 1);
+  }
+  while (::FindNextFileW(handle, &fileData));
+
+  ::FindClose(handle);
+  return true;
+}
+}
+}
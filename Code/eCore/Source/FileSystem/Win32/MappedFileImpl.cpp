@@ -0,0 +1,203 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file MappedFileImpl.cpp
+This file defines the Windows version of the MappedFile::Impl class.
+*/
+
+#include <CorePch.h>
+#include "MappedFileImpl.h"
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+MappedFile::Impl auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Stands for WIN32_MEMORY_RANGE_ENTRY, which is only declared when targeting Windows 8 or later
+struct MappedFileImplMemoryRange
+{
+  PVOID   virtualAddress;
+  SIZE_T  numberOfBytes;
+};
+
+typedef BOOL (WINAPI *MappedFileImplPrefetchFunction)(HANDLE, ULONG_PTR, MappedFileImplMemoryRange*, ULONG);
+
+MappedFileImplPrefetchFunction MappedFileImplGetPrefetchFunction()
+{
+  // PrefetchVirtualMemory is resolved at run time so the library still loads on Windows 7
+  static const MappedFileImplPrefetchFunction pPrefetchFunction =
+    reinterpret_cast<MappedFileImplPrefetchFunction>(::GetProcAddress(::GetModuleHandleW(L"kernel32.dll"), "PrefetchVirtualMemory"));
+  return pPrefetchFunction;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+MappedFile::Impl initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+MappedFile::Impl::Impl()
+  : mFileHandle(INVALID_HANDLE_VALUE)
+  , mMappingHandle(nullptr)
+  , mpData(nullptr)
+  , mSize(0)
+  , mIsWritable(false) {}
+
+MappedFile::Impl::~Impl()
+{
+  Close();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+MappedFile::Impl accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+const Path& MappedFile::Impl::GetPath() const
+{
+  return mFilePath;
+}
+
+Byte* MappedFile::Impl::GetPtr() const
+{
+  return mpData;
+}
+
+size_t MappedFile::Impl::GetSize() const
+{
+  return mSize;
+}
+
+bool MappedFile::Impl::IsOpen() const
+{
+  return mpData != nullptr;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+MappedFile::Impl methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void MappedFile::Impl::Close()
+{
+  if (mpData) ::UnmapViewOfFile(mpData);
+  if (mMappingHandle) ::CloseHandle(mMappingHandle);
+  if (mFileHandle != INVALID_HANDLE_VALUE) ::CloseHandle(mFileHandle);
+  mFileHandle = INVALID_HANDLE_VALUE;
+  mMappingHandle = nullptr;
+  mpData = nullptr;
+  mSize = 0;
+  mIsWritable = false;
+  mFilePath.Clear();
+}
+
+bool MappedFile::Impl::EnableLargePages()
+{
+  // Large pages (SEC_LARGE_PAGES) are only supported by page file backed sections
+  return false;
+}
+
+bool MappedFile::Impl::Flush()
+{
+  if (mpData == nullptr || !::FlushViewOfFile(mpData, 0)) return false;
+  // FlushViewOfFile only starts the writes (and FlushFileBuffers requires write access)
+  return !mIsWritable || ::FlushFileBuffers(mFileHandle);
+}
+
+bool MappedFile::Impl::Open(const Path& filePath, OpenMode openMode, size_t size)
+{
+  E_ASSERT(filePath.GetLength());
+  Close();
+
+  const bool isWritable = (openMode == eOpenModeReadWrite);
+  const DWORD access = isWritable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ;
+  const DWORD creation = (isWritable && size) ? OPEN_ALWAYS : OPEN_EXISTING;
+  WFilePath wfilePath;
+  Text::Utf8ToWide(wfilePath, filePath);
+  mFileHandle = ::CreateFileW(wfilePath.GetPtr(), access, FILE_SHARE_READ, nullptr, creation, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (mFileHandle == INVALID_HANDLE_VALUE) return false;
+
+  LARGE_INTEGER fileSize;
+  if (!::GetFileSizeEx(mFileHandle, &fileSize))
+  {
+    Close();
+    return false;
+  }
+  // Read write mappings with a size resize the file (CreateFileMapping grows it but never shrinks it)
+  if (isWritable && size && static_cast<U64>(fileSize.QuadPart) != size)
+  {
+    fileSize.QuadPart = static_cast<LONGLONG>(size);
+    if (!::SetFilePointerEx(mFileHandle, fileSize, nullptr, FILE_BEGIN) || !::SetEndOfFile(mFileHandle))
+    {
+      Close();
+      return false;
+    }
+  }
+  // Empty files cannot be mapped and files larger than the address space cannot be mapped at once
+  if (fileSize.QuadPart == 0 || static_cast<U64>(fileSize.QuadPart) > static_cast<size_t>(-1))
+  {
+    Close();
+    return false;
+  }
+
+  mMappingHandle = ::CreateFileMappingW(mFileHandle, nullptr, isWritable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, nullptr);
+  if (mMappingHandle) mpData = static_cast<Byte*>(::MapViewOfFile(mMappingHandle, isWritable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0));
+  if (mpData == nullptr)
+  {
+    Close();
+    return false;
+  }
+  mSize = static_cast<size_t>(fileSize.QuadPart);
+  mIsWritable = isWritable;
+  mFilePath = filePath;
+  return true;
+}
+
+void MappedFile::Impl::Prefetch(size_t offset, size_t size)
+{
+  if (offset >= mSize) return;
+  size = Math::Min(size, mSize - offset);
+
+  MappedFileImplPrefetchFunction pPrefetchFunction = MappedFileImplGetPrefetchFunction();
+  if (pPrefetchFunction)
+  {
+    MappedFileImplMemoryRange range = { mpData + offset, size };
+    if (pPrefetchFunction(::GetCurrentProcess(), 1, &range, 0)) return;
+  }
+
+  // Fall back to touching a byte per page
+  SYSTEM_INFO systemInfo;
+  ::GetSystemInfo(&systemInfo);
+  volatile Byte sum = 0;
+  for (size_t i = 0; i < size; i += systemInfo.dwPageSize) sum += mpData[offset + i];
+}
+
+void MappedFile::Impl::SetAccessHint(AccessHint accessHint)
+{
+  // Page faults on mapped views are not affected by the file cache access flags, so the sequential hint prefetches
+  // the whole file (which the memory manager does asynchronously) and the random hint keeps the default behavior
+  if (accessHint == eAccessHintSequential) Prefetch(0, mSize);
+}
+}
+}
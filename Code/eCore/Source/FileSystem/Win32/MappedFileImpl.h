@@ -0,0 +1,73 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file MappedFileImpl.h
+This file declares the MappedFile::Impl implementation class for Windows.
+*/
+
+#ifndef E3_MAPPED_FILE_IMPL_H
+#define E3_MAPPED_FILE_IMPL_H
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+MappedFile::Impl
+----------------------------------------------------------------------------------------------------------------------*/
+class MappedFile::Impl : public Memory::ProxyAllocated
+{
+public:
+                Impl();
+                ~Impl();
+
+  // Accessors
+  const Path&   GetPath() const;
+  Byte*         GetPtr() const;
+  size_t        GetSize() const;
+  bool          IsOpen() const;
+
+  // Methods
+  void          Close();
+  bool          EnableLargePages();
+  bool          Flush();
+  bool          Open(const Path& filePath, OpenMode openMode, size_t size);
+  void          Prefetch(size_t offset, size_t size);
+  void          SetAccessHint(AccessHint accessHint);
+
+private:
+  Path          mFilePath;
+  HANDLE        mFileHandle;    // File handle (INVALID_HANDLE_VALUE while closed)
+  HANDLE        mMappingHandle; // File mapping object handle (nullptr while closed)
+  Byte*         mpData;         // Mapped view of the whole file
+  size_t        mSize;
+  bool          mIsWritable;
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(Impl)
+};
+}
+}
+
+#endif
@@ -0,0 +1,527 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Bvh.cpp
+This file defines the Bvh class methods.
+*/
+
+#include <CorePch.h>
+#include <Math/Bvh.h>
+
+namespace E
+{
+namespace Math
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Bvh auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Bounds are compared exactly (Vector3f::operator== uses an epsilon, which would let sub epsilon moves accumulate)
+static inline bool BvhIsBoundsEqual(const Vector3f& aMin, const Vector3f& aMax, const Vector3f& bMin, const Vector3f& bMax)
+{
+  return aMin.x == bMin.x && aMin.y == bMin.y && aMin.z == bMin.z &&
+    aMax.x == bMax.x && aMax.y == bMax.y && aMax.z == bMax.z;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Bvh methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void Bvh::Build(const Box3f* pBoxes, U32 boxCount)
+{
+  Containers::List<Vector3f> minMaxList(boxCount * 2);
+  for (U32 i = 0; i < boxCount; ++i)
+  {
+    minMaxList.PushBack(pBoxes[i].GetMin());
+    minMaxList.PushBack(pBoxes[i].GetMax());
+  }
+  Build(minMaxList.GetPtr(), boxCount);
+
+  mBoxList.Reserve(boxCount * 2);
+  for (U32 slot = 0; slot < boxCount; ++slot)
+  {
+    const U32 primitiveIndex = mPrimitiveIndexList[slot];
+    mBoxList.PushBack(minMaxList[primitiveIndex * 2]);
+    mBoxList.PushBack(minMaxList[primitiveIndex * 2 + 1]);
+  }
+}
+
+void Bvh::Build(const Vector3f* pPositions, const U32* pIndices, U32 triangleCount)
+{
+  Containers::List<Vector3f> minMaxList(triangleCount * 2);
+  for (U32 i = 0; i < triangleCount; ++i)
+  {
+    const Vector3f& x0 = pPositions[pIndices[i * 3]];
+    const Vector3f& x1 = pPositions[pIndices[i * 3 + 1]];
+    const Vector3f& x2 = pPositions[pIndices[i * 3 + 2]];
+    minMaxList.PushBack(Vector3f::Min(Vector3f::Min(x0, x1), x2));
+    minMaxList.PushBack(Vector3f::Max(Vector3f::Max(x0, x1), x2));
+  }
+  Build(minMaxList.GetPtr(), triangleCount);
+  SetTriangles(pPositions, pIndices);
+}
+
+void Bvh::Clear()
+{
+  mNodeList.Clear();
+  mPrimitiveIndexList.Clear();
+  mParentList.Clear();
+  mLeafList.Clear();
+  mBoxList.Clear();
+  mTriangleList.Clear();
+  mDepth = 0;
+}
+
+bool Bvh::Intersect(const Vector3f& rayOrigin, const Vector3f& rayDirection, Hit& hit) const
+{
+  if (mBoxList.IsEmpty())
+  {
+    TriangleIntersector intersector(mTriangleList.GetPtr(), rayDirection);
+    return Traverse(rayOrigin, rayDirection, hit, intersector);
+  }
+
+  BoxIntersector intersector(mBoxList.GetPtr());
+  return Traverse(rayOrigin, rayDirection, hit, intersector);
+}
+
+void Bvh::Intersect(const Vector3f* pRayOrigins, const Vector3f* pRayDirections, Hit* pHits, U32 rayCount) const
+{
+  U32 i = 0;
+#ifdef E_SIMD_SSE2
+  static_assert(sizeof(Vector3f) == 3 * sizeof(F32), "Vector3f must be packed");
+  if (!IsEmpty())
+  {
+    for (; i + 4 <= rayCount; i += 4) IntersectPacket(&pRayOrigins[i], &pRayDirections[i], &pHits[i]);
+  }
+#endif
+  for (; i < rayCount; ++i) Intersect(pRayOrigins[i], pRayDirections[i], pHits[i]);
+}
+
+void Bvh::Refit(const Box3f* pBoxes)
+{
+  E_ASSERT_MSG(mTriangleList.IsEmpty(), E_ASSERT_MSG_BVH_BOX_HIERARCHY);
+  for (U32 slot = 0; slot < mPrimitiveIndexList.GetCount(); ++slot)
+  {
+    const Box3f& box = pBoxes[mPrimitiveIndexList[slot]];
+    mBoxList[slot * 2] = box.GetMin();
+    mBoxList[slot * 2 + 1] = box.GetMax();
+  }
+  RefitNodes();
+}
+
+void Bvh::Refit(const Vector3f* pPositions, const U32* pIndices)
+{
+  E_ASSERT_MSG(mBoxList.IsEmpty(), E_ASSERT_MSG_BVH_TRIANGLE_HIERARCHY);
+  mTriangleList.Clear();
+  SetTriangles(pPositions, pIndices);
+  RefitNodes();
+}
+
+/**
+Updates a single primitive walking up from its leaf until the node bounds do not change anymore.
+*/
+void Bvh::Refit(U32 primitiveIndex, const Box3f& box)
+{
+  E_ASSERT_MSG(mTriangleList.IsEmpty(), E_ASSERT_MSG_BVH_BOX_HIERARCHY);
+  E_ASSERT_MSG(primitiveIndex < mLeafList.GetCount(), E_ASSERT_MSG_BVH_PRIMITIVE_INDEX_VALUE, primitiveIndex);
+
+  U32 nodeIndex = mLeafList[primitiveIndex];
+  Node& leaf = mNodeList[nodeIndex];
+  for (U32 slot = leaf.index; slot < leaf.index + leaf.count; ++slot)
+  {
+    if (mPrimitiveIndexList[slot] == primitiveIndex)
+    {
+      mBoxList[slot * 2] = box.GetMin();
+      mBoxList[slot * 2 + 1] = box.GetMax();
+      break;
+    }
+  }
+
+  const Vector3f min = leaf.min;
+  const Vector3f max = leaf.max;
+  UpdateLeaf(leaf);
+  if (BvhIsBoundsEqual(leaf.min, leaf.max, min, max)) return;
+
+  for (nodeIndex = mParentList[nodeIndex]; nodeIndex != kInvalidIndex; nodeIndex = mParentList[nodeIndex])
+  {
+    Node& node = mNodeList[nodeIndex];
+    const Node& left = mNodeList[node.index];
+    const Node& right = mNodeList[node.index + 1];
+    const Vector3f nodeMin = Vector3f::Min(left.min, right.min);
+    const Vector3f nodeMax = Vector3f::Max(left.max, right.max);
+    if (BvhIsBoundsEqual(node.min, node.max, nodeMin, nodeMax)) break;
+
+    node.min = nodeMin;
+    node.max = nodeMax;
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Bvh private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/**
+Builds the hierarchy depth first from the primitive bounds (min & max pairs). Each node is split at the bin boundary
+with the lowest SAH cost (left area * left count + right area * right count) among all axes. Ranges whose centroids
+are all the same, and ranges deeper than kMaxSahDepth (which keeps the traversal stack bounded) are split in halves.
+*/
+void Bvh::Build(const Vector3f* pPrimitiveMinMax, U32 primitiveCount)
+{
+  Clear();
+  if (primitiveCount == 0) return;
+
+  Containers::List<Vector3f> centroidList(primitiveCount);
+  mPrimitiveIndexList.Reserve(primitiveCount);
+  for (U32 i = 0; i < primitiveCount; ++i)
+  {
+    centroidList.PushBack((pPrimitiveMinMax[i * 2] + pPrimitiveMinMax[i * 2 + 1]) * 0.5f);
+    mPrimitiveIndexList.PushBack(i);
+  }
+
+  Node root;
+  root.index = 0;
+  root.count = primitiveCount;
+  mNodeList.Reserve(primitiveCount * 2);
+  mNodeList.PushBack(root);
+  mParentList.Reserve(primitiveCount * 2);
+  mParentList.PushBack(static_cast<U32>(kInvalidIndex));
+
+  U32 nodeStack[kMaxDepth];
+  U32 depthStack[kMaxDepth];
+  U32 stackCount = 1;
+  nodeStack[0] = 0;
+  depthStack[0] = 1;
+  U32* pIndices = mPrimitiveIndexList.GetPtr();
+
+  while (stackCount > 0)
+  {
+    --stackCount;
+    const U32 nodeIndex = nodeStack[stackCount];
+    const U32 depth = depthStack[stackCount];
+    const U32 start = mNodeList[nodeIndex].index;
+    const U32 count = mNodeList[nodeIndex].count;
+    if (depth > mDepth) mDepth = depth;
+
+    // Primitive & centroid bounds
+    Vector3f min = pPrimitiveMinMax[pIndices[start] * 2];
+    Vector3f max = pPrimitiveMinMax[pIndices[start] * 2 + 1];
+    Vector3f centroidMin = centroidList[pIndices[start]];
+    Vector3f centroidMax = centroidMin;
+    for (U32 i = start + 1; i < start + count; ++i)
+    {
+      min = Vector3f::Min(min, pPrimitiveMinMax[pIndices[i] * 2]);
+      max = Vector3f::Max(max, pPrimitiveMinMax[pIndices[i] * 2 + 1]);
+      centroidMin = Vector3f::Min(centroidMin, centroidList[pIndices[i]]);
+      centroidMax = Vector3f::Max(centroidMax, centroidList[pIndices[i]]);
+    }
+    mNodeList[nodeIndex].min = min;
+    mNodeList[nodeIndex].max = max;
+
+    if (count <= kMaxLeafSize) continue;
+
+    // Binned SAH
+    U32 splitAxis = kInvalidIndex;
+    U32 splitBin = 0;
+    F32 splitCost = NumericLimits<F32>::Max();
+    for (U32 axis = 0; axis < 3 && depth < kMaxSahDepth; ++axis)
+    {
+      const F32 extent = centroidMax[axis] - centroidMin[axis];
+      if (extent <= 0.0f) continue;
+
+      const F32 scale = static_cast<F32>(kBinCount) / extent;
+      U32 binCounts[kBinCount] = {};
+      Vector3f binMins[kBinCount];
+      Vector3f binMaxs[kBinCount];
+      for (U32 i = start; i < start + count; ++i)
+      {
+        const U32 bin = Math::Min(static_cast<U32>((centroidList[pIndices[i]][axis] - centroidMin[axis]) * scale), kBinCount - 1);
+        binMins[bin] = binCounts[bin] ? Vector3f::Min(binMins[bin], pPrimitiveMinMax[pIndices[i] * 2]) : pPrimitiveMinMax[pIndices[i] * 2];
+        binMaxs[bin] = binCounts[bin] ? Vector3f::Max(binMaxs[bin], pPrimitiveMinMax[pIndices[i] * 2 + 1]) : pPrimitiveMinMax[pIndices[i] * 2 + 1];
+        ++binCounts[bin];
+      }
+
+      // Right side sweep: costs of the split planes between bin i - 1 and bin i
+      F32 rightCosts[kBinCount];
+      U32 rightCount = 0;
+      Vector3f rightMin, rightMax;
+      for (U32 i = kBinCount - 1; i > 0; --i)
+      {
+        if (binCounts[i])
+        {
+          rightMin = rightCount ? Vector3f::Min(rightMin, binMins[i]) : binMins[i];
+          rightMax = rightCount ? Vector3f::Max(rightMax, binMaxs[i]) : binMaxs[i];
+          rightCount += binCounts[i];
+        }
+        const Vector3f size = rightMax - rightMin;
+        rightCosts[i] = rightCount ? (size.x * size.y + size.y * size.z + size.z * size.x) * rightCount : -1.0f;
+      }
+
+      // Left side sweep
+      U32 leftCount = 0;
+      Vector3f leftMin, leftMax;
+      for (U32 i = 1; i < kBinCount; ++i)
+      {
+        if (binCounts[i - 1])
+        {
+          leftMin = leftCount ? Vector3f::Min(leftMin, binMins[i - 1]) : binMins[i - 1];
+          leftMax = leftCount ? Vector3f::Max(leftMax, binMaxs[i - 1]) : binMaxs[i - 1];
+          leftCount += binCounts[i - 1];
+        }
+        if (leftCount == 0 || rightCosts[i] < 0.0f) continue;
+
+        const Vector3f size = leftMax - leftMin;
+        const F32 cost = (size.x * size.y + size.y * size.z + size.z * size.x) * leftCount + rightCosts[i];
+        if (cost < splitCost)
+        {
+          splitCost = cost;
+          splitAxis = axis;
+          splitBin = i;
+        }
+      }
+    }
+
+    U32 middle = start + count / 2;
+    if (splitAxis != kInvalidIndex)
+    {
+      // Partition the range so that primitives in bins below splitBin come first
+      const F32 scale = static_cast<F32>(kBinCount) / (centroidMax[splitAxis] - centroidMin[splitAxis]);
+      U32 i = start;
+      U32 j = start + count;
+      while (i < j)
+      {
+        const U32 bin = Math::Min(static_cast<U32>((centroidList[pIndices[i]][splitAxis] - centroidMin[splitAxis]) * scale), kBinCount - 1);
+        if (bin < splitBin) ++i;
+        else
+        {
+          const U32 index = pIndices[i];
+          pIndices[i] = pIndices[--j];
+          pIndices[j] = index;
+        }
+      }
+      middle = i;
+    }
+
+    // Children
+    const U32 leftIndex = static_cast<U32>(mNodeList.GetCount());
+    Node child;
+    child.index = start;
+    child.count = middle - start;
+    mNodeList.PushBack(child);
+    child.index = middle;
+    child.count = start + count - middle;
+    mNodeList.PushBack(child);
+    mParentList.PushBack(nodeIndex);
+    mParentList.PushBack(nodeIndex);
+    mNodeList[nodeIndex].index = leftIndex;
+    mNodeList[nodeIndex].count = 0;
+
+    nodeStack[stackCount] = leftIndex + 1;
+    depthStack[stackCount++] = depth + 1;
+    nodeStack[stackCount] = leftIndex;
+    depthStack[stackCount++] = depth + 1;
+  }
+
+  mLeafList.EnsureSize(primitiveCount);
+  mLeafList.SetCount(primitiveCount);
+  for (U32 nodeIndex = 0; nodeIndex < mNodeList.GetCount(); ++nodeIndex)
+  {
+    const Node& node = mNodeList[nodeIndex];
+    for (U32 slot = node.index; slot < node.index + node.count; ++slot) mLeafList[pIndices[slot]] = nodeIndex;
+  }
+}
+
+/**
+Children are always stored after their parent so a reverse traversal of the node list updates children first.
+*/
+void Bvh::RefitNodes()
+{
+  for (size_t i = mNodeList.GetCount(); i > 0; --i)
+  {
+    Node& node = mNodeList[i - 1];
+    if (node.count > 0)
+    {
+      UpdateLeaf(node);
+    }
+    else
+    {
+      node.min = Vector3f::Min(mNodeList[node.index].min, mNodeList[node.index + 1].min);
+      node.max = Vector3f::Max(mNodeList[node.index].max, mNodeList[node.index + 1].max);
+    }
+  }
+}
+
+void Bvh::SetTriangles(const Vector3f* pPositions, const U32* pIndices)
+{
+  mTriangleList.Reserve(mPrimitiveIndexList.GetCount() * 3);
+  for (U32 slot = 0; slot < mPrimitiveIndexList.GetCount(); ++slot)
+  {
+    const U32* pTriangleIndices = &pIndices[mPrimitiveIndexList[slot] * 3];
+    const Vector3f& x0 = pPositions[pTriangleIndices[0]];
+    mTriangleList.PushBack(x0);
+    mTriangleList.PushBack(pPositions[pTriangleIndices[1]] - x0);
+    mTriangleList.PushBack(pPositions[pTriangleIndices[2]] - x0);
+  }
+}
+
+void Bvh::UpdateLeaf(Node& node)
+{
+  if (mBoxList.IsEmpty())
+  {
+    for (U32 slot = node.index; slot < node.index + node.count; ++slot)
+    {
+      const Vector3f& x0 = mTriangleList[slot * 3];
+      const Vector3f x1 = x0 + mTriangleList[slot * 3 + 1];
+      const Vector3f x2 = x0 + mTriangleList[slot * 3 + 2];
+      const Vector3f min = Vector3f::Min(Vector3f::Min(x0, x1), x2);
+      const Vector3f max = Vector3f::Max(Vector3f::Max(x0, x1), x2);
+      node.min = (slot == node.index) ? min : Vector3f::Min(node.min, min);
+      node.max = (slot == node.index) ? max : Vector3f::Max(node.max, max);
+    }
+  }
+  else
+  {
+    node.min = mBoxList[node.index * 2];
+    node.max = mBoxList[node.index * 2 + 1];
+    for (U32 slot = node.index + 1; slot < node.index + node.count; ++slot)
+    {
+      node.min = Vector3f::Min(node.min, mBoxList[slot * 2]);
+      node.max = Vector3f::Max(node.max, mBoxList[slot * 2 + 1]);
+    }
+  }
+}
+
+#ifdef E_SIMD_SSE2
+/**
+Traces 4 rays through the hierarchy. A node is visited while any of the rays still hits it, and interior nodes push
+their children in the order given by the first ray direction. Leaf primitives are tested against the 4 rays at once
+evaluating the operations in the same order as IntersectBox and IntersectTriangle.
+*/
+void Bvh::IntersectPacket(const Vector3f* pRayOrigins, const Vector3f* pRayDirections, Hit* pHits) const
+{
+  __m128 rayOrigin[3], rayDirection[3], rayInvDirection[3];
+  Simd::LoadTransposed(&pRayOrigins[0].x, rayOrigin[0], rayOrigin[1], rayOrigin[2]);
+  Simd::LoadTransposed(&pRayDirections[0].x, rayDirection[0], rayDirection[1], rayDirection[2]);
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 one = _mm_set1_ps(1.0f);
+  for (U32 i = 0; i < 3; ++i) rayInvDirection[i] = _mm_div_ps(one, rayDirection[i]);
+
+  __m128 lambda = _mm_setr_ps(pHits[0].lambda, pHits[1].lambda, pHits[2].lambda, pHits[3].lambda);
+  __m128i primitiveIndex = _mm_setr_epi32(pHits[0].primitiveIndex, pHits[1].primitiveIndex, pHits[2].primitiveIndex, pHits[3].primitiveIndex);
+  const Vector3f& direction = pRayDirections[0];
+  const bool boxFlag = !mBoxList.IsEmpty();
+
+  U32 nodeStack[kMaxDepth];
+  U32 stackCount = 1;
+  nodeStack[0] = 0;
+
+  while (stackCount > 0)
+  {
+    const Node& node = mNodeList[nodeStack[--stackCount]];
+    __m128 nearLambda;
+    if (_mm_movemask_ps(IntersectBox(node.min, node.max, rayOrigin, rayInvDirection, lambda, nearLambda)) == 0) continue;
+
+    if (node.count == 0)
+    {
+      const Node& left = mNodeList[node.index];
+      const Node& right = mNodeList[node.index + 1];
+      const Vector3f offset = (right.min + right.max) - (left.min + left.max);
+      const bool leftFirstFlag = (offset.x * direction.x + offset.y * direction.y + offset.z * direction.z) > 0.0f;
+      nodeStack[stackCount++] = leftFirstFlag ? node.index + 1 : node.index;
+      nodeStack[stackCount++] = leftFirstFlag ? node.index : node.index + 1;
+      continue;
+    }
+
+    for (U32 slot = node.index; slot < node.index + node.count; ++slot)
+    {
+      __m128 hitLambda, mask;
+      if (boxFlag)
+      {
+        mask = IntersectBox(mBoxList[slot * 2], mBoxList[slot * 2 + 1], rayOrigin, rayInvDirection, lambda, hitLambda);
+        mask = _mm_and_ps(mask, _mm_cmplt_ps(hitLambda, lambda));
+      }
+      else
+      {
+        const Vector3f& x0 = mTriangleList[slot * 3];
+        const Vector3f& e0 = mTriangleList[slot * 3 + 1];
+        const Vector3f& e1 = mTriangleList[slot * 3 + 2];
+        const __m128 e0x = _mm_set1_ps(e0.x), e0y = _mm_set1_ps(e0.y), e0z = _mm_set1_ps(e0.z);
+        const __m128 e1x = _mm_set1_ps(e1.x), e1y = _mm_set1_ps(e1.y), e1z = _mm_set1_ps(e1.z);
+
+        const __m128 px = _mm_sub_ps(_mm_mul_ps(rayDirection[1], e1z), _mm_mul_ps(rayDirection[2], e1y));
+        const __m128 py = _mm_sub_ps(_mm_mul_ps(rayDirection[2], e1x), _mm_mul_ps(rayDirection[0], e1z));
+        const __m128 pz = _mm_sub_ps(_mm_mul_ps(rayDirection[0], e1y), _mm_mul_ps(rayDirection[1], e1x));
+        const __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e0x, px), _mm_mul_ps(e0y, py)), _mm_mul_ps(e0z, pz));
+        const __m128 invDet = _mm_div_ps(one, det);
+
+        const __m128 tx = _mm_sub_ps(rayOrigin[0], _mm_set1_ps(x0.x));
+        const __m128 ty = _mm_sub_ps(rayOrigin[1], _mm_set1_ps(x0.y));
+        const __m128 tz = _mm_sub_ps(rayOrigin[2], _mm_set1_ps(x0.z));
+        const __m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(tx, px), _mm_mul_ps(ty, py)), _mm_mul_ps(tz, pz)), invDet);
+
+        const __m128 qx = _mm_sub_ps(_mm_mul_ps(ty, e0z), _mm_mul_ps(tz, e0y));
+        const __m128 qy = _mm_sub_ps(_mm_mul_ps(tz, e0x), _mm_mul_ps(tx, e0z));
+        const __m128 qz = _mm_sub_ps(_mm_mul_ps(tx, e0y), _mm_mul_ps(ty, e0x));
+        const __m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(rayDirection[0], qx), _mm_mul_ps(rayDirection[1], qy)), _mm_mul_ps(rayDirection[2], qz)), invDet);
+        hitLambda = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, qx), _mm_mul_ps(e1y, qy)), _mm_mul_ps(e1z, qz)), invDet);
+
+        mask = _mm_and_ps(_mm_cmpneq_ps(det, zero), _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmple_ps(u, one)));
+        mask = _mm_and_ps(mask, _mm_and_ps(_mm_cmpge_ps(v, zero), _mm_cmple_ps(_mm_add_ps(u, v), one)));
+        mask = _mm_and_ps(mask, _mm_and_ps(_mm_cmpge_ps(hitLambda, zero), _mm_cmplt_ps(hitLambda, lambda)));
+      }
+
+      if (_mm_movemask_ps(mask) == 0) continue;
+
+      const __m128i maskInteger = _mm_castps_si128(mask);
+      lambda = _mm_or_ps(_mm_and_ps(mask, hitLambda), _mm_andnot_ps(mask, lambda));
+      primitiveIndex = _mm_or_si128(_mm_and_si128(maskInteger, _mm_set1_epi32(mPrimitiveIndexList[slot])), _mm_andnot_si128(maskInteger, primitiveIndex));
+    }
+  }
+
+  F32 lambdas[4];
+  U32 primitiveIndices[4];
+  _mm_storeu_ps(lambdas, lambda);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(primitiveIndices), primitiveIndex);
+  for (U32 i = 0; i < 4; ++i)
+  {
+    pHits[i].lambda = lambdas[i];
+    pHits[i].primitiveIndex = primitiveIndices[i];
+  }
+}
+
+__m128 Bvh::IntersectBox(const Vector3f& min, const Vector3f& max, const __m128* pRayOrigin, const __m128* pRayInvDirection, __m128 lambda, __m128& outNear)
+{
+  const __m128 x0 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(min.x), pRayOrigin[0]), pRayInvDirection[0]);
+  const __m128 x1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(max.x), pRayOrigin[0]), pRayInvDirection[0]);
+  const __m128 y0 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(min.y), pRayOrigin[1]), pRayInvDirection[1]);
+  const __m128 y1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(max.y), pRayOrigin[1]), pRayInvDirection[1]);
+  const __m128 z0 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(min.z), pRayOrigin[2]), pRayInvDirection[2]);
+  const __m128 z1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(max.z), pRayOrigin[2]), pRayInvDirection[2]);
+  outNear = _mm_max_ps(_mm_max_ps(_mm_max_ps(_mm_min_ps(x0, x1), _mm_min_ps(y0, y1)), _mm_min_ps(z0, z1)), _mm_setzero_ps());
+  const __m128 farLambda = _mm_min_ps(_mm_min_ps(_mm_min_ps(_mm_max_ps(x0, x1), _mm_max_ps(y0, y1)), _mm_max_ps(z0, z1)), lambda);
+  return _mm_cmple_ps(outNear, farLambda);
+}
+#endif
+}
+}
@@ -0,0 +1,713 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+
+/** @file MeshOptimizer.cpp
+This file defines the MeshOptimizer class methods.
+*/
+
+#include <CorePch.h>
+#include <Math/MeshOptimizer.h>
+#include <Math/Algorithm.h>
+#include <Math/Hash.h>
+
+namespace E
+{
+namespace Math
+{
+/*----------------------------------------------------------------------------------------------------------------------
+MeshOptimizer auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+
+struct MeshOptimizerCluster
+{
+  F32 sortKey;
+  U32 startIndex;
+  U32 endIndex;
+
+  // Clusters are sorted by descending key (index order breaks ties so the sort is deterministic)
+  bool operator==(const MeshOptimizerCluster& other) const { return startIndex == other.startIndex; }
+  bool operator<(const MeshOptimizerCluster& other) const
+  {
+    return (sortKey != other.sortKey) ? sortKey > other.sortKey : startIndex < other.startIndex;
+  }
+};
+
+struct MeshOptimizerCollapse
+{
+  F32 cost;
+  U32 sourceVertex;
+  U32 targetVertex;
+
+  bool operator==(const MeshOptimizerCollapse& other) const
+  {
+    return cost == other.cost && sourceVertex == other.sourceVertex && targetVertex == other.targetVertex;
+  }
+  bool operator<(const MeshOptimizerCollapse& other) const
+  {
+    if (cost != other.cost) return cost < other.cost;
+    return (sourceVertex != other.sourceVertex) ? sourceVertex < other.sourceVertex : targetVertex < other.targetVertex;
+  }
+};
+
+// Symmetric 4x4 matrix of the summed squared plane distances together with the summed plane weights (areas)
+struct MeshOptimizerQuadric
+{
+  F32 a2, ab, ac, ad, b2, bc, bd, c2, cd, d2;
+  F32 weight;
+};
+
+inline void MeshOptimizerAddQuadric(MeshOptimizerQuadric& quadric, const MeshOptimizerQuadric& other)
+{
+  quadric.a2 += other.a2; quadric.ab += other.ab; quadric.ac += other.ac; quadric.ad += other.ad;
+  quadric.b2 += other.b2; quadric.bc += other.bc; quadric.bd += other.bd;
+  quadric.c2 += other.c2; quadric.cd += other.cd;
+  quadric.d2 += other.d2;
+  quadric.weight += other.weight;
+}
+
+inline void MeshOptimizerAddPlaneQuadric(MeshOptimizerQuadric& quadric, const Vector3f& normal, F32 distance, F32 weight)
+{
+  quadric.a2 += normal.x * normal.x * weight; quadric.ab += normal.x * normal.y * weight; quadric.ac += normal.x * normal.z * weight; quadric.ad += normal.x * distance * weight;
+  quadric.b2 += normal.y * normal.y * weight; quadric.bc += normal.y * normal.z * weight; quadric.bd += normal.y * distance * weight;
+  quadric.c2 += normal.z * normal.z * weight; quadric.cd += normal.z * distance * weight;
+  quadric.d2 += distance * distance * weight;
+  quadric.weight += weight;
+}
+
+/**
+Returns the weighted squared distance sum of the point to the quadric planes (rounding may give tiny negative values).
+*/
+inline F32 MeshOptimizerEvaluateQuadric(const MeshOptimizerQuadric& quadric, const Vector3f& point)
+{
+  const F32 rx = quadric.a2 * point.x + quadric.ab * point.y + quadric.ac * point.z + quadric.ad;
+  const F32 ry = quadric.ab * point.x + quadric.b2 * point.y + quadric.bc * point.z + quadric.bd;
+  const F32 rz = quadric.ac * point.x + quadric.bc * point.y + quadric.c2 * point.z + quadric.cd;
+  const F32 rw = quadric.ad * point.x + quadric.bd * point.y + quadric.cd * point.z + quadric.d2;
+  return Abs(rx * point.x + ry * point.y + rz * point.z + rw);
+}
+
+/**
+Returns true if the sorted edge list contains the edge.
+*/
+inline bool MeshOptimizerHasEdge(const U64* pEdges, size_t edgeCount, U64 edge)
+{
+  size_t first = 0;
+  size_t last = edgeCount;
+  while (first < last)
+  {
+    const size_t middle = first + (last - first) / 2;
+    if (pEdges[middle] < edge) first = middle + 1;
+    else last = middle;
+  }
+  return first < edgeCount && pEdges[first] == edge;
+}
+
+/**
+Simulates a FIFO vertex cache access of the triangle vertices and returns the number of cache misses.
+*/
+inline U32 MeshOptimizerUpdateCache(const U32* pTriangle, U32* pTimestamps, U32& timestamp, U32 cacheSize)
+{
+  U32 missCount = 0;
+  for (U32 i = 0; i < 3; ++i)
+  {
+    const U32 vertexIndex = pTriangle[i];
+    if (timestamp - pTimestamps[vertexIndex] > cacheSize)
+    {
+      pTimestamps[vertexIndex] = timestamp++;
+      ++missCount;
+    }
+  }
+  return missCount;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+MeshOptimizer methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+MeshOptimizer::VertexCacheStatistics MeshOptimizer::AnalyzeVertexCache(const U32* pIndices, U32 indexCount, U32 vertexCount, U32 cacheSize /* = kDefaultCacheSize */)
+{
+  E_ASSERT_MSG(indexCount % 3 == 0, E_ASSERT_MSG_MESH_OPTIMIZER_INDEX_COUNT, indexCount);
+  VertexCacheStatistics statistics;
+  if (indexCount == 0) return statistics;
+
+  Containers::List<U32> timestampList(vertexCount);
+  timestampList.SetCount(vertexCount);
+  Memory::Zero(timestampList.GetPtr(), vertexCount);
+  U32 timestamp = cacheSize + 1;
+  U32 referencedVertexCount = 0;
+  for (U32 i = 0; i < indexCount; i += 3)
+  {
+    for (U32 j = 0; j < 3; ++j)
+    {
+      E_ASSERT_MSG(pIndices[i + j] < vertexCount, E_ASSERT_MSG_MESH_OPTIMIZER_INDEX_VALUE, pIndices[i + j]);
+      if (timestampList[pIndices[i + j]] == 0) ++referencedVertexCount;
+    }
+    statistics.transformedVertexCount += MeshOptimizerUpdateCache(&pIndices[i], timestampList.GetPtr(), timestamp, cacheSize);
+  }
+
+  statistics.acmr = static_cast<F32>(statistics.transformedVertexCount) / static_cast<F32>(indexCount / 3);
+  statistics.atvr = static_cast<F32>(statistics.transformedVertexCount) / static_cast<F32>(referencedVertexCount);
+  return statistics;
+}
+
+U32 MeshOptimizer::GenerateVertexRemap(U32* pRemap, const U32* pIndices, U32 indexCount, const void* pVertices, U32 vertexCount, size_t vertexSize)
+{
+  for (U32 i = 0; i < vertexCount; ++i) pRemap[i] = kInvalidIndex;
+  if (vertexCount == 0) return 0;
+
+  // Open addressing hash table storing the first vertex of every unique value (load factor below 0.8)
+  U32 tableSize = 1;
+  while (tableSize < vertexCount + vertexCount / 4) tableSize <<= 1;
+  const U32 tableMask = tableSize - 1;
+  Containers::List<U32> tableList(tableSize);
+  tableList.SetCount(tableSize);
+  for (U32 i = 0; i < tableSize; ++i) tableList[i] = kInvalidIndex;
+
+  const Byte* pData = static_cast<const Byte*>(pVertices);
+  const U32 count = (pIndices != nullptr) ? indexCount : vertexCount;
+  U32 uniqueVertexCount = 0;
+  for (U32 i = 0; i < count; ++i)
+  {
+    const U32 vertexIndex = (pIndices != nullptr) ? pIndices[i] : i;
+    E_ASSERT_MSG(vertexIndex < vertexCount, E_ASSERT_MSG_MESH_OPTIMIZER_INDEX_VALUE, vertexIndex);
+    if (pRemap[vertexIndex] != kInvalidIndex) continue;
+
+    const Byte* pVertex = pData + vertexIndex * vertexSize;
+    U32 bucket = static_cast<U32>(XxHash64::Hash(pVertex, vertexSize)) & tableMask;
+    while (tableList[bucket] != kInvalidIndex && memcmp(pData + tableList[bucket] * vertexSize, pVertex, vertexSize) != 0)
+    {
+      bucket = (bucket + 1) & tableMask;
+    }
+
+    if (tableList[bucket] == kInvalidIndex)
+    {
+      tableList[bucket] = vertexIndex;
+      pRemap[vertexIndex] = uniqueVertexCount++;
+    }
+    else
+    {
+      pRemap[vertexIndex] = pRemap[tableList[bucket]];
+    }
+  }
+
+  return uniqueVertexCount;
+}
+
+void MeshOptimizer::OptimizeOverdraw(U32* pResult, const U32* pIndices, U32 indexCount, const Vector3f* pPositions, U32 vertexCount, F32 threshold /* = 1.05f */, U32 cacheSize /* = kDefaultCacheSize */)
+{
+  E_ASSERT_MSG(indexCount % 3 == 0, E_ASSERT_MSG_MESH_OPTIMIZER_INDEX_COUNT, indexCount);
+  if (indexCount == 0) return;
+
+  // Keep a copy of the source indices when optimizing in place
+  Containers::List<U32> sourceList;
+  if (pResult == pIndices)
+  {
+    sourceList.PushBack(pIndices, indexCount);
+    pIndices = sourceList.GetPtr();
+  }
+
+  /*-----------------------------------------------------------------
+  Hard boundaries: triangles missing all their vertices start a new cluster (Tipsify output has a cache flush there)
+  -----------------------------------------------------------------*/
+  const U32 triangleCount = indexCount / 3;
+  Containers::List<U32> timestampList(vertexCount);
+  timestampList.SetCount(vertexCount);
+  Memory::Zero(timestampList.GetPtr(), vertexCount);
+  Containers::List<U32> hardBoundaryList(triangleCount / 8 + 1);
+  U32 timestamp = cacheSize + 1;
+  for (U32 i = 0; i < triangleCount; ++i)
+  {
+    if (MeshOptimizerUpdateCache(&pIndices[i * 3], timestampList.GetPtr(), timestamp, cacheSize) == 3 || i == 0)
+    {
+      hardBoundaryList.PushBack(i);
+    }
+  }
+  hardBoundaryList.PushBack(triangleCount);
+
+  /*-----------------------------------------------------------------
+  Soft boundaries: split hard clusters while the cluster ACMR stays within threshold
+  -----------------------------------------------------------------*/
+  Containers::List<MeshOptimizerCluster> clusterList(hardBoundaryList.GetCount());
+  for (size_t i = 0; i + 1 < hardBoundaryList.GetCount(); ++i)
+  {
+    const U32 start = hardBoundaryList[i];
+    const U32 end = hardBoundaryList[i + 1];
+
+    // Flush the cache (every timestamp becomes too old) and measure the whole cluster
+    timestamp += cacheSize + 1;
+    U32 clusterMissCount = 0;
+    for (U32 j = start; j < end; ++j) clusterMissCount += MeshOptimizerUpdateCache(&pIndices[j * 3], timestampList.GetPtr(), timestamp, cacheSize);
+    const F32 clusterThreshold = threshold * static_cast<F32>(clusterMissCount) / static_cast<F32>(end - start);
+
+    timestamp += cacheSize + 1;
+    U32 clusterStart = start;
+    U32 missCount = 0;
+    for (U32 j = start; j < end; ++j)
+    {
+      missCount += MeshOptimizerUpdateCache(&pIndices[j * 3], timestampList.GetPtr(), timestamp, cacheSize);
+      if (j + 1 == end || static_cast<F32>(missCount) <= clusterThreshold * static_cast<F32>(j + 1 - clusterStart))
+      {
+        MeshOptimizerCluster cluster;
+        cluster.sortKey = 0.0f;
+        cluster.startIndex = clusterStart * 3;
+        cluster.endIndex = (j + 1) * 3;
+        clusterList.PushBack(cluster);
+        clusterStart = j + 1;
+        missCount = 0;
+        timestamp += cacheSize + 1;
+      }
+    }
+  }
+
+  /*-----------------------------------------------------------------
+  Sort clusters: outward facing clusters far from the mesh center first
+  -----------------------------------------------------------------*/
+  Vector3f meshCenter;
+  for (U32 i = 0; i < indexCount; ++i) meshCenter += pPositions[pIndices[i]];
+  meshCenter /= static_cast<F32>(indexCount);
+
+  for (size_t i = 0; i < clusterList.GetCount(); ++i)
+  {
+    MeshOptimizerCluster& cluster = clusterList[i];
+    Vector3f clusterCenter;
+    Vector3f clusterNormal;
+    F32 clusterArea = 0.0f;
+    for (U32 j = cluster.startIndex; j < cluster.endIndex; j += 3)
+    {
+      const Vector3f& x0 = pPositions[pIndices[j]];
+      const Vector3f& x1 = pPositions[pIndices[j + 1]];
+      const Vector3f& x2 = pPositions[pIndices[j + 2]];
+      // The cross product length is twice the triangle area, which weights both the normal and the center
+      const Vector3f normal = Vector3f::Cross(x1 - x0, x2 - x0);
+      const F32 area = normal.GetLength();
+      clusterCenter += (x0 + x1 + x2) * (area / 3.0f);
+      clusterNormal += normal;
+      clusterArea += area;
+    }
+
+    const F32 normalLength = clusterNormal.GetLength();
+    if (clusterArea > 0.0f && normalLength > 0.0f)
+    {
+      clusterCenter /= clusterArea;
+      clusterNormal /= normalLength;
+      cluster.sortKey = Vector3f::Dot(clusterCenter - meshCenter, clusterNormal);
+    }
+  }
+  Sorting<MeshOptimizerCluster>::IntroSort(clusterList.GetPtr(), clusterList.GetCount());
+
+  U32 resultIndex = 0;
+  for (size_t i = 0; i < clusterList.GetCount(); ++i)
+  {
+    const MeshOptimizerCluster& cluster = clusterList[i];
+    for (U32 j = cluster.startIndex; j < cluster.endIndex; ++j) pResult[resultIndex++] = pIndices[j];
+  }
+}
+
+void MeshOptimizer::OptimizeVertexCache(U32* pResult, const U32* pIndices, U32 indexCount, U32 vertexCount, U32 cacheSize /* = kDefaultCacheSize */)
+{
+  E_ASSERT_MSG(indexCount % 3 == 0, E_ASSERT_MSG_MESH_OPTIMIZER_INDEX_COUNT, indexCount);
+  if (indexCount == 0) return;
+
+  // Keep a copy of the source indices when optimizing in place
+  Containers::List<U32> sourceList;
+  if (pResult == pIndices)
+  {
+    sourceList.PushBack(pIndices, indexCount);
+    pIndices = sourceList.GetPtr();
+  }
+
+  /*-----------------------------------------------------------------
+  Vertex triangle adjacency (live triangle counts & packed triangle lists)
+  -----------------------------------------------------------------*/
+  const U32 triangleCount = indexCount / 3;
+  Containers::List<U32> liveCountList(vertexCount);
+  liveCountList.SetCount(vertexCount);
+  Memory::Zero(liveCountList.GetPtr(), vertexCount);
+  for (U32 i = 0; i < indexCount; ++i)
+  {
+    E_ASSERT_MSG(pIndices[i] < vertexCount, E_ASSERT_MSG_MESH_OPTIMIZER_INDEX_VALUE, pIndices[i]);
+    ++liveCountList[pIndices[i]];
+  }
+
+  // Offsets start as inclusive prefix sums and end up as the first triangle of every vertex once filled backwards
+  Containers::List<U32> offsetList(vertexCount + 1);
+  offsetList.SetCount(vertexCount + 1);
+  U32 offset = 0;
+  for (U32 i = 0; i < vertexCount; ++i)
+  {
+    offset += liveCountList[i];
+    offsetList[i] = offset;
+  }
+  offsetList[vertexCount] = offset;
+
+  Containers::List<U32> adjacencyList(indexCount);
+  adjacencyList.SetCount(indexCount);
+  for (U32 i = triangleCount; i-- > 0;)
+  {
+    adjacencyList[--offsetList[pIndices[i * 3]]] = i;
+    adjacencyList[--offsetList[pIndices[i * 3 + 1]]] = i;
+    adjacencyList[--offsetList[pIndices[i * 3 + 2]]] = i;
+  }
+
+  /*-----------------------------------------------------------------
+  Tipsify
+  -----------------------------------------------------------------*/
+  Containers::List<U32> timestampList(vertexCount);
+  timestampList.SetCount(vertexCount);
+  Memory::Zero(timestampList.GetPtr(), vertexCount);
+  Containers::List<U8> emittedList(triangleCount);
+  emittedList.SetCount(triangleCount);
+  Memory::Zero(emittedList.GetPtr(), triangleCount);
+  Containers::List<U32> deadEndList(indexCount);
+  Containers::List<U32> candidateList(64);
+
+  U32 timestamp = cacheSize + 1;
+  U32 cursor = 0;
+  U32 resultIndex = 0;
+  while (cursor < vertexCount && liveCountList[cursor] == 0) ++cursor;
+  U32 fanningVertex = (cursor < vertexCount) ? cursor : kInvalidIndex;
+
+  while (fanningVertex != kInvalidIndex)
+  {
+    // Emit every remaining triangle around the fanning vertex
+    candidateList.Clear();
+    for (U32 i = offsetList[fanningVertex]; i < offsetList[fanningVertex + 1]; ++i)
+    {
+      const U32 triangleIndex = adjacencyList[i];
+      if (emittedList[triangleIndex]) continue;
+
+      for (U32 j = 0; j < 3; ++j)
+      {
+        const U32 vertexIndex = pIndices[triangleIndex * 3 + j];
+        pResult[resultIndex++] = vertexIndex;
+        deadEndList.PushBack(vertexIndex);
+        candidateList.PushBack(vertexIndex);
+        --liveCountList[vertexIndex];
+        if (timestamp - timestampList[vertexIndex] > cacheSize) timestampList[vertexIndex] = timestamp++;
+      }
+      emittedList[triangleIndex] = 1;
+    }
+
+    // Next fanning vertex: the oldest candidate which will still be in cache after emitting all its triangles
+    fanningVertex = kInvalidIndex;
+    U32 bestPriority = 0;
+    for (size_t i = 0; i < candidateList.GetCount(); ++i)
+    {
+      const U32 vertexIndex = candidateList[i];
+      if (liveCountList[vertexIndex] == 0) continue;
+
+      const U32 age = timestamp - timestampList[vertexIndex];
+      const U32 priority = (age + 2 * liveCountList[vertexIndex] <= cacheSize) ? age + 1 : 1;
+      if (priority > bestPriority)
+      {
+        bestPriority = priority;
+        fanningVertex = vertexIndex;
+      }
+    }
+
+    // Dead end: use the most recently emitted vertex with live triangles or the next one in input order
+    while (fanningVertex == kInvalidIndex && !deadEndList.IsEmpty())
+    {
+      const U32 vertexIndex = deadEndList[deadEndList.GetCount() - 1];
+      deadEndList.PopBack();
+      if (liveCountList[vertexIndex] > 0) fanningVertex = vertexIndex;
+    }
+    if (fanningVertex == kInvalidIndex)
+    {
+      while (cursor < vertexCount && liveCountList[cursor] == 0) ++cursor;
+      if (cursor < vertexCount) fanningVertex = cursor;
+    }
+  }
+}
+
+U32 MeshOptimizer::OptimizeVertexFetch(U32* pRemap, const U32* pIndices, U32 indexCount, U32 vertexCount)
+{
+  for (U32 i = 0; i < vertexCount; ++i) pRemap[i] = kInvalidIndex;
+
+  U32 uniqueVertexCount = 0;
+  for (U32 i = 0; i < indexCount; ++i)
+  {
+    E_ASSERT_MSG(pIndices[i] < vertexCount, E_ASSERT_MSG_MESH_OPTIMIZER_INDEX_VALUE, pIndices[i]);
+    if (pRemap[pIndices[i]] == kInvalidIndex) pRemap[pIndices[i]] = uniqueVertexCount++;
+  }
+
+  return uniqueVertexCount;
+}
+
+void MeshOptimizer::RemapIndices(U32* pResult, const U32* pIndices, U32 indexCount, const U32* pRemap)
+{
+  for (U32 i = 0; i < indexCount; ++i) pResult[i] = pRemap[pIndices[i]];
+}
+
+U32 MeshOptimizer::Simplify(U32* pResult, const U32* pIndices, U32 indexCount, const Vector3f* pPositions, U32 vertexCount, U32 targetIndexCount, F32 targetError /* = 1.0f */, F32* pResultError /* = nullptr */)
+{
+  E_ASSERT_MSG(indexCount % 3 == 0, E_ASSERT_MSG_MESH_OPTIMIZER_INDEX_COUNT, indexCount);
+  if (pResultError != nullptr) *pResultError = 0.0f;
+  if (pResult != pIndices) Memory::Copy(pResult, pIndices, indexCount);
+  if (indexCount <= targetIndexCount) return indexCount;
+
+  /*-----------------------------------------------------------------
+  Positions (vertices with the same position are welded and the whole mesh is scaled into the unit cube)
+  -----------------------------------------------------------------*/
+  Containers::List<U32> positionRemapList(vertexCount);
+  positionRemapList.SetCount(vertexCount);
+  const U32 positionCount = GenerateVertexRemap(positionRemapList.GetPtr(), pResult, indexCount, pPositions, vertexCount, sizeof(Vector3f));
+  const U32* pPositionRemap = positionRemapList.GetPtr();
+
+  Containers::List<Vector3f> positionList(positionCount);
+  positionList.SetCount(positionCount);
+  Containers::List<U8> lockedList(positionCount);
+  lockedList.SetCount(positionCount);
+  Memory::Zero(lockedList.GetPtr(), positionCount);
+  Containers::List<U32> wedgeList(positionCount);
+  wedgeList.SetCount(positionCount);
+  for (U32 i = 0; i < positionCount; ++i) wedgeList[i] = kInvalidIndex;
+  for (U32 i = 0; i < vertexCount; ++i)
+  {
+    const U32 positionIndex = pPositionRemap[i];
+    if (positionIndex == kInvalidIndex) continue;
+    positionList[positionIndex] = pPositions[i];
+    // Seam vertices (several vertex indices per position) are locked
+    if (wedgeList[positionIndex] != kInvalidIndex) lockedList[positionIndex] = 1;
+    wedgeList[positionIndex] = i;
+  }
+
+  Vector3f minPosition;
+  Vector3f maxPosition;
+  Vector3f::MinMax(minPosition, maxPosition, positionList.GetPtr(), positionCount);
+  const Vector3f extents = maxPosition - minPosition;
+  const F32 extent = Max(Max(extents.x, extents.y), extents.z);
+  const F32 scale = (extent > 0.0f) ? 1.0f / extent : 1.0f;
+  for (U32 i = 0; i < positionCount; ++i) positionList[i] = (positionList[i] - minPosition) * scale;
+
+  // Triangles degenerated by the position welding (e.g. sphere poles) are removed
+  U32 resultIndexCount = 0;
+  for (U32 i = 0; i < indexCount; i += 3)
+  {
+    const U32 a = pPositionRemap[pResult[i]];
+    const U32 b = pPositionRemap[pResult[i + 1]];
+    const U32 c = pPositionRemap[pResult[i + 2]];
+    if (a == b || b == c || c == a) continue;
+    pResult[resultIndexCount++] = pResult[i];
+    pResult[resultIndexCount++] = pResult[i + 1];
+    pResult[resultIndexCount++] = pResult[i + 2];
+  }
+
+  /*-----------------------------------------------------------------
+  Open boundaries (directed edges without the opposite edge) are locked
+  -----------------------------------------------------------------*/
+  Containers::List<U64> edgeList(resultIndexCount);
+  for (U32 i = 0; i < resultIndexCount; i += 3)
+  {
+    for (U32 j = 0; j < 3; ++j)
+    {
+      const U64 a = pPositionRemap[pResult[i + j]];
+      const U64 b = pPositionRemap[pResult[i + (j + 1) % 3]];
+      edgeList.PushBack((a << 32) | b);
+    }
+  }
+  Sorting<U64>::IntroSort(edgeList.GetPtr(), edgeList.GetCount());
+  for (U32 i = 0; i < resultIndexCount; i += 3)
+  {
+    for (U32 j = 0; j < 3; ++j)
+    {
+      const U32 a = pPositionRemap[pResult[i + j]];
+      const U32 b = pPositionRemap[pResult[i + (j + 1) % 3]];
+      if (!MeshOptimizerHasEdge(edgeList.GetPtr(), edgeList.GetCount(), (static_cast<U64>(b) << 32) | a))
+      {
+        lockedList[a] = 1;
+        lockedList[b] = 1;
+      }
+    }
+  }
+
+  /*-----------------------------------------------------------------
+  Area weighted triangle plane quadrics
+  -----------------------------------------------------------------*/
+  Containers::List<MeshOptimizerQuadric> quadricList(positionCount);
+  quadricList.SetCount(positionCount);
+  Memory::Zero(quadricList.GetPtr(), positionCount);
+  for (U32 i = 0; i < resultIndexCount; i += 3)
+  {
+    const U32 a = pPositionRemap[pResult[i]];
+    const U32 b = pPositionRemap[pResult[i + 1]];
+    const U32 c = pPositionRemap[pResult[i + 2]];
+    Vector3f normal = Vector3f::Cross(positionList[b] - positionList[a], positionList[c] - positionList[a]);
+    const F32 length = normal.GetLength();
+    if (length == 0.0f) continue;
+
+    normal /= length;
+    const F32 distance = -Vector3f::Dot(normal, positionList[a]);
+    MeshOptimizerAddPlaneQuadric(quadricList[a], normal, distance, length * 0.5f);
+    MeshOptimizerAddPlaneQuadric(quadricList[b], normal, distance, length * 0.5f);
+    MeshOptimizerAddPlaneQuadric(quadricList[c], normal, distance, length * 0.5f);
+  }
+
+  /*-----------------------------------------------------------------
+  Collapse passes: collapses are sorted by cost and applied while they do not touch vertices already modified in the
+  same pass (so their cost is still valid)
+  -----------------------------------------------------------------*/
+  Containers::List<U32> offsetList(positionCount + 1);
+  offsetList.SetCount(positionCount + 1);
+  Containers::List<U32> adjacencyList(indexCount);
+  adjacencyList.SetCount(indexCount);
+  Containers::List<U8> passLockedList(positionCount);
+  passLockedList.SetCount(positionCount);
+  Containers::List<U8> removedList(indexCount / 3);
+  removedList.SetCount(indexCount / 3);
+  Containers::List<MeshOptimizerCollapse> collapseList(indexCount);
+
+  const F32 maxCost = targetError * targetError;
+  F32 resultCost = 0.0f;
+  while (resultIndexCount > targetIndexCount)
+  {
+    const U32 triangleCount = resultIndexCount / 3;
+
+    // Position triangle adjacency (offsets are filled backwards as in OptimizeVertexCache)
+    Memory::Zero(offsetList.GetPtr(), positionCount + 1);
+    for (U32 i = 0; i < resultIndexCount; ++i) ++offsetList[pPositionRemap[pResult[i]]];
+    for (U32 i = 1; i <= positionCount; ++i) offsetList[i] += offsetList[i - 1];
+    for (U32 i = triangleCount; i-- > 0;)
+    {
+      adjacencyList[--offsetList[pPositionRemap[pResult[i * 3]]]] = i;
+      adjacencyList[--offsetList[pPositionRemap[pResult[i * 3 + 1]]]] = i;
+      adjacencyList[--offsetList[pPositionRemap[pResult[i * 3 + 2]]]] = i;
+    }
+
+    // Every directed edge proposes collapsing its first vertex onto the second one (the opposite direction is
+    // proposed by the neighbor triangle)
+    collapseList.Clear();
+    for (U32 i = 0; i < resultIndexCount; i += 3)
+    {
+      for (U32 j = 0; j < 3; ++j)
+      {
+        const U32 a = pPositionRemap[pResult[i + j]];
+        const U32 b = pPositionRemap[pResult[i + (j + 1) % 3]];
+        if (lockedList[a] || a == b) continue;
+
+        MeshOptimizerQuadric quadric = quadricList[a];
+        MeshOptimizerAddQuadric(quadric, quadricList[b]);
+        MeshOptimizerCollapse collapse;
+        collapse.cost = (quadric.weight > 0.0f) ? MeshOptimizerEvaluateQuadric(quadric, positionList[b]) / quadric.weight : 0.0f;
+        collapse.sourceVertex = a;
+        collapse.targetVertex = b;
+        collapseList.PushBack(collapse);
+      }
+    }
+    if (collapseList.IsEmpty()) break;
+    Sorting<MeshOptimizerCollapse>::IntroSort(collapseList.GetPtr(), collapseList.GetCount());
+
+    Memory::Zero(passLockedList.GetPtr(), positionCount);
+    Memory::Zero(removedList.GetPtr(), triangleCount);
+    U32 removedIndexCount = 0;
+    U32 collapseCount = 0;
+    for (size_t i = 0; i < collapseList.GetCount() && removedIndexCount < resultIndexCount - targetIndexCount; ++i)
+    {
+      const MeshOptimizerCollapse& collapse = collapseList[i];
+      if (collapse.cost > maxCost) break;
+      const U32 source = collapse.sourceVertex;
+      const U32 target = collapse.targetVertex;
+      if (passLockedList[source] || passLockedList[target]) continue;
+
+      // Find the target vertex index used next to the source and reject collapses flipping triangles
+      U32 targetVertexIndex = kInvalidIndex;
+      bool isValid = true;
+      for (U32 j = offsetList[source]; j < offsetList[source + 1] && isValid; ++j)
+      {
+        const U32 triangleIndex = adjacencyList[j];
+        if (removedList[triangleIndex]) continue;
+
+        const U32* pTriangle = &pResult[triangleIndex * 3];
+        U32 positionIndices[3] = { pPositionRemap[pTriangle[0]], pPositionRemap[pTriangle[1]], pPositionRemap[pTriangle[2]] };
+        bool hasTarget = false;
+        for (U32 k = 0; k < 3; ++k)
+        {
+          if (positionIndices[k] == target)
+          {
+            targetVertexIndex = pTriangle[k];
+            hasTarget = true;
+          }
+        }
+        if (hasTarget) continue;
+
+        const Vector3f normal = Vector3f::Cross(positionList[positionIndices[1]] - positionList[positionIndices[0]], positionList[positionIndices[2]] - positionList[positionIndices[0]]);
+        for (U32 k = 0; k < 3; ++k)
+        {
+          if (positionIndices[k] == source) positionIndices[k] = target;
+        }
+        const Vector3f collapsedNormal = Vector3f::Cross(positionList[positionIndices[1]] - positionList[positionIndices[0]], positionList[positionIndices[2]] - positionList[positionIndices[0]]);
+        // Normals rotating more than ~75 degrees are rejected too so that several passes cannot fold a triangle over
+        const F32 normalLengthSquared = normal.GetLengthSquared();
+        if (normalLengthSquared > 0.0f &&
+          Vector3f::Dot(normal, collapsedNormal) <= 0.25f * Sqrt(normalLengthSquared * collapsedNormal.GetLengthSquared())) isValid = false;
+      }
+      if (!isValid || targetVertexIndex == kInvalidIndex) continue;
+
+      // Collapse (triangles holding both vertices become degenerate and are removed)
+      for (U32 j = offsetList[source]; j < offsetList[source + 1]; ++j)
+      {
+        const U32 triangleIndex = adjacencyList[j];
+        if (removedList[triangleIndex]) continue;
+
+        U32* pTriangle = &pResult[triangleIndex * 3];
+        for (U32 k = 0; k < 3; ++k)
+        {
+          if (pPositionRemap[pTriangle[k]] == source) pTriangle[k] = targetVertexIndex;
+        }
+        const U32 a = pPositionRemap[pTriangle[0]];
+        const U32 b = pPositionRemap[pTriangle[1]];
+        const U32 c = pPositionRemap[pTriangle[2]];
+        if (a == b || b == c || c == a)
+        {
+          removedList[triangleIndex] = 1;
+          removedIndexCount += 3;
+        }
+      }
+      MeshOptimizerAddQuadric(quadricList[target], quadricList[source]);
+      passLockedList[source] = 1;
+      passLockedList[target] = 1;
+      resultCost = Max(resultCost, collapse.cost);
+      ++collapseCount;
+    }
+    if (collapseCount == 0) break;
+
+    // Compact the remaining triangles
+    U32 index = 0;
+    for (U32 i = 0; i < triangleCount; ++i)
+    {
+      if (removedList[i]) continue;
+      pResult[index++] = pResult[i * 3];
+      pResult[index++] = pResult[i * 3 + 1];
+      pResult[index++] = pResult[i * 3 + 2];
+    }
+    resultIndexCount = index;
+  }
+
+  if (pResultError != nullptr) *pResultError = Sqrt(resultCost);
+  return resultIndexCount;
+}
+}
+}
@@ -189,10 +189,79 @@ void XmlSerializer::operator>>(String& v)
   mpImpl->operator>>(v);
 }
 
+/*----------------------------------------------------------------------------------------------------------------------
+XmlSerializer serialization
+----------------------------------------------------------------------------------------------------------------------*/
+
+void XmlSerializer::Read(U16* pData, size_t count)
+{
+  mpImpl->Read(pData, count);
+}
+
+void XmlSerializer::Read(U32* pData, size_t count)
+{
+  mpImpl->Read(pData, count);
+}
+
+void XmlSerializer::Read(U64* pData, size_t count)
+{
+  mpImpl->Read(pData, count);
+}
+
+void XmlSerializer::Read(F32* pData, size_t count)
+{
+  mpImpl->Read(pData, count);
+}
+
+void XmlSerializer::Read(D64* pData, size_t count)
+{
+  mpImpl->Read(pData, count);
+}
+
+void XmlSerializer::ReadBlock(void* pData, size_t size)
+{
+  mpImpl->ReadBlock(pData, size);
+}
+
+void XmlSerializer::Write(const U16* pData, size_t count)
+{
+  mpImpl->Write(pData, count);
+}
+
+void XmlSerializer::Write(const U32* pData, size_t count)
+{
+  mpImpl->Write(pData, count);
+}
+
+void XmlSerializer::Write(const U64* pData, size_t count)
+{
+  mpImpl->Write(pData, count);
+}
+
+void XmlSerializer::Write(const F32* pData, size_t count)
+{
+  mpImpl->Write(pData, count);
+}
+
+void XmlSerializer::Write(const D64* pData, size_t count)
+{
+  mpImpl->Write(pData, count);
+}
+
+void XmlSerializer::WriteBlock(const void* pData, size_t size)
+{
+  mpImpl->WriteBlock(pData, size);
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 XmlSerializer methods
 ----------------------------------------------------------------------------------------------------------------------*/
 
+void XmlSerializer::BeginStream(FileSystem::Archive& archive, StreamMode streamMode)
+{
+  mpImpl->BeginStream(archive, streamMode);
+}
+
 void XmlSerializer::BeginTag(const StringBuffer& name)
 {
   mpImpl->BeginTag(name);
@@ -203,11 +272,21 @@ void XmlSerializer::Clear()
   mpImpl->Clear();
 }
 
+void XmlSerializer::EndStream()
+{
+  mpImpl->EndStream();
+}
+
 void XmlSerializer::EndTag()
 {
   mpImpl->EndTag();
 }
 
+bool XmlSerializer::Load(const StringBuffer& fileName)
+{
+  return mpImpl->Load(fileName);
+}
+
 void XmlSerializer::Save(const StringBuffer& fileName)
 {
   mpImpl->Save(fileName);
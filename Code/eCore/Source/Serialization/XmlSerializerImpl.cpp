@@ -33,6 +33,8 @@ This class uses the third party library pugixml (http://pugixml.org/)
 
 #include <CorePch.h>
 #include "XmlSerializerImpl.h"
+#include <Text/StringUtil.h>
+#include <string>
 
 namespace E
 {
@@ -44,6 +46,20 @@ XmlSerializer::Impl constants
 
 const char*  XmlSerializer::Impl::kValueTag = "value";
 
+/*----------------------------------------------------------------------------------------------------------------------
+XmlSerializer::Impl auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline U8 XmlSerializerImplGetHexValue(char c)
+{
+  return static_cast<U8>((c <= '9') ? c - '0' : c - 'a' + 10);
+}
+
+inline bool XmlSerializerImplIsWhiteSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 XmlSerializer::Impl initialization & finalization
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -59,6 +75,11 @@ XmlSerializer::Impl operators
     
 ISerializer& XmlSerializer::Impl::operator<<(bool v)
 {
+  if (mStreamWriter.IsOpen())
+  {
+    mStreamWriter.WriteValue(v);
+    return *this;
+  }
   pugi::xml_attribute attribute = mCurrentNode.append_attribute(kValueTag);
   attribute.set_value(v);
   return *this;
@@ -87,42 +108,47 @@ ISerializer& XmlSerializer::Impl::operator<<(U16 v)
     
 ISerializer& XmlSerializer::Impl::operator<<(I32 v)
 {
-  pugi::xml_attribute attribute = mCurrentNode.append_attribute(kValueTag);
-  attribute.set_value(v);
+  WriteValue(static_cast<I64>(v));
   return *this;
 }
     
 ISerializer& XmlSerializer::Impl::operator<<(U32 v)
 {
-  pugi::xml_attribute attribute = mCurrentNode.append_attribute(kValueTag);
-  attribute.set_value(v);
+  WriteValue(static_cast<U64>(v));
   return *this;
 }
     
 ISerializer& XmlSerializer::Impl::operator<<(I64 v)
 {
-  return operator<<(static_cast<I32>(v));
+  WriteValue(v);
+  return *this;
 }
     
 ISerializer& XmlSerializer::Impl::operator<<(U64 v)
 {
-  return operator<<(static_cast<U32>(v));
+  WriteValue(v);
+  return *this;
 }
     
 ISerializer& XmlSerializer::Impl::operator<<(F32 v)
 {
-  return operator<<(static_cast<D64>(v));
+  WriteValue(v);
+  return *this;
 }
     
 ISerializer& XmlSerializer::Impl::operator<<(D64 v)
 {
-  pugi::xml_attribute attribute = mCurrentNode.append_attribute(kValueTag);
-  attribute.set_value(v);
+  WriteValue(v);
   return *this;
 }
     
 ISerializer& XmlSerializer::Impl::operator<<(const StringBuffer& v)
 {
+  if (mStreamWriter.IsOpen())
+  {
+    mStreamWriter.WriteValue(v.GetPtr(), v.GetLength());
+    return *this;
+  }
   return operator<<(v.GetPtr());
 }
 
@@ -133,6 +159,11 @@ ISerializer& XmlSerializer::Impl::operator<<(const String& v)
     
 ISerializer& XmlSerializer::Impl::operator<<(const char* pStr)
 {
+  if (mStreamWriter.IsOpen())
+  {
+    mStreamWriter.WriteValue(pStr, Text::GetLength(pStr));
+    return *this;
+  }
   pugi::xml_attribute attribute = mCurrentNode.append_attribute(kValueTag);
   attribute.set_value(pStr);
   return *this;
@@ -140,88 +171,223 @@ ISerializer& XmlSerializer::Impl::operator<<(const char* pStr)
     
 void XmlSerializer::Impl::operator>>(bool& v)
 {
+  if (mStreamReader.IsOpen())
+  {
+    mStreamReader.ReadValue(v);
+    return;
+  }
   pugi::xml_attribute attribute = mCurrentNode.attribute(kValueTag);
   v = attribute.as_bool();
 }
     
 void XmlSerializer::Impl::operator>>(I8& v)
 {
-  pugi::xml_attribute attribute = mCurrentNode.attribute(kValueTag);
-  v = static_cast<I8>(attribute.as_int());
+  I32 value;
+  operator>>(value);
+  v = static_cast<I8>(value);
 }
     
 void XmlSerializer::Impl::operator>>(U8& v)
 {
-  pugi::xml_attribute attribute = mCurrentNode.attribute(kValueTag);
-  v = static_cast<U8>(attribute.as_uint());
+  U32 value;
+  operator>>(value);
+  v = static_cast<U8>(value);
 }
 
 void XmlSerializer::Impl::operator>>(I16& v)
 {
-  pugi::xml_attribute attribute = mCurrentNode.attribute(kValueTag);
-  v = static_cast<I16>(attribute.as_int());
+  I32 value;
+  operator>>(value);
+  v = static_cast<I16>(value);
 }
     
 void XmlSerializer::Impl::operator>>(U16& v)
 {
-  pugi::xml_attribute attribute = mCurrentNode.attribute(kValueTag);
-  v = static_cast<U16>(attribute.as_uint());
+  U32 value;
+  operator>>(value);
+  v = static_cast<U16>(value);
 }
     
 void XmlSerializer::Impl::operator>>(I32& v)
 {
-  pugi::xml_attribute attribute = mCurrentNode.attribute(kValueTag);
-  v = attribute.as_int();
+  I64 value;
+  ReadValue(value);
+  v = static_cast<I32>(value);
 }
     
 void XmlSerializer::Impl::operator>>(U32& v)
 {
-  pugi::xml_attribute attribute = mCurrentNode.attribute(kValueTag);
-  v = attribute.as_uint();
+  U64 value;
+  ReadValue(value);
+  v = static_cast<U32>(value);
 }
     
 void XmlSerializer::Impl::operator>>(I64& v)
 {
-  pugi::xml_attribute attribute = mCurrentNode.attribute(kValueTag);
-  v = attribute.as_int();
+  ReadValue(v);
 }
     
 void XmlSerializer::Impl::operator>>(U64& v)
 {
-  pugi::xml_attribute attribute = mCurrentNode.attribute(kValueTag);
-  v = attribute.as_uint();
+  ReadValue(v);
 }
     
 void XmlSerializer::Impl::operator>>(F32& v)
 {
-  pugi::xml_attribute attribute = mCurrentNode.attribute(kValueTag);
-  v = attribute.as_float();
+  ReadValue(v);
 }
     
 void XmlSerializer::Impl::operator>>(D64& v)
 {
-  pugi::xml_attribute attribute = mCurrentNode.attribute(kValueTag);
-  v = attribute.as_double();
+  ReadValue(v);
 }
     
 void XmlSerializer::Impl::operator>>(StringBuffer& v)
 {
+  if (mStreamReader.IsOpen())
+  {
+    mStreamReader.ReadValue(v);
+    return;
+  }
   pugi::xml_attribute attribute = mCurrentNode.attribute(kValueTag);
   v = attribute.as_string();
 }
 
 void XmlSerializer::Impl::operator>>(String& v)
 {
+  if (mStreamReader.IsOpen())
+  {
+    StringBuffer value;
+    mStreamReader.ReadValue(value);
+    v = value.GetPtr();
+    return;
+  }
   pugi::xml_attribute attribute = mCurrentNode.attribute(kValueTag);
   v = attribute.as_string();
 }
 
+/*----------------------------------------------------------------------------------------------------------------------
+XmlSerializer::Impl serialization
+----------------------------------------------------------------------------------------------------------------------*/
+
+void XmlSerializer::Impl::Read(U16* pData, size_t count)
+{
+  if (mStreamReader.IsOpen()) mStreamReader.ReadValues(pData, count);
+  else ReadValues<U64>(pData, count);
+}
+
+void XmlSerializer::Impl::Read(U32* pData, size_t count)
+{
+  if (mStreamReader.IsOpen()) mStreamReader.ReadValues(pData, count);
+  else ReadValues<U64>(pData, count);
+}
+
+void XmlSerializer::Impl::Read(U64* pData, size_t count)
+{
+  if (mStreamReader.IsOpen()) mStreamReader.ReadValues(pData, count);
+  else ReadValues<U64>(pData, count);
+}
+
+void XmlSerializer::Impl::Read(F32* pData, size_t count)
+{
+  if (mStreamReader.IsOpen()) mStreamReader.ReadValues(pData, count);
+  else ReadValues<F32>(pData, count);
+}
+
+void XmlSerializer::Impl::Read(D64* pData, size_t count)
+{
+  if (mStreamReader.IsOpen()) mStreamReader.ReadValues(pData, count);
+  else ReadValues<D64>(pData, count);
+}
+
+void XmlSerializer::Impl::ReadBlock(void* pData, size_t size)
+{
+  if (mStreamReader.IsOpen())
+  {
+    mStreamReader.ReadBlock(pData, size);
+    return;
+  }
+  pugi::xml_attribute attribute = mCurrentNode.attribute(kValueTag);
+  const char* pHex = attribute.as_string();
+  Byte* pBytes = static_cast<Byte*>(pData);
+  for (size_t i = 0; i < size && pHex[0] && pHex[1]; ++i, pHex += 2)
+  {
+    pBytes[i] = static_cast<Byte>((XmlSerializerImplGetHexValue(pHex[0]) << 4) | XmlSerializerImplGetHexValue(pHex[1]));
+  }
+}
+
+void XmlSerializer::Impl::Write(const U16* pData, size_t count)
+{
+  if (mStreamWriter.IsOpen()) mStreamWriter.WriteValues(pData, count);
+  else WriteValues<U64>(pData, count);
+}
+
+void XmlSerializer::Impl::Write(const U32* pData, size_t count)
+{
+  if (mStreamWriter.IsOpen()) mStreamWriter.WriteValues(pData, count);
+  else WriteValues<U64>(pData, count);
+}
+
+void XmlSerializer::Impl::Write(const U64* pData, size_t count)
+{
+  if (mStreamWriter.IsOpen()) mStreamWriter.WriteValues(pData, count);
+  else WriteValues<U64>(pData, count);
+}
+
+void XmlSerializer::Impl::Write(const F32* pData, size_t count)
+{
+  if (mStreamWriter.IsOpen()) mStreamWriter.WriteValues(pData, count);
+  else WriteValues<F32>(pData, count);
+}
+
+void XmlSerializer::Impl::Write(const D64* pData, size_t count)
+{
+  if (mStreamWriter.IsOpen()) mStreamWriter.WriteValues(pData, count);
+  else WriteValues<D64>(pData, count);
+}
+
+void XmlSerializer::Impl::WriteBlock(const void* pData, size_t size)
+{
+  if (mStreamWriter.IsOpen())
+  {
+    mStreamWriter.WriteBlock(pData, size);
+    return;
+  }
+  static const char kHexDigits[] = "0123456789abcdef";
+  std::string hex(size * 2, '0');
+  const Byte* pBytes = static_cast<const Byte*>(pData);
+  for (size_t i = 0; i < size; ++i)
+  {
+    hex[i * 2] = kHexDigits[pBytes[i] >> 4];
+    hex[i * 2 + 1] = kHexDigits[pBytes[i] & 0xf];
+  }
+  pugi::xml_attribute attribute = mCurrentNode.append_attribute(kValueTag);
+  attribute.set_value(hex.c_str());
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 XmlSerializer::Impl methods
 ----------------------------------------------------------------------------------------------------------------------*/
 
+void XmlSerializer::Impl::BeginStream(FileSystem::Archive& archive, StreamMode streamMode)
+{
+  E_ASSERT(!mStreamReader.IsOpen() && !mStreamWriter.IsOpen());
+  if (streamMode == eStreamModeRead) mStreamReader.Begin(archive);
+  else mStreamWriter.Begin(archive);
+}
+
 void XmlSerializer::Impl::BeginTag(const StringBuffer& name)
 {
+  if (mStreamReader.IsOpen())
+  {
+    mStreamReader.BeginTag(name);
+    return;
+  }
+  if (mStreamWriter.IsOpen())
+  {
+    mStreamWriter.BeginTag(name);
+    return;
+  }
   pugi::xml_node childNode = mCurrentNode.child(name.GetPtr());
   if (childNode == nullptr)
     childNode  = mCurrentNode.append_child(name.GetPtr());
@@ -235,14 +401,106 @@ void XmlSerializer::Impl::Clear()
   mCurrentNode = mDocument;
 }
 
+void XmlSerializer::Impl::EndStream()
+{
+  if (mStreamReader.IsOpen()) mStreamReader.End();
+  if (mStreamWriter.IsOpen()) mStreamWriter.End();
+}
+
 void XmlSerializer::Impl::EndTag()
 {
+  if (mStreamReader.IsOpen())
+  {
+    mStreamReader.EndTag();
+    return;
+  }
+  if (mStreamWriter.IsOpen())
+  {
+    mStreamWriter.EndTag();
+    return;
+  }
   mCurrentNode  = mCurrentNode.parent();
 }
 
+bool XmlSerializer::Impl::Load(const StringBuffer& fileName)
+{
+  Clear();
+  return mDocument.load_file(fileName.GetPtr());
+}
+
 void XmlSerializer::Impl::Save(const StringBuffer& fileName)
 {
   mDocument.save_file(fileName.GetPtr());
 }
+
+/*----------------------------------------------------------------------------------------------------------------------
+XmlSerializer::Impl private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+void XmlSerializer::Impl::ReadValue(T& v)
+{
+  if (mStreamReader.IsOpen())
+  {
+    mStreamReader.ReadValue(v);
+    return;
+  }
+  pugi::xml_attribute attribute = mCurrentNode.attribute(kValueTag);
+  const char* pStr = attribute.as_string();
+  if (Text::ParseNumber(v, pStr, Text::GetLength(pStr)) == 0) v = 0;
+}
+
+template <typename NumberType, typename T>
+void XmlSerializer::Impl::ReadValues(T* pData, size_t count)
+{
+  // Same parsing as XmlStreamReader (elements that can not be parsed and the ones after them are zeroed)
+  pugi::xml_attribute attribute = mCurrentNode.attribute(kValueTag);
+  const char* pStr = attribute.as_string();
+  size_t i = 0;
+  for (; i < count; ++i)
+  {
+    while (XmlSerializerImplIsWhiteSpace(*pStr)) ++pStr;
+    const char* pEnd = pStr;
+    while (*pEnd && !XmlSerializerImplIsWhiteSpace(*pEnd)) ++pEnd;
+    NumberType v;
+    if (pEnd == pStr || Text::ParseNumber(v, pStr, pEnd - pStr) == 0) break;
+    pData[i] = static_cast<T>(v);
+    pStr = pEnd;
+  }
+  for (; i < count; ++i) pData[i] = 0;
+}
+
+template <typename T>
+void XmlSerializer::Impl::WriteValue(T v)
+{
+  if (mStreamWriter.IsOpen())
+  {
+    mStreamWriter.WriteValue(v);
+    return;
+  }
+  // Numbers are formatted by Text::FormatNumber (pugixml truncates 64 bit integers and formats doubles with %g)
+  char str[Text::kMaxNumberLength + 1];
+  str[Text::FormatNumber(str, v)] = 0;
+  pugi::xml_attribute attribute = mCurrentNode.append_attribute(kValueTag);
+  attribute.set_value(str);
+}
+
+template <typename NumberType, typename T>
+void XmlSerializer::Impl::WriteValues(const T* pData, size_t count)
+{
+  if (count == 0) return;
+
+  // Same formatting as XmlStreamWriter (Text::FormatNumber values separated by spaces)
+  std::string str;
+  str.reserve(count * 8);
+  char number[Text::kMaxNumberLength];
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (i) str += ' ';
+    str.append(number, Text::FormatNumber(number, static_cast<NumberType>(pData[i])));
+  }
+  pugi::xml_attribute attribute = mCurrentNode.append_attribute(kValueTag);
+  attribute.set_value(str.c_str());
+}
 }
 }
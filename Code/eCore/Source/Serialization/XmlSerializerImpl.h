@@ -34,6 +34,7 @@ This class uses the third party library pugixml (http://pugixml.org/)
 #ifndef E3_XML_SERIALIZER_IMPL_H
 #define E3_XML_SERIALIZER_IMPL_H
 
+#include "XmlStream.h"
 #include <pugixml/pugixml.hpp>
 
 namespace E
@@ -78,16 +79,44 @@ public:
   void                operator>>(StringBuffer& v);
   void                operator>>(String& v);
 
+  // Serialization
+  void                Read(U16* pData, size_t count);
+  void                Read(U32* pData, size_t count);
+  void                Read(U64* pData, size_t count);
+  void                Read(F32* pData, size_t count);
+  void                Read(D64* pData, size_t count);
+  void                ReadBlock(void* pData, size_t size);
+  void                Write(const U16* pData, size_t count);
+  void                Write(const U32* pData, size_t count);
+  void                Write(const U64* pData, size_t count);
+  void                Write(const F32* pData, size_t count);
+  void                Write(const D64* pData, size_t count);
+  void                WriteBlock(const void* pData, size_t size);
+
   // Methods
+  void                BeginStream(FileSystem::Archive& archive, StreamMode streamMode);
   void                BeginTag(const StringBuffer& name);
   void                Clear();
+  void                EndStream();
   void                EndTag();
+  bool                Load(const StringBuffer& fileName);
   void                Save(const StringBuffer& fileName);
 
 private:
   static const char*  kValueTag;
   pugi::xml_document  mDocument;
   pugi::xml_node      mCurrentNode;
+  XmlStreamReader     mStreamReader;
+  XmlStreamWriter     mStreamWriter;
+
+  template <typename T>
+  void                ReadValue(T& v);
+  template <typename NumberType, typename T>
+  void                ReadValues(T* pData, size_t count);
+  template <typename T>
+  void                WriteValue(T v);
+  template <typename NumberType, typename T>
+  void                WriteValues(const T* pData, size_t count);
 
   E_DISABLE_COPY_AND_ASSSIGNMENT(Impl)
 };
@@ -0,0 +1,857 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file XmlStream.cpp
+This file defines the XmlStreamWriter and XmlStreamReader classes.
+*/
+
+#include <CorePch.h>
+#include "XmlStream.h"
+#include <Text/StringUtil.h>
+#include <cstring>
+
+namespace E
+{
+namespace Serialization
+{
+/*----------------------------------------------------------------------------------------------------------------------
+XmlStream auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+
+static const char kXmlStreamHexDigits[] = "0123456789abcdef";
+
+inline bool XmlStreamIsWhiteSpace(int c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+inline bool XmlStreamIsNameEnd(int c)
+{
+  return c == -1 || c == '=' || c == '/' || c == '>' || XmlStreamIsWhiteSpace(c);
+}
+
+inline int XmlStreamGetHexValue(int c)
+{
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+void XmlStreamAppendUtf8(StringBuffer& v, U32 codePoint)
+{
+  char utf8[4];
+  size_t length = 0;
+  if (codePoint < 0x80)
+  {
+    utf8[length++] = static_cast<char>(codePoint);
+  }
+  else if (codePoint < 0x800)
+  {
+    utf8[length++] = static_cast<char>(0xc0 | (codePoint >> 6));
+    utf8[length++] = static_cast<char>(0x80 | (codePoint & 0x3f));
+  }
+  else if (codePoint < 0x10000)
+  {
+    utf8[length++] = static_cast<char>(0xe0 | (codePoint >> 12));
+    utf8[length++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+    utf8[length++] = static_cast<char>(0x80 | (codePoint & 0x3f));
+  }
+  else
+  {
+    utf8[length++] = static_cast<char>(0xf0 | ((codePoint >> 18) & 0x07));
+    utf8[length++] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f));
+    utf8[length++] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+    utf8[length++] = static_cast<char>(0x80 | (codePoint & 0x3f));
+  }
+  v.Append(utf8, length);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+XmlStreamWriter initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+XmlStreamWriter::XmlStreamWriter()
+  : mpArchive(nullptr)
+  , mBufferLength(0)
+  , mIsStartTagOpen(false)
+{
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+XmlStreamWriter accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool XmlStreamWriter::IsOpen() const
+{
+  return mpArchive != nullptr;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+XmlStreamWriter methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void XmlStreamWriter::Begin(FileSystem::Archive& archive)
+{
+  static const char kDeclaration[] = "<?xml version=\"1.0\"?>\n";
+
+  E_ASSERT(archive.IsOpen());
+  // The buffer is only allocated once the serializer is used in streaming mode
+  if (mBuffer.GetSize() < kBufferSize) mBuffer.Resize(kBufferSize);
+  mpArchive = &archive;
+  mBufferLength = 0;
+  mTagNameList.Clear();
+  mTagNameOffsetList.Clear();
+  mIsStartTagOpen = false;
+  Put(kDeclaration, sizeof(kDeclaration) - 1);
+}
+
+void XmlStreamWriter::BeginTag(const StringBuffer& name)
+{
+  if (mIsStartTagOpen) Put(">\n", 2);
+  PutIndent();
+  Put('<');
+  Put(name.GetPtr(), name.GetLength());
+  mTagNameOffsetList.PushBack(mTagNameList.GetCount());
+  mTagNameList.PushBack(name.GetPtr(), name.GetLength());
+  mIsStartTagOpen = true;
+}
+
+void XmlStreamWriter::End()
+{
+  while (!mTagNameOffsetList.IsEmpty()) EndTag();
+  Flush();
+  mpArchive = nullptr;
+}
+
+void XmlStreamWriter::EndTag()
+{
+  E_ASSERT_MSG(!mTagNameOffsetList.IsEmpty(), E_ASSERT_MSG_XML_STREAM_END_TAG);
+  const size_t offset = *mTagNameOffsetList.GetBack();
+  mTagNameOffsetList.PopBack();
+  if (mIsStartTagOpen)
+  {
+    Put(" />\n", 4);
+    mIsStartTagOpen = false;
+  }
+  else
+  {
+    PutIndent();
+    Put("</", 2);
+    Put(mTagNameList.GetPtr() + offset, mTagNameList.GetCount() - offset);
+    Put(">\n", 2);
+  }
+  mTagNameList.SetCount(offset);
+}
+
+void XmlStreamWriter::WriteBlock(const void* pData, size_t size)
+{
+  if (size == 0) return;
+
+  BeginValue();
+  const Byte* pBytes = static_cast<const Byte*>(pData);
+  for (size_t i = 0; i < size; ++i)
+  {
+    if (kBufferSize - mBufferLength < 2) Flush();
+    mBuffer[mBufferLength++] = kXmlStreamHexDigits[pBytes[i] >> 4];
+    mBuffer[mBufferLength++] = kXmlStreamHexDigits[pBytes[i] & 0xf];
+  }
+  EndValue();
+}
+
+void XmlStreamWriter::WriteValue(bool v)
+{
+  BeginValue();
+  if (v) Put("true", 4);
+  else Put("false", 5);
+  EndValue();
+}
+
+void XmlStreamWriter::WriteValue(I64 v)
+{
+  BeginValue();
+  PutNumber(v);
+  EndValue();
+}
+
+void XmlStreamWriter::WriteValue(U64 v)
+{
+  BeginValue();
+  PutNumber(v);
+  EndValue();
+}
+
+void XmlStreamWriter::WriteValue(F32 v)
+{
+  BeginValue();
+  PutNumber(v);
+  EndValue();
+}
+
+void XmlStreamWriter::WriteValue(D64 v)
+{
+  BeginValue();
+  PutNumber(v);
+  EndValue();
+}
+
+void XmlStreamWriter::WriteValue(const char* pStr, size_t length)
+{
+  BeginValue();
+  PutEscaped(pStr, length);
+  EndValue();
+}
+
+void XmlStreamWriter::WriteValues(const U16* pData, size_t count)
+{
+  PutNumbers<U64>(pData, count);
+}
+
+void XmlStreamWriter::WriteValues(const U32* pData, size_t count)
+{
+  PutNumbers<U64>(pData, count);
+}
+
+void XmlStreamWriter::WriteValues(const U64* pData, size_t count)
+{
+  PutNumbers<U64>(pData, count);
+}
+
+void XmlStreamWriter::WriteValues(const F32* pData, size_t count)
+{
+  PutNumbers<F32>(pData, count);
+}
+
+void XmlStreamWriter::WriteValues(const D64* pData, size_t count)
+{
+  PutNumbers<D64>(pData, count);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+XmlStreamWriter private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void XmlStreamWriter::BeginValue()
+{
+  E_ASSERT_MSG(mIsStartTagOpen, E_ASSERT_MSG_XML_STREAM_VALUE);
+  Put(" value=\"", 8);
+}
+
+void XmlStreamWriter::EndValue()
+{
+  Put('"');
+}
+
+void XmlStreamWriter::Flush()
+{
+  if (mBufferLength) mpArchive->Write(mBuffer.GetPtr(), mBufferLength);
+  mBufferLength = 0;
+}
+
+inline void XmlStreamWriter::Put(char c)
+{
+  if (mBufferLength == kBufferSize) Flush();
+  mBuffer[mBufferLength++] = c;
+}
+
+void XmlStreamWriter::Put(const char* pStr, size_t length)
+{
+  while (length)
+  {
+    if (mBufferLength == kBufferSize) Flush();
+    const size_t copyLength = Math::Min(length, kBufferSize - mBufferLength);
+    Memory::Copy(mBuffer.GetPtr() + mBufferLength, pStr, copyLength);
+    mBufferLength += copyLength;
+    pStr += copyLength;
+    length -= copyLength;
+  }
+}
+
+void XmlStreamWriter::PutEscaped(const char* pStr, size_t length)
+{
+  // Same escaping as pugixml attributes (control characters are written as two digit character references), except for
+  // tabs which pugixml writes as they are (and thus reads back as spaces)
+  size_t spanStart = 0;
+  for (size_t i = 0; i < length; ++i)
+  {
+    const U8 c = static_cast<U8>(pStr[i]);
+    if (c >= 32 && c != '&' && c != '<' && c != '>' && c != '"') continue;
+
+    Put(pStr + spanStart, i - spanStart);
+    spanStart = i + 1;
+    switch (c)
+    {
+    case '&': Put("&amp;", 5); break;
+    case '<': Put("&lt;", 4); break;
+    case '>': Put("&gt;", 4); break;
+    case '"': Put("&quot;", 6); break;
+    default:
+      Put("&#", 2);
+      Put(static_cast<char>('0' + c / 10));
+      Put(static_cast<char>('0' + c % 10));
+      Put(';');
+      break;
+    }
+  }
+  Put(pStr + spanStart, length - spanStart);
+}
+
+void XmlStreamWriter::PutIndent()
+{
+  for (size_t i = 0; i < mTagNameOffsetList.GetCount(); ++i) Put('\t');
+}
+
+template <typename T>
+inline void XmlStreamWriter::PutNumber(T v)
+{
+  if (kBufferSize - mBufferLength < Text::kMaxNumberLength) Flush();
+  mBufferLength += Text::FormatNumber(mBuffer.GetPtr() + mBufferLength, v);
+}
+
+template <typename NumberType, typename T>
+void XmlStreamWriter::PutNumbers(const T* pData, size_t count)
+{
+  if (count == 0) return;
+
+  BeginValue();
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (i) Put(' ');
+    PutNumber(static_cast<NumberType>(pData[i]));
+  }
+  EndValue();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+XmlStreamReader initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+XmlStreamReader::XmlStreamReader()
+  : mpArchive(nullptr)
+  , mBufferPosition(0)
+  , mBufferLength(0)
+  , mState(eStateContent)
+  , mDepth(0)
+  , mMissingDepth(0)
+  , mQuote('"')
+  , mIsEmptyTag(false)
+  , mIsEndTagPending(false)
+{
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+XmlStreamReader accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool XmlStreamReader::IsOpen() const
+{
+  return mpArchive != nullptr;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+XmlStreamReader methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void XmlStreamReader::Begin(FileSystem::Archive& archive)
+{
+  E_ASSERT(archive.IsOpen());
+  // The buffer is only allocated once the serializer is used in streaming mode
+  if (mBuffer.GetSize() < kBufferSize) mBuffer.Resize(kBufferSize);
+  mpArchive = &archive;
+  mBufferPosition = 0;
+  mBufferLength = 0;
+  mState = eStateContent;
+  mDepth = 0;
+  mMissingDepth = 0;
+  mIsEmptyTag = false;
+  mIsEndTagPending = false;
+}
+
+void XmlStreamReader::BeginTag(const StringBuffer& name)
+{
+  if (mMissingDepth)
+  {
+    ++mMissingDepth;
+    return;
+  }
+  FinishStartTag();
+  if (mIsEmptyTag || mIsEndTagPending)
+  {
+    mMissingDepth = 1;
+    return;
+  }
+
+  for (;;)
+  {
+    SkipUntil('<');
+    const int c = Peek();
+    if (c == -1)
+    {
+      mMissingDepth = 1;
+      return;
+    }
+    if (c == '/')
+    {
+      // End of the current tag: the requested tag is missing
+      Get();
+      mIsEndTagPending = true;
+      mMissingDepth = 1;
+      return;
+    }
+    if (c == '?' || c == '!')
+    {
+      SkipMarkup();
+      continue;
+    }
+    const bool isMatch = MatchName(name.GetPtr());
+    SkipName();
+    mState = eStateAttributes;
+    if (isMatch)
+    {
+      ++mDepth;
+      return;
+    }
+    // Skip the sibling tag along with its content
+    FinishStartTag();
+    if (!mIsEmptyTag) SkipContent();
+    mIsEmptyTag = false;
+  }
+}
+
+void XmlStreamReader::End()
+{
+  mpArchive = nullptr;
+}
+
+void XmlStreamReader::EndTag()
+{
+  if (mMissingDepth)
+  {
+    --mMissingDepth;
+    return;
+  }
+  E_ASSERT_MSG(mDepth > 0, E_ASSERT_MSG_XML_STREAM_END_TAG);
+  FinishStartTag();
+  if (!mIsEmptyTag) SkipContent();
+  mIsEmptyTag = false;
+  mIsEndTagPending = false;
+  --mDepth;
+}
+
+void XmlStreamReader::ReadBlock(void* pData, size_t size)
+{
+  Byte* pBytes = static_cast<Byte*>(pData);
+  size_t i = 0;
+  if (size && BeginValue())
+  {
+    for (; i < size; ++i)
+    {
+      const int high = XmlStreamGetHexValue(Peek());
+      if (high < 0) break;
+      Get();
+      const int low = XmlStreamGetHexValue(Peek());
+      if (low < 0) break;
+      Get();
+      pBytes[i] = static_cast<Byte>((high << 4) | low);
+    }
+    EndValue();
+  }
+  for (; i < size; ++i) pBytes[i] = 0;
+}
+
+void XmlStreamReader::ReadValue(bool& v)
+{
+  v = false;
+  if (!BeginValue()) return;
+
+  // Same rule as pugixml (values starting with 1, t, T, y or Y are true)
+  const int c = Peek();
+  v = (c == '1' || c == 't' || c == 'T' || c == 'y' || c == 'Y');
+  EndValue();
+}
+
+void XmlStreamReader::ReadValue(I64& v)
+{
+  ReadNumber(v);
+}
+
+void XmlStreamReader::ReadValue(U64& v)
+{
+  ReadNumber(v);
+}
+
+void XmlStreamReader::ReadValue(F32& v)
+{
+  ReadNumber(v);
+}
+
+void XmlStreamReader::ReadValue(D64& v)
+{
+  ReadNumber(v);
+}
+
+void XmlStreamReader::ReadValue(StringBuffer& v)
+{
+  v.Clear();
+  if (!BeginValue()) return;
+
+  for (;;)
+  {
+    if (mBufferPosition == mBufferLength && !Refill()) break;
+
+    // Append the plain character span straight from the read buffer
+    const char* pSpan = mBuffer.GetPtr() + mBufferPosition;
+    const char* pSpanEnd = mBuffer.GetPtr() + mBufferLength;
+    const char* pCurrent = pSpan;
+    while (pCurrent < pSpanEnd && *pCurrent != mQuote && *pCurrent != '&' && !XmlStreamIsWhiteSpace(*pCurrent)) ++pCurrent;
+    if (pCurrent != pSpan) v.Append(pSpan, pCurrent - pSpan);
+    mBufferPosition += pCurrent - pSpan;
+    if (pCurrent == pSpanEnd) continue;
+
+    // White space is normalized as pugixml does (tabs and line breaks become spaces)
+    const int c = Get();
+    if (c == mQuote) break;
+    if (c == '&') ReadEntity(v);
+    else v << ' ';
+  }
+  mState = eStateAttributes;
+}
+
+void XmlStreamReader::ReadValues(U16* pData, size_t count)
+{
+  ReadNumbers<U64>(pData, count);
+}
+
+void XmlStreamReader::ReadValues(U32* pData, size_t count)
+{
+  ReadNumbers<U64>(pData, count);
+}
+
+void XmlStreamReader::ReadValues(U64* pData, size_t count)
+{
+  ReadNumbers<U64>(pData, count);
+}
+
+void XmlStreamReader::ReadValues(F32* pData, size_t count)
+{
+  ReadNumbers<F32>(pData, count);
+}
+
+void XmlStreamReader::ReadValues(D64* pData, size_t count)
+{
+  ReadNumbers<D64>(pData, count);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+XmlStreamReader private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool XmlStreamReader::BeginValue()
+{
+  if (mMissingDepth) return false;
+  if (mState == eStateValue) EndValue();
+  if (mState != eStateAttributes) return false;
+
+  // Look for the next value attribute, skipping any other attribute
+  for (;;)
+  {
+    SkipWhiteSpace();
+    int c = Peek();
+    if (c == '/' || c == '>' || c == -1) return false;
+
+    const bool isValue = MatchName("value");
+    SkipName();
+    SkipWhiteSpace();
+    c = Get();
+    if (c == '=')
+    {
+      SkipWhiteSpace();
+      c = Get();
+    }
+    if (c != '"' && c != '\'')
+    {
+      E_ASSERT_MSG(false, E_ASSERT_MSG_XML_STREAM_SYNTAX);
+      return false;
+    }
+    if (isValue)
+    {
+      mQuote = static_cast<char>(c);
+      mState = eStateValue;
+      return true;
+    }
+    SkipUntil(static_cast<char>(c));
+  }
+}
+
+void XmlStreamReader::EndValue()
+{
+  SkipUntil(mQuote);
+  mState = eStateAttributes;
+}
+
+void XmlStreamReader::FinishStartTag()
+{
+  if (mState == eStateValue) EndValue();
+  if (mState != eStateAttributes) return;
+
+  for (int c = Get(); c != -1; c = Get())
+  {
+    if (c == '"' || c == '\'')
+    {
+      SkipUntil(static_cast<char>(c));
+    }
+    else if (c == '/' && Peek() == '>')
+    {
+      Get();
+      mIsEmptyTag = true;
+      break;
+    }
+    else if (c == '>')
+    {
+      break;
+    }
+  }
+  mState = eStateContent;
+}
+
+inline int XmlStreamReader::Get()
+{
+  if (mBufferPosition == mBufferLength && !Refill()) return -1;
+  return static_cast<U8>(mBuffer[mBufferPosition++]);
+}
+
+bool XmlStreamReader::MatchName(const char* pName)
+{
+  for (; *pName; ++pName)
+  {
+    if (Peek() != static_cast<U8>(*pName)) return false;
+    ++mBufferPosition;
+  }
+  return XmlStreamIsNameEnd(Peek());
+}
+
+inline int XmlStreamReader::Peek()
+{
+  if (mBufferPosition == mBufferLength && !Refill()) return -1;
+  return static_cast<U8>(mBuffer[mBufferPosition]);
+}
+
+void XmlStreamReader::ReadEntity(StringBuffer& v)
+{
+  // Read the entity name up to the semicolon (the value quote ends unterminated entities)
+  char name[kTokenSize];
+  size_t length = 0;
+  for (int c = Peek(); c != -1 && c != mQuote && c != ';' && length < kTokenSize; c = Peek())
+  {
+    name[length++] = static_cast<char>(c);
+    Get();
+  }
+  const bool isTerminated = (Peek() == ';');
+  if (isTerminated)
+  {
+    Get();
+    if (length > 1 && name[0] == '#')
+    {
+      const bool isHex = (name[1] == 'x');
+      U32 codePoint = 0;
+      size_t i = isHex ? 2 : 1;
+      for (; i < length; ++i)
+      {
+        const int digit = isHex ? XmlStreamGetHexValue(name[i]) : ((name[i] >= '0' && name[i] <= '9') ? name[i] - '0' : -1);
+        if (digit < 0 || codePoint > 0x10ffff) break;
+        codePoint = codePoint * (isHex ? 16 : 10) + digit;
+      }
+      if (i == length && codePoint <= 0x10ffff)
+      {
+        XmlStreamAppendUtf8(v, codePoint);
+        return;
+      }
+    }
+    else if (length == 3 && memcmp(name, "amp", 3) == 0) { v << '&'; return; }
+    else if (length == 2 && memcmp(name, "lt", 2) == 0) { v << '<'; return; }
+    else if (length == 2 && memcmp(name, "gt", 2) == 0) { v << '>'; return; }
+    else if (length == 4 && memcmp(name, "quot", 4) == 0) { v << '"'; return; }
+    else if (length == 4 && memcmp(name, "apos", 4) == 0) { v << '\''; return; }
+  }
+  // Unknown entities are kept as they are
+  v << '&';
+  v.Append(name, length);
+  if (isTerminated) v << ';';
+}
+
+size_t XmlStreamReader::ReadToken(char* pToken)
+{
+  size_t length = 0;
+  for (;;)
+  {
+    if (mBufferPosition == mBufferLength && !Refill()) break;
+    const char c = mBuffer[mBufferPosition];
+    if (c == mQuote || XmlStreamIsWhiteSpace(c)) break;
+    if (length < kTokenSize) pToken[length] = c;
+    ++length;
+    ++mBufferPosition;
+  }
+  // Tokens longer than any number are invalid
+  return length < kTokenSize ? length : 0;
+}
+
+bool XmlStreamReader::Refill()
+{
+  if (mpArchive == nullptr) return false;
+  mBufferPosition = 0;
+  mBufferLength = mpArchive->Read(mBuffer.GetPtr(), kBufferSize);
+  return mBufferLength > 0;
+}
+
+void XmlStreamReader::SkipContent()
+{
+  if (mIsEndTagPending)
+  {
+    SkipUntil('>');
+    mIsEndTagPending = false;
+    return;
+  }
+
+  // Skip up to the end tag matching the current tag
+  U32 depth = 0;
+  for (;;)
+  {
+    SkipUntil('<');
+    const int c = Peek();
+    if (c == -1) return;
+    if (c == '/')
+    {
+      SkipUntil('>');
+      if (depth == 0) return;
+      --depth;
+    }
+    else if (c == '?' || c == '!')
+    {
+      SkipMarkup();
+    }
+    else
+    {
+      SkipName();
+      mState = eStateAttributes;
+      FinishStartTag();
+      if (!mIsEmptyTag) ++depth;
+      mIsEmptyTag = false;
+    }
+  }
+}
+
+void XmlStreamReader::SkipMarkup()
+{
+  // Comments and CDATA sections end with "-->" and "]]>", other markup (declarations and processing instructions) with
+  // the first '>'
+  char delimiter = 0;
+  if (Get() == '!')
+  {
+    if (Peek() == '-')
+    {
+      delimiter = '-';
+      Get();
+      Get();
+    }
+    else if (Peek() == '[')
+    {
+      delimiter = ']';
+    }
+  }
+  if (delimiter == 0)
+  {
+    SkipUntil('>');
+    return;
+  }
+
+  U32 delimiterCount = 0;
+  for (int c = Get(); c != -1; c = Get())
+  {
+    if (c == '>' && delimiterCount >= 2) return;
+    delimiterCount = (c == delimiter) ? delimiterCount + 1 : 0;
+  }
+}
+
+void XmlStreamReader::SkipName()
+{
+  while (!XmlStreamIsNameEnd(Peek())) ++mBufferPosition;
+}
+
+void XmlStreamReader::SkipUntil(char c)
+{
+  for (;;)
+  {
+    if (mBufferPosition == mBufferLength && !Refill()) return;
+    const char* pFound = static_cast<const char*>(memchr(mBuffer.GetPtr() + mBufferPosition, c, mBufferLength - mBufferPosition));
+    if (pFound)
+    {
+      mBufferPosition = pFound - mBuffer.GetPtr() + 1;
+      return;
+    }
+    mBufferPosition = mBufferLength;
+  }
+}
+
+void XmlStreamReader::SkipWhiteSpace()
+{
+  while (XmlStreamIsWhiteSpace(Peek())) ++mBufferPosition;
+}
+
+template <typename T>
+void XmlStreamReader::ReadNumber(T& v)
+{
+  v = 0;
+  if (!BeginValue()) return;
+
+  char token[kTokenSize];
+  const size_t length = ReadToken(token);
+  if (length == 0 || Text::ParseNumber(v, token, length) == 0) v = 0;
+  EndValue();
+}
+
+template <typename NumberType, typename T>
+void XmlStreamReader::ReadNumbers(T* pData, size_t count)
+{
+  size_t i = 0;
+  if (count && BeginValue())
+  {
+    char token[kTokenSize];
+    for (; i < count; ++i)
+    {
+      SkipWhiteSpace();
+      const size_t length = ReadToken(token);
+      NumberType v;
+      if (length == 0 || Text::ParseNumber(v, token, length) == 0) break;
+      pData[i] = static_cast<T>(v);
+    }
+    EndValue();
+  }
+  for (; i < count; ++i) pData[i] = 0;
+}
+}
+}
@@ -0,0 +1,199 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file XmlStream.h
+This file declares the XmlStreamWriter and XmlStreamReader classes, which implement the XmlSerializer streaming mode.
+*/
+
+#ifndef E3_XML_STREAM_H
+#define E3_XML_STREAM_H
+
+#include <Containers/DynamicArray.h>
+#include <Containers/List.h>
+#include <FileSystem/Archive.h>
+#include <Text/CharList.h>
+
+/*----------------------------------------------------------------------------------------------------------------------
+XmlStream assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_XML_STREAM_VALUE   "Streamed values must be written right after their BeginTag"
+#define E_ASSERT_MSG_XML_STREAM_END_TAG "EndTag without a matching BeginTag"
+#define E_ASSERT_MSG_XML_STREAM_SYNTAX  "Malformed XML stream"
+
+namespace E
+{
+namespace Serialization
+{
+/*----------------------------------------------------------------------------------------------------------------------
+XmlStreamWriter
+
+Please note that this class has the following usage contract:
+
+1. The output follows the pugixml default save format (declaration, tab indentation and one tag per line) so streamed
+documents can be loaded by XmlSerializer::Load.
+2. Attribute values escape the characters &, <, >, " and the control characters. Numbers are formatted with
+Text::FormatNumber, and arrays and blocks are formatted straight into the buffer whatever their size.
+----------------------------------------------------------------------------------------------------------------------*/
+class XmlStreamWriter
+{
+public:
+  XmlStreamWriter();
+
+  // Accessors
+  bool                            IsOpen() const;
+
+  // Methods
+  void                            Begin(FileSystem::Archive& archive);
+  void                            BeginTag(const StringBuffer& name);
+  void                            End();
+  void                            EndTag();
+  void                            WriteBlock(const void* pData, size_t size);
+  void                            WriteValue(bool v);
+  void                            WriteValue(I64 v);
+  void                            WriteValue(U64 v);
+  void                            WriteValue(F32 v);
+  void                            WriteValue(D64 v);
+  void                            WriteValue(const char* pStr, size_t length);
+  void                            WriteValues(const U16* pData, size_t count);
+  void                            WriteValues(const U32* pData, size_t count);
+  void                            WriteValues(const U64* pData, size_t count);
+  void                            WriteValues(const F32* pData, size_t count);
+  void                            WriteValues(const D64* pData, size_t count);
+
+private:
+  static const size_t             kBufferSize = 65536;
+
+  FileSystem::Archive*            mpArchive;
+  Containers::DynamicArray<char>  mBuffer;
+  size_t                          mBufferLength;
+  Containers::List<char>          mTagNameList;       // Open tag names (concatenated)
+  Containers::List<size_t>        mTagNameOffsetList; // Open tag name offsets in mTagNameList
+  bool                            mIsStartTagOpen;
+
+  void                            BeginValue();
+  void                            EndValue();
+  void                            Flush();
+  void                            Put(char c);
+  void                            Put(const char* pStr, size_t length);
+  void                            PutEscaped(const char* pStr, size_t length);
+  void                            PutIndent();
+  template <typename T>
+  void                            PutNumber(T v);
+  template <typename NumberType, typename T>
+  void                            PutNumbers(const T* pData, size_t count);
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(XmlStreamWriter)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+XmlStreamReader
+
+Please note that this class has the following usage contract:
+
+1. XmlStreamReader is a pull parser: BeginTag scans forward for the requested child tag (skipping the sibling tags with
+other names along with their content) and EndTag skips whatever is left of the current tag. Only the current tag and
+value token are kept in memory, besides the read buffer.
+2. Each value read consumes the next "value" attribute of the current tag. Array values and blocks are parsed straight
+from the read buffer, so a value attribute may be larger than the buffer.
+3. The parser supports the XML subset written by XmlStreamWriter and pugixml: elements, attributes, text (which is
+ignored), comments, processing instructions, CDATA sections and the predefined and numeric character entities.
+----------------------------------------------------------------------------------------------------------------------*/
+class XmlStreamReader
+{
+public:
+  XmlStreamReader();
+
+  // Accessors
+  bool                            IsOpen() const;
+
+  // Methods
+  void                            Begin(FileSystem::Archive& archive);
+  void                            BeginTag(const StringBuffer& name);
+  void                            End();
+  void                            EndTag();
+  void                            ReadBlock(void* pData, size_t size);
+  void                            ReadValue(bool& v);
+  void                            ReadValue(I64& v);
+  void                            ReadValue(U64& v);
+  void                            ReadValue(F32& v);
+  void                            ReadValue(D64& v);
+  void                            ReadValue(StringBuffer& v);
+  void                            ReadValues(U16* pData, size_t count);
+  void                            ReadValues(U32* pData, size_t count);
+  void                            ReadValues(U64* pData, size_t count);
+  void                            ReadValues(F32* pData, size_t count);
+  void                            ReadValues(D64* pData, size_t count);
+
+private:
+  enum State
+  {
+    eStateContent,    // Parsing the current tag content (or the document)
+    eStateAttributes, // Parsing the current start tag attributes
+    eStateValue       // Parsing a value attribute (right after its opening quote or inside it)
+  };
+
+  static const size_t             kBufferSize = 65536;
+  static const size_t             kTokenSize = 64;
+
+  FileSystem::Archive*            mpArchive;
+  Containers::DynamicArray<char>  mBuffer;
+  size_t                          mBufferPosition;
+  size_t                          mBufferLength;
+  StringBuffer                    mValue;
+  State                           mState;
+  U32                             mDepth;
+  U32                             mMissingDepth;      // Nesting level inside a missing tag
+  char                            mQuote;             // Current value attribute quote character
+  bool                            mIsEmptyTag;        // Current tag has no content (<tag />)
+  bool                            mIsEndTagPending;   // "</" of the current tag end tag already consumed
+
+  bool                            BeginValue();
+  void                            EndValue();
+  void                            FinishStartTag();
+  int                             Get();
+  bool                            MatchName(const char* pName);
+  int                             Peek();
+  void                            ReadEntity(StringBuffer& v);
+  size_t                          ReadToken(char* pToken);
+  bool                            Refill();
+  void                            SkipContent();
+  void                            SkipMarkup();
+  void                            SkipName();
+  void                            SkipUntil(char c);
+  void                            SkipWhiteSpace();
+  template <typename T>
+  void                            ReadNumber(T& v);
+  template <typename NumberType, typename T>
+  void                            ReadNumbers(T* pData, size_t count);
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(XmlStreamReader)
+};
+}
+}
+
+#endif
@@ -0,0 +1,854 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file StringUtil.cpp
+This file defines the locale independent number formatting and parsing functions.
+Floating point formatting implements Grisu2 (Loitsch, "Printing Floating-Point Numbers Quickly and Accurately with
+Integers", 2010). Floating point parsing uses the Clinger fast path and a truncated 128 bit power of ten product (Lemire,
+"Number Parsing at a Gigabyte per Second", 2021), leaving the cases they cannot decide to a classic locale stream.
+*/
+
+#include <CorePch.h>
+#include <Text/StringUtil.h>
+#include <limits>
+#include <locale>
+#include <sstream>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+StringUtil auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+
+static const char kStringUtilDigitPairs[] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+// Grisu2 keeps the scaled binary exponent in [kAlpha, kGamma] so that digits can be generated with 32 bit integers
+static const I32 kStringUtilGrisuAlpha = -60;
+static const I32 kStringUtilGrisuGamma = -32;
+static const I32 kStringUtilCachedPowerMinExponent = -300;
+static const I32 kStringUtilCachedPowerExponentStep = 8;
+
+struct StringUtilCachedPower
+{
+  U64 f;
+  I32 e;
+  I32 k;
+};
+
+// Normalized 64 bit approximations (rounded to nearest) of 10^k = f * 2^e for k in [-300, 324] in steps of 8
+static const StringUtilCachedPower kStringUtilCachedPowers[] =
+{
+  { 0xAB70FE17C79AC6CA, -1060, -300 },
+  { 0xFF77B1FCBEBCDC4F, -1034, -292 },
+  { 0xBE5691EF416BD60C, -1007, -284 },
+  { 0x8DD01FAD907FFC3C,  -980, -276 },
+  { 0xD3515C2831559A83,  -954, -268 },
+  { 0x9D71AC8FADA6C9B5,  -927, -260 },
+  { 0xEA9C227723EE8BCB,  -901, -252 },
+  { 0xAECC49914078536D,  -874, -244 },
+  { 0x823C12795DB6CE57,  -847, -236 },
+  { 0xC21094364DFB5637,  -821, -228 },
+  { 0x9096EA6F3848984F,  -794, -220 },
+  { 0xD77485CB25823AC7,  -768, -212 },
+  { 0xA086CFCD97BF97F4,  -741, -204 },
+  { 0xEF340A98172AACE5,  -715, -196 },
+  { 0xB23867FB2A35B28E,  -688, -188 },
+  { 0x84C8D4DFD2C63F3B,  -661, -180 },
+  { 0xC5DD44271AD3CDBA,  -635, -172 },
+  { 0x936B9FCEBB25C996,  -608, -164 },
+  { 0xDBAC6C247D62A584,  -582, -156 },
+  { 0xA3AB66580D5FDAF6,  -555, -148 },
+  { 0xF3E2F893DEC3F126,  -529, -140 },
+  { 0xB5B5ADA8AAFF80B8,  -502, -132 },
+  { 0x87625F056C7C4A8B,  -475, -124 },
+  { 0xC9BCFF6034C13053,  -449, -116 },
+  { 0x964E858C91BA2655,  -422, -108 },
+  { 0xDFF9772470297EBD,  -396, -100 },
+  { 0xA6DFBD9FB8E5B88F,  -369,  -92 },
+  { 0xF8A95FCF88747D94,  -343,  -84 },
+  { 0xB94470938FA89BCF,  -316,  -76 },
+  { 0x8A08F0F8BF0F156B,  -289,  -68 },
+  { 0xCDB02555653131B6,  -263,  -60 },
+  { 0x993FE2C6D07B7FAC,  -236,  -52 },
+  { 0xE45C10C42A2B3B06,  -210,  -44 },
+  { 0xAA242499697392D3,  -183,  -36 },
+  { 0xFD87B5F28300CA0E,  -157,  -28 },
+  { 0xBCE5086492111AEB,  -130,  -20 },
+  { 0x8CBCCC096F5088CC,  -103,  -12 },
+  { 0xD1B71758E219652C,   -77,   -4 },
+  { 0x9C40000000000000,   -50,    4 },
+  { 0xE8D4A51000000000,   -24,   12 },
+  { 0xAD78EBC5AC620000,     3,   20 },
+  { 0x813F3978F8940984,    30,   28 },
+  { 0xC097CE7BC90715B3,    56,   36 },
+  { 0x8F7E32CE7BEA5C70,    83,   44 },
+  { 0xD5D238A4ABE98068,   109,   52 },
+  { 0x9F4F2726179A2245,   136,   60 },
+  { 0xED63A231D4C4FB27,   162,   68 },
+  { 0xB0DE65388CC8ADA8,   189,   76 },
+  { 0x83C7088E1AAB65DB,   216,   84 },
+  { 0xC45D1DF942711D9A,   242,   92 },
+  { 0x924D692CA61BE758,   269,  100 },
+  { 0xDA01EE641A708DEA,   295,  108 },
+  { 0xA26DA3999AEF774A,   322,  116 },
+  { 0xF209787BB47D6B85,   348,  124 },
+  { 0xB454E4A179DD1877,   375,  132 },
+  { 0x865B86925B9BC5C2,   402,  140 },
+  { 0xC83553C5C8965D3D,   428,  148 },
+  { 0x952AB45CFA97A0B3,   455,  156 },
+  { 0xDE469FBD99A05FE3,   481,  164 },
+  { 0xA59BC234DB398C25,   508,  172 },
+  { 0xF6C69A72A3989F5C,   534,  180 },
+  { 0xB7DCBF5354E9BECE,   561,  188 },
+  { 0x88FCF317F22241E2,   588,  196 },
+  { 0xCC20CE9BD35C78A5,   614,  204 },
+  { 0x98165AF37B2153DF,   641,  212 },
+  { 0xE2A0B5DC971F303A,   667,  220 },
+  { 0xA8D9D1535CE3B396,   694,  228 },
+  { 0xFB9B7CD9A4A7443C,   720,  236 },
+  { 0xBB764C4CA7A44410,   747,  244 },
+  { 0x8BAB8EEFB6409C1A,   774,  252 },
+  { 0xD01FEF10A657842C,   800,  260 },
+  { 0x9B10A4E5E9913129,   827,  268 },
+  { 0xE7109BFBA19C0C9D,   853,  276 },
+  { 0xAC2820D9623BF429,   880,  284 },
+  { 0x80444B5E7AA7CF85,   907,  292 },
+  { 0xBF21E44003ACDD2D,   933,  300 },
+  { 0x8E679C2F5E44FF8F,   960,  308 },
+  { 0xD433179D9C8CB841,   986,  316 },
+  { 0x9E19DB92B4E31BA9,  1013,  324 }
+};
+
+static const I32 kStringUtilPow10MinExponent = -64;
+static const I32 kStringUtilPow10MaxExponent = 64;
+
+// Normalized 128 bit truncations (high, low) of 10^q for q in [-64, 64]
+static const U64 kStringUtilPow10[][2] =
+{
+  { 0xA87FEA27A539E9A5, 0x3F2398D747B36224 }, // 1e-64
+  { 0xD29FE4B18E88640E, 0x8EEC7F0D19A03AAD }, // 1e-63
+  { 0x83A3EEEEF9153E89, 0x1953CF68300424AC }, // 1e-62
+  { 0xA48CEAAAB75A8E2B, 0x5FA8C3423C052DD7 }, // 1e-61
+  { 0xCDB02555653131B6, 0x3792F412CB06794D }, // 1e-60
+  { 0x808E17555F3EBF11, 0xE2BBD88BBEE40BD0 }, // 1e-59
+  { 0xA0B19D2AB70E6ED6, 0x5B6ACEAEAE9D0EC4 }, // 1e-58
+  { 0xC8DE047564D20A8B, 0xF245825A5A445275 }, // 1e-57
+  { 0xFB158592BE068D2E, 0xEED6E2F0F0D56712 }, // 1e-56
+  { 0x9CED737BB6C4183D, 0x55464DD69685606B }, // 1e-55
+  { 0xC428D05AA4751E4C, 0xAA97E14C3C26B886 }, // 1e-54
+  { 0xF53304714D9265DF, 0xD53DD99F4B3066A8 }, // 1e-53
+  { 0x993FE2C6D07B7FAB, 0xE546A8038EFE4029 }, // 1e-52
+  { 0xBF8FDB78849A5F96, 0xDE98520472BDD033 }, // 1e-51
+  { 0xEF73D256A5C0F77C, 0x963E66858F6D4440 }, // 1e-50
+  { 0x95A8637627989AAD, 0xDDE7001379A44AA8 }, // 1e-49
+  { 0xBB127C53B17EC159, 0x5560C018580D5D52 }, // 1e-48
+  { 0xE9D71B689DDE71AF, 0xAAB8F01E6E10B4A6 }, // 1e-47
+  { 0x9226712162AB070D, 0xCAB3961304CA70E8 }, // 1e-46
+  { 0xB6B00D69BB55C8D1, 0x3D607B97C5FD0D22 }, // 1e-45
+  { 0xE45C10C42A2B3B05, 0x8CB89A7DB77C506A }, // 1e-44
+  { 0x8EB98A7A9A5B04E3, 0x77F3608E92ADB242 }, // 1e-43
+  { 0xB267ED1940F1C61C, 0x55F038B237591ED3 }, // 1e-42
+  { 0xDF01E85F912E37A3, 0x6B6C46DEC52F6688 }, // 1e-41
+  { 0x8B61313BBABCE2C6, 0x2323AC4B3B3DA015 }, // 1e-40
+  { 0xAE397D8AA96C1B77, 0xABEC975E0A0D081A }, // 1e-39
+  { 0xD9C7DCED53C72255, 0x96E7BD358C904A21 }, // 1e-38
+  { 0x881CEA14545C7575, 0x7E50D64177DA2E54 }, // 1e-37
+  { 0xAA242499697392D2, 0xDDE50BD1D5D0B9E9 }, // 1e-36
+  { 0xD4AD2DBFC3D07787, 0x955E4EC64B44E864 }, // 1e-35
+  { 0x84EC3C97DA624AB4, 0xBD5AF13BEF0B113E }, // 1e-34
+  { 0xA6274BBDD0FADD61, 0xECB1AD8AEACDD58E }, // 1e-33
+  { 0xCFB11EAD453994BA, 0x67DE18EDA5814AF2 }, // 1e-32
+  { 0x81CEB32C4B43FCF4, 0x80EACF948770CED7 }, // 1e-31
+  { 0xA2425FF75E14FC31, 0xA1258379A94D028D }, // 1e-30
+  { 0xCAD2F7F5359A3B3E, 0x096EE45813A04330 }, // 1e-29
+  { 0xFD87B5F28300CA0D, 0x8BCA9D6E188853FC }, // 1e-28
+  { 0x9E74D1B791E07E48, 0x775EA264CF55347D }, // 1e-27
+  { 0xC612062576589DDA, 0x95364AFE032A819D }, // 1e-26
+  { 0xF79687AED3EEC551, 0x3A83DDBD83F52204 }, // 1e-25
+  { 0x9ABE14CD44753B52, 0xC4926A9672793542 }, // 1e-24
+  { 0xC16D9A0095928A27, 0x75B7053C0F178293 }, // 1e-23
+  { 0xF1C90080BAF72CB1, 0x5324C68B12DD6338 }, // 1e-22
+  { 0x971DA05074DA7BEE, 0xD3F6FC16EBCA5E03 }, // 1e-21
+  { 0xBCE5086492111AEA, 0x88F4BB1CA6BCF584 }, // 1e-20
+  { 0xEC1E4A7DB69561A5, 0x2B31E9E3D06C32E5 }, // 1e-19
+  { 0x9392EE8E921D5D07, 0x3AFF322E62439FCF }, // 1e-18
+  { 0xB877AA3236A4B449, 0x09BEFEB9FAD487C2 }, // 1e-17
+  { 0xE69594BEC44DE15B, 0x4C2EBE687989A9B3 }, // 1e-16
+  { 0x901D7CF73AB0ACD9, 0x0F9D37014BF60A10 }, // 1e-15
+  { 0xB424DC35095CD80F, 0x538484C19EF38C94 }, // 1e-14
+  { 0xE12E13424BB40E13, 0x2865A5F206B06FB9 }, // 1e-13
+  { 0x8CBCCC096F5088CB, 0xF93F87B7442E45D3 }, // 1e-12
+  { 0xAFEBFF0BCB24AAFE, 0xF78F69A51539D748 }, // 1e-11
+  { 0xDBE6FECEBDEDD5BE, 0xB573440E5A884D1B }, // 1e-10
+  { 0x89705F4136B4A597, 0x31680A88F8953030 }, // 1e-9
+  { 0xABCC77118461CEFC, 0xFDC20D2B36BA7C3D }, // 1e-8
+  { 0xD6BF94D5E57A42BC, 0x3D32907604691B4C }, // 1e-7
+  { 0x8637BD05AF6C69B5, 0xA63F9A49C2C1B10F }, // 1e-6
+  { 0xA7C5AC471B478423, 0x0FCF80DC33721D53 }, // 1e-5
+  { 0xD1B71758E219652B, 0xD3C36113404EA4A8 }, // 1e-4
+  { 0x83126E978D4FDF3B, 0x645A1CAC083126E9 }, // 1e-3
+  { 0xA3D70A3D70A3D70A, 0x3D70A3D70A3D70A3 }, // 1e-2
+  { 0xCCCCCCCCCCCCCCCC, 0xCCCCCCCCCCCCCCCC }, // 1e-1
+  { 0x8000000000000000, 0x0000000000000000 }, // 1e0
+  { 0xA000000000000000, 0x0000000000000000 }, // 1e1
+  { 0xC800000000000000, 0x0000000000000000 }, // 1e2
+  { 0xFA00000000000000, 0x0000000000000000 }, // 1e3
+  { 0x9C40000000000000, 0x0000000000000000 }, // 1e4
+  { 0xC350000000000000, 0x0000000000000000 }, // 1e5
+  { 0xF424000000000000, 0x0000000000000000 }, // 1e6
+  { 0x9896800000000000, 0x0000000000000000 }, // 1e7
+  { 0xBEBC200000000000, 0x0000000000000000 }, // 1e8
+  { 0xEE6B280000000000, 0x0000000000000000 }, // 1e9
+  { 0x9502F90000000000, 0x0000000000000000 }, // 1e10
+  { 0xBA43B74000000000, 0x0000000000000000 }, // 1e11
+  { 0xE8D4A51000000000, 0x0000000000000000 }, // 1e12
+  { 0x9184E72A00000000, 0x0000000000000000 }, // 1e13
+  { 0xB5E620F480000000, 0x0000000000000000 }, // 1e14
+  { 0xE35FA931A0000000, 0x0000000000000000 }, // 1e15
+  { 0x8E1BC9BF04000000, 0x0000000000000000 }, // 1e16
+  { 0xB1A2BC2EC5000000, 0x0000000000000000 }, // 1e17
+  { 0xDE0B6B3A76400000, 0x0000000000000000 }, // 1e18
+  { 0x8AC7230489E80000, 0x0000000000000000 }, // 1e19
+  { 0xAD78EBC5AC620000, 0x0000000000000000 }, // 1e20
+  { 0xD8D726B7177A8000, 0x0000000000000000 }, // 1e21
+  { 0x878678326EAC9000, 0x0000000000000000 }, // 1e22
+  { 0xA968163F0A57B400, 0x0000000000000000 }, // 1e23
+  { 0xD3C21BCECCEDA100, 0x0000000000000000 }, // 1e24
+  { 0x84595161401484A0, 0x0000000000000000 }, // 1e25
+  { 0xA56FA5B99019A5C8, 0x0000000000000000 }, // 1e26
+  { 0xCECB8F27F4200F3A, 0x0000000000000000 }, // 1e27
+  { 0x813F3978F8940984, 0x4000000000000000 }, // 1e28
+  { 0xA18F07D736B90BE5, 0x5000000000000000 }, // 1e29
+  { 0xC9F2C9CD04674EDE, 0xA400000000000000 }, // 1e30
+  { 0xFC6F7C4045812296, 0x4D00000000000000 }, // 1e31
+  { 0x9DC5ADA82B70B59D, 0xF020000000000000 }, // 1e32
+  { 0xC5371912364CE305, 0x6C28000000000000 }, // 1e33
+  { 0xF684DF56C3E01BC6, 0xC732000000000000 }, // 1e34
+  { 0x9A130B963A6C115C, 0x3C7F400000000000 }, // 1e35
+  { 0xC097CE7BC90715B3, 0x4B9F100000000000 }, // 1e36
+  { 0xF0BDC21ABB48DB20, 0x1E86D40000000000 }, // 1e37
+  { 0x96769950B50D88F4, 0x1314448000000000 }, // 1e38
+  { 0xBC143FA4E250EB31, 0x17D955A000000000 }, // 1e39
+  { 0xEB194F8E1AE525FD, 0x5DCFAB0800000000 }, // 1e40
+  { 0x92EFD1B8D0CF37BE, 0x5AA1CAE500000000 }, // 1e41
+  { 0xB7ABC627050305AD, 0xF14A3D9E40000000 }, // 1e42
+  { 0xE596B7B0C643C719, 0x6D9CCD05D0000000 }, // 1e43
+  { 0x8F7E32CE7BEA5C6F, 0xE4820023A2000000 }, // 1e44
+  { 0xB35DBF821AE4F38B, 0xDDA2802C8A800000 }, // 1e45
+  { 0xE0352F62A19E306E, 0xD50B2037AD200000 }, // 1e46
+  { 0x8C213D9DA502DE45, 0x4526F422CC340000 }, // 1e47
+  { 0xAF298D050E4395D6, 0x9670B12B7F410000 }, // 1e48
+  { 0xDAF3F04651D47B4C, 0x3C0CDD765F114000 }, // 1e49
+  { 0x88D8762BF324CD0F, 0xA5880A69FB6AC800 }, // 1e50
+  { 0xAB0E93B6EFEE0053, 0x8EEA0D047A457A00 }, // 1e51
+  { 0xD5D238A4ABE98068, 0x72A4904598D6D880 }, // 1e52
+  { 0x85A36366EB71F041, 0x47A6DA2B7F864750 }, // 1e53
+  { 0xA70C3C40A64E6C51, 0x999090B65F67D924 }, // 1e54
+  { 0xD0CF4B50CFE20765, 0xFFF4B4E3F741CF6D }, // 1e55
+  { 0x82818F1281ED449F, 0xBFF8F10E7A8921A4 }, // 1e56
+  { 0xA321F2D7226895C7, 0xAFF72D52192B6A0D }, // 1e57
+  { 0xCBEA6F8CEB02BB39, 0x9BF4F8A69F764490 }, // 1e58
+  { 0xFEE50B7025C36A08, 0x02F236D04753D5B4 }, // 1e59
+  { 0x9F4F2726179A2245, 0x01D762422C946590 }, // 1e60
+  { 0xC722F0EF9D80AAD6, 0x424D3AD2B7B97EF5 }, // 1e61
+  { 0xF8EBAD2B84E0D58B, 0xD2E0898765A7DEB2 }, // 1e62
+  { 0x9B934C3B330C8577, 0x63CC55F49F88EB2F }, // 1e63
+  { 0xC2781F49FFCFA6D5, 0x3CBF6B71C76B25FB }  // 1e64
+};
+
+static const D64 kStringUtilExactPow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+static const F32 kStringUtilExactPow10f[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+// Floating point value layouts
+struct StringUtilFloatLayout
+{
+  U32 mantissaBits;   // Including the hidden bit
+  I32 exponentBias;
+};
+
+static const StringUtilFloatLayout kStringUtilF32Layout = { 24, 127 };
+static const StringUtilFloatLayout kStringUtilD64Layout = { 53, 1023 };
+
+// Do-it-yourself floating point value (f * 2^e)
+struct StringUtilDiyFp
+{
+  StringUtilDiyFp() {}
+  StringUtilDiyFp(U64 f, I32 e) : f(f), e(e) {}
+
+  U64 f;
+  I32 e;
+};
+
+inline U32 StringUtilCountLeadingZeros(U64 v)
+{
+  U32 count = 0;
+  if ((v >> 32) == 0) { count += 32; v <<= 32; }
+  if ((v >> 48) == 0) { count += 16; v <<= 16; }
+  if ((v >> 56) == 0) { count += 8; v <<= 8; }
+  if ((v >> 60) == 0) { count += 4; v <<= 4; }
+  if ((v >> 62) == 0) { count += 2; v <<= 2; }
+  if ((v >> 63) == 0) { count += 1; }
+  return count;
+}
+
+inline void StringUtilMultiply(U64 a, U64 b, U64& high, U64& low)
+{
+  const U64 aLow = a & 0xffffffff;
+  const U64 aHigh = a >> 32;
+  const U64 bLow = b & 0xffffffff;
+  const U64 bHigh = b >> 32;
+  const U64 p0 = aLow * bLow;
+  const U64 p1 = aLow * bHigh;
+  const U64 p2 = aHigh * bLow;
+  const U64 p3 = aHigh * bHigh;
+  const U64 middle = (p0 >> 32) + (p1 & 0xffffffff) + (p2 & 0xffffffff);
+  low = (middle << 32) | (p0 & 0xffffffff);
+  high = p3 + (p1 >> 32) + (p2 >> 32) + (middle >> 32);
+}
+
+inline StringUtilDiyFp StringUtilMultiply(const StringUtilDiyFp& a, const StringUtilDiyFp& b)
+{
+  // Rounded upper half of the 128 bit product
+  U64 high, low;
+  StringUtilMultiply(a.f, b.f, high, low);
+  return StringUtilDiyFp(high + (low >> 63), a.e + b.e + 64);
+}
+
+inline StringUtilDiyFp StringUtilNormalize(const StringUtilDiyFp& v)
+{
+  const U32 shift = StringUtilCountLeadingZeros(v.f);
+  return StringUtilDiyFp(v.f << shift, v.e - static_cast<I32>(shift));
+}
+
+inline U32 StringUtilFindLargestPow10(U32 v, U32& pow10)
+{
+  if (v >= 1000000000) { pow10 = 1000000000; return 10; }
+  if (v >= 100000000) { pow10 = 100000000; return 9; }
+  if (v >= 10000000) { pow10 = 10000000; return 8; }
+  if (v >= 1000000) { pow10 = 1000000; return 7; }
+  if (v >= 100000) { pow10 = 100000; return 6; }
+  if (v >= 10000) { pow10 = 10000; return 5; }
+  if (v >= 1000) { pow10 = 1000; return 4; }
+  if (v >= 100) { pow10 = 100; return 3; }
+  if (v >= 10) { pow10 = 10; return 2; }
+  pow10 = 1;
+  return 1;
+}
+
+inline void StringUtilGrisuRound(char* pDigits, U32 length, U64 distance, U64 delta, U64 rest, U64 tenK)
+{
+  // Move the last digit down while the result gets closer to the value and stays inside the rounding interval
+  while (rest < distance && delta - rest >= tenK && (rest + tenK < distance || distance - rest > rest + tenK - distance))
+  {
+    --pDigits[length - 1];
+    rest += tenK;
+  }
+}
+
+static U32 StringUtilGrisuGenerateDigits(char* pDigits, I32& decimalExponent, const StringUtilDiyFp& mMinus, const StringUtilDiyFp& w, const StringUtilDiyFp& mPlus)
+{
+  U64 delta = mPlus.f - mMinus.f;
+  U64 distance = mPlus.f - w.f;
+  const StringUtilDiyFp one(static_cast<U64>(1) << -mPlus.e, mPlus.e);
+  U32 p1 = static_cast<U32>(mPlus.f >> -one.e);
+  U64 p2 = mPlus.f & (one.f - 1);
+  U32 length = 0;
+
+  // Integral digits
+  U32 pow10;
+  U32 n = StringUtilFindLargestPow10(p1, pow10);
+  while (n > 0)
+  {
+    pDigits[length++] = static_cast<char>('0' + p1 / pow10);
+    p1 %= pow10;
+    --n;
+    const U64 rest = (static_cast<U64>(p1) << -one.e) + p2;
+    if (rest <= delta)
+    {
+      decimalExponent += n;
+      StringUtilGrisuRound(pDigits, length, distance, delta, rest, static_cast<U64>(pow10) << -one.e);
+      return length;
+    }
+    pow10 /= 10;
+  }
+
+  // Fractional digits
+  I32 m = 0;
+  for (;;)
+  {
+    p2 *= 10;
+    pDigits[length++] = static_cast<char>('0' + (p2 >> -one.e));
+    p2 &= one.f - 1;
+    ++m;
+    delta *= 10;
+    distance *= 10;
+    if (p2 <= delta) break;
+  }
+  decimalExponent -= m;
+  StringUtilGrisuRound(pDigits, length, distance, delta, p2, one.f);
+  return length;
+}
+
+static U32 StringUtilGrisu(char* pDigits, I32& decimalExponent, U64 significand, I32 exponent, bool lowerBoundaryIsCloser)
+{
+  // Boundaries of the rounding interval (halfway to the neighbour values)
+  const StringUtilDiyFp mPlus = StringUtilNormalize(StringUtilDiyFp(2 * significand + 1, exponent - 1));
+  const StringUtilDiyFp mMinusRaw = lowerBoundaryIsCloser ? StringUtilDiyFp(4 * significand - 1, exponent - 2) : StringUtilDiyFp(2 * significand - 1, exponent - 1);
+  const StringUtilDiyFp mMinus(mMinusRaw.f << (mMinusRaw.e - mPlus.e), mPlus.e);
+  const StringUtilDiyFp v = StringUtilNormalize(StringUtilDiyFp(significand, exponent));
+
+  // Scale by a cached power of ten c = 10^-k so the boundaries exponent lies in [kAlpha, kGamma]
+  const I32 f = kStringUtilGrisuAlpha - mPlus.e - 1;
+  const I32 k = (f * 78913) / (1 << 18) + (f > 0);
+  const I32 index = (-kStringUtilCachedPowerMinExponent + k + (kStringUtilCachedPowerExponentStep - 1)) / kStringUtilCachedPowerExponentStep;
+  const StringUtilCachedPower& cachedPower = kStringUtilCachedPowers[index];
+  const StringUtilDiyFp c(cachedPower.f, cachedPower.e);
+
+  const StringUtilDiyFp w = StringUtilMultiply(v, c);
+  const StringUtilDiyFp wMinus = StringUtilMultiply(mMinus, c);
+  const StringUtilDiyFp wPlus = StringUtilMultiply(mPlus, c);
+  // Shrink the interval by one unit to account for the multiplication errors
+  decimalExponent = -cachedPower.k;
+  return StringUtilGrisuGenerateDigits(pDigits, decimalExponent, StringUtilDiyFp(wMinus.f + 1, wMinus.e), w, StringUtilDiyFp(wPlus.f - 1, wPlus.e));
+}
+
+static size_t StringUtilFormatUnsigned(char* pTarget, U64 v)
+{
+  // Digits are generated backwards two at a time
+  char buffer[20];
+  char* pEnd = buffer + sizeof(buffer);
+  char* pDigits = pEnd;
+  while (v > 0xffffffff)
+  {
+    const U32 pair = static_cast<U32>(v % 100) * 2;
+    v /= 100;
+    pDigits -= 2;
+    pDigits[0] = kStringUtilDigitPairs[pair];
+    pDigits[1] = kStringUtilDigitPairs[pair + 1];
+  }
+  U32 v32 = static_cast<U32>(v);
+  while (v32 >= 100)
+  {
+    const U32 pair = (v32 % 100) * 2;
+    v32 /= 100;
+    pDigits -= 2;
+    pDigits[0] = kStringUtilDigitPairs[pair];
+    pDigits[1] = kStringUtilDigitPairs[pair + 1];
+  }
+  if (v32 >= 10)
+  {
+    pDigits -= 2;
+    pDigits[0] = kStringUtilDigitPairs[v32 * 2];
+    pDigits[1] = kStringUtilDigitPairs[v32 * 2 + 1];
+  }
+  else
+  {
+    *--pDigits = static_cast<char>('0' + v32);
+  }
+
+  const size_t length = pEnd - pDigits;
+  memcpy(pTarget, pDigits, length);
+  return length;
+}
+
+static size_t StringUtilFormatDecimal(char* pTarget, const char* pDigits, U32 length, I32 decimalExponent)
+{
+  // The decimal point goes after k digits
+  const I32 n = static_cast<I32>(length);
+  const I32 k = n + decimalExponent;
+  char* p = pTarget;
+
+  if (n <= k && k <= 21)
+  {
+    // Integral value (ddd000)
+    memcpy(p, pDigits, n);
+    memset(p + n, '0', k - n);
+    return k;
+  }
+  if (0 < k && k <= 21)
+  {
+    // ddd.ddd
+    memcpy(p, pDigits, k);
+    p[k] = '.';
+    memcpy(p + k + 1, pDigits + k, n - k);
+    return n + 1;
+  }
+  if (-6 < k && k <= 0)
+  {
+    // 0.000ddd
+    p[0] = '0';
+    p[1] = '.';
+    memset(p + 2, '0', -k);
+    memcpy(p + 2 - k, pDigits, n);
+    return 2 - k + n;
+  }
+
+  // d.ddde[-]xxx
+  *p++ = pDigits[0];
+  if (n > 1)
+  {
+    *p++ = '.';
+    memcpy(p, pDigits + 1, n - 1);
+    p += n - 1;
+  }
+  *p++ = 'e';
+  I32 exponent = k - 1;
+  if (exponent < 0)
+  {
+    *p++ = '-';
+    exponent = -exponent;
+  }
+  p += StringUtilFormatUnsigned(p, static_cast<U64>(exponent));
+  return p - pTarget;
+}
+
+static size_t StringUtilFormatFloat(char* pTarget, U64 bits, const StringUtilFloatLayout& layout)
+{
+  const U32 fractionBits = layout.mantissaBits - 1;
+  const U64 fraction = bits & ((static_cast<U64>(1) << fractionBits) - 1);
+  const I32 biasedExponent = static_cast<I32>((bits >> fractionBits) & (2 * layout.exponentBias + 1));
+  const bool negative = (bits >> (fractionBits + (layout.mantissaBits == 24 ? 8 : 11))) != 0;
+  char* p = pTarget;
+
+  if (biasedExponent == 2 * layout.exponentBias + 1)
+  {
+    if (fraction)
+    {
+      memcpy(p, "nan", 3);
+      return 3;
+    }
+    if (negative) *p++ = '-';
+    memcpy(p, "inf", 3);
+    return p + 3 - pTarget;
+  }
+  if (negative) *p++ = '-';
+  if (biasedExponent == 0 && fraction == 0)
+  {
+    *p = '0';
+    return p + 1 - pTarget;
+  }
+
+  // Values are f * 2^e (subnormal values have no hidden bit)
+  const I32 exponentOffset = layout.exponentBias + static_cast<I32>(fractionBits);
+  const U64 significand = biasedExponent ? fraction | (static_cast<U64>(1) << fractionBits) : fraction;
+  const I32 exponent = biasedExponent ? biasedExponent - exponentOffset : 1 - exponentOffset;
+  char digits[20];
+  I32 decimalExponent;
+  const U32 length = StringUtilGrisu(digits, decimalExponent, significand, exponent, fraction == 0 && biasedExponent > 1);
+  return p - pTarget + StringUtilFormatDecimal(p, digits, length, decimalExponent);
+}
+
+static bool StringUtilComputeFloat(U64 w, I32 q, const StringUtilFloatLayout& layout, U64& bits)
+{
+  // w * 10^q is approximated by the top 128 bits of the normalized 64 x 128 bit product. The truncated product is at
+  // most 2 units (of its last bit) below the exact one, so it decides the rounding unless the discarded bits are close
+  // to a carry or to a tie
+  if (q < kStringUtilPow10MinExponent || q > kStringUtilPow10MaxExponent) return false;
+  const U64* pPow10 = kStringUtilPow10[q - kStringUtilPow10MinExponent];
+  const U32 leadingZeros = StringUtilCountLeadingZeros(w);
+  w <<= leadingZeros;
+
+  U64 high, low, crossHigh, crossLow;
+  StringUtilMultiply(w, pPow10[0], high, low);
+  StringUtilMultiply(w, pPow10[1], crossHigh, crossLow);
+  low += crossHigh;
+  if (low < crossHigh) ++high;
+
+  // Keep one bit more than the mantissa for rounding
+  const U32 upperBit = static_cast<U32>(high >> 63);
+  const U32 shift = 62 + upperBit - layout.mantissaBits;
+  const U64 remainderMask = (static_cast<U64>(1) << shift) - 1;
+  const U64 remainder = high & remainderMask;
+  U64 mantissa = high >> shift;
+  if (remainder == remainderMask && low >= ~static_cast<U64>(0) - 1) return false;
+  if ((mantissa & 1) && remainder == 0 && low == 0) return false;
+
+  // 10^q = pow10 * 2^(floor(q * log2(10)) - 127)
+  I32 exponent = static_cast<I32>(shift) + 2 + ((217706 * q) >> 16) - static_cast<I32>(leadingZeros);
+  mantissa = (mantissa + 1) >> 1;
+  if (mantissa >> layout.mantissaBits)
+  {
+    mantissa >>= 1;
+    ++exponent;
+  }
+  const I32 biasedExponent = exponent + static_cast<I32>(layout.mantissaBits) - 1 + layout.exponentBias;
+  // Subnormal and overflowing values are left to the fallback
+  if (biasedExponent <= 0 || biasedExponent >= 2 * layout.exponentBias + 1) return false;
+
+  bits = (static_cast<U64>(biasedExponent) << (layout.mantissaBits - 1)) | (mantissa & ((static_cast<U64>(1) << (layout.mantissaBits - 1)) - 1));
+  return true;
+}
+
+inline bool StringUtilParseExact(D64& v, U64 w, I32 q)
+{
+  // Both the significand and the power of ten are exact, so a single operation rounds correctly
+  if (w > (static_cast<U64>(1) << 53) || q < -22 || q > 22) return false;
+  v = q < 0 ? static_cast<D64>(w) / kStringUtilExactPow10[-q] : static_cast<D64>(w) * kStringUtilExactPow10[q];
+  return true;
+}
+
+inline bool StringUtilParseExact(F32& v, U64 w, I32 q)
+{
+  if (w <= (static_cast<U64>(1) << 24) && q >= -10 && q <= 10)
+  {
+    v = q < 0 ? static_cast<F32>(w) / kStringUtilExactPow10f[-q] : static_cast<F32>(w) * kStringUtilExactPow10f[q];
+    return true;
+  }
+
+  // Longer significands go through the correctly rounded double, which rounds to the right float unless it lies
+  // exactly halfway between two floats (the 29 extra mantissa bits are 100...0)
+  D64 d;
+  if (!StringUtilParseExact(d, w, q)) return false;
+  U64 bits;
+  memcpy(&bits, &d, sizeof(bits));
+  if ((bits & 0x1fffffff) == 0x10000000) return false;
+  v = static_cast<F32>(d);
+  return true;
+}
+
+inline void StringUtilSetBits(D64& v, U64 bits)
+{
+  memcpy(&v, &bits, sizeof(v));
+}
+
+inline void StringUtilSetBits(F32& v, U64 bits)
+{
+  const U32 bits32 = static_cast<U32>(bits);
+  memcpy(&v, &bits32, sizeof(v));
+}
+
+inline bool StringUtilIsDigit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+static size_t StringUtilParseWord(const char* pSource, const char* pEnd, const char* pWord)
+{
+  const char* p = pSource;
+  for (; *pWord; ++p, ++pWord)
+  {
+    if (p == pEnd || (*p | 0x20) != *pWord) return 0;
+  }
+  return p - pSource;
+}
+
+template <typename T>
+static size_t StringUtilParseFloat(T& v, const char* pSource, size_t length, const StringUtilFloatLayout& layout)
+{
+  const char* p = pSource;
+  const char* pEnd = pSource + length;
+  const bool negative = p < pEnd && *p == '-';
+  if (p < pEnd && (*p == '-' || *p == '+')) ++p;
+
+  // Non finite values
+  if (p < pEnd && !StringUtilIsDigit(*p) && *p != '.')
+  {
+    size_t wordLength = StringUtilParseWord(p, pEnd, "nan");
+    if (wordLength)
+    {
+      v = std::numeric_limits<T>::quiet_NaN();
+      return p + wordLength - pSource;
+    }
+    wordLength = StringUtilParseWord(p, pEnd, "inf");
+    if (wordLength == 0) return 0;
+    wordLength += StringUtilParseWord(p + wordLength, pEnd, "inity");
+    v = negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+    return p + wordLength - pSource;
+  }
+
+  // Up to 19 significant digits fit in the significand, the rest only scale it
+  U64 w = 0;
+  I32 q = 0;
+  U32 digitCount = 0;
+  bool hasDigits = false;
+  bool isTruncated = false;
+  for (; p < pEnd && StringUtilIsDigit(*p); ++p)
+  {
+    hasDigits = true;
+    if (digitCount < 19)
+    {
+      w = w * 10 + (*p - '0');
+      if (w) ++digitCount;
+    }
+    else
+    {
+      ++q;
+      isTruncated |= *p != '0';
+    }
+  }
+  if (p < pEnd && *p == '.')
+  {
+    for (++p; p < pEnd && StringUtilIsDigit(*p); ++p)
+    {
+      hasDigits = true;
+      if (digitCount < 19)
+      {
+        w = w * 10 + (*p - '0');
+        if (w) ++digitCount;
+        --q;
+      }
+      else
+      {
+        isTruncated |= *p != '0';
+      }
+    }
+  }
+  if (!hasDigits) return 0;
+
+  if (p < pEnd && (*p == 'e' || *p == 'E'))
+  {
+    const char* pExponent = p++;
+    const bool isExponentNegative = p < pEnd && *p == '-';
+    if (p < pEnd && (*p == '-' || *p == '+')) ++p;
+    if (p < pEnd && StringUtilIsDigit(*p))
+    {
+      I32 exponent = 0;
+      for (; p < pEnd && StringUtilIsDigit(*p); ++p)
+      {
+        if (exponent < 100000) exponent = exponent * 10 + (*p - '0');
+      }
+      q += isExponentNegative ? -exponent : exponent;
+    }
+    else
+    {
+      // Not an exponent (e.g. "1e" is parsed as "1")
+      p = pExponent;
+    }
+  }
+  const size_t parsedLength = p - pSource;
+
+  U64 bits;
+  if (w == 0)
+  {
+    v = negative ? -static_cast<T>(0) : static_cast<T>(0);
+  }
+  else if (!isTruncated && StringUtilParseExact(v, w, q))
+  {
+    if (negative) v = -v;
+  }
+  else if (!isTruncated && StringUtilComputeFloat(w, q, layout, bits))
+  {
+    StringUtilSetBits(v, bits);
+    if (negative) v = -v;
+  }
+  else
+  {
+    std::istringstream iss(std::string(pSource, parsedLength));
+    iss.imbue(std::locale::classic());
+    iss >> v;
+    // Streams fail on out of range values
+    if (iss.fail()) v = (q < 0) ? (negative ? -static_cast<T>(0) : static_cast<T>(0)) : (negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity());
+  }
+  return parsedLength;
+}
+
+static size_t StringUtilParseUnsigned(U64& v, const char* pSource, const char* pEnd)
+{
+  const char* p = pSource;
+  U64 value = 0;
+  for (; p < pEnd && StringUtilIsDigit(*p); ++p)
+  {
+    const U32 digit = static_cast<U32>(*p - '0');
+    // Overflow check (18446744073709551615)
+    if (value > (~static_cast<U64>(0) - digit) / 10) return 0;
+    value = value * 10 + digit;
+  }
+  v = value;
+  return p - pSource;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+StringUtil functions
+----------------------------------------------------------------------------------------------------------------------*/
+
+size_t Text::FormatNumber(char* pTarget, I64 v)
+{
+  if (v >= 0) return StringUtilFormatUnsigned(pTarget, static_cast<U64>(v));
+  pTarget[0] = '-';
+  return 1 + StringUtilFormatUnsigned(pTarget + 1, static_cast<U64>(0) - static_cast<U64>(v));
+}
+
+size_t Text::FormatNumber(char* pTarget, U64 v)
+{
+  return StringUtilFormatUnsigned(pTarget, v);
+}
+
+size_t Text::FormatNumber(char* pTarget, F32 v)
+{
+  U32 bits;
+  memcpy(&bits, &v, sizeof(bits));
+  return StringUtilFormatFloat(pTarget, bits, kStringUtilF32Layout);
+}
+
+size_t Text::FormatNumber(char* pTarget, D64 v)
+{
+  U64 bits;
+  memcpy(&bits, &v, sizeof(bits));
+  return StringUtilFormatFloat(pTarget, bits, kStringUtilD64Layout);
+}
+
+size_t Text::ParseNumber(I64& v, const char* pSource, size_t length)
+{
+  const char* pEnd = pSource + length;
+  const bool negative = length && pSource[0] == '-';
+  const size_t signLength = (length && (pSource[0] == '-' || pSource[0] == '+')) ? 1 : 0;
+  U64 value;
+  const size_t digitLength = StringUtilParseUnsigned(value, pSource + signLength, pEnd);
+  if (digitLength == 0) return 0;
+  // Overflow check (-9223372036854775808 to 9223372036854775807)
+  if (value > static_cast<U64>(std::numeric_limits<I64>::max()) + (negative ? 1 : 0)) return 0;
+  v = negative ? static_cast<I64>(static_cast<U64>(0) - value) : static_cast<I64>(value);
+  return signLength + digitLength;
+}
+
+size_t Text::ParseNumber(U64& v, const char* pSource, size_t length)
+{
+  const size_t signLength = (length && pSource[0] == '+') ? 1 : 0;
+  const size_t digitLength = StringUtilParseUnsigned(v, pSource + signLength, pSource + length);
+  return digitLength ? signLength + digitLength : 0;
+}
+
+size_t Text::ParseNumber(F32& v, const char* pSource, size_t length)
+{
+  return StringUtilParseFloat(v, pSource, length, kStringUtilF32Layout);
+}
+
+size_t Text::ParseNumber(D64& v, const char* pSource, size_t length)
+{
+  return StringUtilParseFloat(v, pSource, length, kStringUtilD64Layout);
+}
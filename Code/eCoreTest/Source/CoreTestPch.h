@@ -52,26 +52,46 @@ This file defines includes all the headers required by the Utilities test applic
 #include <EventSystem/Event.h>
 #include <Containers/DynamicArray.h>
 #include <Containers/List.h>
+#include <Containers/ConcurrentQueue.h>
 #include <Containers/Map.h>
 #include <Containers/Queue.h>
+#include <Containers/RingBuffer.h>
+#include <Containers/SlotMap.h>
+#include <Containers/SmallList.h>
 #include <Containers/Stack.h>
 #include <Containers/Array.h>
+#include <FileSystem/Archive.h>
+#include <FileSystem/AsyncIO.h>
+#include <FileSystem/DirectoryScanner.h>
 #include <FileSystem/File.h>
+#include <FileSystem/MappedFile.h>
+#include <FileSystem/PackFile.h>
+#include <FileSystem/VirtualFileSystem.h>
+#include <FileSystem/DerivedDataCache.h>
 #include <Math/Random.h>
 #include <Math/Hash.h>
 #include <Math/Algorithm.h>
+#include <Math/ParallelSorting.h>
 #include <Math/Vector2.h>
 #include <Math/Vector3.h>
 #include <Math/Vector4.h>
 #include <Math/Matrix4.h>
+#include <Math/Projection.h>
 #include <Math/Quaternion.h>
+#include <Math/Batch.h>
+#include <Math/Bvh.h>
+#include <Math/LooseOctree.h>
+#include <Math/MeshOptimizer.h>
+#include <Math/Intersection.h>
 #include <Memory/Factory.h>
 #include <Memory/GarbageCollection.h>
+#include <Serialization/ByteReader.h>
 #include <Serialization/ByteSerializer.h>
 #include <Serialization/StringSerializer.h>
 #include <Serialization/XmlSerializer.h>
 #include <Singleton.h>
 #include <Text/String.h>
+#include <Text/StringUtil.h>
 #include <Threads/ThreadPool.h>
 #include <Threads/Atomic.h>
 #include <Time/Timer.h>
@@ -101,14 +121,26 @@ This file defines includes all the headers required by the Utilities test applic
 #include "Test/Text/StringBuffer.h"
 #include "Test/Serialization/Serialization.h"
 #include "Test/Math/Hash.h"
+#include "Test/Containers/ConcurrentQueue.h"
 #include "Test/Containers/Map.h"
 #include "Test/Containers/Queue.h"
+#include "Test/Containers/SlotMap.h"
+#include "Test/Containers/SmallList.h"
 #include "Test/Containers/Stack.h"
+#include "Test/FileSystem/AsyncIO.h"
+#include "Test/FileSystem/DirectoryScanner.h"
 #include "Test/FileSystem/File.h"
+#include "Test/FileSystem/PackFile.h"
+#include "Test/FileSystem/DerivedDataCache.h"
 #include "Test/Time/Time.h"
 #include "Test/Math/Vector.h"
 #include "Test/Math/Matrix.h"
 #include "Test/Math/Quaternion.h"
+#include "Test/Math/Batch.h"
+#include "Test/Math/Bvh.h"
+#include "Test/Math/LooseOctree.h"
+#include "Test/Math/MeshOptimizer.h"
+#include "Test/Math/Random.h"
 #include "Test/Memory/Allocator.h"
 #include "Test/Memory/Factory.h"
 #include "Test/Memory/GarbageCollection.h"
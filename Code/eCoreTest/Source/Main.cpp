@@ -73,11 +73,19 @@ void main()
     Test::Hash::Run();
     Test::Map::Run();
     Test::Queue::Run();
+    Test::ConcurrentQueue::Run();
+    Test::SlotMap::Run();
+    Test::SmallList::Run();
     Test::Stack::Run();
     Test::Time::Run();
     Test::Vector::Run();
     Test::Matrix::Run();
     Test::Quaternion::Run();
+    Test::Batch::Run();
+    Test::Bvh::Run();
+    Test::LooseOctree::Run();
+    Test::MeshOptimizer::Run();
+    Test::Random::Run();
     Test::Serialization::Run();
     Test::Thread::Run();
     Test::Event::Run();
@@ -87,6 +95,10 @@ void main()
     Test::Allocator::Run();
     Test::Algorithm::Run();
     Test::File::Run();
+    Test::AsyncIO::Run();
+    Test::DirectoryScanner::Run();
+    Test::PackFile::Run();
+    Test::DerivedDataCache::Run();
     Test::WeakPtr::Run();
     Test::GarbageCollection::Run();*/
     Test::ConditionVariable::Run();
@@ -0,0 +1,295 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file ConcurrentQueue.cpp
+This file defines ConcurrentQueue and RingBuffer test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef TEST_SIZE
+#define TEST_SIZE 1024
+#endif
+
+#ifndef TEST_ITEM_COUNT
+#define TEST_ITEM_COUNT 1000000
+#endif
+
+#ifndef TEST_MAX_PAIR_COUNT
+#define TEST_MAX_PAIR_COUNT 8
+#endif
+
+// Bounded Queue protected by a Mutex (the ThreadPool approach) used as reference
+class MutexQueue
+{
+public:
+  explicit MutexQueue(size_t size) : mQueue(size) {}
+
+  bool Pop(U32& value)
+  {
+    Threads::Lock l(mMutex);
+    if (mQueue.IsEmpty()) return false;
+    value = mQueue.GetFront();
+    mQueue.Pop();
+    return true;
+  }
+
+  bool Push(const U32& value)
+  {
+    Threads::Lock l(mMutex);
+    if (mQueue.GetCount() == mQueue.GetSize()) return false;
+    mQueue.Push(value);
+    return true;
+  }
+
+private:
+  Containers::Queue<U32>  mQueue;
+  Threads::Mutex          mMutex;
+};
+
+template <class QueueClass>
+struct QueueProducer : public Threads::IRunnable
+{
+  QueueProducer() : pQueue(nullptr), count(0) {}
+
+  I32 Run()
+  {
+    // Values start at 1 so that the consumer checksum detects lost items
+    for (U32 i = 1; i <= count; ++i) while (!pQueue->Push(i)) Threads::Thread::Sleep(0);
+    return 0;
+  }
+
+  QueueClass* pQueue;
+  U32         count;
+};
+
+template <class QueueClass>
+struct QueueConsumer : public Threads::IRunnable
+{
+  QueueConsumer() : pQueue(nullptr), count(0), checksum(0), ordered(true) {}
+
+  I32 Run()
+  {
+    U32 value = 0;
+    U32 last = 0;
+    for (U32 i = 0; i < count; ++i)
+    {
+      while (!pQueue->Pop(value)) Threads::Thread::Sleep(0);
+      if (value <= last) ordered = false;
+      last = value;
+      checksum += value;
+    }
+    return 0;
+  }
+
+  QueueClass* pQueue;
+  U32         count;
+  U64         checksum;
+  bool        ordered;
+};
+
+template <class QueueClass>
+F32 RunQueuePairs(QueueClass** ppQueueList, U32 pairCount, U32 itemCount, bool& ordered);
+
+/*----------------------------------------------------------------------------------------------------------------------
+TestConcurrentQueue methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::ConcurrentQueue::Run()
+{
+  try
+  {
+    std::cout << "[Test::ConcurrentQueue::Run] using queue size of " << TEST_SIZE << std::endl;
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::ConcurrentQueue::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::ConcurrentQueue::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::ConcurrentQueue::RunFunctionalityTest()
+{
+  try
+  {
+    std::cout << "[Test::ConcurrentQueue::RunFunctionalityTest]" << std::endl;
+
+    /*-----------------------------------------------------------------
+    ConcurrentQueue (single thread)
+    -----------------------------------------------------------------*/
+    E::Containers::ConcurrentQueue<I32> queue(TEST_SIZE);
+    E_ASSERT(queue.GetSize() == TEST_SIZE && queue.IsEmpty());
+    I32 value = 0;
+    E_ASSERT(!queue.Pop(value));
+    for (I32 i = 0; i < TEST_SIZE; ++i) E_ASSERT(queue.Push(i));
+    E_ASSERT(!queue.Push(TEST_SIZE) && queue.GetCount() == TEST_SIZE);
+    for (I32 i = 0; i < TEST_SIZE; ++i) E_ASSERT(queue.Pop(value) && value == i);
+    E_ASSERT(!queue.Pop(value) && queue.IsEmpty());
+    // Wrap around the buffer several times
+    for (I32 i = 0; i < TEST_SIZE * 4; ++i) E_ASSERT(queue.Push(i) && queue.Pop(value) && value == i);
+
+    /*-----------------------------------------------------------------
+    RingBuffer (single thread)
+    -----------------------------------------------------------------*/
+    E::Containers::RingBuffer<StringBuffer> ringBuffer(4);
+    StringBuffer sb;
+    E_ASSERT(!ringBuffer.Pop(sb));
+    E_ASSERT(ringBuffer.Push("a") && ringBuffer.Push("b") && ringBuffer.Push("c") && ringBuffer.Push("d"));
+    E_ASSERT(!ringBuffer.Push("e") && ringBuffer.GetCount() == 4);
+    E_ASSERT(ringBuffer.Pop(sb) && sb == "a");
+    E_ASSERT(ringBuffer.Push("e"));
+    E_ASSERT(ringBuffer.Pop(sb) && sb == "b");
+    E_ASSERT(ringBuffer.Pop(sb) && sb == "c");
+    E_ASSERT(ringBuffer.Pop(sb) && sb == "d");
+    E_ASSERT(ringBuffer.Pop(sb) && sb == "e");
+    E_ASSERT(!ringBuffer.Pop(sb) && ringBuffer.IsEmpty());
+
+    /*-----------------------------------------------------------------
+    Multiple threads (no lost or duplicated items)
+    -----------------------------------------------------------------*/
+    bool ordered = false;
+    E::Containers::ConcurrentQueue<U32> sharedQueue(TEST_SIZE);
+    E::Containers::ConcurrentQueue<U32>* sharedQueueList[] = { &sharedQueue, &sharedQueue, &sharedQueue, &sharedQueue };
+    E_ASSERT(RunQueuePairs(sharedQueueList, 4, TEST_ITEM_COUNT / 10, ordered) >= 0.0f);
+
+    E::Containers::RingBuffer<U32> ringBufferA(TEST_SIZE);
+    E::Containers::RingBuffer<U32> ringBufferB(TEST_SIZE);
+    E::Containers::RingBuffer<U32>* ringBufferList[] = { &ringBufferA, &ringBufferB };
+    E_ASSERT(RunQueuePairs(ringBufferList, 2, TEST_ITEM_COUNT / 10, ordered) >= 0.0f && ordered);
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+bool Test::ConcurrentQueue::RunPerformanceTest()
+{
+  try
+  {
+    std::cout << "[Test::ConcurrentQueue::RunPerformanceTest]" << std::endl;
+    std::cout << "Items per producer: " << TEST_ITEM_COUNT << " processors: " << Threads::Thread::GetProcessorCount() << std::endl << std::endl;
+
+    bool ordered = false;
+    for (U32 pairCount = 1; pairCount <= TEST_MAX_PAIR_COUNT; pairCount *= 2)
+    {
+      // All the pairs share a single MPMC queue
+      MutexQueue mutexQueue(TEST_SIZE);
+      Containers::ConcurrentQueue<U32> concurrentQueue(TEST_SIZE);
+      MutexQueue* mutexQueueList[TEST_MAX_PAIR_COUNT];
+      Containers::ConcurrentQueue<U32>* concurrentQueueList[TEST_MAX_PAIR_COUNT];
+      // Every pair owns a SPSC ring buffer
+      Containers::RingBuffer<U32>* ringBufferList[TEST_MAX_PAIR_COUNT];
+      for (U32 i = 0; i < pairCount; ++i)
+      {
+        mutexQueueList[i] = &mutexQueue;
+        concurrentQueueList[i] = &concurrentQueue;
+        ringBufferList[i] = new Containers::RingBuffer<U32>(TEST_SIZE);
+      }
+
+      F32 mutexQueueTime = RunQueuePairs(mutexQueueList, pairCount, TEST_ITEM_COUNT, ordered);
+      F32 concurrentQueueTime = RunQueuePairs(concurrentQueueList, pairCount, TEST_ITEM_COUNT, ordered);
+      F32 ringBufferTime = RunQueuePairs(ringBufferList, pairCount, TEST_ITEM_COUNT, ordered);
+      for (U32 i = 0; i < pairCount; ++i) delete ringBufferList[i];
+
+      // Throughput in million items per second
+      F32 itemCount = static_cast<F32>(pairCount) * TEST_ITEM_COUNT;
+      std::cout << pairCount << " pair(s)" << std::endl;
+      std::cout << "Queue + Mutex    [" << mutexQueueTime << " ms]\t" << itemCount / (mutexQueueTime * 1000.0f) << " Mitems/s" << std::endl;
+      std::cout << "ConcurrentQueue  [" << concurrentQueueTime << " ms]\t" << itemCount / (concurrentQueueTime * 1000.0f) << " Mitems/s" << std::endl;
+      std::cout << "RingBuffer       [" << ringBufferTime << " ms]\t" << itemCount / (ringBufferTime * 1000.0f) << " Mitems/s" << std::endl << std::endl;
+    }
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------------------------------------------------
+RunQueuePairs
+
+Runs a producer and a consumer thread for each queue in the list (which may repeat the same queue) and returns the
+elapsed milliseconds. It asserts that the values popped match the values pushed, while ordered reports whether every
+consumer received its values in increasing order (only guaranteed for one producer per queue).
+----------------------------------------------------------------------------------------------------------------------*/
+template <class QueueClass>
+F32 RunQueuePairs(QueueClass** ppQueueList, U32 pairCount, U32 itemCount, bool& ordered)
+{
+  QueueProducer<QueueClass> producerList[TEST_MAX_PAIR_COUNT];
+  QueueConsumer<QueueClass> consumerList[TEST_MAX_PAIR_COUNT];
+  Threads::Thread* threadList[TEST_MAX_PAIR_COUNT * 2];
+
+  for (U32 i = 0; i < pairCount; ++i)
+  {
+    producerList[i].pQueue = ppQueueList[i];
+    producerList[i].count = itemCount;
+    consumerList[i].pQueue = ppQueueList[i];
+    consumerList[i].count = itemCount;
+    threadList[i * 2] = new Threads::Thread(producerList[i]);
+    threadList[i * 2 + 1] = new Threads::Thread(consumerList[i]);
+  }
+
+  E::Time::Timer t;
+  for (U32 i = 0; i < pairCount * 2; ++i) threadList[i]->Start();
+  for (U32 i = 0; i < pairCount * 2; ++i) threadList[i]->WaitForTermination();
+  F32 elapsed = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+  U64 checksum = 0;
+  ordered = true;
+  for (U32 i = 0; i < pairCount; ++i)
+  {
+    checksum += consumerList[i].checksum;
+    ordered = ordered && consumerList[i].ordered;
+    delete threadList[i * 2];
+    delete threadList[i * 2 + 1];
+  }
+  E_ASSERT(checksum == static_cast<U64>(pairCount) * itemCount * (itemCount + 1) / 2);
+
+  return elapsed;
+}
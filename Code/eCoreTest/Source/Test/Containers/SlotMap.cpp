@@ -0,0 +1,231 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file SlotMap.cpp
+This file defines E::Containers::SlotMap test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef TEST_SIZE
+#define TEST_SIZE 4096
+#endif
+
+#ifndef TEST_OBJECT_COUNT
+#define TEST_OBJECT_COUNT 10000
+#endif
+
+#ifndef TEST_CHURN_COUNT
+#define TEST_CHURN_COUNT 100000
+#endif
+
+#ifndef TEST_ITERATION_COUNT
+#define TEST_ITERATION_COUNT 1000
+#endif
+
+// Stands for a scene object instance: pointer sized values removed by value from a List (World::Unload approach)
+typedef I32* SlotMapTestObject;
+
+/*----------------------------------------------------------------------------------------------------------------------
+TestSlotMap methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::SlotMap::Run()
+{
+  try
+  {
+    std::cout << "[Test::SlotMap::Run] using array size of " << TEST_SIZE << std::endl;
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::SlotMap::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::SlotMap::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::SlotMap::RunFunctionalityTest()
+{
+  try
+  {
+    std::cout << "[Test::SlotMap::RunFunctionalityTest]" << std::endl;
+
+    /*-----------------------------------------------------------------
+    Insertion & access
+    -----------------------------------------------------------------*/
+    E::Containers::SlotMap<I32> slotMap;
+    E::Containers::List<E::Containers::SlotMapHandle> handleList(TEST_SIZE);
+    E_ASSERT(slotMap.IsEmpty() && !slotMap.IsValid(E::Containers::SlotMap<I32>::kInvalidHandle));
+
+    for (I32 i = 0; i < TEST_SIZE; ++i) handleList.PushBack(slotMap.Insert(i));
+    E_ASSERT(slotMap.GetCount() == TEST_SIZE);
+    for (I32 i = 0; i < TEST_SIZE; ++i)
+    {
+      E_ASSERT(handleList[i] != E::Containers::SlotMap<I32>::kInvalidHandle);
+      E_ASSERT(slotMap.IsValid(handleList[i]) && slotMap[handleList[i]] == i);
+    }
+
+    /*-----------------------------------------------------------------
+    Removal & stale handles
+    -----------------------------------------------------------------*/
+    for (I32 i = 0; i < TEST_SIZE; i += 2) E_ASSERT(slotMap.Remove(handleList[i]));
+    E_ASSERT(slotMap.GetCount() == TEST_SIZE / 2);
+    for (I32 i = 0; i < TEST_SIZE; i += 2)
+    {
+      E_ASSERT(!slotMap.IsValid(handleList[i]) && slotMap.Find(handleList[i]) == nullptr);
+      E_ASSERT(!slotMap.Remove(handleList[i]));
+    }
+    for (I32 i = 1; i < TEST_SIZE; i += 2) E_ASSERT(*slotMap.Find(handleList[i]) == i);
+
+    // Reused slots do not validate old handles
+    E::Containers::SlotMapHandle handle = slotMap.Insert(-1);
+    E_ASSERT(slotMap[handle] == -1);
+    for (I32 i = 0; i < TEST_SIZE; i += 2) E_ASSERT(!slotMap.IsValid(handleList[i]));
+
+    // Dense iteration & handle retrieval
+    I64 sum = 0;
+    for (auto value : slotMap) sum += value;
+    E_ASSERT(sum == static_cast<I64>(TEST_SIZE / 2) * (TEST_SIZE / 2) - 1);
+    for (size_t i = 0; i < slotMap.GetCount(); ++i) E_ASSERT(slotMap[slotMap.GetHandle(i)] == slotMap.GetPtr()[i]);
+
+    /*-----------------------------------------------------------------
+    Copy & clear
+    -----------------------------------------------------------------*/
+    E::Containers::SlotMap<I32> copySlotMap(slotMap);
+    E_ASSERT(copySlotMap.GetCount() == slotMap.GetCount() && copySlotMap[handle] == -1);
+    slotMap.Clear();
+    E_ASSERT(slotMap.IsEmpty() && !slotMap.IsValid(handle) && copySlotMap.IsValid(handle));
+    slotMap.Reserve(TEST_SIZE);
+    E_ASSERT(slotMap.GetSize() >= TEST_SIZE);
+
+    /*-----------------------------------------------------------------
+    Non-POD values
+    -----------------------------------------------------------------*/
+    E::Containers::SlotMap<E::StringBuffer> stringSlotMap;
+    E::Containers::SlotMapHandle handleA = stringSlotMap.Insert("a");
+    E::Containers::SlotMapHandle handleB = stringSlotMap.Insert("b");
+    E::Containers::SlotMapHandle handleC = stringSlotMap.Insert("c");
+    E_ASSERT(stringSlotMap.Remove(handleA));
+    E_ASSERT(stringSlotMap[handleB] == "b" && stringSlotMap[handleC] == "c");
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+bool Test::SlotMap::RunPerformanceTest()
+{
+  try
+  {
+    std::cout << "[Test::SlotMap::RunPerformanceTest]" << std::endl;
+    std::cout << "Objects: " << TEST_OBJECT_COUNT << " churn: " << TEST_CHURN_COUNT << " iterations: " << TEST_ITERATION_COUNT << std::endl << std::endl;
+
+    E::Time::Timer t;
+    I32 objects[TEST_OBJECT_COUNT];
+    for (I32 i = 0; i < TEST_OBJECT_COUNT; ++i) objects[i] = i;
+
+    // Random churn sequence: which object is unloaded and loaded again
+    E::Containers::List<U32> churnList(TEST_CHURN_COUNT);
+    Math::Global::GetRandom().SetSeed(120120);
+    for (U32 i = 0; i < TEST_CHURN_COUNT; ++i) churnList.PushBack(Math::Global::GetRandom().GetU32(TEST_OBJECT_COUNT));
+
+    /*-----------------------------------------------------------------
+    Churn (unload + load by object)
+    -----------------------------------------------------------------*/
+    E::Containers::List<SlotMapTestObject> objectList;
+    for (I32 i = 0; i < TEST_OBJECT_COUNT; ++i) objectList.PushBack(&objects[i]);
+
+    t.Reset();
+    for (U32 i = 0; i < TEST_CHURN_COUNT; ++i)
+    {
+      SlotMapTestObject pObject = &objects[churnList[i]];
+      // World::Load / World::Unload with a List (search by value)
+      objectList.RemoveIfFast(pObject);
+      if (objectList.FindValue(pObject) == nullptr) objectList.PushBack(pObject);
+    }
+    F32 listChurnTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+    E::Containers::SlotMap<SlotMapTestObject> objectSlotMap;
+    E::Containers::List<E::Containers::SlotMapHandle> handleList(TEST_OBJECT_COUNT);
+    for (I32 i = 0; i < TEST_OBJECT_COUNT; ++i) handleList.PushBack(objectSlotMap.Insert(&objects[i]));
+
+    t.Reset();
+    for (U32 i = 0; i < TEST_CHURN_COUNT; ++i)
+    {
+      U32 index = churnList[i];
+      objectSlotMap.Remove(handleList[index]);
+      handleList[index] = objectSlotMap.Insert(&objects[index]);
+    }
+    F32 slotMapChurnTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+    E_ASSERT(objectList.GetCount() == objectSlotMap.GetCount());
+    std::cout << "Churn time [" << slotMapChurnTime << " / " << listChurnTime << "]\t" << (listChurnTime / slotMapChurnTime * 100.0) - 100.0 << "% faster" << std::endl;
+
+    /*-----------------------------------------------------------------
+    Iteration
+    -----------------------------------------------------------------*/
+    I64 listChecksum = 0;
+    t.Reset();
+    for (U32 i = 0; i < TEST_ITERATION_COUNT; ++i)
+    {
+      for (auto it = begin(objectList); it != end(objectList); ++it) listChecksum += **it;
+    }
+    F32 listIterationTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+    I64 slotMapChecksum = 0;
+    t.Reset();
+    for (U32 i = 0; i < TEST_ITERATION_COUNT; ++i)
+    {
+      for (auto it = begin(objectSlotMap); it != end(objectSlotMap); ++it) slotMapChecksum += **it;
+    }
+    F32 slotMapIterationTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+    E_ASSERT(listChecksum == slotMapChecksum);
+    std::cout << "Iteration time [" << slotMapIterationTime << " / " << listIterationTime << "]\t" << (listIterationTime / slotMapIterationTime * 100.0) - 100.0 << "% faster" << std::endl;
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,290 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file E::Containers::SmallList.cpp
+This file defines E::Containers::SmallList test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef TEST_SIZE
+#define TEST_SIZE 4096
+#endif
+
+#ifndef TEST_SCENE_NODE_COUNT
+#define TEST_SCENE_NODE_COUNT 100000
+#endif
+
+#ifndef TEST_SCENE_UPDATE_COUNT
+#define TEST_SCENE_UPDATE_COUNT 100
+#endif
+
+class SmallListCountingAllocator : public Memory::IAllocator
+{
+public:
+  SmallListCountingAllocator() : mAllocationCount(0) {}
+
+  void* Allocate(size_t size, const Tag = IAllocator::eTagNew)
+  {
+    if (size) mAllocationCount++;
+    return Memory::Heap::Allocate(size);
+  }
+
+  void Deallocate(void* p, const Tag = IAllocator::eTagDelete)
+  {
+    Memory::Heap::Deallocate(p);
+  }
+
+  U32 GetAllocationCount() const { return mAllocationCount; }
+  void ResetAllocationCount() { mAllocationCount = 0; }
+
+private:
+  U32 mAllocationCount;
+};
+
+template <class ComponentList, class ChildrenList>
+struct SceneNode
+{
+  Matrix4f      worldMatrix;
+  ComponentList componentList;
+  ChildrenList  childrenList;
+};
+
+typedef SceneNode<Containers::List<I32*>, Containers::List<I32*>>               ListSceneNode;
+typedef SceneNode<Containers::SmallList<I32*, 2>, Containers::SmallList<I32*, 4>> SmallListSceneNode;
+
+template <class Node>
+void BuildScene(Containers::List<Node*>& nodeList, SmallListCountingAllocator& allocator, U32& allocationCount);
+template <class Node>
+void DestroyScene(Containers::List<Node*>& nodeList);
+template <class Node>
+F32 TimeSceneUpdate(Containers::List<Node*>& nodeList, I32& checksum);
+
+/*----------------------------------------------------------------------------------------------------------------------
+TestSmallList methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::SmallList::Run()
+{
+  try
+  {
+    std::cout << "[Test::SmallList::Run] using array size of " << TEST_SIZE << std::endl;
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::SmallList::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::SmallList::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::SmallList::RunFunctionalityTest()
+{
+  try
+  {
+    std::cout << "[Test::SmallList::RunFunctionalityTest]" << std::endl;
+
+    SmallListCountingAllocator allocator;
+
+    /*-----------------------------------------------------------------
+    Construction
+    -----------------------------------------------------------------*/
+    E::Containers::SmallList<I32, 4> intList;
+    E_ASSERT(intList.GetSize() == 4 && intList.GetCount() == 0 && intList.IsInline());
+    intList.SetAllocator(&allocator);
+
+    E::Containers::SmallList<I32, 4> preSizedIntList(TEST_SIZE);
+    E_ASSERT(preSizedIntList.GetSize() == TEST_SIZE && preSizedIntList.GetCount() == 0 && !preSizedIntList.IsInline());
+
+    /*-----------------------------------------------------------------
+    Inline storage & spilling
+    -----------------------------------------------------------------*/
+    for (I32 i = 0; i < 4; ++i) intList.PushBack(i);
+    E_ASSERT(intList.IsInline() && allocator.GetAllocationCount() == 0);
+    intList.PushBack(4);
+    E_ASSERT(!intList.IsInline() && allocator.GetAllocationCount() == 1);
+    for (I32 i = 0; i < 5; ++i) E_ASSERT(intList[i] == i);
+
+    // Range for loop
+    I32 sum = 0;
+    for (auto value : intList) sum += value;
+    E_ASSERT(sum == 10);
+
+    // Compact moves the elements back to the inline storage
+    intList.RemoveFast(intList.GetBegin());
+    E_ASSERT(intList.GetCount() == 4 && intList[0] == 4);
+    intList.Compact();
+    E_ASSERT(intList.IsInline() && intList.GetSize() == 4);
+    E_ASSERT(intList.HasValue(1) && intList.HasValue(2) && intList.HasValue(3) && intList.HasValue(4));
+
+    /*-----------------------------------------------------------------
+    Copy
+    -----------------------------------------------------------------*/
+    for (I32 i = 5; i < TEST_SIZE; ++i) intList.PushBack(i);
+    E::Containers::SmallList<I32, 4> copyIntList(intList);
+    E_ASSERT(copyIntList.GetCount() == intList.GetCount() && copyIntList.GetPtr() != intList.GetPtr());
+    for (size_t i = 0; i < intList.GetCount(); ++i) E_ASSERT(copyIntList[i] == intList[i]);
+    E::Containers::SmallList<I32, 4> assignedIntList;
+    assignedIntList = intList;
+    E_ASSERT(assignedIntList.GetCount() == intList.GetCount());
+
+    /*-----------------------------------------------------------------
+    Removal
+    -----------------------------------------------------------------*/
+    E_ASSERT(intList.RemoveIf(TEST_SIZE - 1));
+    E_ASSERT(!intList.RemoveIfFast(TEST_SIZE - 1));
+    E_ASSERT(intList.FindIndex(5) == 4);
+    intList.RemoveIndex(0);
+    E_ASSERT(intList.FindIndex(5) == 3);
+    intList.InsertAt(-1, 0);
+    E_ASSERT(intList[0] == -1 && intList.FindIndex(5) == 4);
+    intList.Trim(2);
+    E_ASSERT(intList.GetCount() == 2);
+    intList.Clear();
+    E_ASSERT(intList.IsEmpty());
+    intList.Resize(0);
+    E_ASSERT(intList.IsInline() && intList.GetSize() == 4);
+
+    /*-----------------------------------------------------------------
+    Non-POD values
+    -----------------------------------------------------------------*/
+    E::Containers::SmallList<E::StringBuffer, 2> stringList;
+    stringList.PushBack("a");
+    stringList.PushBack("b");
+    stringList.PushBack("c");
+    E_ASSERT(!stringList.IsInline() && stringList[2] == "c");
+    stringList.RemoveIndexFast(0);
+    E_ASSERT(stringList[0] == "c" && stringList.GetCount() == 2);
+    stringList.Compact();
+    E_ASSERT(stringList.IsInline() && stringList[1] == "b");
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+bool Test::SmallList::RunPerformanceTest()
+{
+  try
+  {
+    std::cout << "[Test::SmallList::RunPerformanceTest]" << std::endl;
+    std::cout << "Scene nodes: " << TEST_SCENE_NODE_COUNT << " updates: " << TEST_SCENE_UPDATE_COUNT << std::endl << std::endl;
+
+    SmallListCountingAllocator allocator;
+    U32 allocationCount = 0;
+    U32 smallAllocationCount = 0;
+    I32 checksum = 0;
+    I32 smallChecksum = 0;
+
+    Containers::List<ListSceneNode*> nodeList;
+    BuildScene(nodeList, allocator, allocationCount);
+    F32 updateTime = TimeSceneUpdate(nodeList, checksum);
+    DestroyScene(nodeList);
+
+    Containers::List<SmallListSceneNode*> smallNodeList;
+    BuildScene(smallNodeList, allocator, smallAllocationCount);
+    F32 smallUpdateTime = TimeSceneUpdate(smallNodeList, smallChecksum);
+    DestroyScene(smallNodeList);
+
+    E_ASSERT(checksum == smallChecksum);
+    std::cout << "Allocations [" << smallAllocationCount << " / " << allocationCount << "]" << std::endl;
+    std::cout << "Update time [" << smallUpdateTime << " / " << updateTime << "]\t" << (updateTime / smallUpdateTime * 100.0) - 100.0 << "% faster" << std::endl;
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <class Node>
+void BuildScene(Containers::List<Node*>& nodeList, SmallListCountingAllocator& allocator, U32& allocationCount)
+{
+  static I32 sComponent = 1;
+  static I32 sChild = 2;
+
+  Math::Global::GetRandom().SetSeed(120120);
+  nodeList.Reserve(TEST_SCENE_NODE_COUNT);
+  allocator.ResetAllocationCount();
+  for (U32 i = 0; i < TEST_SCENE_NODE_COUNT; ++i)
+  {
+    Node* pNode = new Node();
+    pNode->componentList.SetAllocator(&allocator);
+    pNode->childrenList.SetAllocator(&allocator);
+    // Most scene objects hold one or two components and a few children
+    U32 componentCount = Math::Global::GetRandom().GetU32(3);
+    U32 childCount = Math::Global::GetRandom().GetU32(5);
+    for (U32 j = 0; j < componentCount; ++j) pNode->componentList.PushBack(&sComponent);
+    for (U32 j = 0; j < childCount; ++j) pNode->childrenList.PushBack(&sChild);
+    nodeList.PushBack(pNode);
+  }
+  allocationCount = allocator.GetAllocationCount();
+}
+
+template <class Node>
+void DestroyScene(Containers::List<Node*>& nodeList)
+{
+  for (auto it = begin(nodeList); it != end(nodeList); ++it) delete *it;
+  nodeList.Clear();
+}
+
+template <class Node>
+F32 TimeSceneUpdate(Containers::List<Node*>& nodeList, I32& checksum)
+{
+  E::Time::Timer t;
+  for (U32 i = 0; i < TEST_SCENE_UPDATE_COUNT; ++i)
+  {
+    for (auto it = begin(nodeList); it != end(nodeList); ++it)
+    {
+      Node* pNode = *it;
+      for (auto cit = begin(pNode->componentList); cit != end(pNode->componentList); ++cit) checksum += **cit;
+      for (auto cit = begin(pNode->childrenList); cit != end(pNode->childrenList); ++cit) checksum += **cit;
+    }
+  }
+
+  return static_cast<F32>(t.GetElapsed().GetMilliseconds());
+}
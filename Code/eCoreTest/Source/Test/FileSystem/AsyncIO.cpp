@@ -0,0 +1,300 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file AsyncIO.cpp
+This file defines AsyncIO test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+using namespace std;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Test macros
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Stands for the functionality test file size in bytes
+#define TEST_ASYNC_IO_FILE_SIZE 1048576
+// Stands for the performance test small file count and size in bytes
+#define TEST_ASYNC_IO_SMALL_FILE_COUNT 10000
+#define TEST_ASYNC_IO_SMALL_FILE_SIZE 4096
+// Stands for the performance test large file count and size in bytes
+#define TEST_ASYNC_IO_LARGE_FILE_COUNT 4
+#define TEST_ASYNC_IO_LARGE_FILE_SIZE 67108864
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+class AsyncIOTestHandler : public EventSystem::IEventHandler, public FileSystem::AsyncIO::ICompletionHandler
+{
+public:
+  U64 readSize;
+  U32 eventCount;
+  U32 failedEventCount;
+  U32 handledRequestCount;
+
+  AsyncIOTestHandler()
+    : readSize(0)
+    , eventCount(0)
+    , failedEventCount(0)
+    , handledRequestCount(0) {}
+
+  // Called by AsyncIO::Dispatch
+  void OnEvent(const FileSystem::AsyncIO::CompletionEvent& event)
+  {
+    readSize += event.size;
+    ++eventCount;
+    if (!event.succeeded) ++failedEventCount;
+  }
+
+  // Called on the I/O thread (only used by a single request at a time)
+  void OnRequestCompletion(const FileSystem::AsyncIO::CompletionEvent& event)
+  {
+    if (event.succeeded) ++handledRequestCount;
+  }
+};
+
+inline FilePath GetAsyncIOTestFilePath(const char* pName, U32 index)
+{
+  FilePath filePath;
+  filePath.Print("../../../Bin/AsyncIO/%s%u.bin", pName, index);
+  return filePath;
+}
+
+inline U64 GetChecksum(const Byte* pData, size_t size)
+{
+  U64 checksum = 0;
+  for (size_t i = 0; i < size; ++i) checksum += pData[i];
+  return checksum;
+}
+
+inline F32 GetMegabytesPerSecond(size_t size, const E::Time::Timer& t)
+{
+  D64 seconds = Math::Max(t.GetElapsed().GetMilliseconds(), 1e-3) / 1000.0;
+  return static_cast<F32>(size / (1024.0 * 1024.0) / seconds);
+}
+
+inline void WriteAsyncIOTestFile(const FilePath& filePath, size_t size, U32 seed)
+{
+  E::Containers::List<char> data(size);
+  data.SetCount(size);
+  for (size_t i = 0; i < size; ++i) data[i] = static_cast<char>(i * 7 + seed);
+  FileSystem::Archive archive;
+  archive.Open(filePath, FileSystem::Archive::eOpenModeWrite);
+  archive.Write(data.GetPtr(), size);
+  archive.Close();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Test functions
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::AsyncIO::Run()
+{
+  try
+  {
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::AsyncIO::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::AsyncIO::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::AsyncIO::RunFunctionalityTest()
+{
+  std::cout << "[Test::AsyncIO::RunFunctionalityTest]" << std::endl;
+
+  FileSystem::Directory::Create("../../../Bin/AsyncIO");
+  const FilePath filePath = GetAsyncIOTestFilePath("functionalityFile", 0);
+  WriteAsyncIOTestFile(filePath, TEST_ASYNC_IO_FILE_SIZE, 0);
+
+  AsyncIOTestHandler handler;
+  FileSystem::AsyncIO asyncIO(2);
+  asyncIO.GetCompletionEventCallback() += &handler;
+
+  E::Containers::List<Byte> fileBuffer(TEST_ASYNC_IO_FILE_SIZE);
+  fileBuffer.SetCount(TEST_ASYNC_IO_FILE_SIZE);
+  E::Containers::List<Byte> chunkBuffer(TEST_ASYNC_IO_FILE_SIZE);
+  chunkBuffer.SetCount(TEST_ASYNC_IO_FILE_SIZE);
+  E::Containers::List<Byte> duplicateBuffer(TEST_ASYNC_IO_FILE_SIZE / 16);
+  duplicateBuffer.SetCount(TEST_ASYNC_IO_FILE_SIZE / 16);
+  Byte tailBuffer[256];
+
+  // Whole file read (handled on the I/O thread as well)
+  FileSystem::AsyncIO::Request request;
+  request.filePath = filePath;
+  request.pBuffer = fileBuffer.GetPtr();
+  request.size = TEST_ASYNC_IO_FILE_SIZE;
+  request.pHandler = &handler;
+  asyncIO.AddRequest(request);
+  request.pHandler = nullptr;
+
+  // Chunk reads to the same file in reverse order and with different priorities (coalesced while pending)
+  const size_t chunkSize = TEST_ASYNC_IO_FILE_SIZE / 16;
+  for (size_t i = 16; i > 0; --i)
+  {
+    request.pBuffer = chunkBuffer.GetPtr() + (i - 1) * chunkSize;
+    request.offset = (i - 1) * chunkSize;
+    request.size = chunkSize;
+    request.priority = static_cast<FileSystem::AsyncIO::Priority>(i % FileSystem::AsyncIO::ePriorityCount);
+    asyncIO.AddRequest(request);
+  }
+  // Same range as the first chunk (read once if coalesced)
+  request.pBuffer = duplicateBuffer.GetPtr();
+  request.offset = 0;
+  asyncIO.AddRequest(request);
+  // Read past the end of the file (completes with the available bytes)
+  request.pBuffer = tailBuffer;
+  request.offset = TEST_ASYNC_IO_FILE_SIZE - 100;
+  request.size = sizeof(tailBuffer);
+  asyncIO.AddRequest(request);
+  // Missing file (fails)
+  request.filePath = "SomeFakePath/SomeFakeFile.bin";
+  request.offset = 0;
+  asyncIO.AddRequest(request);
+
+  asyncIO.WaitForIdle();
+  E_ASSERT(asyncIO.GetPendingRequestCount() == 0);
+  E_ASSERT(handler.handledRequestCount == 1);
+  E_ASSERT(asyncIO.Dispatch() == 20);
+  E_ASSERT(asyncIO.Dispatch() == 0);
+  E_ASSERT(handler.eventCount == 20 && handler.failedEventCount == 1);
+  E_ASSERT(handler.readSize == TEST_ASYNC_IO_FILE_SIZE * 2 + chunkSize + 100);
+
+  for (size_t i = 0; i < TEST_ASYNC_IO_FILE_SIZE; ++i)
+  {
+    E_ASSERT(fileBuffer[i] == static_cast<Byte>(i * 7));
+    E_ASSERT(chunkBuffer[i] == static_cast<Byte>(i * 7));
+  }
+  for (size_t i = 0; i < chunkSize; ++i) E_ASSERT(duplicateBuffer[i] == static_cast<Byte>(i * 7));
+  for (size_t i = 0; i < 100; ++i) E_ASSERT(tailBuffer[i] == static_cast<Byte>((TEST_ASYNC_IO_FILE_SIZE - 100 + i) * 7));
+
+  asyncIO.GetCompletionEventCallback() -= &handler;
+  FileSystem::File::Destroy(filePath);
+
+  return true;
+}
+
+bool Test::AsyncIO::RunPerformanceTest()
+{
+  std::cout << "[Test::AsyncIO::RunPerformanceTest]" << std::endl;
+
+  // Freshly written (and therefore cached) files
+  FileSystem::Directory::Create("../../../Bin/AsyncIO");
+  for (U32 i = 0; i < TEST_ASYNC_IO_SMALL_FILE_COUNT; ++i) WriteAsyncIOTestFile(GetAsyncIOTestFilePath("smallFile", i), TEST_ASYNC_IO_SMALL_FILE_SIZE, i);
+  for (U32 i = 0; i < TEST_ASYNC_IO_LARGE_FILE_COUNT; ++i) WriteAsyncIOTestFile(GetAsyncIOTestFilePath("largeFile", i), TEST_ASYNC_IO_LARGE_FILE_SIZE, i);
+
+  const size_t smallSize = TEST_ASYNC_IO_SMALL_FILE_COUNT * TEST_ASYNC_IO_SMALL_FILE_SIZE;
+  const size_t largeSize = static_cast<size_t>(TEST_ASYNC_IO_LARGE_FILE_COUNT) * TEST_ASYNC_IO_LARGE_FILE_SIZE;
+  E::Containers::List<Byte> smallBuffer(smallSize);
+  smallBuffer.SetCount(smallSize);
+  E::Containers::List<Byte> largeBuffer(largeSize);
+  largeBuffer.SetCount(largeSize);
+  Memory::Zero(smallBuffer.GetPtr(), smallSize);
+  Memory::Zero(largeBuffer.GetPtr(), largeSize);
+
+  std::cout << std::endl;
+  E::Time::Timer t;
+
+  // Synchronous Archive reads on the calling thread
+  FileSystem::Archive archive;
+  for (U32 i = 0; i < TEST_ASYNC_IO_SMALL_FILE_COUNT; ++i)
+  {
+    archive.Open(GetAsyncIOTestFilePath("smallFile", i));
+    archive.Read(reinterpret_cast<char*>(smallBuffer.GetPtr() + i * TEST_ASYNC_IO_SMALL_FILE_SIZE), TEST_ASYNC_IO_SMALL_FILE_SIZE);
+    archive.Close();
+  }
+  std::cout << "Archive " << TEST_ASYNC_IO_SMALL_FILE_COUNT << " small files: " << GetMegabytesPerSecond(smallSize, t) << " MB/s" << std::endl;
+  const U64 smallChecksum = GetChecksum(smallBuffer.GetPtr(), smallSize);
+  t.Reset();
+  for (U32 i = 0; i < TEST_ASYNC_IO_LARGE_FILE_COUNT; ++i)
+  {
+    archive.Open(GetAsyncIOTestFilePath("largeFile", i));
+    archive.Read(reinterpret_cast<char*>(largeBuffer.GetPtr() + static_cast<size_t>(i) * TEST_ASYNC_IO_LARGE_FILE_SIZE), TEST_ASYNC_IO_LARGE_FILE_SIZE);
+    archive.Close();
+  }
+  std::cout << "Archive " << TEST_ASYNC_IO_LARGE_FILE_COUNT << " large files: " << GetMegabytesPerSecond(largeSize, t) << " MB/s" << std::endl;
+  const U64 largeChecksum = GetChecksum(largeBuffer.GetPtr(), largeSize);
+
+  // Concurrent AsyncIO reads (the large file chunks are coalesced into a request group per file)
+  Memory::Zero(smallBuffer.GetPtr(), smallSize);
+  Memory::Zero(largeBuffer.GetPtr(), largeSize);
+  AsyncIOTestHandler handler;
+  FileSystem::AsyncIO asyncIO;
+  asyncIO.GetCompletionEventCallback() += &handler;
+  std::cout << "AsyncIO threads: " << asyncIO.GetThreadCount() << std::endl;
+
+  t.Reset();
+  FileSystem::AsyncIO::Request request;
+  request.size = TEST_ASYNC_IO_SMALL_FILE_SIZE;
+  for (U32 i = 0; i < TEST_ASYNC_IO_SMALL_FILE_COUNT; ++i)
+  {
+    request.filePath = GetAsyncIOTestFilePath("smallFile", i);
+    request.pBuffer = smallBuffer.GetPtr() + i * TEST_ASYNC_IO_SMALL_FILE_SIZE;
+    asyncIO.AddRequest(request);
+  }
+  asyncIO.WaitForIdle();
+  asyncIO.Dispatch();
+  std::cout << "AsyncIO " << TEST_ASYNC_IO_SMALL_FILE_COUNT << " small files: " << GetMegabytesPerSecond(smallSize, t) << " MB/s" << std::endl;
+  E_ASSERT(GetChecksum(smallBuffer.GetPtr(), smallSize) == smallChecksum);
+
+  t.Reset();
+  const size_t chunkSize = TEST_ASYNC_IO_LARGE_FILE_SIZE / 16;
+  request.size = chunkSize;
+  for (U32 i = 0; i < TEST_ASYNC_IO_LARGE_FILE_COUNT; ++i)
+  {
+    request.filePath = GetAsyncIOTestFilePath("largeFile", i);
+    for (size_t j = 0; j < 16; ++j)
+    {
+      request.pBuffer = largeBuffer.GetPtr() + static_cast<size_t>(i) * TEST_ASYNC_IO_LARGE_FILE_SIZE + j * chunkSize;
+      request.offset = j * chunkSize;
+      asyncIO.AddRequest(request);
+    }
+  }
+  asyncIO.WaitForIdle();
+  asyncIO.Dispatch();
+  std::cout << "AsyncIO " << TEST_ASYNC_IO_LARGE_FILE_COUNT << " large files: " << GetMegabytesPerSecond(largeSize, t) << " MB/s" << std::endl;
+  E_ASSERT(GetChecksum(largeBuffer.GetPtr(), largeSize) == largeChecksum);
+  E_ASSERT(handler.failedEventCount == 0 && handler.readSize == smallSize + largeSize);
+
+  asyncIO.GetCompletionEventCallback() -= &handler;
+  for (U32 i = 0; i < TEST_ASYNC_IO_SMALL_FILE_COUNT; ++i) FileSystem::File::Destroy(GetAsyncIOTestFilePath("smallFile", i));
+  for (U32 i = 0; i < TEST_ASYNC_IO_LARGE_FILE_COUNT; ++i) FileSystem::File::Destroy(GetAsyncIOTestFilePath("largeFile", i));
+  FileSystem::Directory::Destroy("../../../Bin/AsyncIO");
+
+  return true;
+}
@@ -0,0 +1,325 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 19-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file DerivedDataCache.cpp
+This file defines DerivedDataCache test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+using namespace std;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Test macros
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Stands for the test cache directory path and the test source (asset) directory path
+#define TEST_DERIVED_DATA_CACHE_PATH "../../../Bin/DerivedDataCache"
+#define TEST_DERIVED_DATA_CACHE_SOURCE_PATH "../../../Bin/DerivedDataCacheSource"
+// Stands for the performance test asset count and grid size (a (size + 1) x (size + 1) vertex grid per asset)
+#define TEST_DERIVED_DATA_CACHE_ASSET_COUNT 16
+#define TEST_DERIVED_DATA_CACHE_GRID_SIZE 128
+#define TEST_DERIVED_DATA_CACHE_MAX_SIZE (64 << 20)
+
+// Stands for the processing string of the test assets (processing name, version and parameters)
+static const char kDerivedDataCacheTestProcessing[] = "MeshOptimizer|v1|cache=16|lod=0.5";
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline FilePath GetDerivedDataCacheTestPath(const char* pDirectory, U32 index)
+{
+  FilePath filePath;
+  filePath.Print("%s/asset%u.bin", pDirectory, index);
+  return filePath;
+}
+
+inline void GetDerivedDataCacheTestData(Containers::List<Byte>& data, size_t size)
+{
+  data.EnsureSize(size);
+  data.SetCount(size);
+  for (size_t i = 0; i < size; ++i) data[i] = static_cast<Byte>(Math::Global::GetRandom().GetU32(256));
+}
+
+inline bool IsDerivedDataCacheTestDataEqual(const Containers::List<Byte>& a, const Containers::List<Byte>& b)
+{
+  return a.GetCount() == b.GetCount() && (a.IsEmpty() || memcmp(a.GetPtr(), b.GetPtr(), a.GetCount()) == 0);
+}
+
+inline void WriteDerivedDataCacheTestFile(const FilePath& filePath, const Containers::List<Byte>& data)
+{
+  FileSystem::Archive archive;
+  archive.Open(filePath, FileSystem::Archive::eOpenModeWrite);
+  archive.Write(reinterpret_cast<const char*>(data.GetPtr()), data.GetCount());
+  archive.Close();
+}
+
+// Creates an asset source file: a height field grid (random heights) stored as its vertex count, index count,
+// positions and indices
+void CreateDerivedDataCacheTestAsset(Containers::List<Byte>& data, U32 size)
+{
+  const U32 vertexCount = (size + 1) * (size + 1);
+  const U32 indexCount = size * size * 6;
+  data.EnsureSize(2 * sizeof(U32) + vertexCount * sizeof(Vector3f) + indexCount * sizeof(U32));
+  data.SetCount(data.GetSize());
+  U32* pCounts = reinterpret_cast<U32*>(data.GetPtr());
+  Vector3f* pPositions = reinterpret_cast<Vector3f*>(pCounts + 2);
+  U32* pIndices = reinterpret_cast<U32*>(pPositions + vertexCount);
+  pCounts[0] = vertexCount;
+  pCounts[1] = indexCount;
+  for (U32 i = 0; i <= size; ++i)
+  {
+    for (U32 j = 0; j <= size; ++j)
+    {
+      pPositions[i * (size + 1) + j] = Vector3f(static_cast<F32>(j), Math::Global::GetRandom().GetF32() * 0.1f, static_cast<F32>(i));
+    }
+  }
+  for (U32 i = 0; i < size; ++i)
+  {
+    for (U32 j = 0; j < size; ++j)
+    {
+      const U32 a = i * (size + 1) + j;
+      const U32 b = a + size + 1;
+      *pIndices++ = a; *pIndices++ = b; *pIndices++ = a + 1;
+      *pIndices++ = a + 1; *pIndices++ = b; *pIndices++ = b + 1;
+    }
+  }
+}
+
+// Stands for the expensive asset processing: vertex cache optimization and a half resolution level of detail, stored as
+// the LOD index count followed by both index lists
+void ProcessDerivedDataCacheTestAsset(const Containers::List<Byte>& sourceData, Containers::List<Byte>& derivedData)
+{
+  const U32* pCounts = reinterpret_cast<const U32*>(sourceData.GetPtr());
+  const Vector3f* pPositions = reinterpret_cast<const Vector3f*>(pCounts + 2);
+  const U32* pIndices = reinterpret_cast<const U32*>(pPositions + pCounts[0]);
+  const U32 vertexCount = pCounts[0];
+  const U32 indexCount = pCounts[1];
+
+  derivedData.EnsureSize(sizeof(U32) + 2 * indexCount * sizeof(U32));
+  derivedData.SetCount(derivedData.GetSize());
+  U32* pLodIndexCount = reinterpret_cast<U32*>(derivedData.GetPtr());
+  U32* pOptimizedIndices = pLodIndexCount + 1;
+  U32* pLodIndices = pOptimizedIndices + indexCount;
+  Math::MeshOptimizer::OptimizeVertexCache(pOptimizedIndices, pIndices, indexCount, vertexCount);
+  *pLodIndexCount = Math::MeshOptimizer::Simplify(pLodIndices, pOptimizedIndices, indexCount, pPositions, vertexCount, indexCount / 2);
+  derivedData.SetCount(sizeof(U32) + (indexCount + *pLodIndexCount) * sizeof(U32));
+}
+
+// Loads the test assets the way an engine loader would (looking the derived data up in the cache before processing)
+// and gets the derived data hash of every asset
+void LoadDerivedDataCacheTestAssets(FileSystem::DerivedDataCache& cache, Containers::List<U64>& hashList, U32& processedCount)
+{
+  Containers::List<Byte> sourceData;
+  Containers::List<Byte> derivedData;
+  FileSystem::VirtualFileSystem vfs;
+  hashList.Clear();
+  processedCount = 0;
+  for (U32 i = 0; i < TEST_DERIVED_DATA_CACHE_ASSET_COUNT; ++i)
+  {
+    E_ASSERT(vfs.Read(GetDerivedDataCacheTestPath(TEST_DERIVED_DATA_CACHE_SOURCE_PATH, i), sourceData));
+    const U64 key = FileSystem::DerivedDataCache::GetKey(sourceData.GetPtr(), sourceData.GetCount(), kDerivedDataCacheTestProcessing);
+    if (!cache.Get(key, derivedData))
+    {
+      ProcessDerivedDataCacheTestAsset(sourceData, derivedData);
+      cache.Put(key, derivedData.GetPtr(), derivedData.GetCount());
+      ++processedCount;
+    }
+    hashList.PushBack(Math::XxHash64::Hash(derivedData.GetPtr(), derivedData.GetCount()));
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Test functions
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::DerivedDataCache::Run()
+{
+  try
+  {
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::DerivedDataCache::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::DerivedDataCache::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::DerivedDataCache::RunFunctionalityTest()
+{
+  std::cout << "[Test::DerivedDataCache::RunFunctionalityTest]" << std::endl;
+
+  // Keys depend on both the source data and the processing
+  Containers::List<Byte> sourceData;
+  GetDerivedDataCacheTestData(sourceData, 1000);
+  const U64 key = FileSystem::DerivedDataCache::GetKey(sourceData.GetPtr(), sourceData.GetCount(), "Test|v1");
+  E_ASSERT(key == FileSystem::DerivedDataCache::GetKey(sourceData.GetPtr(), sourceData.GetCount(), "Test|v1"));
+  E_ASSERT(key != FileSystem::DerivedDataCache::GetKey(sourceData.GetPtr(), sourceData.GetCount(), "Test|v2"));
+  E_ASSERT(key != FileSystem::DerivedDataCache::GetKey(sourceData.GetPtr(), sourceData.GetCount() - 1, "Test|v1"));
+
+  // Closed caches miss
+  FileSystem::DerivedDataCache cache;
+  Containers::List<Byte> data;
+  E_ASSERT(!cache.IsOpen());
+  E_ASSERT(!cache.Put(key, sourceData.GetPtr(), sourceData.GetCount()));
+  E_ASSERT(!cache.Get(key, data));
+
+  // Put & get (3 entries of 1000 bytes in a 3000 byte cache)
+  Containers::List<Byte> data1, data2, data3, data4;
+  GetDerivedDataCacheTestData(data1, 1000);
+  GetDerivedDataCacheTestData(data2, 1000);
+  GetDerivedDataCacheTestData(data3, 1000);
+  GetDerivedDataCacheTestData(data4, 1000);
+  E_ASSERT(cache.Open(TEST_DERIVED_DATA_CACHE_PATH, 3000));
+  E_ASSERT(cache.IsOpen() && cache.GetCount() == 0 && cache.GetSize() == 0);
+  E_ASSERT(!cache.Get(1, data));
+  E_ASSERT(cache.Put(1, data1.GetPtr(), data1.GetCount()));
+  E_ASSERT(cache.Put(2, data2.GetPtr(), data2.GetCount()));
+  E_ASSERT(cache.Put(3, data3.GetPtr(), data3.GetCount()));
+  E_ASSERT(cache.GetCount() == 3 && cache.GetSize() == 3000);
+  E_ASSERT(cache.Get(2, data) && IsDerivedDataCacheTestDataEqual(data, data2));
+  E_ASSERT(cache.Get(1, data) && IsDerivedDataCacheTestDataEqual(data, data1));
+  // Entries larger than the cache are not stored
+  Containers::List<Byte> largeData;
+  GetDerivedDataCacheTestData(largeData, 4000);
+  E_ASSERT(!cache.Put(5, largeData.GetPtr(), largeData.GetCount()));
+
+  // LRU eviction (3 is the least recently used entry)
+  E_ASSERT(cache.Put(4, data4.GetPtr(), data4.GetCount()));
+  E_ASSERT(cache.GetCount() == 3 && cache.GetSize() == 3000);
+  E_ASSERT(!cache.Contains(3) && !cache.Get(3, data));
+  E_ASSERT(cache.Contains(1) && cache.Contains(2) && cache.Contains(4));
+  // Replacing an entry
+  E_ASSERT(cache.Put(2, data3.GetPtr(), 500));
+  E_ASSERT(cache.GetCount() == 3 && cache.GetSize() == 2500);
+  E_ASSERT(cache.Get(2, data) && data.GetCount() == 500 && memcmp(data.GetPtr(), data3.GetPtr(), 500) == 0);
+  // Empty entries
+  E_ASSERT(cache.Put(6, nullptr, 0));
+  E_ASSERT(cache.Get(6, data) && data.IsEmpty());
+
+  // Integrity (a damaged entry is a miss and it is removed)
+  FilePath entryPath;
+  entryPath.Print("%s/%s%s", TEST_DERIVED_DATA_CACHE_PATH, "0000000000000004", FileSystem::DerivedDataCache::kExtension);
+  E_ASSERT(FileSystem::File::Exists(entryPath));
+  FileSystem::VirtualFileSystem vfs;
+  Containers::List<Byte> entryData;
+  E_ASSERT(vfs.Read(entryPath, entryData));
+  entryData[entryData.GetCount() - 500] ^= 0xff;
+  WriteDerivedDataCacheTestFile(entryPath, entryData);
+  E_ASSERT(!cache.Get(4, data));
+  E_ASSERT(!cache.Contains(4) && !FileSystem::File::Exists(entryPath));
+
+  // Index persistence (the last use order survives Close / Open)
+  E_ASSERT(cache.Put(4, data4.GetPtr(), data4.GetCount()));
+  E_ASSERT(cache.Get(1, data));
+  cache.Close();
+  E_ASSERT(!cache.IsOpen() && !cache.Contains(1));
+  E_ASSERT(cache.Open(TEST_DERIVED_DATA_CACHE_PATH, 3000));
+  E_ASSERT(cache.GetCount() == 4 && cache.GetSize() == 2500);
+  E_ASSERT(cache.Get(1, data) && IsDerivedDataCacheTestDataEqual(data, data1));
+  E_ASSERT(cache.Put(3, data3.GetPtr(), data3.GetCount()));
+  E_ASSERT(!cache.Contains(2) && cache.Contains(1) && cache.Contains(3) && cache.Contains(4));
+
+  // Index rebuilding (a cache that was not closed is rebuilt from its entry files)
+  FileSystem::DerivedDataCache otherCache;
+  E_ASSERT(otherCache.Open(TEST_DERIVED_DATA_CACHE_PATH, 3000));
+  E_ASSERT(otherCache.GetCount() == 4 && otherCache.GetSize() == 3000);
+  E_ASSERT(otherCache.Get(3, data) && IsDerivedDataCacheTestDataEqual(data, data3));
+  // Lower maximum sizes evict on Open
+  otherCache.Close();
+  E_ASSERT(otherCache.Open(TEST_DERIVED_DATA_CACHE_PATH, 1000));
+  E_ASSERT(otherCache.GetSize() <= 1000 && otherCache.Contains(3));
+  // Cache directories can not be files
+  entryPath.Print("%s/%s%s", TEST_DERIVED_DATA_CACHE_PATH, "0000000000000003", FileSystem::DerivedDataCache::kExtension);
+  E_ASSERT(!cache.Open(entryPath, 1000) && !cache.IsOpen());
+  E_ASSERT(otherCache.Remove(3) && !otherCache.Remove(3));
+
+  // Cleanup
+  otherCache.Close();
+  FileSystem::PathList pathList;
+  FileSystem::Directory::GetChildren(TEST_DERIVED_DATA_CACHE_PATH, pathList, FileSystem::File::eFlagFile);
+  for (size_t i = 0; i < pathList.GetCount(); ++i) FileSystem::File::Destroy(pathList[i]);
+  FileSystem::Directory::Destroy(TEST_DERIVED_DATA_CACHE_PATH);
+
+  return true;
+}
+
+bool Test::DerivedDataCache::RunPerformanceTest()
+{
+  std::cout << "[Test::DerivedDataCache::RunPerformanceTest]" << std::endl;
+
+  FileSystem::Directory::Create(TEST_DERIVED_DATA_CACHE_SOURCE_PATH);
+  Containers::List<Byte> sourceData;
+  for (U32 i = 0; i < TEST_DERIVED_DATA_CACHE_ASSET_COUNT; ++i)
+  {
+    CreateDerivedDataCacheTestAsset(sourceData, TEST_DERIVED_DATA_CACHE_GRID_SIZE);
+    WriteDerivedDataCacheTestFile(GetDerivedDataCacheTestPath(TEST_DERIVED_DATA_CACHE_SOURCE_PATH, i), sourceData);
+  }
+
+  // The cold run processes every asset (empty cache) and the second run, a new start up (the cache is closed and
+  // opened again), gets every asset from the cache
+  Containers::List<U64> coldHashList;
+  Containers::List<U64> warmHashList;
+  FileSystem::DerivedDataCache cache;
+  U32 processedCount = 0;
+
+  std::cout << std::endl;
+  E::Time::Timer t;
+  E_ASSERT(cache.Open(TEST_DERIVED_DATA_CACHE_PATH, TEST_DERIVED_DATA_CACHE_MAX_SIZE));
+  LoadDerivedDataCacheTestAssets(cache, coldHashList, processedCount);
+  cache.Close();
+  const D64 coldTime = t.GetElapsed().GetMilliseconds();
+  E_ASSERT(processedCount == TEST_DERIVED_DATA_CACHE_ASSET_COUNT);
+  std::cout << "Cold run (" << TEST_DERIVED_DATA_CACHE_ASSET_COUNT << " assets processed): " << coldTime << " ms" << std::endl;
+
+  t.Reset();
+  E_ASSERT(cache.Open(TEST_DERIVED_DATA_CACHE_PATH, TEST_DERIVED_DATA_CACHE_MAX_SIZE));
+  LoadDerivedDataCacheTestAssets(cache, warmHashList, processedCount);
+  const D64 warmTime = t.GetElapsed().GetMilliseconds();
+  E_ASSERT(processedCount == 0);
+  for (U32 i = 0; i < TEST_DERIVED_DATA_CACHE_ASSET_COUNT; ++i) E_ASSERT(coldHashList[i] == warmHashList[i]);
+  std::cout << "Second run (" << cache.GetCount() << " assets cached, " << cache.GetSize() << " bytes): " << warmTime << " ms (x" << coldTime / Math::Max(warmTime, 1e-3) << ")" << std::endl;
+
+  cache.Close();
+  FileSystem::PathList pathList;
+  FileSystem::Directory::GetChildren(TEST_DERIVED_DATA_CACHE_PATH, pathList, FileSystem::File::eFlagFile);
+  FileSystem::Directory::GetChildren(TEST_DERIVED_DATA_CACHE_SOURCE_PATH, pathList, FileSystem::File::eFlagFile);
+  for (size_t i = 0; i < pathList.GetCount(); ++i) FileSystem::File::Destroy(pathList[i]);
+  FileSystem::Directory::Destroy(TEST_DERIVED_DATA_CACHE_PATH);
+  FileSystem::Directory::Destroy(TEST_DERIVED_DATA_CACHE_SOURCE_PATH);
+
+  return true;
+}
@@ -0,0 +1,280 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 19-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file DirectoryScanner.cpp
+This file defines DirectoryScanner test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+using namespace std;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Test macros
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Stands for the test directory path
+#define TEST_DIRECTORY_SCANNER_PATH "../../../Bin/DirectoryScanner"
+// Stands for the performance test tree (directory count per level and file count per leaf directory)
+#define TEST_DIRECTORY_SCANNER_DIRECTORY_COUNT 100
+#define TEST_DIRECTORY_SCANNER_SUBDIRECTORY_COUNT 10
+#define TEST_DIRECTORY_SCANNER_FILE_COUNT 100
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline FilePath GetDirectoryScannerTestPath(const char* pName)
+{
+  FilePath filePath;
+  filePath.Print("%s/%s", TEST_DIRECTORY_SCANNER_PATH, pName);
+  return filePath;
+}
+
+inline FilePath GetDirectoryScannerTestTreePath(U32 directoryIndex, U32 subdirectoryIndex, U32 fileIndex)
+{
+  FilePath filePath;
+  if (subdirectoryIndex == static_cast<U32>(-1)) filePath.Print("%s/d%u", TEST_DIRECTORY_SCANNER_PATH, directoryIndex);
+  else if (fileIndex == static_cast<U32>(-1)) filePath.Print("%s/d%u/s%u", TEST_DIRECTORY_SCANNER_PATH, directoryIndex, subdirectoryIndex);
+  else filePath.Print("%s/d%u/s%u/f%u.bin", TEST_DIRECTORY_SCANNER_PATH, directoryIndex, subdirectoryIndex, fileIndex);
+  return filePath;
+}
+
+// Walks a tree the way callers did before DirectoryScanner (a listing and an info query per entry)
+void GetDirectoryScannerTestTreeInfo(const FilePath& path, U32& fileCount, U32& directoryCount)
+{
+  FileSystem::PathList pathList;
+  FileSystem::Directory::GetChildren(path, pathList);
+  for (size_t i = 0; i < pathList.GetCount(); ++i)
+  {
+    FileSystem::File::Info info;
+    if (!FileSystem::File::GetInfo(pathList[i], info)) continue;
+    if (info.flags & FileSystem::File::eFlagDirectory)
+    {
+      ++directoryCount;
+      GetDirectoryScannerTestTreeInfo(pathList[i], fileCount, directoryCount);
+    }
+    else ++fileCount;
+  }
+}
+
+void GetDirectoryScannerTestRecordCount(const FileSystem::DirectoryScanner& scanner, U32& fileCount, U32& directoryCount, size_t& byteSize)
+{
+  fileCount = 0;
+  directoryCount = 0;
+  byteSize = 0;
+  const FileSystem::DirectoryScanner::RecordList& recordList = scanner.GetRecordList();
+  for (size_t i = 0; i < recordList.GetCount(); ++i)
+  {
+    if (recordList[i].info.flags & FileSystem::File::eFlagDirectory) ++directoryCount;
+    else
+    {
+      ++fileCount;
+      byteSize += recordList[i].info.byteSize;
+    }
+  }
+}
+
+inline void WriteDirectoryScannerTestFile(const FilePath& filePath, size_t size)
+{
+  char data[64];
+  Memory::Zero(data, sizeof(data));
+  FileSystem::Archive archive;
+  archive.Open(filePath, FileSystem::Archive::eOpenModeWrite);
+  archive.Write(data, size);
+  archive.Close();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Test functions
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::DirectoryScanner::Run()
+{
+  try
+  {
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::DirectoryScanner::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::DirectoryScanner::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::DirectoryScanner::RunFunctionalityTest()
+{
+  std::cout << "[Test::DirectoryScanner::RunFunctionalityTest]" << std::endl;
+
+  // Root
+  // |- a
+  // |  |- b
+  // |  |  |- f2.bin (30 bytes)
+  // |  |- f1.bin (20 bytes)
+  // |- c
+  // |- f0.bin (10 bytes)
+  FileSystem::Directory::Create(TEST_DIRECTORY_SCANNER_PATH);
+  FileSystem::Directory::Create(GetDirectoryScannerTestPath("a"));
+  FileSystem::Directory::Create(GetDirectoryScannerTestPath("a/b"));
+  FileSystem::Directory::Create(GetDirectoryScannerTestPath("c"));
+  WriteDirectoryScannerTestFile(GetDirectoryScannerTestPath("f0.bin"), 10);
+  WriteDirectoryScannerTestFile(GetDirectoryScannerTestPath("a/f1.bin"), 20);
+  WriteDirectoryScannerTestFile(GetDirectoryScannerTestPath("a/b/f2.bin"), 30);
+
+  U32 fileCount = 0;
+  U32 directoryCount = 0;
+  size_t byteSize = 0;
+
+  // Full scan
+  FileSystem::DirectoryScanner scanner;
+  E_ASSERT(!scanner.Scan("SomeFakePath/SomeFakeDirectory"));
+  E_ASSERT(scanner.Scan(TEST_DIRECTORY_SCANNER_PATH));
+  E_ASSERT(scanner.GetDirectoryList().GetCount() == 4);
+  E_ASSERT(scanner.GetListedDirectoryCount() == 4);
+  GetDirectoryScannerTestRecordCount(scanner, fileCount, directoryCount, byteSize);
+  E_ASSERT(fileCount == 3 && directoryCount == 3 && byteSize == 60);
+  const FileSystem::DirectoryScanner::RecordList& recordList = scanner.GetRecordList();
+  for (size_t i = 0; i < recordList.GetCount(); ++i)
+  {
+    const FileSystem::DirectoryScanner::Record& record = recordList[i];
+    const FileSystem::DirectoryScanner::Directory& directory = scanner.GetDirectoryList()[record.directoryIndex];
+    // Records are stored by directory
+    E_ASSERT(i >= directory.firstRecordIndex && i < directory.firstRecordIndex + directory.recordCount);
+    if (strcmp(scanner.GetName(record), "f2.bin") == 0) E_ASSERT(record.info.byteSize == 30);
+    E_ASSERT(strlen(scanner.GetName(record)) == record.nameLength);
+    E_ASSERT(scanner.GetPath(record).GetLength() == directory.pathLength + 1 + record.nameLength);
+  }
+
+  // Unchanged tree (every directory is revalidated)
+  E_ASSERT(scanner.Scan(TEST_DIRECTORY_SCANNER_PATH));
+  E_ASSERT(scanner.GetListedDirectoryCount() == 0);
+  GetDirectoryScannerTestRecordCount(scanner, fileCount, directoryCount, byteSize);
+  E_ASSERT(fileCount == 3 && directoryCount == 3 && byteSize == 60);
+
+  // New file (only its directory is listed again)
+  WriteDirectoryScannerTestFile(GetDirectoryScannerTestPath("a/f3.bin"), 40);
+  E_ASSERT(scanner.Scan(TEST_DIRECTORY_SCANNER_PATH));
+  E_ASSERT(scanner.GetListedDirectoryCount() == 1);
+  GetDirectoryScannerTestRecordCount(scanner, fileCount, directoryCount, byteSize);
+  E_ASSERT(fileCount == 4 && directoryCount == 3 && byteSize == 100);
+
+  // Cache file
+  const FilePath cacheFilePath = GetDirectoryScannerTestPath("c/cache.bin");
+  E_ASSERT(scanner.SaveCache(cacheFilePath));
+  FileSystem::DirectoryScanner cachedScanner;
+  E_ASSERT(!cachedScanner.LoadCache("SomeFakePath/SomeFakeFile.bin"));
+  E_ASSERT(!cachedScanner.LoadCache(GetDirectoryScannerTestPath("a/f3.bin")));
+  E_ASSERT(cachedScanner.LoadCache(cacheFilePath));
+  E_ASSERT(cachedScanner.GetRecordList().GetCount() == scanner.GetRecordList().GetCount());
+  // Saving the cache file changed its directory
+  E_ASSERT(cachedScanner.Scan(TEST_DIRECTORY_SCANNER_PATH));
+  E_ASSERT(cachedScanner.GetListedDirectoryCount() == 1);
+  GetDirectoryScannerTestRecordCount(cachedScanner, fileCount, directoryCount, byteSize);
+  E_ASSERT(fileCount == 5 && directoryCount == 3);
+
+  FileSystem::File::Destroy(cacheFilePath);
+  FileSystem::File::Destroy(GetDirectoryScannerTestPath("a/f3.bin"));
+  FileSystem::File::Destroy(GetDirectoryScannerTestPath("a/b/f2.bin"));
+  FileSystem::File::Destroy(GetDirectoryScannerTestPath("a/f1.bin"));
+  FileSystem::File::Destroy(GetDirectoryScannerTestPath("f0.bin"));
+  FileSystem::Directory::Destroy(GetDirectoryScannerTestPath("c"));
+  FileSystem::Directory::Destroy(GetDirectoryScannerTestPath("a/b"));
+  FileSystem::Directory::Destroy(GetDirectoryScannerTestPath("a"));
+  FileSystem::Directory::Destroy(TEST_DIRECTORY_SCANNER_PATH);
+
+  return true;
+}
+
+bool Test::DirectoryScanner::RunPerformanceTest()
+{
+  std::cout << "[Test::DirectoryScanner::RunPerformanceTest]" << std::endl;
+
+  FileSystem::Directory::Create(TEST_DIRECTORY_SCANNER_PATH);
+  for (U32 i = 0; i < TEST_DIRECTORY_SCANNER_DIRECTORY_COUNT; ++i)
+  {
+    FileSystem::Directory::Create(GetDirectoryScannerTestTreePath(i, static_cast<U32>(-1), 0));
+    for (U32 j = 0; j < TEST_DIRECTORY_SCANNER_SUBDIRECTORY_COUNT; ++j)
+    {
+      FileSystem::Directory::Create(GetDirectoryScannerTestTreePath(i, j, static_cast<U32>(-1)));
+      for (U32 k = 0; k < TEST_DIRECTORY_SCANNER_FILE_COUNT; ++k) FileSystem::File::Create(GetDirectoryScannerTestTreePath(i, j, k));
+    }
+  }
+  const U32 treeFileCount = TEST_DIRECTORY_SCANNER_DIRECTORY_COUNT * TEST_DIRECTORY_SCANNER_SUBDIRECTORY_COUNT * TEST_DIRECTORY_SCANNER_FILE_COUNT;
+  const U32 treeDirectoryCount = TEST_DIRECTORY_SCANNER_DIRECTORY_COUNT * (TEST_DIRECTORY_SCANNER_SUBDIRECTORY_COUNT + 1);
+  const FilePath cacheFilePath = GetDirectoryScannerTestPath("cache.bin");
+
+  U32 fileCount = 0;
+  U32 directoryCount = 0;
+  size_t byteSize = 0;
+  std::cout << std::endl;
+  E::Time::Timer t;
+
+  // Recursive Directory::GetChildren and File::GetInfo calls
+  GetDirectoryScannerTestTreeInfo(TEST_DIRECTORY_SCANNER_PATH, fileCount, directoryCount);
+  std::cout << "Directory::GetChildren " << fileCount << " files: " << t.GetElapsed().GetMilliseconds() << " ms" << std::endl;
+  E_ASSERT(fileCount == treeFileCount && directoryCount == treeDirectoryCount);
+
+  // Parallel scan
+  FileSystem::DirectoryScanner scanner;
+  t.Reset();
+  E_ASSERT(scanner.Scan(TEST_DIRECTORY_SCANNER_PATH));
+  std::cout << "DirectoryScanner::Scan " << scanner.GetRecordList().GetCount() << " records: " << t.GetElapsed().GetMilliseconds() << " ms" << std::endl;
+  GetDirectoryScannerTestRecordCount(scanner, fileCount, directoryCount, byteSize);
+  E_ASSERT(fileCount == treeFileCount && directoryCount == treeDirectoryCount);
+  E_ASSERT(scanner.SaveCache(cacheFilePath));
+
+  // Cached scan (every directory but the root, changed by the cache file, is revalidated)
+  FileSystem::DirectoryScanner cachedScanner;
+  t.Reset();
+  E_ASSERT(cachedScanner.LoadCache(cacheFilePath));
+  E_ASSERT(cachedScanner.Scan(TEST_DIRECTORY_SCANNER_PATH));
+  std::cout << "DirectoryScanner::Scan (cached) " << cachedScanner.GetListedDirectoryCount() << " listed directories: " << t.GetElapsed().GetMilliseconds() << " ms" << std::endl;
+  GetDirectoryScannerTestRecordCount(cachedScanner, fileCount, directoryCount, byteSize);
+  E_ASSERT(fileCount == treeFileCount + 1 && directoryCount == treeDirectoryCount);
+  E_ASSERT(cachedScanner.GetListedDirectoryCount() == 1);
+
+  FileSystem::File::Destroy(cacheFilePath);
+  for (U32 i = 0; i < TEST_DIRECTORY_SCANNER_DIRECTORY_COUNT; ++i)
+  {
+    for (U32 j = 0; j < TEST_DIRECTORY_SCANNER_SUBDIRECTORY_COUNT; ++j)
+    {
+      for (U32 k = 0; k < TEST_DIRECTORY_SCANNER_FILE_COUNT; ++k) FileSystem::File::Destroy(GetDirectoryScannerTestTreePath(i, j, k));
+      FileSystem::Directory::Destroy(GetDirectoryScannerTestTreePath(i, j, static_cast<U32>(-1)));
+    }
+    FileSystem::Directory::Destroy(GetDirectoryScannerTestTreePath(i, static_cast<U32>(-1), 0));
+  }
+  FileSystem::Directory::Destroy(TEST_DIRECTORY_SCANNER_PATH);
+
+  return true;
+}
@@ -35,6 +35,17 @@ This file defines File test functions.
 using namespace E;
 using namespace std;
 
+/*----------------------------------------------------------------------------------------------------------------------
+Test macros
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Stands for the mapped file test file size in bytes
+#define TEST_FILE_MAPPED_SIZE 1048576
+// Stands for the performance test file size in bytes
+#define TEST_FILE_PERFORMANCE_SIZE 268435456
+// Stands for the performance test Archive read buffer size in bytes
+#define TEST_FILE_READ_BUFFER_SIZE 65536
+
 /*----------------------------------------------------------------------------------------------------------------------
 Auxiliary declarations
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -49,6 +60,19 @@ inline E::String ToString(const E::Time::Date& source)
   return str;
 }
 
+inline U64 GetChecksum(const Byte* pData, size_t size)
+{
+  U64 checksum = 0;
+  for (size_t i = 0; i < size; ++i) checksum += pData[i];
+  return checksum;
+}
+
+inline F32 GetMegabytesPerSecond(size_t size, const E::Time::Timer& t)
+{
+  D64 seconds = Math::Max(t.GetElapsed().GetMilliseconds(), 1e-3) / 1000.0;
+  return static_cast<F32>(size / (1024.0 * 1024.0) / seconds);
+}
+
 inline void PrintFileInfo(const E::FileInfo& fileInfo)
 {
   std::cout << "File info:" << std::endl;
@@ -150,6 +174,44 @@ bool Test::File::RunFunctionalityTest()
   E_ASSERT(FileSystem::File::Create(testFile));
   E_ASSERT(FileSystem::File::Destroy(testFile));
 
+  // MappedFile read write mapping (creation & writes)
+  const FilePath mappedFilePath("../../../Bin/mappedFile.bin");
+  FileSystem::File::Destroy(mappedFilePath);
+  FileSystem::MappedFile mappedFile;
+  E_ASSERT(!mappedFile.Open(fakePath));
+  E_ASSERT(!mappedFile.Open(mappedFilePath, FileSystem::MappedFile::eOpenModeReadWrite));
+  E_ASSERT(mappedFile.Open(mappedFilePath, FileSystem::MappedFile::eOpenModeReadWrite, TEST_FILE_MAPPED_SIZE));
+  E_ASSERT(mappedFile.GetSize() == TEST_FILE_MAPPED_SIZE && mappedFile.GetPtr()[TEST_FILE_MAPPED_SIZE - 1] == 0);
+  Byte* pMappedData = mappedFile.GetPtr();
+  for (size_t i = 0; i < TEST_FILE_MAPPED_SIZE; ++i) pMappedData[i] = static_cast<Byte>(i * 7);
+  E_ASSERT(mappedFile.Flush());
+  mappedFile.Close();
+  E_ASSERT(!mappedFile.IsOpen() && mappedFile.GetPtr() == nullptr && mappedFile.GetSize() == 0);
+
+  // The written data read back through an Archive
+  E::Containers::List<char> archiveData(TEST_FILE_MAPPED_SIZE);
+  archiveData.SetCount(TEST_FILE_MAPPED_SIZE);
+  FileSystem::Archive archive;
+  E_ASSERT(archive.Open(mappedFilePath));
+  E_ASSERT(archive.Read(archiveData.GetPtr(), TEST_FILE_MAPPED_SIZE) == TEST_FILE_MAPPED_SIZE);
+  archive.Close();
+  for (size_t i = 0; i < TEST_FILE_MAPPED_SIZE; ++i) E_ASSERT(static_cast<Byte>(archiveData[i]) == static_cast<Byte>(i * 7));
+
+  // Read only mapping & hints (out of range prefetches are clamped)
+  E_ASSERT(mappedFile.Open(mappedFilePath));
+  E_ASSERT(mappedFile.GetPath() == mappedFilePath && mappedFile.GetSize() == TEST_FILE_MAPPED_SIZE);
+  mappedFile.SetAccessHint(FileSystem::MappedFile::eAccessHintRandom);
+  mappedFile.Prefetch(TEST_FILE_MAPPED_SIZE / 2 + 1, TEST_FILE_MAPPED_SIZE);
+  mappedFile.Prefetch(TEST_FILE_MAPPED_SIZE, 1);
+  std::cout << "MappedFile large pages: " << mappedFile.EnableLargePages() << std::endl;
+  E_ASSERT(memcmp(mappedFile.GetPtr(), archiveData.GetPtr(), TEST_FILE_MAPPED_SIZE) == 0);
+
+  // Read write mapping resizing an existing file
+  E_ASSERT(mappedFile.Open(mappedFilePath, FileSystem::MappedFile::eOpenModeReadWrite, 4096));
+  E_ASSERT(mappedFile.GetSize() == 4096 && mappedFile.GetPtr()[10] == 70);
+  mappedFile.Close();
+  E_ASSERT(FileSystem::File::Destroy(mappedFilePath));
+
   return true;
 }
 
@@ -157,6 +219,66 @@ bool Test::File::RunPerformanceTest()
 {
   std::cout << "[Test::File::RunPerformanceTest]" << std::endl;
 
+  // Sequential read throughput of a freshly written (and therefore cached) file
+  const FilePath filePath("../../../Bin/performanceFile.bin");
+  FileSystem::MappedFile mappedFile;
+  E_ASSERT(mappedFile.Open(filePath, FileSystem::MappedFile::eOpenModeReadWrite, TEST_FILE_PERFORMANCE_SIZE));
+  Byte* pMappedData = mappedFile.GetPtr();
+  for (size_t i = 0; i < TEST_FILE_PERFORMANCE_SIZE; ++i) pMappedData[i] = static_cast<Byte>(i * 7);
+  const U64 checksum = GetChecksum(pMappedData, TEST_FILE_PERFORMANCE_SIZE);
+  mappedFile.Close();
+
+  std::cout << std::endl;
+  E::Time::Timer t;
+
+  // Archive reading a buffer at a time
+  E::Containers::List<char> buffer(TEST_FILE_READ_BUFFER_SIZE);
+  buffer.SetCount(TEST_FILE_READ_BUFFER_SIZE);
+  FileSystem::Archive archive;
+  U64 archiveChecksum = 0;
+  archive.Open(filePath);
+  for (size_t readSize = archive.Read(buffer.GetPtr(), TEST_FILE_READ_BUFFER_SIZE); readSize; readSize = archive.Read(buffer.GetPtr(), TEST_FILE_READ_BUFFER_SIZE))
+  {
+    archiveChecksum += GetChecksum(reinterpret_cast<const Byte*>(buffer.GetPtr()), readSize);
+  }
+  archive.Close();
+  std::cout << "Archive buffered Read: " << GetMegabytesPerSecond(TEST_FILE_PERFORMANCE_SIZE, t) << " MB/s" << std::endl;
+  E_ASSERT(archiveChecksum == checksum);
+
+  // Archive reading the whole file into memory
+  t.Reset();
+  E::Containers::List<char> fileData(TEST_FILE_PERFORMANCE_SIZE);
+  fileData.SetCount(TEST_FILE_PERFORMANCE_SIZE);
+  archive.Open(filePath);
+  archive.Read(fileData.GetPtr(), TEST_FILE_PERFORMANCE_SIZE);
+  archive.Close();
+  archiveChecksum = GetChecksum(reinterpret_cast<const Byte*>(fileData.GetPtr()), TEST_FILE_PERFORMANCE_SIZE);
+  std::cout << "Archive whole file Read: " << GetMegabytesPerSecond(TEST_FILE_PERFORMANCE_SIZE, t) << " MB/s" << std::endl;
+  E_ASSERT(archiveChecksum == checksum);
+  fileData.Clear();
+  fileData.Compact();
+
+  // MappedFile with the sequential access hint
+  t.Reset();
+  mappedFile.Open(filePath);
+  mappedFile.SetAccessHint(FileSystem::MappedFile::eAccessHintSequential);
+  U64 mappedChecksum = GetChecksum(mappedFile.GetPtr(), mappedFile.GetSize());
+  mappedFile.Close();
+  std::cout << "MappedFile sequential read: " << GetMegabytesPerSecond(TEST_FILE_PERFORMANCE_SIZE, t) << " MB/s" << std::endl;
+  E_ASSERT(mappedChecksum == checksum);
+
+  // MappedFile prefetching the whole file
+  t.Reset();
+  mappedFile.Open(filePath);
+  mappedFile.Prefetch(0, mappedFile.GetSize());
+  mappedChecksum = GetChecksum(mappedFile.GetPtr(), mappedFile.GetSize());
+  mappedFile.Close();
+  std::cout << "MappedFile prefetched read: " << GetMegabytesPerSecond(TEST_FILE_PERFORMANCE_SIZE, t) << " MB/s" << std::endl;
+  E_ASSERT(mappedChecksum == checksum);
+  std::cout << std::endl;
+
+  E_ASSERT(FileSystem::File::Destroy(filePath));
+
   return true;
 }
 
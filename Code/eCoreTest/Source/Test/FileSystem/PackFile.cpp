@@ -0,0 +1,287 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 19-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file PackFile.cpp
+This file defines PackFile test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+using namespace std;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Test macros
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Stands for the test directory path (the directory the packs are created from) and the test pack file path
+#define TEST_PACK_FILE_PATH "../../../Bin/PackFile"
+#define TEST_PACK_FILE_PACK_PATH "../../../Bin/PackFileTest.epk"
+// Stands for the performance test file count and size
+#define TEST_PACK_FILE_FILE_COUNT 2000
+#define TEST_PACK_FILE_FILE_SIZE 16384
+#define TEST_PACK_FILE_RUN_COUNT 3
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline FilePath GetPackFileTestPath(const char* pName)
+{
+  FilePath filePath;
+  filePath.Print("%s/%s", TEST_PACK_FILE_PATH, pName);
+  return filePath;
+}
+
+// Fills a buffer with text like data (a few repeated words) or with random data (not compressible)
+void GetPackFileTestData(Containers::List<Byte>& data, size_t size, bool compressible)
+{
+  static const char* kWords[] = { "float4 ", "position ", "normal ", "texcoord ", "return ", "{\n", "}\n", "0.5f, " };
+  data.EnsureSize(size);
+  data.SetCount(size);
+  for (size_t i = 0; i < size;)
+  {
+    if (compressible)
+    {
+      const char* pWord = kWords[Math::Global::GetRandom().GetU32(8)];
+      for (; *pWord && i < size; ++pWord) data[i++] = static_cast<Byte>(*pWord);
+    }
+    else data[i++] = static_cast<Byte>(Math::Global::GetRandom().GetU32(256));
+  }
+}
+
+inline void WritePackFileTestFile(const FilePath& filePath, const Containers::List<Byte>& data)
+{
+  FileSystem::Archive archive;
+  archive.Open(filePath, FileSystem::Archive::eOpenModeWrite);
+  archive.Write(reinterpret_cast<const char*>(data.GetPtr()), data.GetCount());
+  archive.Close();
+}
+
+inline bool IsPackFileTestDataEqual(const Containers::List<Byte>& a, const Containers::List<Byte>& b)
+{
+  return a.GetCount() == b.GetCount() && (a.IsEmpty() || memcmp(a.GetPtr(), b.GetPtr(), a.GetCount()) == 0);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Test functions
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::PackFile::Run()
+{
+  try
+  {
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::PackFile::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::PackFile::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::PackFile::RunFunctionalityTest()
+{
+  std::cout << "[Test::PackFile::RunFunctionalityTest]" << std::endl;
+
+  // Root
+  // |- Shaders
+  // |  |- Forward.hlsl (compressible)
+  // |- Textures
+  // |  |- Brick.dds (random)
+  // |- empty.txt
+  Containers::List<Byte> shaderData;
+  Containers::List<Byte> textureData;
+  Containers::List<Byte> emptyData;
+  GetPackFileTestData(shaderData, 20000, true);
+  GetPackFileTestData(textureData, 5000, false);
+  FileSystem::Directory::Create(TEST_PACK_FILE_PATH);
+  FileSystem::Directory::Create(GetPackFileTestPath("Shaders"));
+  FileSystem::Directory::Create(GetPackFileTestPath("Textures"));
+  WritePackFileTestFile(GetPackFileTestPath("Shaders/Forward.hlsl"), shaderData);
+  WritePackFileTestFile(GetPackFileTestPath("Textures/Brick.dds"), textureData);
+  WritePackFileTestFile(GetPackFileTestPath("empty.txt"), emptyData);
+
+  // Path normalization
+  FilePath path("./Data\\\\Textures/./Brick.DDS/");
+  FileSystem::PackFile::NormalizePath(path);
+  E_ASSERT(path == "data/textures/brick.dds");
+
+  // Creation
+  FileSystem::PathList pathList;
+  pathList.PushBack("Shaders/Forward.hlsl");
+  pathList.PushBack("Textures/Brick.dds");
+  pathList.PushBack("empty.txt");
+  E_ASSERT(FileSystem::PackFile::Create(TEST_PACK_FILE_PACK_PATH, TEST_PACK_FILE_PATH, pathList));
+  pathList.PushBack("shaders/forward.hlsl");
+  E_ASSERT(!FileSystem::PackFile::Create(TEST_PACK_FILE_PACK_PATH, TEST_PACK_FILE_PATH, pathList));
+  pathList.PopBack();
+  pathList.PushBack("Shaders/Missing.hlsl");
+  E_ASSERT(!FileSystem::PackFile::Create(TEST_PACK_FILE_PACK_PATH, TEST_PACK_FILE_PATH, pathList));
+  pathList.PopBack();
+  E_ASSERT(FileSystem::PackFile::Create(TEST_PACK_FILE_PACK_PATH, TEST_PACK_FILE_PATH, pathList));
+
+  // Lookups & reads
+  FileSystem::PackFile packFile;
+  E_ASSERT(!packFile.Open("SomeFakePath/SomeFakeFile.epk"));
+  E_ASSERT(!packFile.Open(GetPackFileTestPath("Textures/Brick.dds")));
+  E_ASSERT(packFile.Open(TEST_PACK_FILE_PACK_PATH));
+  E_ASSERT(packFile.GetEntryCount() == 3);
+  for (U32 i = 0; i < packFile.GetEntryCount(); ++i)
+  {
+    const FileSystem::PackFile::Entry& entry = packFile.GetEntries()[i];
+    E_ASSERT(entry.offset % FileSystem::PackFile::kAlignment == 0);
+    E_ASSERT(i == 0 || packFile.GetEntries()[i - 1].pathHash <= entry.pathHash);
+  }
+  E_ASSERT(packFile.Find("Shaders/Missing.hlsl") == nullptr);
+  const FileSystem::PackFile::Entry* pShaderEntry = packFile.Find("shaders\\FORWARD.hlsl");
+  const FileSystem::PackFile::Entry* pTextureEntry = packFile.Find("Textures/Brick.dds");
+  const FileSystem::PackFile::Entry* pEmptyEntry = packFile.Find("empty.txt");
+  E_ASSERT(pShaderEntry && pTextureEntry && pEmptyEntry);
+  E_ASSERT(strcmp(packFile.GetPath(*pShaderEntry), "shaders/forward.hlsl") == 0);
+  // Only the compressible file is compressed
+  E_ASSERT(pShaderEntry->compression == FileSystem::PackFile::eCompressionLz4 && pShaderEntry->storedSize < pShaderEntry->size);
+  E_ASSERT(pTextureEntry->compression == FileSystem::PackFile::eCompressionNone);
+  E_ASSERT(pEmptyEntry->size == 0);
+  Containers::List<Byte> data(static_cast<size_t>(pShaderEntry->size));
+  data.SetCount(static_cast<size_t>(pShaderEntry->size));
+  E_ASSERT(packFile.Read(*pShaderEntry, data.GetPtr()));
+  E_ASSERT(IsPackFileTestDataEqual(data, shaderData));
+  E_ASSERT(memcmp(packFile.GetData(*pTextureEntry), textureData.GetPtr(), textureData.GetCount()) == 0);
+  packFile.Close();
+
+  // Virtual file system (packs first, then the disk)
+  FileSystem::VirtualFileSystem vfs;
+  E_ASSERT(!vfs.Mount("SomeFakePath/SomeFakeFile.epk", TEST_PACK_FILE_PATH));
+  E_ASSERT(vfs.Mount(TEST_PACK_FILE_PACK_PATH, TEST_PACK_FILE_PATH));
+  E_ASSERT(vfs.GetPackCount() == 1);
+  E_ASSERT(vfs.IsPacked(GetPackFileTestPath("Shaders/Forward.hlsl")));
+  E_ASSERT(!vfs.IsPacked("Shaders/Forward.hlsl"));
+  E_ASSERT(!vfs.IsPacked(GetPackFileTestPath("Shaders")));
+  E_ASSERT(vfs.Read(GetPackFileTestPath("Shaders/Forward.hlsl"), data) && IsPackFileTestDataEqual(data, shaderData));
+  E_ASSERT(vfs.Read(GetPackFileTestPath("empty.txt"), data) && data.IsEmpty());
+  const Byte* pData = nullptr;
+  size_t size = 0;
+  E_ASSERT(!vfs.Map(GetPackFileTestPath("Shaders/Forward.hlsl"), pData, size));
+  E_ASSERT(vfs.Map(GetPackFileTestPath("Textures/Brick.dds"), pData, size));
+  E_ASSERT(size == textureData.GetCount() && memcmp(pData, textureData.GetPtr(), size) == 0);
+  // Loose files not packed
+  Containers::List<Byte> looseData;
+  GetPackFileTestData(looseData, 100, true);
+  WritePackFileTestFile(GetPackFileTestPath("loose.txt"), looseData);
+  E_ASSERT(vfs.Exists(GetPackFileTestPath("loose.txt")) && !vfs.IsPacked(GetPackFileTestPath("loose.txt")));
+  E_ASSERT(vfs.Read(GetPackFileTestPath("loose.txt"), data) && IsPackFileTestDataEqual(data, looseData));
+  E_ASSERT(!vfs.Exists(GetPackFileTestPath("missing.txt")) && !vfs.Read(GetPackFileTestPath("missing.txt"), data));
+  // Packed files override loose ones, even after the loose file changes
+  WritePackFileTestFile(GetPackFileTestPath("Textures/Brick.dds"), looseData);
+  E_ASSERT(vfs.Read(GetPackFileTestPath("Textures/Brick.dds"), data) && IsPackFileTestDataEqual(data, textureData));
+  E_ASSERT(!vfs.Unmount("SomeFakePath/SomeFakeFile.epk"));
+  E_ASSERT(vfs.Unmount(TEST_PACK_FILE_PACK_PATH));
+  E_ASSERT(vfs.GetPackCount() == 0);
+  E_ASSERT(vfs.Read(GetPackFileTestPath("Textures/Brick.dds"), data) && IsPackFileTestDataEqual(data, looseData));
+
+  FileSystem::File::Destroy(TEST_PACK_FILE_PACK_PATH);
+  FileSystem::File::Destroy(GetPackFileTestPath("loose.txt"));
+  FileSystem::File::Destroy(GetPackFileTestPath("empty.txt"));
+  FileSystem::File::Destroy(GetPackFileTestPath("Textures/Brick.dds"));
+  FileSystem::File::Destroy(GetPackFileTestPath("Shaders/Forward.hlsl"));
+  FileSystem::Directory::Destroy(GetPackFileTestPath("Textures"));
+  FileSystem::Directory::Destroy(GetPackFileTestPath("Shaders"));
+  FileSystem::Directory::Destroy(TEST_PACK_FILE_PATH);
+
+  return true;
+}
+
+bool Test::PackFile::RunPerformanceTest()
+{
+  std::cout << "[Test::PackFile::RunPerformanceTest]" << std::endl;
+
+  // Half of the files compress (text like data) and half do not (random data)
+  FileSystem::Directory::Create(TEST_PACK_FILE_PATH);
+  FileSystem::PathList pathList;
+  Containers::List<Byte> data;
+  size_t totalSize = 0;
+  for (U32 i = 0; i < TEST_PACK_FILE_FILE_COUNT; ++i)
+  {
+    FilePath path;
+    path.Print("f%u.bin", i);
+    GetPackFileTestData(data, TEST_PACK_FILE_FILE_SIZE, (i & 1) == 0);
+    WritePackFileTestFile(GetPackFileTestPath(path.GetPtr()), data);
+    pathList.PushBack(path);
+    totalSize += data.GetCount();
+  }
+
+  std::cout << std::endl;
+  E::Time::Timer t;
+  E_ASSERT(FileSystem::PackFile::Create(TEST_PACK_FILE_PACK_PATH, TEST_PACK_FILE_PATH, pathList));
+  std::cout << "PackFile::Create " << TEST_PACK_FILE_FILE_COUNT << " files: " << t.GetElapsed().GetMilliseconds() << " ms" << std::endl;
+  FileSystem::File::Info packInfo;
+  FileSystem::File::GetInfo(TEST_PACK_FILE_PACK_PATH, packInfo);
+  std::cout << "Pack file size: " << packInfo.byteSize << " bytes (" << totalSize << " bytes loose)" << std::endl;
+
+  // The first run stands for a cold load (no open files, no mapping) and the next ones for warm loads. Truly cold
+  // loads require the OS file cache to be flushed (e.g. a reboot) between runs, which a test can not do.
+  FileSystem::VirtualFileSystem vfs;
+  for (U32 run = 0; run < TEST_PACK_FILE_RUN_COUNT; ++run)
+  {
+    size_t readSize = 0;
+    t.Reset();
+    for (size_t i = 0; i < pathList.GetCount(); ++i)
+    {
+      E_ASSERT(vfs.Read(GetPackFileTestPath(pathList[i].GetPtr()), data));
+      readSize += data.GetCount();
+    }
+    const D64 looseTime = t.GetElapsed().GetMilliseconds();
+    E_ASSERT(readSize == totalSize);
+
+    readSize = 0;
+    t.Reset();
+    E_ASSERT(vfs.Mount(TEST_PACK_FILE_PACK_PATH, TEST_PACK_FILE_PATH));
+    for (size_t i = 0; i < pathList.GetCount(); ++i)
+    {
+      E_ASSERT(vfs.Read(GetPackFileTestPath(pathList[i].GetPtr()), data));
+      readSize += data.GetCount();
+    }
+    const D64 packTime = t.GetElapsed().GetMilliseconds();
+    E_ASSERT(readSize == totalSize);
+    vfs.UnmountAll();
+
+    std::cout << (run ? "Warm" : "Cold") << " load: loose files " << looseTime << " ms, pack file " << packTime << " ms" << std::endl;
+  }
+
+  FileSystem::File::Destroy(TEST_PACK_FILE_PACK_PATH);
+  for (size_t i = 0; i < pathList.GetCount(); ++i) FileSystem::File::Destroy(GetPackFileTestPath(pathList[i].GetPtr()));
+  FileSystem::Directory::Destroy(TEST_PACK_FILE_PATH);
+
+  return true;
+}
@@ -39,6 +39,15 @@ using namespace std;
 Auxiliary method declaration
 ----------------------------------------------------------------------------------------------------------------------*/
 void SortPerformanceComparison(I32 minValue, I32 maxValue, U32 maxArraySize, U32 iterationCount);
+void SortScalabilityComparison(size_t maxArraySize);
+
+#ifndef TEST_SORTING_MAX_SIZE
+#ifdef E_CPU_X64
+#define TEST_SORTING_MAX_SIZE 100000000
+#else
+#define TEST_SORTING_MAX_SIZE 10000000
+#endif
+#endif
 
 /*----------------------------------------------------------------------------------------------------------------------
 TestList methods
@@ -131,6 +140,104 @@ bool Test::Algorithm::RunFunctionalityTest()
   E::Math::Sorting<I32>::QuickSort(b.GetPtr(), b.GetSize());
   CompareSortedArray(b, v);
 
+  b.Copy(a.GetPtr(), a.GetSize());
+  E::Math::Sorting<I32>::SortingNetwork(b.GetPtr(), b.GetSize());
+  CompareSortedArray(b, v);
+
+  /*-------------------------------------------------------------------------------
+  Sorting networks (0-1 principle: a network sorting all binary inputs sorts any input)
+  -------------------------------------------------------------------------------*/
+  for (U32 size = 2; size <= 8; ++size)
+  {
+    for (U32 bits = 0; bits < (1u << size); ++bits)
+    {
+      I32 values[8];
+      for (U32 i = 0; i < size; ++i) values[i] = (bits >> i) & 1;
+      E::Math::Sorting<I32>::SortingNetwork(values, size);
+      for (U32 i = 1; i < size; ++i) E_ASSERT(values[i - 1] <= values[i]);
+    }
+  }
+  for (U32 bits = 0; bits < (1u << E::Math::SimdSorting::kMaxSize); ++bits)
+  {
+    I32 intValues[E::Math::SimdSorting::kMaxSize];
+    F32 floatValues[E::Math::SimdSorting::kMaxSize];
+    for (U32 i = 0; i < E::Math::SimdSorting::kMaxSize; ++i) floatValues[i] = static_cast<F32>(intValues[i] = (bits >> i) & 1);
+    E::Math::SimdSorting::Sort(intValues, E::Math::SimdSorting::kMaxSize);
+    E::Math::SimdSorting::Sort(floatValues, E::Math::SimdSorting::kMaxSize);
+    for (U32 i = 1; i < E::Math::SimdSorting::kMaxSize; ++i) E_ASSERT(intValues[i - 1] <= intValues[i] && floatValues[i - 1] <= floatValues[i]);
+  }
+  for (U32 size = 1; size <= E::Math::SimdSorting::kMaxSize; ++size)
+  {
+    std::vector<I32> intValues(size);
+    std::vector<F32> floatValues(size);
+    for (U32 i = 0; i < size; ++i)
+    {
+      intValues[i] = Math::Global::GetRandom().GetI32(Math::NumericLimits<I32>::Min(), Math::NumericLimits<I32>::Max());
+      floatValues[i] = Math::Global::GetRandom().GetF32(-1000.0f, 1000.0f);
+    }
+    std::vector<I32> sortedIntValues(intValues);
+    std::vector<F32> sortedFloatValues(floatValues);
+    std::sort(sortedIntValues.begin(), sortedIntValues.end());
+    std::sort(sortedFloatValues.begin(), sortedFloatValues.end());
+    E::Math::SimdSorting::Sort(&intValues[0], size);
+    E::Math::SimdSorting::Sort(&floatValues[0], size);
+    E_ASSERT(intValues == sortedIntValues && floatValues == sortedFloatValues);
+  }
+
+  /*-------------------------------------------------------------------------------
+  RadixSorting
+  -------------------------------------------------------------------------------*/
+  const size_t radixSize = 10000;
+  std::vector<U32> u32Keys(radixSize), u32Buffer(radixSize);
+  std::vector<I32> i32Keys(radixSize), i32Buffer(radixSize);
+  std::vector<F32> f32Keys(radixSize), f32Buffer(radixSize);
+  std::vector<U64> u64Keys(radixSize), u64Buffer(radixSize);
+  for (size_t i = 0; i < radixSize; ++i)
+  {
+    u32Keys[i] = Math::Global::GetRandom().GetU32(Math::NumericLimits<U32>::Max());
+    i32Keys[i] = Math::Global::GetRandom().GetI32(Math::NumericLimits<I32>::Min(), Math::NumericLimits<I32>::Max());
+    f32Keys[i] = (i % 64 == 0) ? -0.0f : Math::Global::GetRandom().GetF32(-1.0e6f, 1.0e6f);
+    u64Keys[i] = (static_cast<U64>(u32Keys[i]) << 32) | Math::Global::GetRandom().GetU32(Math::NumericLimits<U32>::Max());
+  }
+  std::vector<U32> sortedU32Keys(u32Keys);
+  std::vector<I32> sortedI32Keys(i32Keys);
+  std::vector<F32> sortedF32Keys(f32Keys);
+  std::vector<U64> sortedU64Keys(u64Keys);
+  std::sort(sortedU32Keys.begin(), sortedU32Keys.end());
+  std::sort(sortedI32Keys.begin(), sortedI32Keys.end());
+  std::sort(sortedF32Keys.begin(), sortedF32Keys.end());
+  std::sort(sortedU64Keys.begin(), sortedU64Keys.end());
+  E::Math::RadixSorting::Sort(&u32Keys[0], &u32Buffer[0], radixSize);
+  E::Math::RadixSorting::Sort(&i32Keys[0], &i32Buffer[0], radixSize);
+  E::Math::RadixSorting::Sort(&f32Keys[0], &f32Buffer[0], radixSize);
+  E::Math::RadixSorting::Sort(&u64Keys[0], &u64Buffer[0], radixSize);
+  E_ASSERT(u32Keys == sortedU32Keys && i32Keys == sortedI32Keys && f32Keys == sortedF32Keys && u64Keys == sortedU64Keys);
+
+  // Key / value sorting must be stable (render key buckets keep their submission order)
+  std::vector<U32> values(radixSize), valueBuffer(radixSize);
+  for (size_t i = 0; i < radixSize; ++i)
+  {
+    u64Keys[i] = static_cast<U64>(Math::Global::GetRandom().GetU32(16)) << 40;
+    values[i] = static_cast<U32>(i);
+  }
+  E::Math::RadixSorting::Sort(&u64Keys[0], &values[0], &u64Buffer[0], &valueBuffer[0], radixSize);
+  for (size_t i = 1; i < radixSize; ++i)
+  {
+    E_ASSERT(u64Keys[i - 1] <= u64Keys[i]);
+    E_ASSERT(u64Keys[i - 1] != u64Keys[i] || values[i - 1] < values[i]);
+  }
+
+  /*-------------------------------------------------------------------------------
+  ParallelSorting
+  -------------------------------------------------------------------------------*/
+  const size_t parallelSize = 1 << 20;
+  std::vector<I32> parallelKeys(parallelSize), parallelBuffer(parallelSize);
+  for (size_t i = 0; i < parallelSize; ++i) parallelKeys[i] = Math::Global::GetRandom().GetI32(0, 1000);
+  std::vector<I32> sortedParallelKeys(parallelKeys);
+  std::sort(sortedParallelKeys.begin(), sortedParallelKeys.end());
+  E::Math::ParallelSorting<I32>::Sort(&parallelKeys[0], &parallelBuffer[0], parallelSize);
+  E_ASSERT(parallelKeys == sortedParallelKeys);
+
 
   return true;
 }
@@ -152,6 +259,8 @@ bool Test::Algorithm::RunPerformanceTest()
   maxValue = 100;
   
   SortPerformanceComparison(minValue, maxValue, maxArraySize, iterationCount);
+
+  SortScalabilityComparison(TEST_SORTING_MAX_SIZE);
  
   return true;
 }
@@ -353,3 +462,135 @@ void SortPerformanceComparison(I32 minValue, I32 maxValue, U32 maxArraySize, U32
   Succeeded! Elapsed time: 3227.32 ms [Test::Algorithm::RunPerformanceTest]
   */
 }
+
+void SortScalabilityComparison(size_t maxArraySize)
+{
+  /*-------------------------------------------------------------------------------
+  STD vs comparison, radix and parallel sorting with increasing array sizes
+  -------------------------------------------------------------------------------*/
+  // Elements sorted for each array size (the iteration count is weighted with it)
+  const size_t elementCount = 10000000;
+
+  std::cout << "Parameters: " << std::endl
+            << "- Max array size      [" << maxArraySize << "]" << std::endl
+            << "- Processor count     [" << E::Threads::Thread::GetProcessorCount() << "]" << std::endl
+            << "- Sorted elements     [" << elementCount << "]"  << std::endl << std::endl;
+
+  E::Time::Timer t;
+  for (size_t size = 1000; size <= maxArraySize; size *= 10)
+  {
+    size_t iterationCount = Math::Max<size_t>(1, elementCount / size);
+    std::cout << "Array size " << size << " / " << iterationCount << " iterations (ms per sort)" << std::endl;
+
+    /*-------------------------------------------------------------------------------
+    U32 keys (large index arrays)
+    -------------------------------------------------------------------------------*/
+    {
+      std::vector<U32> source(size), keys(size), sortedKeys(size), buffer(size);
+      for (size_t i = 0; i < size; ++i) source[i] = Math::Global::GetRandom().GetU32(Math::NumericLimits<U32>::Max());
+      F32 sortTimeStd = 0;
+      F32 introSortTime = 0;
+      F32 quickSortDPTime = 0;
+      F32 radixSortTime = 0;
+      F32 parallelSortTime = 0;
+
+      for (size_t j = 0; j < iterationCount; ++j)
+      {
+        std::copy(source.begin(), source.end(), sortedKeys.begin());
+        t.Reset();
+        std::sort(sortedKeys.begin(), sortedKeys.end());
+        sortTimeStd += static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+        std::copy(source.begin(), source.end(), keys.begin());
+        t.Reset();
+        Math::Sorting<U32>::IntroSort(&keys[0], size);
+        introSortTime += static_cast<F32>(t.GetElapsed().GetMilliseconds());
+        E_ASSERT(keys == sortedKeys);
+
+        std::copy(source.begin(), source.end(), keys.begin());
+        t.Reset();
+        Math::Sorting<U32>::QuickSortDualPivot(&keys[0], size);
+        quickSortDPTime += static_cast<F32>(t.GetElapsed().GetMilliseconds());
+        E_ASSERT(keys == sortedKeys);
+
+        std::copy(source.begin(), source.end(), keys.begin());
+        t.Reset();
+        Math::RadixSorting::Sort(&keys[0], &buffer[0], size);
+        radixSortTime += static_cast<F32>(t.GetElapsed().GetMilliseconds());
+        E_ASSERT(keys == sortedKeys);
+
+        std::copy(source.begin(), source.end(), keys.begin());
+        t.Reset();
+        Math::ParallelSorting<U32>::Sort(&keys[0], &buffer[0], size);
+        parallelSortTime += static_cast<F32>(t.GetElapsed().GetMilliseconds());
+        E_ASSERT(keys == sortedKeys);
+      }
+
+      std::cout << "U32     std " << sortTimeStd / iterationCount 
+                << "\tIntroSort " << introSortTime / iterationCount 
+                << "\tQS DualP " << quickSortDPTime / iterationCount 
+                << "\tRadix " << radixSortTime / iterationCount << " (" << (sortTimeStd / radixSortTime * 100.0f) - 100.0f << "% faster)"
+                << "\tParallel " << parallelSortTime / iterationCount << " (" << (sortTimeStd / parallelSortTime * 100.0f) - 100.0f << "% faster)" << std::endl;
+    }
+
+    /*-------------------------------------------------------------------------------
+    F32 keys (depth sorting)
+    -------------------------------------------------------------------------------*/
+    {
+      std::vector<F32> source(size), keys(size), sortedKeys(size), buffer(size);
+      for (size_t i = 0; i < size; ++i) source[i] = Math::Global::GetRandom().GetF32(-1.0e6f, 1.0e6f);
+      F32 sortTimeStd = 0;
+      F32 radixSortTime = 0;
+
+      for (size_t j = 0; j < iterationCount; ++j)
+      {
+        std::copy(source.begin(), source.end(), sortedKeys.begin());
+        t.Reset();
+        std::sort(sortedKeys.begin(), sortedKeys.end());
+        sortTimeStd += static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+        std::copy(source.begin(), source.end(), keys.begin());
+        t.Reset();
+        Math::RadixSorting::Sort(&keys[0], &buffer[0], size);
+        radixSortTime += static_cast<F32>(t.GetElapsed().GetMilliseconds());
+        E_ASSERT(keys == sortedKeys);
+      }
+
+      std::cout << "F32     std " << sortTimeStd / iterationCount 
+                << "\tRadix " << radixSortTime / iterationCount << " (" << (sortTimeStd / radixSortTime * 100.0f) - 100.0f << "% faster)" << std::endl;
+    }
+
+    /*-------------------------------------------------------------------------------
+    U64 keys with U32 values (render key / draw index pairs)
+    -------------------------------------------------------------------------------*/
+    {
+      std::vector<U64> source(size), keys(size), keyBuffer(size);
+      std::vector<U32> values(size), valueBuffer(size);
+      std::vector<std::pair<U64, U32> > pairs(size);
+      for (size_t i = 0; i < size; ++i) 
+      {
+        source[i] = (static_cast<U64>(Math::Global::GetRandom().GetU32(Math::NumericLimits<U32>::Max())) << 32) | Math::Global::GetRandom().GetU32(Math::NumericLimits<U32>::Max());
+      }
+      F32 sortTimeStd = 0;
+      F32 radixSortTime = 0;
+
+      for (size_t j = 0; j < iterationCount; ++j)
+      {
+        for (size_t i = 0; i < size; ++i) pairs[i] = std::make_pair(source[i], static_cast<U32>(i));
+        t.Reset();
+        std::sort(pairs.begin(), pairs.end());
+        sortTimeStd += static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+        std::copy(source.begin(), source.end(), keys.begin());
+        for (size_t i = 0; i < size; ++i) values[i] = static_cast<U32>(i);
+        t.Reset();
+        Math::RadixSorting::Sort(&keys[0], &values[0], &keyBuffer[0], &valueBuffer[0], size);
+        radixSortTime += static_cast<F32>(t.GetElapsed().GetMilliseconds());
+        for (size_t i = 0; i < size; ++i) E_ASSERT(keys[i] == pairs[i].first && values[i] == pairs[i].second);
+      }
+
+      std::cout << "U64/U32 std " << sortTimeStd / iterationCount 
+                << "\tRadix " << radixSortTime / iterationCount << " (" << (sortTimeStd / radixSortTime * 100.0f) - 100.0f << "% faster)" << std::endl << std::endl;
+    }
+  }
+}
@@ -0,0 +1,694 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Batch.cpp
+This file defines E::Math::Batch test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef TEST_BATCH_MAX_SIZE
+#define TEST_BATCH_MAX_SIZE 1000000
+#endif
+
+#ifndef TEST_BATCH_ELEMENT_COUNT
+#define TEST_BATCH_ELEMENT_COUNT 10000000
+#endif
+
+#ifndef TEST_BATCH_CULL_COUNT
+#define TEST_BATCH_CULL_COUNT 1000000
+#endif
+
+#ifndef TEST_BATCH_CULL_ITERATION_COUNT
+#define TEST_BATCH_CULL_ITERATION_COUNT 10
+#endif
+
+#ifndef TEST_BATCH_VERTEX_COUNT
+#define TEST_BATCH_VERTEX_COUNT 1000000
+#endif
+
+#ifndef TEST_BATCH_VERTEX_GROWTH_COUNT
+#define TEST_BATCH_VERTEX_GROWTH_COUNT 10000
+#endif
+
+#ifndef TEST_BATCH_CONVERSION_ITERATION_COUNT
+#define TEST_BATCH_CONVERSION_ITERATION_COUNT 10
+#endif
+
+static const U32 kBatchTestPlaneCount = 6;
+
+// Stands for Graphics::CompressedPositionTextureNormalVertex (eEngine)
+struct BatchTestCompressedVertex
+{
+  Vector3f            position;
+  U32                 meshID;
+  Math::Vector2<U16>  texCoord;
+  Math::Vector4<U16>  normal;
+};
+
+static F32 BatchTestGetRandom()
+{
+  return Math::Global::GetRandom().GetF32(-100.0f, 100.0f);
+}
+
+static Vector3f BatchTestGetRandomVector()
+{
+  return Vector3f(BatchTestGetRandom(), BatchTestGetRandom(), BatchTestGetRandom());
+}
+
+static Matrix4f BatchTestGetRandomMatrix()
+{
+  Matrix4f m;
+  m.SetRotation(Math::Global::GetRandom().GetF32(-3.0f, 3.0f), Math::Global::GetRandom().GetF32(-3.0f, 3.0f), Math::Global::GetRandom().GetF32(-3.0f, 3.0f));
+  m.Scale(Math::Global::GetRandom().GetF32(0.5f, 2.0f));
+  m.SetTranslation(BatchTestGetRandomVector());
+  return m;
+}
+
+static Quatf BatchTestGetRandomQuaternion()
+{
+  Quatf q(BatchTestGetRandom(), BatchTestGetRandom(), BatchTestGetRandom(), BatchTestGetRandom());
+  q.Normalize();
+  return q;
+}
+
+static bool BatchTestIsExact(const Vector3f& a, const Vector3f& b)
+{
+#ifdef E_MATH_SIMD_FMA
+  return Math::IsRelativelyEqual(a.x, b.x, 1e-5f) && Math::IsRelativelyEqual(a.y, b.y, 1e-5f) && Math::IsRelativelyEqual(a.z, b.z, 1e-5f);
+#else
+  return a.x == b.x && a.y == b.y && a.z == b.z;
+#endif
+}
+
+static bool BatchTestIsExact(const Matrix4f& a, const Matrix4f& b)
+{
+  for (U32 i = 0; i < 16; ++i)
+  {
+#ifdef E_MATH_SIMD_FMA
+    if (!Math::IsRelativelyEqual(a[i], b[i], 1e-5f)) return false;
+#else
+    if (a[i] != b[i]) return false;
+#endif
+  }
+  return true;
+}
+
+/**
+Returns 1 if the bounds are visible, 0 if they are culled and -1 if they touch a culling plane (within rounding error).
+*/
+static I32 BatchTestGetVisibility(const Planef* pPlanes, const Vector3f& center, const Vector3f& extents, F32 radius)
+{
+  F32 minDistance = pPlanes[0].GetDistanceToPoint(center) + radius + extents.x * Math::Abs(pPlanes[0].GetNormal().x) +
+    extents.y * Math::Abs(pPlanes[0].GetNormal().y) + extents.z * Math::Abs(pPlanes[0].GetNormal().z);
+  for (U32 i = 1; i < kBatchTestPlaneCount; ++i)
+  {
+    const Vector3f& normal = pPlanes[i].GetNormal();
+    minDistance = Math::Min(minDistance, pPlanes[i].GetDistanceToPoint(center) + radius +
+      extents.x * Math::Abs(normal.x) + extents.y * Math::Abs(normal.y) + extents.z * Math::Abs(normal.z));
+  }
+  if (Math::Abs(minDistance) < 1e-3f) return -1;
+  return minDistance >= 0.0f ? 1 : 0;
+}
+
+static U32 BatchTestGetVisibleCount(const U32* pVisibleList, size_t count)
+{
+  U32 visibleCount = 0;
+  for (size_t i = 0; i < count; ++i) visibleCount += (pVisibleList[i / 32] >> (i % 32)) & 1;
+  return visibleCount;
+}
+
+static bool BatchTestIsVisibleCountEqual(U32 a, U32 b)
+{
+#ifdef E_MATH_SIMD_FMA
+  // Fused multiply-add may classify bounds touching a plane differently
+  return Math::Abs(static_cast<I32>(a) - static_cast<I32>(b)) <= 10;
+#else
+  return a == b;
+#endif
+}
+
+/**
+Packs the vertices the way Mesh did: a Half call per component and an IBuffer::Add call (byte copy) per vertex.
+*/
+static void BatchTestPackVertices(E::Containers::List<Byte>& vertexBufferData, const Vector3f* pPosition, const Vector3f* pNormal,
+  const Vector2f* pTexCoord, size_t count)
+{
+  BatchTestCompressedVertex vertex = BatchTestCompressedVertex();
+  for (size_t i = 0; i < count; ++i)
+  {
+    vertex.position = pPosition[i];
+    vertex.meshID = 0;
+    vertex.texCoord.x = Math::Half(pTexCoord[i].x);
+    vertex.texCoord.y = Math::Half(pTexCoord[i].y);
+    vertex.normal.x = Math::Half(pNormal[i].x);
+    vertex.normal.y = Math::Half(pNormal[i].y);
+    vertex.normal.z = Math::Half(pNormal[i].z);
+    vertexBufferData.Copy(reinterpret_cast<const Byte*>(&vertex), sizeof(BatchTestCompressedVertex), vertexBufferData.GetCount());
+  }
+}
+
+/**
+Packs the vertices the way Mesh does: whole vertex array packing and a single IBuffer::Add call.
+*/
+static void BatchTestPackVertexArray(E::Containers::List<Byte>& vertexBufferData, const Vector3f* pPosition, const Vector3f* pNormal,
+  const Vector2f* pTexCoord, size_t count)
+{
+  E::Containers::List<BatchTestCompressedVertex> vertexList(count);
+  vertexList.SetCount(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    vertexList[i].position = pPosition[i];
+    vertexList[i].meshID = 0;
+  }
+  Math::Batch::ConvertToHalf(&vertexList[0].texCoord.x, sizeof(BatchTestCompressedVertex), &pTexCoord[0].x, sizeof(Vector2f), 2, count);
+  Math::Batch::ConvertToHalf(&vertexList[0].normal.x, sizeof(BatchTestCompressedVertex), &pNormal[0].x, sizeof(Vector3f), 3, count);
+  vertexBufferData.Copy(reinterpret_cast<const Byte*>(vertexList.GetPtr()), count * sizeof(BatchTestCompressedVertex), vertexBufferData.GetCount());
+}
+
+static void BatchTestPrintTime(const char* pName, size_t size, F32 batchTime, F32 scalarTime)
+{
+  std::cout << pName << " [" << size << "] time [" << batchTime << " / " << scalarTime << "]\t" << (scalarTime / batchTime * 100.0) - 100.0 << "% faster" << std::endl;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TestBatch methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::Batch::Run()
+{
+  try
+  {
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::Batch::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::Batch::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::Batch::RunFunctionalityTest()
+{
+  try
+  {
+    std::cout << "[Test::Batch::RunFunctionalityTest]" << std::endl;
+
+    // Sizes covering empty arrays, scalar remainders and full SIMD blocks
+    const size_t sizeList[] = { 0, 1, 3, 4, 5, 7, 8, 9, 16, 17, 100 };
+    for (size_t s = 0; s < sizeof(sizeList) / sizeof(size_t); ++s)
+    {
+      const size_t size = sizeList[s];
+      Matrix4f m = BatchTestGetRandomMatrix();
+      Planef plane(Vector3f(BatchTestGetRandom(), BatchTestGetRandom(), BatchTestGetRandom()), BatchTestGetRandom());
+      plane.Normalize();
+
+      E::Containers::List<Vector3f> pointList(size + 1);
+      E::Containers::List<Vector3f> resultList(size + 1);
+      E::Containers::List<Matrix4f> matrixListA(size + 1);
+      E::Containers::List<Matrix4f> matrixListB(size + 1);
+      E::Containers::List<Matrix4f> matrixResultList(size + 1);
+      E::Containers::List<Quatf> quaternionList(size + 1);
+      E::Containers::List<Spheref> sphereList(size + 1);
+      E::Containers::List<Box3f> boxList(size + 1);
+      E::Containers::List<F32> xList(size + 1), yList(size + 1), zList(size + 1);
+      E::Containers::List<F32> centerXList(size + 1), centerYList(size + 1), centerZList(size + 1);
+      E::Containers::List<F32> extentXList(size + 1), extentYList(size + 1), extentZList(size + 1), radiusList(size + 1);
+      bool intersectionList[101];
+      for (size_t i = 0; i < size; ++i)
+      {
+        pointList.PushBack(BatchTestGetRandomVector());
+        resultList.PushBack(Vector3f());
+        matrixListA.PushBack(BatchTestGetRandomMatrix());
+        matrixListB.PushBack(BatchTestGetRandomMatrix());
+        matrixResultList.PushBack(Matrix4f());
+        quaternionList.PushBack(BatchTestGetRandomQuaternion());
+        sphereList.PushBack(Spheref(BatchTestGetRandomVector(), Math::Global::GetRandom().GetF32(0.0f, 100.0f)));
+        Vector3f center = BatchTestGetRandomVector();
+        Vector3f extents(Math::Global::GetRandom().GetF32(0.0f, 50.0f), Math::Global::GetRandom().GetF32(0.0f, 50.0f), Math::Global::GetRandom().GetF32(0.0f, 50.0f));
+        boxList.PushBack(Box3f(center - extents, center + extents));
+        xList.PushBack(pointList[i].x);
+        yList.PushBack(pointList[i].y);
+        zList.PushBack(pointList[i].z);
+        centerXList.PushBack(center.x);
+        centerYList.PushBack(center.y);
+        centerZList.PushBack(center.z);
+        extentXList.PushBack(extents.x);
+        extentYList.PushBack(extents.y);
+        extentZList.PushBack(extents.z);
+        radiusList.PushBack(sphereList[i].GetRadius() * 0.25f);
+      }
+
+      /*-----------------------------------------------------------------
+      Point & vector transformation
+      -----------------------------------------------------------------*/
+      Math::Batch::TransformPoints(resultList.GetPtr(), m, pointList.GetPtr(), size);
+      for (size_t i = 0; i < size; ++i) E_ASSERT(BatchTestIsExact(resultList[i], Matrix4f::TransformPoint(m, pointList[i])));
+      Math::Batch::TransformPoints(xList.GetPtr(), yList.GetPtr(), zList.GetPtr(), m, size);
+      for (size_t i = 0; i < size; ++i) E_ASSERT(BatchTestIsExact(resultList[i], Vector3f(xList[i], yList[i], zList[i])));
+      Math::Batch::RotateVectors(resultList.GetPtr(), m, pointList.GetPtr(), size);
+      for (size_t i = 0; i < size; ++i) E_ASSERT(BatchTestIsExact(resultList[i], Matrix4f::RotateVector(m, pointList[i])));
+      // In-place
+      Math::Batch::TransformPoints(pointList.GetPtr(), m, pointList.GetPtr(), size);
+      for (size_t i = 0; i < size; ++i) E_ASSERT(BatchTestIsExact(pointList[i], Vector3f(xList[i], yList[i], zList[i])));
+
+      /*-----------------------------------------------------------------
+      Matrix product & quaternion conversion
+      -----------------------------------------------------------------*/
+      Math::Batch::Multiply(matrixResultList.GetPtr(), matrixListA.GetPtr(), matrixListB.GetPtr(), size);
+      for (size_t i = 0; i < size; ++i) E_ASSERT(BatchTestIsExact(matrixResultList[i], matrixListA[i] * matrixListB[i]));
+      Math::Batch::Multiply(matrixResultList.GetPtr(), matrixListA.GetPtr(), m, size);
+      for (size_t i = 0; i < size; ++i) E_ASSERT(BatchTestIsExact(matrixResultList[i], matrixListA[i] * m));
+      Math::Batch::GetRotation(matrixResultList.GetPtr(), quaternionList.GetPtr(), size);
+      for (size_t i = 0; i < size; ++i)
+      {
+        Matrix4f rotation;
+        quaternionList[i].GetRotation(rotation);
+        E_ASSERT(BatchTestIsExact(matrixResultList[i], rotation));
+      }
+
+      /*-----------------------------------------------------------------
+      Plane intersection
+      -----------------------------------------------------------------*/
+      Math::Batch::IntersectPlaneSpheres(intersectionList, plane, sphereList.GetPtr(), size);
+      for (size_t i = 0; i < size; ++i) E_ASSERT(intersectionList[i] == (plane.GetDistanceToPoint(sphereList[i].GetOrigin()) >= -sphereList[i].GetRadius()));
+      Math::Batch::IntersectPlaneBoxes(intersectionList, plane, boxList.GetPtr(), size);
+      for (size_t i = 0; i < size; ++i)
+      {
+        // A box is behind the plane if all its corners are
+        const Box3f& box = boxList[i];
+        const Vector3f cornerList[] = { box.GetBackBottomLeft(), box.GetBackBottomRight(), box.GetBackTopLeft(), box.GetBackTopRight(),
+          box.GetFrontBottomLeft(), box.GetFrontBottomRight(), box.GetFrontTopLeft(), box.GetFrontTopRight() };
+        F32 maxDistance = plane.GetDistanceToPoint(cornerList[0]);
+        for (U32 j = 1; j < 8; ++j) maxDistance = Math::Max(maxDistance, plane.GetDistanceToPoint(cornerList[j]));
+        // Skip boxes touching the plane (within rounding error)
+        E_ASSERT(Math::Abs(maxDistance) < 1e-3f || intersectionList[i] == (maxDistance >= 0.0f));
+      }
+
+      /*-----------------------------------------------------------------
+      Half conversion
+      -----------------------------------------------------------------*/
+      U16 halfList[101];
+      F32 floatList[101];
+      Math::Batch::ConvertToHalf(halfList, xList.GetPtr(), size);
+      for (size_t i = 0; i < size; ++i) E_ASSERT(halfList[i] == Math::Half(xList[i]));
+      Math::Batch::ConvertToFloat(floatList, halfList, size);
+      for (size_t i = 0; i < size; ++i) E_ASSERT(floatList[i] == Math::HalfToFloat(halfList[i]));
+      // Strided (vertex packing)
+      E::Containers::List<BatchTestCompressedVertex> vertexList(size + 1, BatchTestCompressedVertex());
+      Math::Batch::ConvertToHalf(&vertexList[0].normal.x, sizeof(BatchTestCompressedVertex), &pointList[0].x, sizeof(Vector3f), 3, size);
+      for (size_t i = 0; i < size; ++i)
+      {
+        E_ASSERT(vertexList[i].normal.x == Math::Half(pointList[i].x) && vertexList[i].normal.y == Math::Half(pointList[i].y));
+        E_ASSERT(vertexList[i].normal.z == Math::Half(pointList[i].z) && vertexList[i].normal.w == 0);
+      }
+
+      /*-----------------------------------------------------------------
+      Frustum culling
+      -----------------------------------------------------------------*/
+      // Planes facing the origin so that a part of the bounds is culled
+      Planef planeList[kBatchTestPlaneCount];
+      for (U32 i = 0; i < kBatchTestPlaneCount; ++i)
+      {
+        planeList[i] = Planef(BatchTestGetRandomVector(), Math::Global::GetRandom().GetF32(0.0f, 100.0f));
+        planeList[i].Normalize();
+      }
+      U32 visibleList[4];
+      U8 planeCache[13];
+      for (U32 i = 0; i < 13; ++i) planeCache[i] = 0;
+
+      // Without and with plane cache (twice to test the cached planes of the culled groups)
+      for (U32 k = 0; k < 3; ++k)
+      {
+        U8* pPlaneCache = (k == 0) ? nullptr : planeCache;
+        for (U32 i = 0; i < 4; ++i) visibleList[i] = 0xFFFFFFFF;
+        Math::Batch::CullSpheres(visibleList, planeList, kBatchTestPlaneCount, xList.GetPtr(), yList.GetPtr(), zList.GetPtr(), radiusList.GetPtr(), size, pPlaneCache);
+        for (size_t i = 0; i < size; ++i)
+        {
+          I32 visibility = BatchTestGetVisibility(planeList, Vector3f(xList[i], yList[i], zList[i]), Vector3f(0.0f, 0.0f, 0.0f), radiusList[i]);
+          E_ASSERT(visibility == -1 || static_cast<I32>((visibleList[i / 32] >> (i % 32)) & 1) == visibility);
+        }
+        // Bits beyond the count are cleared
+        if (size % 32) E_ASSERT((visibleList[size / 32] >> (size % 32)) == 0);
+
+        for (U32 i = 0; i < 4; ++i) visibleList[i] = 0xFFFFFFFF;
+        Math::Batch::CullBoxes(visibleList, planeList, kBatchTestPlaneCount, centerXList.GetPtr(), centerYList.GetPtr(), centerZList.GetPtr(),
+          extentXList.GetPtr(), extentYList.GetPtr(), extentZList.GetPtr(), size, pPlaneCache);
+        for (size_t i = 0; i < size; ++i)
+        {
+          I32 visibility = BatchTestGetVisibility(planeList, boxList[i].GetCenter(), boxList[i].GetExtents(), 0.0f);
+          E_ASSERT(visibility == -1 || static_cast<I32>((visibleList[i / 32] >> (i % 32)) & 1) == visibility);
+        }
+        if (size % 32) E_ASSERT((visibleList[size / 32] >> (size % 32)) == 0);
+      }
+      for (U32 i = 0; i < (size + 7) / 8; ++i) E_ASSERT(planeCache[i] < kBatchTestPlaneCount);
+    }
+
+    /*-----------------------------------------------------------------
+    Exhaustive half conversion (all 2^32 floats and all 2^16 halves)
+    -----------------------------------------------------------------*/
+    // NaN inputs may also become NaN halves (F16C quiets them, see Batch contract item 8)
+    const U32 kBlockSize = 65536;
+    E::Containers::List<U32> bitList(kBlockSize);
+    bitList.SetCount(kBlockSize);
+    E::Containers::List<U16> halfBlockList(kBlockSize);
+    halfBlockList.SetCount(kBlockSize);
+    E::Containers::List<F32> floatBlockList(kBlockSize);
+    floatBlockList.SetCount(kBlockSize);
+    for (U64 base = 0; base <= 0xFFFFFFFF; base += kBlockSize)
+    {
+      for (U32 i = 0; i < kBlockSize; ++i) bitList[i] = static_cast<U32>(base + i);
+      const F32* pFloats = reinterpret_cast<const F32*>(bitList.GetPtr());
+      Math::Batch::ConvertToHalf(halfBlockList.GetPtr(), pFloats, kBlockSize);
+      for (U32 i = 0; i < kBlockSize; ++i)
+      {
+        const U16 half = halfBlockList[i];
+        const bool isNanHalf = pFloats[i] != pFloats[i] && (half & 0x7C00) == 0x7C00 && (half & 0x03FF) != 0;
+        E_ASSERT(half == Math::Half(pFloats[i]) || isNanHalf);
+      }
+    }
+    for (U32 i = 0; i < kBlockSize; ++i) halfBlockList[i] = static_cast<U16>(i);
+    Math::Batch::ConvertToFloat(floatBlockList.GetPtr(), halfBlockList.GetPtr(), kBlockSize);
+    for (U32 i = 0; i < kBlockSize; ++i)
+    {
+      const F32 expected = Math::HalfToFloat(static_cast<U16>(i));
+      const bool isNan = expected != expected;
+      E_ASSERT(isNan ? floatBlockList[i] != floatBlockList[i] : memcmp(&floatBlockList[i], &expected, sizeof(F32)) == 0);
+    }
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+bool Test::Batch::RunPerformanceTest()
+{
+  try
+  {
+    std::cout << "[Test::Batch::RunPerformanceTest]" << std::endl;
+    std::cout << "Max size: " << TEST_BATCH_MAX_SIZE << " elements per size: " << TEST_BATCH_ELEMENT_COUNT << std::endl << std::endl;
+
+    E::Containers::List<Vector3f> pointList(TEST_BATCH_MAX_SIZE);
+    E::Containers::List<Vector3f> resultList(TEST_BATCH_MAX_SIZE);
+    E::Containers::List<F32> xList(TEST_BATCH_MAX_SIZE), yList(TEST_BATCH_MAX_SIZE), zList(TEST_BATCH_MAX_SIZE);
+    E::Containers::List<Matrix4f> matrixList(TEST_BATCH_MAX_SIZE);
+    E::Containers::List<Matrix4f> matrixResultList(TEST_BATCH_MAX_SIZE);
+    E::Containers::List<Quatf> quaternionList(TEST_BATCH_MAX_SIZE);
+    E::Containers::List<Spheref> sphereList(TEST_BATCH_MAX_SIZE);
+    E::Containers::List<bool> intersectionList(TEST_BATCH_MAX_SIZE);
+    for (size_t i = 0; i < TEST_BATCH_MAX_SIZE; ++i)
+    {
+      pointList.PushBack(BatchTestGetRandomVector());
+      resultList.PushBack(Vector3f());
+      xList.PushBack(pointList[i].x);
+      yList.PushBack(pointList[i].y);
+      zList.PushBack(pointList[i].z);
+      matrixList.PushBack(BatchTestGetRandomMatrix());
+      matrixResultList.PushBack(Matrix4f());
+      quaternionList.PushBack(BatchTestGetRandomQuaternion());
+      sphereList.PushBack(Spheref(BatchTestGetRandomVector(), Math::Global::GetRandom().GetF32(0.0f, 100.0f)));
+      intersectionList.PushBack(false);
+    }
+    Matrix4f m = BatchTestGetRandomMatrix();
+    Planef plane(Vector3f(0.0f, 1.0f, 0.0f), 0.0f);
+    E::Time::Timer t;
+    F32 checksum = 0.0f;
+
+    for (size_t size = 1000; size <= TEST_BATCH_MAX_SIZE; size *= 10)
+    {
+      const size_t iterationCount = TEST_BATCH_ELEMENT_COUNT / size;
+      std::cout << std::endl;
+
+      // Point transformation (AoS)
+      t.Reset();
+      for (size_t k = 0; k < iterationCount; ++k)
+      {
+        for (size_t i = 0; i < size; ++i) resultList[i] = Matrix4f::TransformPoint(m, pointList[i]);
+      }
+      F32 scalarTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+      checksum += resultList[size - 1].x;
+      t.Reset();
+      for (size_t k = 0; k < iterationCount; ++k) Math::Batch::TransformPoints(resultList.GetPtr(), m, pointList.GetPtr(), size);
+      BatchTestPrintTime("TransformPoints", size, static_cast<F32>(t.GetElapsed().GetMilliseconds()), scalarTime);
+      checksum += resultList[size - 1].x;
+
+      // Point transformation (SoA, in-place)
+      t.Reset();
+      for (size_t k = 0; k < iterationCount; ++k) Math::Batch::TransformPoints(xList.GetPtr(), yList.GetPtr(), zList.GetPtr(), m, size);
+      BatchTestPrintTime("TransformPoints SoA", size, static_cast<F32>(t.GetElapsed().GetMilliseconds()), scalarTime);
+      checksum += xList[size - 1];
+
+      // Matrix product
+      t.Reset();
+      for (size_t k = 0; k < iterationCount; ++k)
+      {
+        for (size_t i = 0; i < size; ++i) matrixResultList[i] = matrixList[i] * m;
+      }
+      scalarTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+      checksum += matrixResultList[size - 1][0];
+      t.Reset();
+      for (size_t k = 0; k < iterationCount; ++k) Math::Batch::Multiply(matrixResultList.GetPtr(), matrixList.GetPtr(), m, size);
+      BatchTestPrintTime("Multiply", size, static_cast<F32>(t.GetElapsed().GetMilliseconds()), scalarTime);
+      checksum += matrixResultList[size - 1][0];
+
+      // Quaternion to matrix
+      t.Reset();
+      for (size_t k = 0; k < iterationCount; ++k)
+      {
+        for (size_t i = 0; i < size; ++i) quaternionList[i].GetRotation(matrixResultList[i]);
+      }
+      scalarTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+      checksum += matrixResultList[size - 1][0];
+      t.Reset();
+      for (size_t k = 0; k < iterationCount; ++k) Math::Batch::GetRotation(matrixResultList.GetPtr(), quaternionList.GetPtr(), size);
+      BatchTestPrintTime("GetRotation", size, static_cast<F32>(t.GetElapsed().GetMilliseconds()), scalarTime);
+      checksum += matrixResultList[size - 1][0];
+
+      // Sphere vs plane
+      t.Reset();
+      for (size_t k = 0; k < iterationCount; ++k)
+      {
+        for (size_t i = 0; i < size; ++i) intersectionList[i] = plane.GetDistanceToPoint(sphereList[i].GetOrigin()) >= -sphereList[i].GetRadius();
+      }
+      scalarTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+      checksum += intersectionList[size - 1] ? 1.0f : 0.0f;
+      t.Reset();
+      for (size_t k = 0; k < iterationCount; ++k) Math::Batch::IntersectPlaneSpheres(intersectionList.GetPtr(), plane, sphereList.GetPtr(), size);
+      BatchTestPrintTime("IntersectPlaneSpheres", size, static_cast<F32>(t.GetElapsed().GetMilliseconds()), scalarTime);
+      checksum += intersectionList[size - 1] ? 1.0f : 0.0f;
+    }
+
+    /*-----------------------------------------------------------------
+    Frustum culling
+    -----------------------------------------------------------------*/
+    // 90 degree perspective frustum looking down the z axis
+    const Planef planeList[kBatchTestPlaneCount] =
+    {
+      Planef(Vector3f(Math::kSqrt2Div2f, 0.0f, Math::kSqrt2Div2f), 0.0f),
+      Planef(Vector3f(-Math::kSqrt2Div2f, 0.0f, Math::kSqrt2Div2f), 0.0f),
+      Planef(Vector3f(0.0f, Math::kSqrt2Div2f, Math::kSqrt2Div2f), 0.0f),
+      Planef(Vector3f(0.0f, -Math::kSqrt2Div2f, Math::kSqrt2Div2f), 0.0f),
+      Planef(Vector3f(0.0f, 0.0f, 1.0f), -1.0f),
+      Planef(Vector3f(0.0f, 0.0f, -1.0f), 100.0f)
+    };
+    E::Containers::List<F32> cullXList(TEST_BATCH_CULL_COUNT), cullYList(TEST_BATCH_CULL_COUNT), cullZList(TEST_BATCH_CULL_COUNT);
+    E::Containers::List<F32> cullRadiusList(TEST_BATCH_CULL_COUNT);
+    E::Containers::List<F32> cullExtentXList(TEST_BATCH_CULL_COUNT), cullExtentYList(TEST_BATCH_CULL_COUNT), cullExtentZList(TEST_BATCH_CULL_COUNT);
+    // Objects stored in spatially coherent clusters of 32 (i.e. in spatial index order)
+    Vector3f clusterCenter;
+    for (size_t i = 0; i < TEST_BATCH_CULL_COUNT; ++i)
+    {
+      if (i % 32 == 0) clusterCenter = BatchTestGetRandomVector();
+      cullXList.PushBack(clusterCenter.x + Math::Global::GetRandom().GetF32(-4.0f, 4.0f));
+      cullYList.PushBack(clusterCenter.y + Math::Global::GetRandom().GetF32(-4.0f, 4.0f));
+      cullZList.PushBack(clusterCenter.z + Math::Global::GetRandom().GetF32(-4.0f, 4.0f));
+      cullRadiusList.PushBack(Math::Global::GetRandom().GetF32(0.0f, 2.0f));
+      cullExtentXList.PushBack(Math::Global::GetRandom().GetF32(0.0f, 2.0f));
+      cullExtentYList.PushBack(Math::Global::GetRandom().GetF32(0.0f, 2.0f));
+      cullExtentZList.PushBack(Math::Global::GetRandom().GetF32(0.0f, 2.0f));
+    }
+    E::Containers::List<U32> cullVisibleList((TEST_BATCH_CULL_COUNT + 31) / 32, 0);
+    E::Containers::List<U8> cullPlaneCache((TEST_BATCH_CULL_COUNT + 7) / 8, 0);
+    std::cout << std::endl;
+
+    // Sphere culling: Graphics::Frustum::IsInside per object
+    t.Reset();
+    for (U32 k = 0; k < TEST_BATCH_CULL_ITERATION_COUNT; ++k)
+    {
+      for (size_t i = 0; i < TEST_BATCH_CULL_COUNT; ++i)
+      {
+        const Vector3f point(cullXList[i], cullYList[i], cullZList[i]);
+        U32 j = 0;
+        while (j < kBatchTestPlaneCount && !(planeList[j].GetDistanceToPoint(point) < -cullRadiusList[i])) ++j;
+        if (i % 32 == 0) cullVisibleList[i / 32] = 0;
+        if (j == kBatchTestPlaneCount) cullVisibleList[i / 32] |= 1u << (i % 32);
+      }
+    }
+    F32 scalarTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+    U32 scalarVisibleCount = BatchTestGetVisibleCount(cullVisibleList.GetPtr(), TEST_BATCH_CULL_COUNT);
+    t.Reset();
+    for (U32 k = 0; k < TEST_BATCH_CULL_ITERATION_COUNT; ++k)
+    {
+      Math::Batch::CullSpheres(cullVisibleList.GetPtr(), planeList, kBatchTestPlaneCount, cullXList.GetPtr(), cullYList.GetPtr(), cullZList.GetPtr(),
+        cullRadiusList.GetPtr(), TEST_BATCH_CULL_COUNT);
+    }
+    BatchTestPrintTime("CullSpheres", TEST_BATCH_CULL_COUNT, static_cast<F32>(t.GetElapsed().GetMilliseconds()), scalarTime);
+    E_ASSERT(BatchTestIsVisibleCountEqual(BatchTestGetVisibleCount(cullVisibleList.GetPtr(), TEST_BATCH_CULL_COUNT), scalarVisibleCount));
+    t.Reset();
+    for (U32 k = 0; k < TEST_BATCH_CULL_ITERATION_COUNT; ++k)
+    {
+      Math::Batch::CullSpheres(cullVisibleList.GetPtr(), planeList, kBatchTestPlaneCount, cullXList.GetPtr(), cullYList.GetPtr(), cullZList.GetPtr(),
+        cullRadiusList.GetPtr(), TEST_BATCH_CULL_COUNT, cullPlaneCache.GetPtr());
+    }
+    BatchTestPrintTime("CullSpheres cached", TEST_BATCH_CULL_COUNT, static_cast<F32>(t.GetElapsed().GetMilliseconds()), scalarTime);
+    E_ASSERT(BatchTestIsVisibleCountEqual(BatchTestGetVisibleCount(cullVisibleList.GetPtr(), TEST_BATCH_CULL_COUNT), scalarVisibleCount));
+    std::cout << "Visible spheres: " << scalarVisibleCount << std::endl;
+
+    // Box culling
+    for (size_t i = 0; i < cullPlaneCache.GetCount(); ++i) cullPlaneCache[i] = 0;
+    t.Reset();
+    for (U32 k = 0; k < TEST_BATCH_CULL_ITERATION_COUNT; ++k)
+    {
+      for (size_t i = 0; i < TEST_BATCH_CULL_COUNT; ++i)
+      {
+        const Vector3f point(cullXList[i], cullYList[i], cullZList[i]);
+        U32 j = 0;
+        for (; j < kBatchTestPlaneCount; ++j)
+        {
+          const Vector3f& normal = planeList[j].GetNormal();
+          const F32 radius = cullExtentXList[i] * Math::Abs(normal.x) + cullExtentYList[i] * Math::Abs(normal.y) + cullExtentZList[i] * Math::Abs(normal.z);
+          if (planeList[j].GetDistanceToPoint(point) < -radius) break;
+        }
+        if (i % 32 == 0) cullVisibleList[i / 32] = 0;
+        if (j == kBatchTestPlaneCount) cullVisibleList[i / 32] |= 1u << (i % 32);
+      }
+    }
+    scalarTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+    scalarVisibleCount = BatchTestGetVisibleCount(cullVisibleList.GetPtr(), TEST_BATCH_CULL_COUNT);
+    t.Reset();
+    for (U32 k = 0; k < TEST_BATCH_CULL_ITERATION_COUNT; ++k)
+    {
+      Math::Batch::CullBoxes(cullVisibleList.GetPtr(), planeList, kBatchTestPlaneCount, cullXList.GetPtr(), cullYList.GetPtr(), cullZList.GetPtr(),
+        cullExtentXList.GetPtr(), cullExtentYList.GetPtr(), cullExtentZList.GetPtr(), TEST_BATCH_CULL_COUNT);
+    }
+    BatchTestPrintTime("CullBoxes", TEST_BATCH_CULL_COUNT, static_cast<F32>(t.GetElapsed().GetMilliseconds()), scalarTime);
+    E_ASSERT(BatchTestIsVisibleCountEqual(BatchTestGetVisibleCount(cullVisibleList.GetPtr(), TEST_BATCH_CULL_COUNT), scalarVisibleCount));
+    t.Reset();
+    for (U32 k = 0; k < TEST_BATCH_CULL_ITERATION_COUNT; ++k)
+    {
+      Math::Batch::CullBoxes(cullVisibleList.GetPtr(), planeList, kBatchTestPlaneCount, cullXList.GetPtr(), cullYList.GetPtr(), cullZList.GetPtr(),
+        cullExtentXList.GetPtr(), cullExtentYList.GetPtr(), cullExtentZList.GetPtr(), TEST_BATCH_CULL_COUNT, cullPlaneCache.GetPtr());
+    }
+    BatchTestPrintTime("CullBoxes cached", TEST_BATCH_CULL_COUNT, static_cast<F32>(t.GetElapsed().GetMilliseconds()), scalarTime);
+    E_ASSERT(BatchTestIsVisibleCountEqual(BatchTestGetVisibleCount(cullVisibleList.GetPtr(), TEST_BATCH_CULL_COUNT), scalarVisibleCount));
+    std::cout << "Visible boxes: " << scalarVisibleCount << std::endl;
+
+    /*-----------------------------------------------------------------
+    Vertex packing (mesh upload preparation)
+    -----------------------------------------------------------------*/
+    E::Containers::List<Vector3f> vertexPositionList(TEST_BATCH_VERTEX_COUNT);
+    E::Containers::List<Vector3f> vertexNormalList(TEST_BATCH_VERTEX_COUNT);
+    E::Containers::List<Vector2f> vertexTexCoordList(TEST_BATCH_VERTEX_COUNT);
+    for (size_t i = 0; i < TEST_BATCH_VERTEX_COUNT; ++i)
+    {
+      vertexPositionList.PushBack(BatchTestGetRandomVector());
+      Vector3f normal = BatchTestGetRandomVector();
+      normal.Normalize();
+      vertexNormalList.PushBack(normal);
+      vertexTexCoordList.PushBack(Vector2f(Math::Global::GetRandom().GetF32(0.0f, 1.0f), Math::Global::GetRandom().GetF32(0.0f, 1.0f)));
+    }
+    std::cout << std::endl;
+
+    // Per vertex appends reallocate the buffer data every time (range addition does not use the growth factor) so they
+    // are measured with a reserved buffer, which is the best case for them, and with a growing buffer on a smaller mesh
+    const size_t vertexCountList[] = { TEST_BATCH_VERTEX_COUNT, TEST_BATCH_VERTEX_GROWTH_COUNT };
+    for (U32 k = 0; k < 2; ++k)
+    {
+      const size_t vertexCount = vertexCountList[k];
+      E::Containers::List<Byte> vertexBufferData((k == 0) ? vertexCount * sizeof(BatchTestCompressedVertex) : 0);
+      t.Reset();
+      BatchTestPackVertices(vertexBufferData, vertexPositionList.GetPtr(), vertexNormalList.GetPtr(), vertexTexCoordList.GetPtr(), vertexCount);
+      F32 scalarTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+      E::Containers::List<Byte> packedVertexBufferData;
+      t.Reset();
+      BatchTestPackVertexArray(packedVertexBufferData, vertexPositionList.GetPtr(), vertexNormalList.GetPtr(), vertexTexCoordList.GetPtr(), vertexCount);
+      BatchTestPrintTime((k == 0) ? "Vertex packing (reserved)" : "Vertex packing", vertexCount, static_cast<F32>(t.GetElapsed().GetMilliseconds()), scalarTime);
+      E_ASSERT(vertexBufferData.GetCount() == packedVertexBufferData.GetCount());
+      E_ASSERT(std::memcmp(vertexBufferData.GetPtr(), packedVertexBufferData.GetPtr(), vertexBufferData.GetCount()) == 0);
+    }
+
+    // Bulk conversion
+    const size_t componentCount = TEST_BATCH_VERTEX_COUNT * 3;
+    const F32* pComponents = &vertexNormalList[0].x;
+    E::Containers::List<U16> halfList(componentCount, 0);
+    E::Containers::List<F32> floatList(componentCount, 0.0f);
+    t.Reset();
+    for (U32 k = 0; k < TEST_BATCH_CONVERSION_ITERATION_COUNT; ++k)
+    {
+      for (size_t i = 0; i < componentCount; ++i) halfList[i] = Math::Half(pComponents[i]);
+    }
+    scalarTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+    t.Reset();
+    for (U32 k = 0; k < TEST_BATCH_CONVERSION_ITERATION_COUNT; ++k) Math::Batch::ConvertToHalf(halfList.GetPtr(), pComponents, componentCount);
+    BatchTestPrintTime("ConvertToHalf", componentCount, static_cast<F32>(t.GetElapsed().GetMilliseconds()), scalarTime);
+    t.Reset();
+    for (U32 k = 0; k < TEST_BATCH_CONVERSION_ITERATION_COUNT; ++k)
+    {
+      for (size_t i = 0; i < componentCount; ++i) floatList[i] = Math::HalfToFloat(halfList[i]);
+    }
+    scalarTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+    checksum += floatList[componentCount - 1];
+    t.Reset();
+    for (U32 k = 0; k < TEST_BATCH_CONVERSION_ITERATION_COUNT; ++k) Math::Batch::ConvertToFloat(floatList.GetPtr(), halfList.GetPtr(), componentCount);
+    BatchTestPrintTime("ConvertToFloat", componentCount, static_cast<F32>(t.GetElapsed().GetMilliseconds()), scalarTime);
+    checksum += floatList[componentCount - 1];
+
+    std::cout << std::endl << "Checksum: " << checksum << std::endl;
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,564 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Bvh.cpp
+This file defines E::Math::Bvh test functions.
+*/
+
+#include <CoreTestPch.h>
+#include <fstream>
+#include <sstream>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef TEST_BVH_TRIANGLE_COUNT
+#define TEST_BVH_TRIANGLE_COUNT 5000
+#endif
+
+#ifndef TEST_BVH_BOX_COUNT
+#define TEST_BVH_BOX_COUNT 2000
+#endif
+
+#ifndef TEST_BVH_RAY_COUNT
+#define TEST_BVH_RAY_COUNT 2000
+#endif
+
+#ifndef TEST_BVH_IMAGE_SIZE
+#define TEST_BVH_IMAGE_SIZE 1024
+#endif
+
+#ifndef TEST_BVH_SPHERE_GRID_SIZE
+#define TEST_BVH_SPHERE_GRID_SIZE 6
+#endif
+
+#ifndef TEST_BVH_MODEL_PATH
+#define TEST_BVH_MODEL_PATH "../../../Data/Models/Fokker/fokker.obj"
+#endif
+
+struct BvhTestMesh
+{
+  Containers::List<Vector3f>  positionList;
+  Containers::List<U32>       indexList;
+  U32 GetTriangleCount() const { return static_cast<U32>(indexList.GetCount() / 3); }
+};
+
+// Forwards world hierarchy queries to the mesh hierarchies (one per world box)
+struct BvhTestMeshIntersector
+{
+  BvhTestMeshIntersector(const Math::Bvh* pMeshBvhs, const Vector3f& rayOrigin, const Vector3f& rayDirection)
+    : pMeshBvhs(pMeshBvhs), rayOrigin(rayOrigin), rayDirection(rayDirection), meshTriangle(Math::Bvh::kInvalidIndex) {}
+
+  bool operator()(U32 primitiveIndex, F32& lambda)
+  {
+    Math::Bvh::Hit hit;
+    hit.lambda = lambda;
+    if (!pMeshBvhs[primitiveIndex].Intersect(rayOrigin, rayDirection, hit)) return false;
+
+    lambda = hit.lambda;
+    meshTriangle = hit.primitiveIndex;
+    return true;
+  }
+
+  const Math::Bvh*  pMeshBvhs;
+  const Vector3f&   rayOrigin;
+  const Vector3f&   rayDirection;
+  U32               meshTriangle;
+};
+
+static Vector3f BvhTestGetRandomVector(F32 min, F32 max)
+{
+  Math::RandomNumberGenerator& random = Math::Global::GetRandom();
+  return Vector3f(random.GetF32(min, max), random.GetF32(min, max), random.GetF32(min, max));
+}
+
+static void BvhTestCreateTriangles(BvhTestMesh& mesh, U32 triangleCount)
+{
+  for (U32 i = 0; i < triangleCount; ++i)
+  {
+    const Vector3f center = BvhTestGetRandomVector(-100.0f, 100.0f);
+    for (U32 j = 0; j < 3; ++j)
+    {
+      mesh.indexList.PushBack(static_cast<U32>(mesh.positionList.GetCount()));
+      mesh.positionList.PushBack(center + BvhTestGetRandomVector(-5.0f, 5.0f));
+    }
+  }
+}
+
+// Same vertex & index layout as Graphics::Scene::MeshHelper::CreateSphere
+static void BvhTestCreateSphere(BvhTestMesh& mesh, const Vector3f& center, F32 radius, U32 sliceCount, U32 stackCount)
+{
+  const U32 baseVertex = static_cast<U32>(mesh.positionList.GetCount());
+  const F32 phiStep = Math::kPif / stackCount;
+  const F32 thetaStep = Math::k2Pif / sliceCount;
+  const U32 ringCount = stackCount - 1;
+  for (U32 i = 1; i <= ringCount; ++i)
+  {
+    const F32 phi = i * phiStep;
+    for (U32 j = 0; j <= sliceCount; ++j)
+    {
+      const F32 theta = j * thetaStep;
+      mesh.positionList.PushBack(center + Vector3f(radius * Math::Sin(phi) * Math::Cos(theta), radius * Math::Cos(phi), radius * Math::Sin(phi) * Math::Sin(theta)));
+    }
+  }
+  mesh.positionList.PushBack(center + Vector3f(0.0f, -radius, 0.0f));
+  mesh.positionList.PushBack(center + Vector3f(0.0f, radius, 0.0f));
+
+  const U32 northPoleIndex = static_cast<U32>(mesh.positionList.GetCount() - 1) - baseVertex;
+  const U32 southPoleIndex = northPoleIndex - 1;
+  const U32 ringVertexCount = sliceCount + 1;
+  const U32 indices[6] = { 0, 1, ringVertexCount, ringVertexCount, 1, ringVertexCount + 1 };
+  for (U32 i = 0; i < stackCount - 2; ++i)
+  {
+    for (U32 j = 0; j < sliceCount; ++j)
+    {
+      for (U32 k = 0; k < 6; ++k) mesh.indexList.PushBack(baseVertex + i * ringVertexCount + j + indices[k]);
+    }
+  }
+  const U32 baseIndex = (ringCount - 1) * ringVertexCount;
+  for (U32 i = 0; i < sliceCount; ++i)
+  {
+    mesh.indexList.PushBack(baseVertex + northPoleIndex);
+    mesh.indexList.PushBack(baseVertex + i + 1);
+    mesh.indexList.PushBack(baseVertex + i);
+    mesh.indexList.PushBack(baseVertex + southPoleIndex);
+    mesh.indexList.PushBack(baseVertex + baseIndex + i);
+    mesh.indexList.PushBack(baseVertex + baseIndex + i + 1);
+  }
+}
+
+// Minimal Wavefront OBJ reader: vertex positions and (fan triangulated) faces
+static bool BvhTestLoadModel(BvhTestMesh& mesh, const char* pPath)
+{
+  std::ifstream file(pPath);
+  if (!file.is_open()) return false;
+
+  std::string line;
+  while (std::getline(file, line))
+  {
+    std::istringstream stream(line);
+    std::string type;
+    stream >> type;
+    if (type == "v")
+    {
+      Vector3f position;
+      stream >> position.x >> position.y >> position.z;
+      mesh.positionList.PushBack(position);
+    }
+    else if (type == "f")
+    {
+      Containers::List<U32> faceList;
+      std::string vertex;
+      while (stream >> vertex) faceList.PushBack(static_cast<U32>(atoi(vertex.c_str()) - 1));
+      for (U32 i = 2; i < faceList.GetCount(); ++i)
+      {
+        mesh.indexList.PushBack(faceList[0]);
+        mesh.indexList.PushBack(faceList[i - 1]);
+        mesh.indexList.PushBack(faceList[i]);
+      }
+    }
+  }
+
+  return !mesh.indexList.IsEmpty();
+}
+
+// Pinhole camera rays looking at the bounds center from outside the bounds (rows of coherent rays)
+static void BvhTestCreateRays(Containers::List<Vector3f>& originList, Containers::List<Vector3f>& directionList, const Vector3f& min, const Vector3f& max, U32 imageSize)
+{
+  const Vector3f center = (min + max) * 0.5f;
+  const Vector3f extents = (max - min) * 0.5f;
+  const F32 radius = extents.GetLength();
+  const Vector3f origin = center + Vector3f(radius * 0.6f, radius * 0.5f, -radius * 1.8f);
+  Vector3f forward = center - origin;
+  forward.Normalize();
+  Vector3f right = Vector3f::Cross(Vector3f(0.0f, 1.0f, 0.0f), forward);
+  right.Normalize();
+  const Vector3f up = Vector3f::Cross(forward, right);
+
+  originList.Reserve(imageSize * imageSize);
+  directionList.Reserve(imageSize * imageSize);
+  for (U32 y = 0; y < imageSize; ++y)
+  {
+    for (U32 x = 0; x < imageSize; ++x)
+    {
+      const F32 u = (static_cast<F32>(x) + 0.5f) / imageSize - 0.5f;
+      const F32 v = (static_cast<F32>(y) + 0.5f) / imageSize - 0.5f;
+      Vector3f direction = forward + right * u + up * v;
+      direction.Normalize();
+      originList.PushBack(origin);
+      directionList.PushBack(direction);
+    }
+  }
+}
+
+static bool BvhTestIntersectBruteForce(const BvhTestMesh& mesh, const Vector3f& rayOrigin, const Vector3f& rayDirection, F32& outLambda)
+{
+  bool result = false;
+  outLambda = Math::NumericLimits<F32>::Max();
+  for (U32 i = 0; i < mesh.GetTriangleCount(); ++i)
+  {
+    F32 lambda;
+    const U32* pIndices = &mesh.indexList[i * 3];
+    if (Math::IntersectRayTriangle(rayOrigin, rayDirection, mesh.positionList[pIndices[0]], mesh.positionList[pIndices[1]], mesh.positionList[pIndices[2]], lambda, false) && lambda >= 0.0f && lambda < outLambda)
+    {
+      outLambda = lambda;
+      result = true;
+    }
+  }
+  return result;
+}
+
+static bool BvhTestIntersectBruteForce(const Box3f* pBoxes, U32 count, const Vector3f& rayOrigin, const Vector3f& rayDirection, F32& outLambda)
+{
+  bool result = false;
+  outLambda = Math::NumericLimits<F32>::Max();
+  for (U32 i = 0; i < count; ++i)
+  {
+    // Slab test clamping the entry distance to the ray origin
+    const Vector3f min = pBoxes[i].GetMin();
+    const Vector3f max = pBoxes[i].GetMax();
+    F32 nearLambda = 0.0f;
+    F32 farLambda = outLambda;
+    for (U32 axis = 0; axis < 3; ++axis)
+    {
+      const F32 invDirection = 1.0f / rayDirection[axis];
+      const F32 lambda0 = (min[axis] - rayOrigin[axis]) * invDirection;
+      const F32 lambda1 = (max[axis] - rayOrigin[axis]) * invDirection;
+      nearLambda = Math::Max(nearLambda, Math::Min(lambda0, lambda1));
+      farLambda = Math::Min(farLambda, Math::Max(lambda0, lambda1));
+    }
+    if (nearLambda <= farLambda && nearLambda < outLambda)
+    {
+      outLambda = nearLambda;
+      result = true;
+    }
+  }
+  return result;
+}
+
+static bool BvhTestIsEqual(F32 a, F32 b)
+{
+  return Math::Abs(a - b) <= 1e-3f * Math::Max(1.0f, Math::Abs(a));
+}
+
+static void BvhTestRunBenchmark(const char* pName, const BvhTestMesh& mesh)
+{
+  E::Time::Timer t;
+  Math::Bvh bvh;
+  bvh.Build(mesh.positionList.GetPtr(), mesh.indexList.GetPtr(), mesh.GetTriangleCount());
+  F32 buildTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+  t.Reset();
+  bvh.Refit(mesh.positionList.GetPtr(), mesh.indexList.GetPtr());
+  F32 refitTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+  std::cout << pName << ": " << mesh.GetTriangleCount() << " triangles, " << bvh.GetNodeCount() << " nodes, depth " << bvh.GetDepth() << std::endl;
+  std::cout << "Build time " << buildTime << " ms, refit time " << refitTime << " ms" << std::endl;
+
+  Vector3f min, max;
+  Vector3f::MinMax(min, max, mesh.positionList.GetPtr(), static_cast<U32>(mesh.positionList.GetCount()));
+  Containers::List<Vector3f> originList, directionList;
+  BvhTestCreateRays(originList, directionList, min, max, TEST_BVH_IMAGE_SIZE);
+  const U32 rayCount = static_cast<U32>(originList.GetCount());
+
+  Containers::List<Math::Bvh::Hit> hitList(rayCount, Math::Bvh::Hit());
+  t.Reset();
+  for (U32 i = 0; i < rayCount; ++i) bvh.Intersect(originList[i], directionList[i], hitList[i]);
+  F32 singleTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+  Containers::List<Math::Bvh::Hit> packetHitList(rayCount, Math::Bvh::Hit());
+  t.Reset();
+  bvh.Intersect(originList.GetPtr(), directionList.GetPtr(), packetHitList.GetPtr(), rayCount);
+  F32 packetTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+  U32 hitCount = 0;
+  F32 checksum = 0.0f;
+  for (U32 i = 0; i < rayCount; ++i)
+  {
+    E_ASSERT(hitList[i].lambda == packetHitList[i].lambda);
+    if (hitList[i].primitiveIndex == Math::Bvh::kInvalidIndex) continue;
+    ++hitCount;
+    checksum += hitList[i].lambda + packetHitList[i].lambda;
+  }
+
+  std::cout << "Rays " << rayCount << " hits " << hitCount << " checksum " << checksum << std::endl;
+  std::cout << "Single ray rate " << rayCount / singleTime / 1000.0f << " Mrays/s, packet rate " << rayCount / packetTime / 1000.0f << " Mrays/s" << std::endl;
+  std::cout << "Packet time [" << packetTime << " / " << singleTime << "]\t" << (singleTime / packetTime * 100.0) - 100.0 << "% faster" << std::endl << std::endl;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TestBvh methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::Bvh::Run()
+{
+  try
+  {
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::Bvh::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::Bvh::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::Bvh::RunFunctionalityTest()
+{
+  try
+  {
+    std::cout << "[Test::Bvh::RunFunctionalityTest]" << std::endl;
+    Math::Global::GetRandom().SetSeed(340340);
+
+    /*-----------------------------------------------------------------
+    Empty hierarchy
+    -----------------------------------------------------------------*/
+    Math::Bvh bvh;
+    Math::Bvh::Hit hit;
+    E_ASSERT(bvh.IsEmpty() && bvh.GetPrimitiveCount() == 0);
+    E_ASSERT(!bvh.Intersect(Vector3f(0.0f), Vector3f(0.0f, 0.0f, 1.0f), hit) && hit.primitiveIndex == Math::Bvh::kInvalidIndex);
+
+    /*-----------------------------------------------------------------
+    Triangle hierarchy (against brute force)
+    -----------------------------------------------------------------*/
+    BvhTestMesh mesh;
+    BvhTestCreateTriangles(mesh, TEST_BVH_TRIANGLE_COUNT);
+    bvh.Build(mesh.positionList.GetPtr(), mesh.indexList.GetPtr(), mesh.GetTriangleCount());
+    E_ASSERT(!bvh.IsEmpty() && bvh.GetPrimitiveCount() == TEST_BVH_TRIANGLE_COUNT);
+    E_ASSERT(bvh.GetNodeCount() < TEST_BVH_TRIANGLE_COUNT * 2);
+
+    Containers::List<Vector3f> originList(TEST_BVH_RAY_COUNT);
+    Containers::List<Vector3f> directionList(TEST_BVH_RAY_COUNT);
+    for (U32 i = 0; i < TEST_BVH_RAY_COUNT; ++i)
+    {
+      originList.PushBack(BvhTestGetRandomVector(-150.0f, 150.0f));
+      Vector3f direction = BvhTestGetRandomVector(-100.0f, 100.0f) - originList[i];
+      direction.Normalize();
+      directionList.PushBack(direction);
+    }
+    // Axis aligned rays (infinite inverse directions)
+    directionList[0] = Vector3f(1.0f, 0.0f, 0.0f);
+    directionList[1] = Vector3f(0.0f, -1.0f, 0.0f);
+    directionList[2] = Vector3f(0.0f, 0.0f, 1.0f);
+
+    Containers::List<Math::Bvh::Hit> hitList(TEST_BVH_RAY_COUNT, Math::Bvh::Hit());
+    U32 hitCount = 0;
+    for (U32 i = 0; i < TEST_BVH_RAY_COUNT; ++i)
+    {
+      F32 lambda;
+      const bool result = bvh.Intersect(originList[i], directionList[i], hitList[i]);
+      E_ASSERT(result == BvhTestIntersectBruteForce(mesh, originList[i], directionList[i], lambda));
+      if (!result) continue;
+
+      E_ASSERT(BvhTestIsEqual(hitList[i].lambda, lambda) && hitList[i].primitiveIndex < TEST_BVH_TRIANGLE_COUNT);
+      ++hitCount;
+    }
+    E_ASSERT(hitCount > 0);
+
+    // Maximum distance
+    for (U32 i = 0; i < TEST_BVH_RAY_COUNT; ++i)
+    {
+      if (hitList[i].primitiveIndex == Math::Bvh::kInvalidIndex) continue;
+      hit = Math::Bvh::Hit();
+      hit.lambda = hitList[i].lambda * 0.5f;
+      if (bvh.Intersect(originList[i], directionList[i], hit)) E_ASSERT(hit.lambda < hitList[i].lambda * 0.5f);
+    }
+
+    /*-----------------------------------------------------------------
+    Packet traversal (against single ray traversal)
+    -----------------------------------------------------------------*/
+    Containers::List<Math::Bvh::Hit> packetHitList(TEST_BVH_RAY_COUNT, Math::Bvh::Hit());
+    bvh.Intersect(originList.GetPtr(), directionList.GetPtr(), packetHitList.GetPtr(), TEST_BVH_RAY_COUNT);
+    for (U32 i = 0; i < TEST_BVH_RAY_COUNT; ++i)
+    {
+      E_ASSERT(packetHitList[i].lambda == hitList[i].lambda);
+      E_ASSERT((packetHitList[i].primitiveIndex == Math::Bvh::kInvalidIndex) == (hitList[i].primitiveIndex == Math::Bvh::kInvalidIndex));
+    }
+
+    /*-----------------------------------------------------------------
+    Triangle refit (against rebuild)
+    -----------------------------------------------------------------*/
+    for (U32 i = 0; i < mesh.positionList.GetCount(); ++i) mesh.positionList[i] += BvhTestGetRandomVector(-2.0f, 2.0f);
+    bvh.Refit(mesh.positionList.GetPtr(), mesh.indexList.GetPtr());
+    Math::Bvh rebuiltBvh;
+    rebuiltBvh.Build(mesh.positionList.GetPtr(), mesh.indexList.GetPtr(), mesh.GetTriangleCount());
+    for (U32 i = 0; i < TEST_BVH_RAY_COUNT; ++i)
+    {
+      Math::Bvh::Hit refitHit, rebuiltHit;
+      E_ASSERT(bvh.Intersect(originList[i], directionList[i], refitHit) == rebuiltBvh.Intersect(originList[i], directionList[i], rebuiltHit));
+      E_ASSERT(refitHit.lambda == rebuiltHit.lambda);
+    }
+
+    /*-----------------------------------------------------------------
+    Box hierarchy (against brute force)
+    -----------------------------------------------------------------*/
+    Containers::List<Box3f> boxList(TEST_BVH_BOX_COUNT);
+    for (U32 i = 0; i < TEST_BVH_BOX_COUNT; ++i)
+    {
+      const Vector3f min = BvhTestGetRandomVector(-100.0f, 100.0f);
+      boxList.PushBack(Box3f(min, min + BvhTestGetRandomVector(0.1f, 5.0f)));
+    }
+    Math::Bvh boxBvh;
+    boxBvh.Build(boxList.GetPtr(), TEST_BVH_BOX_COUNT);
+    E_ASSERT(boxBvh.GetPrimitiveCount() == TEST_BVH_BOX_COUNT);
+
+    for (U32 i = 0; i < TEST_BVH_RAY_COUNT; ++i)
+    {
+      F32 lambda;
+      hitList[i] = Math::Bvh::Hit();
+      const bool result = boxBvh.Intersect(originList[i], directionList[i], hitList[i]);
+      E_ASSERT(result == BvhTestIntersectBruteForce(boxList.GetPtr(), TEST_BVH_BOX_COUNT, originList[i], directionList[i], lambda));
+      if (result) E_ASSERT(hitList[i].lambda == lambda);
+    }
+
+    packetHitList.Fill(Math::Bvh::Hit());
+    boxBvh.Intersect(originList.GetPtr(), directionList.GetPtr(), packetHitList.GetPtr(), TEST_BVH_RAY_COUNT);
+    for (U32 i = 0; i < TEST_BVH_RAY_COUNT; ++i) E_ASSERT(packetHitList[i].lambda == hitList[i].lambda);
+
+    /*-----------------------------------------------------------------
+    Incremental box refit (against brute force)
+    -----------------------------------------------------------------*/
+    for (U32 i = 0; i < TEST_BVH_BOX_COUNT; i += 7)
+    {
+      const Vector3f min = BvhTestGetRandomVector(-100.0f, 100.0f);
+      boxList[i] = Box3f(min, min + BvhTestGetRandomVector(0.1f, 5.0f));
+      boxBvh.Refit(i, boxList[i]);
+    }
+    for (U32 i = 0; i < TEST_BVH_RAY_COUNT; ++i)
+    {
+      F32 lambda;
+      hit = Math::Bvh::Hit();
+      const bool result = boxBvh.Intersect(originList[i], directionList[i], hit);
+      E_ASSERT(result == BvhTestIntersectBruteForce(boxList.GetPtr(), TEST_BVH_BOX_COUNT, originList[i], directionList[i], lambda));
+      if (result) E_ASSERT(hit.lambda == lambda);
+    }
+    E_ASSERT(boxBvh.GetBounds().IsOverlapped(boxList[0]));
+
+    // Moves below the Vector3f comparison epsilon must still reach the root
+    {
+      const U32 kRowCount = 64;
+      Box3f rowList[kRowCount];
+      for (U32 i = 0; i < kRowCount; ++i) rowList[i] = Box3f(Vector3f(i * 0.01f, 0.0f, 0.0f), Vector3f(i * 0.01f + 0.005f, 0.005f, 0.005f));
+      Math::Bvh rowBvh;
+      rowBvh.Build(rowList, kRowCount);
+      for (U32 i = 0; i < 1000; ++i)
+      {
+        rowList[kRowCount - 1] = Box3f(rowList[kRowCount - 1].GetMin() + Vector3f(2e-6f, 0.0f, 0.0f), rowList[kRowCount - 1].GetMax() + Vector3f(2e-6f, 0.0f, 0.0f));
+        rowBvh.Refit(kRowCount - 1, rowList[kRowCount - 1]);
+      }
+      E_ASSERT(rowBvh.GetBounds().GetMax().x >= rowList[kRowCount - 1].GetMax().x);
+    }
+
+    /*-----------------------------------------------------------------
+    World hierarchy of mesh hierarchies
+    -----------------------------------------------------------------*/
+    const U32 kMeshCount = 8;
+    BvhTestMesh meshes[kMeshCount];
+    Math::Bvh meshBvhs[kMeshCount];
+    Box3f meshBoxes[kMeshCount];
+    for (U32 i = 0; i < kMeshCount; ++i)
+    {
+      BvhTestCreateTriangles(meshes[i], TEST_BVH_TRIANGLE_COUNT / kMeshCount);
+      meshBvhs[i].Build(meshes[i].positionList.GetPtr(), meshes[i].indexList.GetPtr(), meshes[i].GetTriangleCount());
+      meshBoxes[i] = meshBvhs[i].GetBounds();
+    }
+    Math::Bvh worldBvh;
+    worldBvh.Build(meshBoxes, kMeshCount);
+
+    for (U32 i = 0; i < TEST_BVH_RAY_COUNT; ++i)
+    {
+      BvhTestMeshIntersector intersector(meshBvhs, originList[i], directionList[i]);
+      hit = Math::Bvh::Hit();
+      const bool result = worldBvh.Intersect(originList[i], directionList[i], hit, intersector);
+
+      F32 bruteForceLambda = Math::NumericLimits<F32>::Max();
+      for (U32 j = 0; j < kMeshCount; ++j)
+      {
+        F32 lambda;
+        if (BvhTestIntersectBruteForce(meshes[j], originList[i], directionList[i], lambda)) bruteForceLambda = Math::Min(bruteForceLambda, lambda);
+      }
+      E_ASSERT(result == (bruteForceLambda != Math::NumericLimits<F32>::Max()));
+      if (result) E_ASSERT(BvhTestIsEqual(hit.lambda, bruteForceLambda) && hit.primitiveIndex < kMeshCount && intersector.meshTriangle != Math::Bvh::kInvalidIndex);
+    }
+
+    bvh.Clear();
+    E_ASSERT(bvh.IsEmpty() && bvh.GetNodeCount() == 0);
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+bool Test::Bvh::RunPerformanceTest()
+{
+  try
+  {
+    std::cout << "[Test::Bvh::RunPerformanceTest]" << std::endl;
+    std::cout << "Image size: " << TEST_BVH_IMAGE_SIZE << "x" << TEST_BVH_IMAGE_SIZE << std::endl << std::endl;
+
+    /*-----------------------------------------------------------------
+    Model
+    -----------------------------------------------------------------*/
+    BvhTestMesh model;
+    if (BvhTestLoadModel(model, TEST_BVH_MODEL_PATH)) BvhTestRunBenchmark("Model", model);
+    else std::cout << "Model " << TEST_BVH_MODEL_PATH << " not found, skipping benchmark" << std::endl << std::endl;
+
+    /*-----------------------------------------------------------------
+    Sphere grid
+    -----------------------------------------------------------------*/
+    BvhTestMesh spheres;
+    for (U32 x = 0; x < TEST_BVH_SPHERE_GRID_SIZE; ++x)
+    {
+      for (U32 y = 0; y < TEST_BVH_SPHERE_GRID_SIZE; ++y)
+      {
+        for (U32 z = 0; z < TEST_BVH_SPHERE_GRID_SIZE; ++z)
+        {
+          BvhTestCreateSphere(spheres, Vector3f(static_cast<F32>(x), static_cast<F32>(y), static_cast<F32>(z)) * 3.0f, 1.0f, 48, 48);
+        }
+      }
+    }
+    BvhTestRunBenchmark("Spheres", spheres);
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
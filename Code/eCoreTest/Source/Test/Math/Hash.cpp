@@ -35,6 +35,31 @@ This file defines Hash test functions.
 using namespace E;
 using namespace std;
 
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef TEST_HASH_BUFFER_SIZE
+#define TEST_HASH_BUFFER_SIZE (1 << 24)
+#endif
+
+#ifndef TEST_HASH_BYTE_COUNT
+#define TEST_HASH_BYTE_COUNT (1 << 28)
+#endif
+
+// Byte at a time reference (Fnv32 applied to a byte range)
+U32 HashFnv32Bytes(const U8* pData, size_t size)
+{
+  U32 hash = 2166136261;
+  for (size_t i = 0; i < size; ++i) hash = (hash ^ pData[i]) * 16777619;
+  return hash;
+}
+
+D64 GetHashThroughput(size_t byteCount, D64 milliseconds)
+{
+  return (milliseconds > 0.0) ? static_cast<D64>(byteCount) / (milliseconds * 1.0e6) : 0.0;
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 TestList methods
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -85,12 +110,159 @@ bool Test::Hash::RunFunctionalityTest()
   std::cout << "Hashing string ptr [" << s2.GetPtr() << "]: " << Math::Murmur3<size_t>::Hash((size_t)s2.GetPtr()) << std::endl;
   std::cout << std::endl;
 
+  /*-----------------------------------------------------------------
+  XxHash64 reference values
+  -----------------------------------------------------------------*/
+  E_ASSERT(Math::XxHash64::Hash("", 0) == 0xef46db3751d8e999ULL);
+  E_ASSERT(Math::XxHash64::Hash("a", 1) == 0xd24ec4f1a98c6e5bULL);
+  E_ASSERT(Math::XxHash64::Hash("abc", 3) == 0x44bc2cf5ad770999ULL);
+  E_ASSERT(Math::XxHash64::Hash(E::String("Nobody inspects the spammish repetition")) == 0xfbcea83c8a378bf1ULL);
+
+  /*-----------------------------------------------------------------
+  XxHash64 streaming
+  -----------------------------------------------------------------*/
+  U8 buffer[1031];
+  for (U32 i = 0; i < sizeof(buffer); ++i) buffer[i] = static_cast<U8>(Math::Global::GetRandom().GetU32(256));
+  const size_t chunkSizeList[] = { 1, 3, 8, 31, 32, 33, 100, 1031 };
+  for (U64 seed = 0; seed < 3; ++seed)
+  {
+    for (U32 size = 0; size <= sizeof(buffer); size += (size < 70) ? 1 : 97)
+    {
+      U64 hash = Math::XxHash64::Hash(buffer, size, seed);
+      for (U32 i = 0; i < sizeof(chunkSizeList) / sizeof(size_t); ++i)
+      {
+        Math::XxHash64 hasher(seed);
+        for (size_t offset = 0; offset < size; offset += chunkSizeList[i]) 
+        {
+          hasher.Update(buffer + offset, Math::Min(chunkSizeList[i], size - offset));
+        }
+        E_ASSERT(hasher.GetHash() == hash);
+      }
+    }
+  }
+
+  /*-----------------------------------------------------------------
+  Murmur3 batch
+  -----------------------------------------------------------------*/
+  U32 keys32[67], hashes32[67];
+  U64 keys64[67], hashes64[67];
+  for (U32 i = 0; i < 67; ++i)
+  {
+    keys32[i] = Math::Global::GetRandom().GetU32(Math::NumericLimits<U32>::Max());
+    keys64[i] = (static_cast<U64>(keys32[i]) << 32) | Math::Global::GetRandom().GetU32(Math::NumericLimits<U32>::Max());
+  }
+  for (U32 count = 0; count <= 67; ++count)
+  {
+    Math::Murmur3<U32>::Hash(keys32, hashes32, count);
+    Math::Murmur3<U64>::Hash(keys64, hashes64, count);
+    for (U32 i = 0; i < count; ++i) E_ASSERT(hashes32[i] == Math::Murmur3<U32>::Hash(keys32[i]) && hashes64[i] == Math::Murmur3<U64>::Hash(keys64[i]));
+  }
+
   return true;
 }
 
 bool Test::Hash::RunPerformanceTest()
 {
   std::cout << "[Test::Hash::RunPerformanceTest]" << std::endl;
+  std::cout << "Hashed bytes: " << TEST_HASH_BYTE_COUNT << " (GB/s)" << std::endl << std::endl;
+
+  E::Time::Timer t;
+  volatile U64 checksum = 0;
+
+  /*-----------------------------------------------------------------
+  Strings (paths, shader names)
+  -----------------------------------------------------------------*/
+  const U32 lengthList[] = { 8, 32, 128, 255 };
+  for (U32 i = 0; i < sizeof(lengthList) / sizeof(U32); ++i)
+  {
+    char str[256];
+    for (U32 j = 0; j < lengthList[i]; ++j) str[j] = static_cast<char>(Math::Global::GetRandom().GetI32('a', 'z'));
+    E::String s(str, lengthList[i]);
+    size_t iterationCount = TEST_HASH_BYTE_COUNT / lengthList[i] / 16;
+
+    t.Reset();
+    for (size_t j = 0; j < iterationCount; ++j) { s[0] = static_cast<char>('a' + (j & 15)); checksum += Math::Djb2<E::String>::Hash(s); }
+    D64 djb2Time = t.GetElapsed().GetMilliseconds();
+    t.Reset();
+    for (size_t j = 0; j < iterationCount; ++j) { s[0] = static_cast<char>('a' + (j & 15)); checksum += Math::Fnv32<E::String>::Hash(s); }
+    D64 fnv32Time = t.GetElapsed().GetMilliseconds();
+    t.Reset();
+    for (size_t j = 0; j < iterationCount; ++j) { s[0] = static_cast<char>('a' + (j & 15)); checksum += Math::XxHash64::Hash(s); }
+    D64 xxHash64Time = t.GetElapsed().GetMilliseconds();
+
+    size_t byteCount = iterationCount * lengthList[i];
+    std::cout << "String length " << lengthList[i] 
+              << "\tDjb2 " << GetHashThroughput(byteCount, djb2Time)
+              << "\tFnv32 " << GetHashThroughput(byteCount, fnv32Time)
+              << "\tXxHash64 " << GetHashThroughput(byteCount, xxHash64Time) << std::endl;
+  }
+
+  /*-----------------------------------------------------------------
+  Byte ranges (vertex data, serialized blobs)
+  -----------------------------------------------------------------*/
+  std::vector<U8> buffer(TEST_HASH_BUFFER_SIZE);
+  for (size_t i = 0; i < buffer.size(); ++i) buffer[i] = static_cast<U8>(Math::Global::GetRandom().GetU32(256));
+  const size_t blockSizeList[] = { 64, 4096, 1 << 16, TEST_HASH_BUFFER_SIZE };
+  for (U32 i = 0; i < sizeof(blockSizeList) / sizeof(size_t); ++i)
+  {
+    size_t blockCount = TEST_HASH_BYTE_COUNT / blockSizeList[i];
+    size_t offsetMask = TEST_HASH_BUFFER_SIZE / blockSizeList[i] - 1;
+
+    t.Reset();
+    for (size_t j = 0; j < blockCount / 16; ++j) checksum += HashFnv32Bytes(&buffer[(j & offsetMask) * blockSizeList[i]], blockSizeList[i]);
+    D64 fnv32Time = t.GetElapsed().GetMilliseconds() * 16;
+    t.Reset();
+    for (size_t j = 0; j < blockCount; ++j) checksum += Math::XxHash64::Hash(&buffer[(j & offsetMask) * blockSizeList[i]], blockSizeList[i]);
+    D64 xxHash64Time = t.GetElapsed().GetMilliseconds();
+    t.Reset();
+    for (size_t j = 0; j < blockCount; ++j) 
+    {
+      // Streaming in 1KB chunks
+      Math::XxHash64 hasher;
+      const U8* pBlock = &buffer[(j & offsetMask) * blockSizeList[i]];
+      for (size_t offset = 0; offset < blockSizeList[i]; offset += 1024) hasher.Update(pBlock + offset, Math::Min<size_t>(1024, blockSizeList[i] - offset));
+      checksum += hasher.GetHash();
+    }
+    D64 xxHash64StreamTime = t.GetElapsed().GetMilliseconds();
+
+    std::cout << "Block size " << blockSizeList[i] 
+              << "\tFnv32 (bytes) " << GetHashThroughput(TEST_HASH_BYTE_COUNT, fnv32Time)
+              << "\tXxHash64 " << GetHashThroughput(TEST_HASH_BYTE_COUNT, xxHash64Time)
+              << "\tXxHash64 (stream) " << GetHashThroughput(TEST_HASH_BYTE_COUNT, xxHash64StreamTime) << std::endl;
+  }
+
+  /*-----------------------------------------------------------------
+  Integer keys (batch)
+  -----------------------------------------------------------------*/
+  size_t keyCount = TEST_HASH_BUFFER_SIZE / sizeof(U64);
+  size_t iterationCount = TEST_HASH_BYTE_COUNT / TEST_HASH_BUFFER_SIZE;
+  std::vector<U32> keys32(keyCount), hashes32(keyCount);
+  std::vector<U64> keys64(keyCount), hashes64(keyCount);
+  for (size_t i = 0; i < keyCount; ++i) keys64[i] = keys32[i] = Math::Global::GetRandom().GetU32(Math::NumericLimits<U32>::Max());
+
+  t.Reset();
+  for (size_t j = 0; j < iterationCount; ++j) for (size_t i = 0; i < keyCount; ++i) hashes32[i] = Math::Murmur3<U32>::Hash(keys32[i]);
+  D64 murmur32Time = t.GetElapsed().GetMilliseconds();
+  checksum += hashes32[keyCount - 1];
+  t.Reset();
+  for (size_t j = 0; j < iterationCount; ++j) Math::Murmur3<U32>::Hash(&keys32[0], &hashes32[0], keyCount);
+  D64 murmur32BatchTime = t.GetElapsed().GetMilliseconds();
+  checksum += hashes32[keyCount - 1];
+  t.Reset();
+  for (size_t j = 0; j < iterationCount; ++j) for (size_t i = 0; i < keyCount; ++i) hashes64[i] = Math::Murmur3<U64>::Hash(keys64[i]);
+  D64 murmur64Time = t.GetElapsed().GetMilliseconds();
+  checksum += hashes64[keyCount - 1];
+  t.Reset();
+  for (size_t j = 0; j < iterationCount; ++j) Math::Murmur3<U64>::Hash(&keys64[0], &hashes64[0], keyCount);
+  D64 murmur64BatchTime = t.GetElapsed().GetMilliseconds();
+  checksum += hashes64[keyCount - 1];
+
+  size_t keyByteCount = iterationCount * keyCount;
+  std::cout << "Murmur3 U32 keys\tsingle " << GetHashThroughput(keyByteCount * sizeof(U32), murmur32Time)
+            << "\tbatch " << GetHashThroughput(keyByteCount * sizeof(U32), murmur32BatchTime) << std::endl;
+  std::cout << "Murmur3 U64 keys\tsingle " << GetHashThroughput(keyByteCount * sizeof(U64), murmur64Time)
+            << "\tbatch " << GetHashThroughput(keyByteCount * sizeof(U64), murmur64BatchTime) << std::endl;
+  std::cout << "Checksum: " << checksum << std::endl << std::endl;
 
   return true;
 }
@@ -0,0 +1,406 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file LooseOctree.cpp
+This file defines E::Math::LooseOctree test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef TEST_LOOSE_OCTREE_OBJECT_COUNT
+#define TEST_LOOSE_OCTREE_OBJECT_COUNT 4000
+#endif
+
+#ifndef TEST_LOOSE_OCTREE_QUERY_COUNT
+#define TEST_LOOSE_OCTREE_QUERY_COUNT 200
+#endif
+
+#ifndef TEST_LOOSE_OCTREE_PERFORMANCE_OBJECT_COUNT
+#define TEST_LOOSE_OCTREE_PERFORMANCE_OBJECT_COUNT 100000
+#endif
+
+#ifndef TEST_LOOSE_OCTREE_PERFORMANCE_MOVING_COUNT
+#define TEST_LOOSE_OCTREE_PERFORMANCE_MOVING_COUNT 10000
+#endif
+
+#ifndef TEST_LOOSE_OCTREE_PERFORMANCE_FRAME_COUNT
+#define TEST_LOOSE_OCTREE_PERFORMANCE_FRAME_COUNT 60
+#endif
+
+#ifndef TEST_LOOSE_OCTREE_PERFORMANCE_QUERY_COUNT
+#define TEST_LOOSE_OCTREE_PERFORMANCE_QUERY_COUNT 200
+#endif
+
+#ifndef TEST_LOOSE_OCTREE_HALF_SIZE
+#define TEST_LOOSE_OCTREE_HALF_SIZE 1000.0f
+#endif
+
+#ifndef TEST_LOOSE_OCTREE_DEPTH
+#define TEST_LOOSE_OCTREE_DEPTH 8
+#endif
+
+typedef Math::LooseOctree<U32> LooseOctreeTestOctree;
+
+static const U32 kLooseOctreeTestPlaneCount = 6;
+
+static Vector3f LooseOctreeTestGetRandomVector(F32 min, F32 max)
+{
+  Math::RandomNumberGenerator& random = Math::Global::GetRandom();
+  return Vector3f(random.GetF32(min, max), random.GetF32(min, max), random.GetF32(min, max));
+}
+
+static Box3f LooseOctreeTestGetRandomBox(F32 range, F32 maxExtent)
+{
+  Vector3f center = LooseOctreeTestGetRandomVector(-range, range);
+  Vector3f extents = LooseOctreeTestGetRandomVector(0.0f, maxExtent);
+  return Box3f(center - extents, center + extents);
+}
+
+// Frustum like convex volume: 90 degree field of view pyramid looking along +z or -z (inward normals)
+static void LooseOctreeTestGetFrustumPlanes(Planef* pPlanes, const Vector3f& position, F32 direction, F32 farDistance)
+{
+  const F32 k = Math::kSqrt2Div2f;
+  pPlanes[0] = Planef(Vector3f(-k, 0.0f, k * direction), position);
+  pPlanes[1] = Planef(Vector3f(k, 0.0f, k * direction), position);
+  pPlanes[2] = Planef(Vector3f(0.0f, -k, k * direction), position);
+  pPlanes[3] = Planef(Vector3f(0.0f, k, k * direction), position);
+  pPlanes[4] = Planef(Vector3f(0.0f, 0.0f, direction), position + Vector3f(0.0f, 0.0f, direction));
+  pPlanes[5] = Planef(Vector3f(0.0f, 0.0f, -direction), position + Vector3f(0.0f, 0.0f, direction * farDistance));
+}
+
+static bool LooseOctreeTestIsOverlapped(const Box3f& bounds, const Spheref& sphere)
+{
+  const Vector3f& center = bounds.GetCenter();
+  const Vector3f& extents = bounds.GetExtents();
+  F32 ex = Math::Max(Math::Abs(center.x - sphere.GetOrigin().x) - extents.x, 0.0f);
+  F32 ey = Math::Max(Math::Abs(center.y - sphere.GetOrigin().y) - extents.y, 0.0f);
+  F32 ez = Math::Max(Math::Abs(center.z - sphere.GetOrigin().z) - extents.z, 0.0f);
+  return ex * ex + ey * ey + ez * ez <= sphere.GetRadius() * sphere.GetRadius();
+}
+
+static bool LooseOctreeTestIsOverlapped(const Box3f& bounds, const Planef* pPlanes, U32 planeCount)
+{
+  const Vector3f& extents = bounds.GetExtents();
+  for (U32 i = 0; i < planeCount; ++i)
+  {
+    const Vector3f& normal = pPlanes[i].GetNormal();
+    F32 radius = Math::Abs(normal.x) * extents.x + Math::Abs(normal.y) * extents.y + Math::Abs(normal.z) * extents.z;
+    if (pPlanes[i].GetDistanceToPoint(bounds.GetCenter()) < -radius) return false;
+  }
+  return true;
+}
+
+// Checks a query result against the expected flags: every expected value must be reported exactly once
+static bool LooseOctreeTestCheckResult(const Containers::List<U32>& result, const Containers::List<bool>& expectedList)
+{
+  Containers::List<U32> countList(expectedList.GetCount(), 0);
+  for (size_t i = 0; i < result.GetCount(); ++i) ++countList[result[i]];
+  for (size_t i = 0; i < expectedList.GetCount(); ++i)
+  {
+    if (countList[i] != (expectedList[i] ? 1u : 0u)) return false;
+  }
+  return true;
+}
+
+// Runs box, sphere and plane queries on the octree and compares them against brute force
+static void LooseOctreeTestCheckQueries(
+  const LooseOctreeTestOctree& octree,
+  const Containers::List<Box3f>& boundsList,
+  const Containers::List<bool>& loadedList)
+{
+  Containers::List<U32> result;
+  Containers::List<bool> expectedList(boundsList.GetCount(), false);
+  Planef planes[kLooseOctreeTestPlaneCount];
+
+  for (U32 i = 0; i < TEST_LOOSE_OCTREE_QUERY_COUNT; ++i)
+  {
+    // Box query (from small to bigger than the root cell)
+    Box3f box = LooseOctreeTestGetRandomBox(TEST_LOOSE_OCTREE_HALF_SIZE, (i % 10 == 0) ? TEST_LOOSE_OCTREE_HALF_SIZE * 2.0f : 200.0f);
+    result.Clear();
+    octree.Query(box, result);
+    for (size_t j = 0; j < boundsList.GetCount(); ++j) expectedList[j] = loadedList[j] && boundsList[j].IsOverlapped(box);
+    E_ASSERT(LooseOctreeTestCheckResult(result, expectedList));
+
+    // Sphere query
+    Spheref sphere(LooseOctreeTestGetRandomVector(-TEST_LOOSE_OCTREE_HALF_SIZE, TEST_LOOSE_OCTREE_HALF_SIZE), Math::Global::GetRandom().GetF32(1.0f, 400.0f));
+    result.Clear();
+    octree.Query(sphere, result);
+    for (size_t j = 0; j < boundsList.GetCount(); ++j) expectedList[j] = loadedList[j] && LooseOctreeTestIsOverlapped(boundsList[j], sphere);
+    E_ASSERT(LooseOctreeTestCheckResult(result, expectedList));
+
+    // Frustum query
+    LooseOctreeTestGetFrustumPlanes(planes, LooseOctreeTestGetRandomVector(-TEST_LOOSE_OCTREE_HALF_SIZE, TEST_LOOSE_OCTREE_HALF_SIZE), (i & 1) ? 1.0f : -1.0f, 500.0f);
+    result.Clear();
+    octree.Query(planes, kLooseOctreeTestPlaneCount, result);
+    for (size_t j = 0; j < boundsList.GetCount(); ++j) expectedList[j] = loadedList[j] && LooseOctreeTestIsOverlapped(boundsList[j], planes, kLooseOctreeTestPlaneCount);
+    E_ASSERT(LooseOctreeTestCheckResult(result, expectedList));
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TestLooseOctree methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::LooseOctree::Run()
+{
+  try
+  {
+    std::cout << "[Test::LooseOctree::Run]" << std::endl;
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::LooseOctree::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::LooseOctree::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::LooseOctree::RunFunctionalityTest()
+{
+  try
+  {
+    std::cout << "[Test::LooseOctree::RunFunctionalityTest]" << std::endl;
+    Math::Global::GetRandom().SetSeed(350350);
+
+    /*-----------------------------------------------------------------
+    Insertion (including objects outside the root cell)
+    -----------------------------------------------------------------*/
+    LooseOctreeTestOctree octree(Vector3f(), TEST_LOOSE_OCTREE_HALF_SIZE, TEST_LOOSE_OCTREE_DEPTH);
+    E_ASSERT(octree.IsEmpty() && octree.GetNodeCount() == 1 && octree.GetDepth() == TEST_LOOSE_OCTREE_DEPTH);
+
+    Containers::List<Box3f> boundsList(TEST_LOOSE_OCTREE_OBJECT_COUNT);
+    Containers::List<Containers::SlotMapHandle> handleList(TEST_LOOSE_OCTREE_OBJECT_COUNT);
+    Containers::List<bool> loadedList(TEST_LOOSE_OCTREE_OBJECT_COUNT, true);
+    for (U32 i = 0; i < TEST_LOOSE_OCTREE_OBJECT_COUNT; ++i)
+    {
+      // Mostly small objects, a few big ones and a few outside the root cell
+      F32 maxExtent = (i % 50 == 0) ? 300.0f : 10.0f;
+      F32 range = (i % 100 == 1) ? TEST_LOOSE_OCTREE_HALF_SIZE * 1.5f : TEST_LOOSE_OCTREE_HALF_SIZE;
+      boundsList.PushBack(LooseOctreeTestGetRandomBox(range, maxExtent));
+      handleList.PushBack(octree.Insert(i, boundsList[i]));
+    }
+    // Point objects
+    boundsList[2] = Box3f(Vector3f(3.0f), Vector3f(3.0f));
+    E_ASSERT(octree.Update(handleList[2], boundsList[2]));
+
+    E_ASSERT(octree.GetCount() == TEST_LOOSE_OCTREE_OBJECT_COUNT && octree.GetNodeCount() > 1);
+    for (U32 i = 0; i < TEST_LOOSE_OCTREE_OBJECT_COUNT; ++i)
+    {
+      E_ASSERT(octree.IsValid(handleList[i]) && octree[handleList[i]] == i);
+      E_ASSERT(octree.GetBounds(handleList[i]).GetCenter() == boundsList[i].GetCenter());
+    }
+    LooseOctreeTestCheckQueries(octree, boundsList, loadedList);
+
+    // Query volumes containing the whole root cell report every object inside it
+    Containers::List<U32> result;
+    octree.Query(Box3f(Vector3f(-TEST_LOOSE_OCTREE_HALF_SIZE * 4.0f), Vector3f(TEST_LOOSE_OCTREE_HALF_SIZE * 4.0f)), result);
+    E_ASSERT(result.GetCount() == TEST_LOOSE_OCTREE_OBJECT_COUNT);
+
+    /*-----------------------------------------------------------------
+    Update (small moves mostly keep their node, big moves do not)
+    -----------------------------------------------------------------*/
+    U32 movedCount = 0;
+    for (U32 i = 0; i < TEST_LOOSE_OCTREE_OBJECT_COUNT; i += 2)
+    {
+      Vector3f offset = (i % 8 == 0) ? LooseOctreeTestGetRandomVector(-500.0f, 500.0f) : LooseOctreeTestGetRandomVector(-0.1f, 0.1f);
+      boundsList[i] = Box3f(boundsList[i].GetMin() + offset, boundsList[i].GetMax() + offset);
+      if (octree.Update(handleList[i], boundsList[i])) ++movedCount;
+    }
+    E_ASSERT(movedCount > 0 && movedCount < TEST_LOOSE_OCTREE_OBJECT_COUNT / 2);
+    LooseOctreeTestCheckQueries(octree, boundsList, loadedList);
+
+    /*-----------------------------------------------------------------
+    Removal & stale handles
+    -----------------------------------------------------------------*/
+    for (U32 i = 0; i < TEST_LOOSE_OCTREE_OBJECT_COUNT; i += 3)
+    {
+      E_ASSERT(octree.Remove(handleList[i]));
+      E_ASSERT(!octree.Remove(handleList[i]) && !octree.IsValid(handleList[i]));
+      loadedList[i] = false;
+    }
+    for (U32 i = 0; i < TEST_LOOSE_OCTREE_OBJECT_COUNT; ++i)
+    {
+      if (loadedList[i]) E_ASSERT(octree[handleList[i]] == i);
+    }
+    LooseOctreeTestCheckQueries(octree, boundsList, loadedList);
+
+    // Reinsertion after removal
+    for (U32 i = 0; i < TEST_LOOSE_OCTREE_OBJECT_COUNT; i += 3)
+    {
+      handleList[i] = octree.Insert(i, boundsList[i]);
+      loadedList[i] = true;
+    }
+    E_ASSERT(octree.GetCount() == TEST_LOOSE_OCTREE_OBJECT_COUNT);
+    LooseOctreeTestCheckQueries(octree, boundsList, loadedList);
+
+    /*-----------------------------------------------------------------
+    Copy & clear
+    -----------------------------------------------------------------*/
+    LooseOctreeTestOctree copyOctree(octree);
+    octree.Clear();
+    E_ASSERT(octree.IsEmpty() && octree.GetNodeCount() == 1 && !octree.IsValid(handleList[0]));
+    result.Clear();
+    octree.Query(Spheref(Vector3f(), TEST_LOOSE_OCTREE_HALF_SIZE * 4.0f), result);
+    E_ASSERT(result.IsEmpty());
+    E_ASSERT(copyOctree.GetCount() == TEST_LOOSE_OCTREE_OBJECT_COUNT && copyOctree[handleList[0]] == 0);
+    LooseOctreeTestCheckQueries(copyOctree, boundsList, loadedList);
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+bool Test::LooseOctree::RunPerformanceTest()
+{
+  try
+  {
+    std::cout << "[Test::LooseOctree::RunPerformanceTest]" << std::endl;
+    std::cout << "Objects: " << TEST_LOOSE_OCTREE_PERFORMANCE_OBJECT_COUNT << " (moving: " << TEST_LOOSE_OCTREE_PERFORMANCE_MOVING_COUNT << ") frames: "
+      << TEST_LOOSE_OCTREE_PERFORMANCE_FRAME_COUNT << " queries: " << TEST_LOOSE_OCTREE_PERFORMANCE_QUERY_COUNT << std::endl << std::endl;
+    Math::Global::GetRandom().SetSeed(350351);
+
+    E::Time::Timer t;
+    Containers::List<Box3f> boundsList(TEST_LOOSE_OCTREE_PERFORMANCE_OBJECT_COUNT);
+    Containers::List<Vector3f> velocityList(TEST_LOOSE_OCTREE_PERFORMANCE_MOVING_COUNT);
+    for (U32 i = 0; i < TEST_LOOSE_OCTREE_PERFORMANCE_OBJECT_COUNT; ++i) boundsList.PushBack(LooseOctreeTestGetRandomBox(TEST_LOOSE_OCTREE_HALF_SIZE, 5.0f));
+    for (U32 i = 0; i < TEST_LOOSE_OCTREE_PERFORMANCE_MOVING_COUNT; ++i) velocityList.PushBack(LooseOctreeTestGetRandomVector(-2.0f, 2.0f));
+
+    /*-----------------------------------------------------------------
+    Insertion
+    -----------------------------------------------------------------*/
+    LooseOctreeTestOctree octree(Vector3f(), TEST_LOOSE_OCTREE_HALF_SIZE, TEST_LOOSE_OCTREE_DEPTH);
+    Containers::List<Containers::SlotMapHandle> handleList(TEST_LOOSE_OCTREE_PERFORMANCE_OBJECT_COUNT);
+    t.Reset();
+    for (U32 i = 0; i < TEST_LOOSE_OCTREE_PERFORMANCE_OBJECT_COUNT; ++i) handleList.PushBack(octree.Insert(i, boundsList[i]));
+    F32 insertionTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+    std::cout << "Insertion time " << insertionTime << " ms (" << octree.GetNodeCount() << " nodes)" << std::endl;
+
+    /*-----------------------------------------------------------------
+    Update (moving objects only)
+    -----------------------------------------------------------------*/
+    U32 movedCount = 0;
+    t.Reset();
+    for (U32 i = 0; i < TEST_LOOSE_OCTREE_PERFORMANCE_FRAME_COUNT; ++i)
+    {
+      for (U32 j = 0; j < TEST_LOOSE_OCTREE_PERFORMANCE_MOVING_COUNT; ++j)
+      {
+        boundsList[j] = Box3f(boundsList[j].GetMin() + velocityList[j], boundsList[j].GetMax() + velocityList[j]);
+        if (octree.Update(handleList[j], boundsList[j])) ++movedCount;
+      }
+    }
+    F32 updateTime = static_cast<F32>(t.GetElapsed().GetMilliseconds()) / TEST_LOOSE_OCTREE_PERFORMANCE_FRAME_COUNT;
+    std::cout << "Update time " << updateTime << " ms per frame (" << movedCount / TEST_LOOSE_OCTREE_PERFORMANCE_FRAME_COUNT << " node changes per frame)" << std::endl;
+
+    /*-----------------------------------------------------------------
+    Queries (against linear scan)
+    -----------------------------------------------------------------*/
+    Containers::List<Spheref> sphereList(TEST_LOOSE_OCTREE_PERFORMANCE_QUERY_COUNT);
+    Containers::List<Vector3f> positionList(TEST_LOOSE_OCTREE_PERFORMANCE_QUERY_COUNT);
+    for (U32 i = 0; i < TEST_LOOSE_OCTREE_PERFORMANCE_QUERY_COUNT; ++i)
+    {
+      sphereList.PushBack(Spheref(LooseOctreeTestGetRandomVector(-TEST_LOOSE_OCTREE_HALF_SIZE, TEST_LOOSE_OCTREE_HALF_SIZE), 50.0f));
+      positionList.PushBack(LooseOctreeTestGetRandomVector(-TEST_LOOSE_OCTREE_HALF_SIZE, TEST_LOOSE_OCTREE_HALF_SIZE));
+    }
+
+    Containers::List<U32> result(TEST_LOOSE_OCTREE_PERFORMANCE_OBJECT_COUNT);
+    size_t octreeChecksum = 0;
+    t.Reset();
+    for (U32 i = 0; i < TEST_LOOSE_OCTREE_PERFORMANCE_QUERY_COUNT; ++i)
+    {
+      result.Clear();
+      octree.Query(sphereList[i], result);
+      octreeChecksum += result.GetCount();
+    }
+    F32 octreeSphereTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+    size_t linearChecksum = 0;
+    t.Reset();
+    for (U32 i = 0; i < TEST_LOOSE_OCTREE_PERFORMANCE_QUERY_COUNT; ++i)
+    {
+      result.Clear();
+      for (U32 j = 0; j < TEST_LOOSE_OCTREE_PERFORMANCE_OBJECT_COUNT; ++j)
+      {
+        if (LooseOctreeTestIsOverlapped(boundsList[j], sphereList[i])) result.PushBack(j);
+      }
+      linearChecksum += result.GetCount();
+    }
+    F32 linearSphereTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+    E_ASSERT(octreeChecksum == linearChecksum);
+    std::cout << "Sphere query time [" << octreeSphereTime << " / " << linearSphereTime << "]\t" << (linearSphereTime / octreeSphereTime * 100.0) - 100.0 << "% faster (" << octreeChecksum << " objects)" << std::endl;
+
+    Planef planes[kLooseOctreeTestPlaneCount];
+    octreeChecksum = 0;
+    t.Reset();
+    for (U32 i = 0; i < TEST_LOOSE_OCTREE_PERFORMANCE_QUERY_COUNT; ++i)
+    {
+      LooseOctreeTestGetFrustumPlanes(planes, positionList[i], (i & 1) ? 1.0f : -1.0f, 300.0f);
+      result.Clear();
+      octree.Query(planes, kLooseOctreeTestPlaneCount, result);
+      octreeChecksum += result.GetCount();
+    }
+    F32 octreeFrustumTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+    linearChecksum = 0;
+    t.Reset();
+    for (U32 i = 0; i < TEST_LOOSE_OCTREE_PERFORMANCE_QUERY_COUNT; ++i)
+    {
+      LooseOctreeTestGetFrustumPlanes(planes, positionList[i], (i & 1) ? 1.0f : -1.0f, 300.0f);
+      result.Clear();
+      for (U32 j = 0; j < TEST_LOOSE_OCTREE_PERFORMANCE_OBJECT_COUNT; ++j)
+      {
+        if (LooseOctreeTestIsOverlapped(boundsList[j], planes, kLooseOctreeTestPlaneCount)) result.PushBack(j);
+      }
+      linearChecksum += result.GetCount();
+    }
+    F32 linearFrustumTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+    E_ASSERT(octreeChecksum == linearChecksum);
+    std::cout << "Frustum query time [" << octreeFrustumTime << " / " << linearFrustumTime << "]\t" << (linearFrustumTime / octreeFrustumTime * 100.0) - 100.0 << "% faster (" << octreeChecksum << " objects)" << std::endl;
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
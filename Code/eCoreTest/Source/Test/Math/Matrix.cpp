@@ -38,6 +38,53 @@ using namespace E;
 Auxiliary declarations
 ----------------------------------------------------------------------------------------------------------------------*/
 
+#ifndef TEST_MATRIX_SIZE
+#define TEST_MATRIX_SIZE 100000
+#endif
+
+#ifndef TEST_MATRIX_ITERATION_COUNT
+#define TEST_MATRIX_ITERATION_COUNT 20
+#endif
+
+static Matrix4f MatrixTestGetRandom()
+{
+  F32 data[16];
+  for (U32 i = 0; i < 16; ++i) data[i] = Math::Global::GetRandom().GetF32(-10.0f, 10.0f);
+  return Matrix4f(data);
+}
+
+static Matrix4f MatrixTestGetRandomAffine()
+{
+  Matrix4f m;
+  m.SetRotation(Math::Global::GetRandom().GetF32(-3.0f, 3.0f), Math::Global::GetRandom().GetF32(-3.0f, 3.0f), Math::Global::GetRandom().GetF32(-3.0f, 3.0f));
+  m.SetTranslation(Math::Global::GetRandom().GetF32(-100.0f, 100.0f), Math::Global::GetRandom().GetF32(-100.0f, 100.0f), Math::Global::GetRandom().GetF32(-100.0f, 100.0f));
+  return m;
+}
+
+// Scalar reference of the matrix product (same operation order as the generic Matrix4 version)
+static Matrix4f MatrixTestMultiply(const Matrix4f& a, const Matrix4f& b)
+{
+  F32 data[16];
+  for (U32 i = 0; i < 4; ++i)
+  {
+    for (U32 j = 0; j < 4; ++j) data[i * 4 + j] = a(i, 0) * b(0, j) + a(i, 1) * b(1, j) + a(i, 2) * b(2, j) + a(i, 3) * b(3, j);
+  }
+  return Matrix4f(data);
+}
+
+static bool MatrixTestIsExact(const Matrix4f& a, const Matrix4f& b)
+{
+  for (U32 i = 0; i < 16; ++i)
+  {
+#ifdef E_MATH_SIMD_FMA
+    if (!Math::IsRelativelyEqual(a[i], b[i], 1e-5f)) return false;
+#else
+    if (a[i] != b[i]) return false;
+#endif
+  }
+  return true;
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 TestList methods
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -269,6 +316,70 @@ bool Test::Matrix::RunFunctionalityTest()
   m.SetRotationZ(Math::Rad(30.f));
   E_ASSERT(m == m2);
 
+  /*-------------------------------------------------------------------------------
+  Matrix4 F32 SIMD specializations (results must match the scalar operations)
+  -------------------------------------------------------------------------------*/
+  for (U32 i = 0; i < 1000; ++i)
+  {
+    Matrix4f a = MatrixTestGetRandom();
+    Matrix4f b = MatrixTestGetRandom();
+    F32 s = Math::Global::GetRandom().GetF32(-2.0f, 2.0f);
+    E_ASSERT(MatrixTestIsExact(a * b, MatrixTestMultiply(a, b)));
+    Matrix4f sum = a + b;
+    Matrix4f difference = a - b;
+    Matrix4f scaled = a * s;
+    Matrix4f product = a;
+    product *= b;
+    Matrix4f negated = -a;
+    Matrix4f transposed = Matrix4f::Transpose(a);
+    for (U32 j = 0; j < 16; ++j)
+    {
+      E_ASSERT(sum[j] == a[j] + b[j] && difference[j] == a[j] - b[j] && scaled[j] == a[j] * s);
+      E_ASSERT(product[j] == a[j] * b[j] && negated[j] == -a[j] && transposed(j % 4, j / 4) == a(j / 4, j % 4));
+    }
+
+    // Point / vector transformation
+    Vector3f p(Math::Global::GetRandom().GetF32(-10.0f, 10.0f), Math::Global::GetRandom().GetF32(-10.0f, 10.0f), Math::Global::GetRandom().GetF32(-10.0f, 10.0f));
+    Vector3f v = Matrix4f::RotateVector(a, p);
+    E_ASSERT(
+      v.x == a[0] * p.x + a[4] * p.y + a[8] * p.z && 
+      v.y == a[1] * p.x + a[5] * p.y + a[9] * p.z && 
+      v.z == a[2] * p.x + a[6] * p.y + a[10] * p.z);
+    F32 w = a[3] * p.x + a[7] * p.y + a[11] * p.z + a[15];
+    F32 invW = Math::IsEqual(w, 0.0f) ? 1.0f : 1.0f / w;
+    Vector3f tp = Matrix4f::TransformPoint(a, p);
+    E_ASSERT(
+      tp.x == (a[0] * p.x + a[4] * p.y + a[8] * p.z + a[12]) * invW && 
+      tp.y == (a[1] * p.x + a[5] * p.y + a[9] * p.z + a[13]) * invW && 
+      tp.z == (a[2] * p.x + a[6] * p.y + a[10] * p.z + a[14]) * invW);
+
+    // Affine inversion
+    Matrix4f affine = MatrixTestGetRandomAffine();
+    Matrix4f affineInverse = affine;
+    affineInverse.AffineInvert();
+    Matrix4f affineReference(
+      affine[0], affine[4], affine[8], 0.0f,
+      affine[1], affine[5], affine[9], 0.0f,
+      affine[2], affine[6], affine[10], 0.0f,
+      -(affine[0] * affine[12] + affine[1] * affine[13] + affine[2] * affine[14]), 
+      -(affine[4] * affine[12] + affine[5] * affine[13] + affine[6] * affine[14]), 
+      -(affine[8] * affine[12] + affine[9] * affine[13] + affine[10] * affine[14]), 1.0f);
+    E_ASSERT(MatrixTestIsExact(affineInverse, affineReference));
+    Matrix4f affineInverseTranspose = affine;
+    affineInverseTranspose.AffineInvertTranspose();
+    E_ASSERT(MatrixTestIsExact(affineInverseTranspose, Matrix4f::Transpose(affineReference)));
+
+    // General inversion of a well conditioned matrix (against the D64 version)
+    Matrix4f scaledAffine = affine;
+    scaledAffine.Scale(Math::Global::GetRandom().GetF32(0.5f, 2.0f), Math::Global::GetRandom().GetF32(0.5f, 2.0f), Math::Global::GetRandom().GetF32(0.5f, 2.0f));
+    scaledAffine[3] = Math::Global::GetRandom().GetF32(-0.1f, 0.1f);
+    Matrix4f inverse = Matrix4f::Invert(scaledAffine);
+    Matrix4d ad;
+    for (U32 j = 0; j < 16; ++j) ad[j] = scaledAffine[j];
+    Matrix4d inversed = Matrix4d::Invert(ad);
+    for (U32 j = 0; j < 16; ++j) E_ASSERT(Math::Abs(inverse[j] - static_cast<F32>(inversed[j])) <= 1e-3f * (1.0f + Math::Abs(static_cast<F32>(inversed[j]))));
+  }
+
   return true;
 }
 
@@ -365,6 +476,61 @@ bool Test::Matrix::RunPerformanceTest()
       Math::IsEqual(rotationXYZ[14], rotation[14]) &&
       Math::IsEqual(rotationXYZ[15], rotation[15]));
   }
+
+  /*-----------------------------------------------------------------
+  Matrix4 F32 SIMD throughput
+  -----------------------------------------------------------------*/
+  std::cout << "Matrices: " << TEST_MATRIX_SIZE << " iterations: " << TEST_MATRIX_ITERATION_COUNT << std::endl << std::endl;
+  E::Containers::List<Matrix4f> aList(TEST_MATRIX_SIZE);
+  E::Containers::List<Matrix4f> bList(TEST_MATRIX_SIZE);
+  E::Containers::List<Matrix4f> resultList(TEST_MATRIX_SIZE);
+  E::Containers::List<Vector3f> pointList(TEST_MATRIX_SIZE);
+  for (U32 i = 0; i < TEST_MATRIX_SIZE; ++i)
+  {
+    aList.PushBack(MatrixTestGetRandomAffine());
+    bList.PushBack(MatrixTestGetRandomAffine());
+    resultList.PushBack(Matrix4f());
+    pointList.PushBack(Vector3f(Math::Global::GetRandom().GetF32(), Math::Global::GetRandom().GetF32(), Math::Global::GetRandom().GetF32()));
+  }
+  E::Time::Timer t;
+
+  // Product
+  t.Reset();
+  for (U32 k = 0; k < TEST_MATRIX_ITERATION_COUNT; ++k)
+  {
+    for (U32 i = 0; i < TEST_MATRIX_SIZE; ++i) resultList[i] = MatrixTestMultiply(aList[i], bList[i]);
+  }
+  F32 scalarTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+  Matrix4f scalarChecksum = resultList[TEST_MATRIX_SIZE / 2];
+
+  t.Reset();
+  for (U32 k = 0; k < TEST_MATRIX_ITERATION_COUNT; ++k)
+  {
+    for (U32 i = 0; i < TEST_MATRIX_SIZE; ++i) resultList[i] = aList[i] * bList[i];
+  }
+  F32 simdTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+  E_ASSERT(MatrixTestIsExact(scalarChecksum, resultList[TEST_MATRIX_SIZE / 2]));
+  std::cout << "Product time [" << simdTime << " / " << scalarTime << "]\t" << (scalarTime / simdTime * 100.0) - 100.0 << "% faster (" 
+    << static_cast<D64>(TEST_MATRIX_SIZE) * TEST_MATRIX_ITERATION_COUNT / simdTime / 1000.0 << " M products/s)" << std::endl;
+
+  // Inversion
+  t.Reset();
+  for (U32 k = 0; k < TEST_MATRIX_ITERATION_COUNT; ++k)
+  {
+    for (U32 i = 0; i < TEST_MATRIX_SIZE; ++i) resultList[i] = Matrix4f::Invert(aList[i]);
+  }
+  simdTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+  std::cout << "Inversion time [" << simdTime << "]\t" << static_cast<D64>(TEST_MATRIX_SIZE) * TEST_MATRIX_ITERATION_COUNT / simdTime / 1000.0 << " M inversions/s" << std::endl;
+
+  // Point transformation
+  Vector3f checksum;
+  t.Reset();
+  for (U32 k = 0; k < TEST_MATRIX_ITERATION_COUNT; ++k)
+  {
+    for (U32 i = 0; i < TEST_MATRIX_SIZE; ++i) checksum += Matrix4f::TransformPoint(aList[i], pointList[i]);
+  }
+  simdTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+  std::cout << "Point transformation time [" << simdTime << "]\t" << static_cast<D64>(TEST_MATRIX_SIZE) * TEST_MATRIX_ITERATION_COUNT / simdTime / 1000.0 << " M points/s (checksum " << checksum.x << ")" << std::endl;
   
   return true;
 }
@@ -0,0 +1,473 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file MeshOptimizer.cpp
+This file defines E::Math::MeshOptimizer test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef TEST_MESH_OPTIMIZER_GRID_SIZE
+#define TEST_MESH_OPTIMIZER_GRID_SIZE 64
+#endif
+
+#ifndef TEST_MESH_OPTIMIZER_PERFORMANCE_GRID_SIZE
+#define TEST_MESH_OPTIMIZER_PERFORMANCE_GRID_SIZE 512
+#endif
+
+typedef Math::MeshOptimizer MeshOptimizerTestOptimizer;
+
+/**
+Creates a sphere as a (size + 1) x (size + 1) latitude / longitude vertex grid. Pole and seam vertices hold bitwise
+identical positions so that welding them gives a closed mesh.
+*/
+static void MeshOptimizerTestCreateSphere(Containers::List<Vector3f>& positionList, Containers::List<U32>& indexList, U32 size)
+{
+  positionList.Clear();
+  indexList.Clear();
+  positionList.Reserve((size + 1) * (size + 1));
+  indexList.Reserve(size * size * 6);
+  for (U32 i = 0; i <= size; ++i)
+  {
+    const F32 phi = Math::kPif * static_cast<F32>(i) / static_cast<F32>(size);
+    for (U32 j = 0; j <= size; ++j)
+    {
+      const F32 theta = 2.0f * Math::kPif * static_cast<F32>(j % size) / static_cast<F32>(size);
+      if (i == 0 || i == size) positionList.PushBack(Vector3f(0.0f, (i == 0) ? 1.0f : -1.0f, 0.0f));
+      else positionList.PushBack(Vector3f(sinf(phi) * cosf(theta), cosf(phi), sinf(phi) * sinf(theta)));
+    }
+  }
+  for (U32 i = 0; i < size; ++i)
+  {
+    for (U32 j = 0; j < size; ++j)
+    {
+      const U32 a = i * (size + 1) + j;
+      const U32 b = a + size + 1;
+      indexList.PushBack(a);
+      indexList.PushBack(b);
+      indexList.PushBack(a + 1);
+      indexList.PushBack(a + 1);
+      indexList.PushBack(b);
+      indexList.PushBack(b + 1);
+    }
+  }
+}
+
+/**
+Creates a flat square in the XZ plane as a (size + 1) x (size + 1) vertex grid.
+*/
+static void MeshOptimizerTestCreatePlane(Containers::List<Vector3f>& positionList, Containers::List<U32>& indexList, U32 size)
+{
+  positionList.Clear();
+  indexList.Clear();
+  for (U32 i = 0; i <= size; ++i)
+  {
+    for (U32 j = 0; j <= size; ++j) positionList.PushBack(Vector3f(static_cast<F32>(j), 0.0f, static_cast<F32>(i)));
+  }
+  for (U32 i = 0; i < size; ++i)
+  {
+    for (U32 j = 0; j < size; ++j)
+    {
+      const U32 a = i * (size + 1) + j;
+      const U32 b = a + size + 1;
+      indexList.PushBack(a);
+      indexList.PushBack(b);
+      indexList.PushBack(a + 1);
+      indexList.PushBack(a + 1);
+      indexList.PushBack(b);
+      indexList.PushBack(b + 1);
+    }
+  }
+}
+
+/**
+Returns the summed triangle normals (twice the area weighted normal of the mesh).
+*/
+static Vector3f MeshOptimizerTestGetAreaNormal(const Vector3f* pPositions, const U32* pIndices, U32 indexCount)
+{
+  Vector3f areaNormal(0.0f, 0.0f, 0.0f);
+  for (U32 i = 0; i < indexCount; i += 3)
+  {
+    const Vector3f& a = pPositions[pIndices[i]];
+    areaNormal += Vector3f::Cross(pPositions[pIndices[i + 1]] - a, pPositions[pIndices[i + 2]] - a);
+  }
+  return areaNormal;
+}
+
+/**
+Shuffles the triangle order keeping the triangle winding.
+*/
+static void MeshOptimizerTestShuffle(Containers::List<U32>& indexList)
+{
+  Math::RandomStream random(120120);
+  const U32 triangleCount = static_cast<U32>(indexList.GetCount() / 3);
+  for (U32 i = triangleCount - 1; i > 0; --i)
+  {
+    const U32 j = random.GetU32(i + 1);
+    for (U32 k = 0; k < 3; ++k)
+    {
+      const U32 value = indexList[i * 3 + k];
+      indexList[i * 3 + k] = indexList[j * 3 + k];
+      indexList[j * 3 + k] = value;
+    }
+  }
+}
+
+/**
+Returns an order independent key of the triangle positions which keeps the triangle winding.
+*/
+static U64 MeshOptimizerTestGetTriangleKey(const Vector3f* pPositions, const U32* pTriangle)
+{
+  U64 hashes[3];
+  for (U32 i = 0; i < 3; ++i) hashes[i] = Math::XxHash64::Hash(&pPositions[pTriangle[i]], sizeof(Vector3f));
+  // Rotate the smallest hash first
+  U32 first = (hashes[1] < hashes[0]) ? 1 : 0;
+  if (hashes[2] < hashes[first]) first = 2;
+  const U64 rotatedHashes[3] = { hashes[first], hashes[(first + 1) % 3], hashes[(first + 2) % 3] };
+  return Math::XxHash64::Hash(rotatedHashes, sizeof(rotatedHashes));
+}
+
+/**
+Returns true if both meshes hold the same triangles (compared by position with the same winding) in any order.
+*/
+static bool MeshOptimizerTestIsSameMesh(const Vector3f* pPositionsA, const U32* pIndicesA, const Vector3f* pPositionsB, const U32* pIndicesB, U32 indexCount)
+{
+  Containers::List<U64> triangleListA(indexCount / 3);
+  Containers::List<U64> triangleListB(indexCount / 3);
+  for (U32 i = 0; i < indexCount; i += 3)
+  {
+    triangleListA.PushBack(MeshOptimizerTestGetTriangleKey(pPositionsA, &pIndicesA[i]));
+    triangleListB.PushBack(MeshOptimizerTestGetTriangleKey(pPositionsB, &pIndicesB[i]));
+  }
+  Math::Sorting<U64>::IntroSort(triangleListA.GetPtr(), triangleListA.GetCount());
+  Math::Sorting<U64>::IntroSort(triangleListB.GetPtr(), triangleListB.GetCount());
+  for (size_t i = 0; i < triangleListA.GetCount(); ++i)
+  {
+    if (triangleListA[i] != triangleListB[i]) return false;
+  }
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TestMeshOptimizer methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::MeshOptimizer::Run()
+{
+  try
+  {
+    std::cout << "[Test::MeshOptimizer::Run] using grid size of " << TEST_MESH_OPTIMIZER_GRID_SIZE << std::endl;
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::MeshOptimizer::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::MeshOptimizer::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::MeshOptimizer::RunFunctionalityTest()
+{
+  try
+  {
+    std::cout << "[Test::MeshOptimizer::RunFunctionalityTest]" << std::endl;
+
+    /*-----------------------------------------------------------------
+    Statistics
+    -----------------------------------------------------------------*/
+    const U32 triangle[3] = { 0, 1, 2 };
+    MeshOptimizerTestOptimizer::VertexCacheStatistics statistics = MeshOptimizerTestOptimizer::AnalyzeVertexCache(triangle, 3, 3);
+    E_ASSERT(statistics.transformedVertexCount == 3 && statistics.acmr == 3.0f && statistics.atvr == 1.0f);
+    // A vertex evicted from a 3 entry FIFO cache is transformed again
+    const U32 quad[12] = { 0, 1, 2, 2, 1, 3, 3, 4, 5, 0, 1, 2 };
+    statistics = MeshOptimizerTestOptimizer::AnalyzeVertexCache(quad, 12, 6, 3);
+    E_ASSERT(statistics.transformedVertexCount == 9 && statistics.atvr == 1.5f);
+
+    Containers::List<Vector3f> positionList;
+    Containers::List<U32> indexList;
+    MeshOptimizerTestCreateSphere(positionList, indexList, TEST_MESH_OPTIMIZER_GRID_SIZE);
+    const U32 vertexCount = static_cast<U32>(positionList.GetCount());
+    const U32 indexCount = static_cast<U32>(indexList.GetCount());
+
+    /*-----------------------------------------------------------------
+    Vertex welding
+    -----------------------------------------------------------------*/
+    // Non indexed triangle soup (every triangle has its own vertices)
+    Containers::List<Vector3f> soupPositionList(indexCount);
+    for (U32 i = 0; i < indexCount; ++i) soupPositionList.PushBack(positionList[indexList[i]]);
+    Containers::List<U32> remapList(indexCount);
+    remapList.SetCount(indexCount);
+    U32 uniqueVertexCount = MeshOptimizerTestOptimizer::GenerateVertexRemap(remapList.GetPtr(), nullptr, indexCount, soupPositionList.GetPtr(), indexCount, sizeof(Vector3f));
+    // Sphere seams and poles hold vertices with the same position
+    E_ASSERT(uniqueVertexCount < vertexCount && uniqueVertexCount > vertexCount - 3 * (TEST_MESH_OPTIMIZER_GRID_SIZE + 1));
+
+    Containers::List<U32> weldedIndexList(indexCount);
+    weldedIndexList.SetCount(indexCount);
+    for (U32 i = 0; i < indexCount; ++i) weldedIndexList[i] = i;
+    MeshOptimizerTestOptimizer::RemapIndices(weldedIndexList.GetPtr(), weldedIndexList.GetPtr(), indexCount, remapList.GetPtr());
+    Containers::List<Vector3f> weldedPositionList(uniqueVertexCount);
+    weldedPositionList.SetCount(uniqueVertexCount);
+    MeshOptimizerTestOptimizer::RemapVertices(weldedPositionList.GetPtr(), soupPositionList.GetPtr(), indexCount, remapList.GetPtr());
+    for (U32 i = 0; i < indexCount; ++i) E_ASSERT(weldedPositionList[weldedIndexList[i]] == soupPositionList[i]);
+    // First use order
+    for (U32 i = 0, maxIndex = 0; i < indexCount; ++i)
+    {
+      E_ASSERT(weldedIndexList[i] <= maxIndex);
+      if (weldedIndexList[i] == maxIndex) ++maxIndex;
+    }
+
+    // Indexed welding of an already unique mesh keeps all vertices
+    const Vector3f* pEquatorPositions = &positionList[(TEST_MESH_OPTIMIZER_GRID_SIZE / 2) * (TEST_MESH_OPTIMIZER_GRID_SIZE + 1)];
+    E_ASSERT(MeshOptimizerTestOptimizer::GenerateVertexRemap(remapList.GetPtr(), triangle, 3, pEquatorPositions, 3, sizeof(Vector3f)) == 3);
+
+    /*-----------------------------------------------------------------
+    Vertex cache
+    -----------------------------------------------------------------*/
+    MeshOptimizerTestShuffle(indexList);
+    MeshOptimizerTestOptimizer::VertexCacheStatistics shuffledStatistics = MeshOptimizerTestOptimizer::AnalyzeVertexCache(indexList.GetPtr(), indexCount, vertexCount);
+    Containers::List<U32> cacheIndexList(indexCount);
+    cacheIndexList.SetCount(indexCount);
+    MeshOptimizerTestOptimizer::OptimizeVertexCache(cacheIndexList.GetPtr(), indexList.GetPtr(), indexCount, vertexCount);
+    MeshOptimizerTestOptimizer::VertexCacheStatistics cacheStatistics = MeshOptimizerTestOptimizer::AnalyzeVertexCache(cacheIndexList.GetPtr(), indexCount, vertexCount);
+    E_ASSERT(MeshOptimizerTestIsSameMesh(positionList.GetPtr(), indexList.GetPtr(), positionList.GetPtr(), cacheIndexList.GetPtr(), indexCount));
+    E_ASSERT(cacheStatistics.acmr < 0.8f && cacheStatistics.acmr < shuffledStatistics.acmr * 0.5f);
+    E_ASSERT(cacheStatistics.atvr < shuffledStatistics.atvr);
+
+    // In place optimization gives the same result
+    Containers::List<U32> inPlaceIndexList(indexList);
+    MeshOptimizerTestOptimizer::OptimizeVertexCache(inPlaceIndexList.GetPtr(), inPlaceIndexList.GetPtr(), indexCount, vertexCount);
+    for (U32 i = 0; i < indexCount; ++i) E_ASSERT(inPlaceIndexList[i] == cacheIndexList[i]);
+
+    /*-----------------------------------------------------------------
+    Overdraw
+    -----------------------------------------------------------------*/
+    Containers::List<U32> overdrawIndexList(indexCount);
+    overdrawIndexList.SetCount(indexCount);
+    MeshOptimizerTestOptimizer::OptimizeOverdraw(overdrawIndexList.GetPtr(), cacheIndexList.GetPtr(), indexCount, positionList.GetPtr(), vertexCount, 1.05f);
+    MeshOptimizerTestOptimizer::VertexCacheStatistics overdrawStatistics = MeshOptimizerTestOptimizer::AnalyzeVertexCache(overdrawIndexList.GetPtr(), indexCount, vertexCount);
+    E_ASSERT(MeshOptimizerTestIsSameMesh(positionList.GetPtr(), indexList.GetPtr(), positionList.GetPtr(), overdrawIndexList.GetPtr(), indexCount));
+    E_ASSERT(overdrawStatistics.acmr <= cacheStatistics.acmr * 1.1f);
+
+    /*-----------------------------------------------------------------
+    Vertex fetch
+    -----------------------------------------------------------------*/
+    uniqueVertexCount = MeshOptimizerTestOptimizer::OptimizeVertexFetch(remapList.GetPtr(), overdrawIndexList.GetPtr(), indexCount, vertexCount);
+    E_ASSERT(uniqueVertexCount == vertexCount);
+    Containers::List<U32> fetchIndexList(indexCount);
+    fetchIndexList.SetCount(indexCount);
+    MeshOptimizerTestOptimizer::RemapIndices(fetchIndexList.GetPtr(), overdrawIndexList.GetPtr(), indexCount, remapList.GetPtr());
+    Containers::List<Vector3f> fetchPositionList(vertexCount);
+    fetchPositionList.SetCount(vertexCount);
+    MeshOptimizerTestOptimizer::RemapVertices(fetchPositionList.GetPtr(), positionList.GetPtr(), vertexCount, remapList.GetPtr());
+    E_ASSERT(MeshOptimizerTestIsSameMesh(positionList.GetPtr(), indexList.GetPtr(), fetchPositionList.GetPtr(), fetchIndexList.GetPtr(), indexCount));
+    for (U32 i = 0, maxIndex = 0; i < indexCount; ++i)
+    {
+      E_ASSERT(fetchIndexList[i] <= maxIndex);
+      if (fetchIndexList[i] == maxIndex) ++maxIndex;
+    }
+    // Index order does not change the cache statistics
+    statistics = MeshOptimizerTestOptimizer::AnalyzeVertexCache(fetchIndexList.GetPtr(), indexCount, vertexCount);
+    E_ASSERT(statistics.transformedVertexCount == overdrawStatistics.transformedVertexCount);
+
+    /*-----------------------------------------------------------------
+    Simplification
+    -----------------------------------------------------------------*/
+    // A plane collapses without error down to its locked boundary keeping its area and orientation
+    Containers::List<Vector3f> planePositionList;
+    Containers::List<U32> planeIndexList;
+    MeshOptimizerTestCreatePlane(planePositionList, planeIndexList, 16);
+    const U32 planeIndexCount = static_cast<U32>(planeIndexList.GetCount());
+    Containers::List<U32> simplifiedIndexList(indexCount);
+    simplifiedIndexList.SetCount(indexCount);
+    F32 error = 1.0f;
+    U32 simplifiedIndexCount = MeshOptimizerTestOptimizer::Simplify(simplifiedIndexList.GetPtr(), planeIndexList.GetPtr(), planeIndexCount, planePositionList.GetPtr(), static_cast<U32>(planePositionList.GetCount()), 0, 0.001f, &error);
+    E_ASSERT(simplifiedIndexCount % 3 == 0 && simplifiedIndexCount * 4 < planeIndexCount && error < 0.0001f);
+    const Vector3f planeAreaNormal = MeshOptimizerTestGetAreaNormal(planePositionList.GetPtr(), planeIndexList.GetPtr(), planeIndexCount);
+    const Vector3f simplifiedAreaNormal = MeshOptimizerTestGetAreaNormal(planePositionList.GetPtr(), simplifiedIndexList.GetPtr(), simplifiedIndexCount);
+    E_ASSERT(Math::IsEqual(planeAreaNormal.y, simplifiedAreaNormal.y, 0.01f) && Math::IsEqual(planeAreaNormal.y, 512.0f, 0.01f));
+    // Boundary vertices are kept
+    Containers::List<U8> usedList(planePositionList.GetCount());
+    usedList.SetCount(planePositionList.GetCount());
+    Memory::Zero(usedList.GetPtr(), usedList.GetCount());
+    for (U32 i = 0; i < simplifiedIndexCount; ++i) usedList[simplifiedIndexList[i]] = 1;
+    for (U32 i = 0; i <= 16; ++i) E_ASSERT(usedList[i] && usedList[16 * 17 + i] && usedList[i * 17] && usedList[i * 17 + 16]);
+
+    // A sphere halved with a small error referencing the source vertices
+    simplifiedIndexCount = MeshOptimizerTestOptimizer::Simplify(simplifiedIndexList.GetPtr(), indexList.GetPtr(), indexCount, positionList.GetPtr(), vertexCount, indexCount / 2, 1.0f, &error);
+    E_ASSERT(simplifiedIndexCount % 3 == 0 && simplifiedIndexCount <= indexCount / 2 && simplifiedIndexCount > indexCount / 4);
+    E_ASSERT(error > 0.0f && error < 0.01f);
+    for (U32 i = 0; i < simplifiedIndexCount; i += 3)
+    {
+      E_ASSERT(simplifiedIndexList[i] < vertexCount && simplifiedIndexList[i + 1] < vertexCount && simplifiedIndexList[i + 2] < vertexCount);
+      E_ASSERT(positionList[simplifiedIndexList[i]] != positionList[simplifiedIndexList[i + 1]]);
+      E_ASSERT(positionList[simplifiedIndexList[i + 1]] != positionList[simplifiedIndexList[i + 2]]);
+      E_ASSERT(positionList[simplifiedIndexList[i + 2]] != positionList[simplifiedIndexList[i]]);
+    }
+    // The simplified sphere still faces outwards (no flipped triangles)
+    for (U32 i = 0; i < simplifiedIndexCount; i += 3)
+    {
+      const Vector3f& a = positionList[simplifiedIndexList[i]];
+      const Vector3f normal = Vector3f::Cross(positionList[simplifiedIndexList[i + 1]] - a, positionList[simplifiedIndexList[i + 2]] - a);
+      E_ASSERT(Vector3f::Dot(normal, a + positionList[simplifiedIndexList[i + 1]] + positionList[simplifiedIndexList[i + 2]]) < 0.0f);
+    }
+
+    // In place simplification gives the same result
+    Containers::List<U32> inPlaceSimplifiedIndexList(indexList);
+    E_ASSERT(MeshOptimizerTestOptimizer::Simplify(inPlaceSimplifiedIndexList.GetPtr(), inPlaceSimplifiedIndexList.GetPtr(), indexCount, positionList.GetPtr(), vertexCount, indexCount / 2) == simplifiedIndexCount);
+    for (U32 i = 0; i < simplifiedIndexCount; ++i) E_ASSERT(inPlaceSimplifiedIndexList[i] == simplifiedIndexList[i]);
+
+    // A tiny error bound stops the simplification early
+    simplifiedIndexCount = MeshOptimizerTestOptimizer::Simplify(simplifiedIndexList.GetPtr(), indexList.GetPtr(), indexCount, positionList.GetPtr(), vertexCount, 0, 0.00001f, &error);
+    E_ASSERT(simplifiedIndexCount > indexCount * 3 / 4 && error <= 0.00001f);
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+bool Test::MeshOptimizer::RunPerformanceTest()
+{
+  try
+  {
+    std::cout << "[Test::MeshOptimizer::RunPerformanceTest]" << std::endl;
+
+    E::Time::Timer t;
+    Containers::List<Vector3f> positionList;
+    Containers::List<U32> indexList;
+    MeshOptimizerTestCreateSphere(positionList, indexList, TEST_MESH_OPTIMIZER_PERFORMANCE_GRID_SIZE);
+    const U32 vertexCount = static_cast<U32>(positionList.GetCount());
+    const U32 indexCount = static_cast<U32>(indexList.GetCount());
+    std::cout << "Triangles: " << indexCount / 3 << " vertices: " << vertexCount << std::endl << std::endl;
+
+    // Welding
+    Containers::List<Vector3f> soupPositionList(indexCount);
+    for (U32 i = 0; i < indexCount; ++i) soupPositionList.PushBack(positionList[indexList[i]]);
+    Containers::List<U32> remapList(indexCount);
+    remapList.SetCount(indexCount);
+    t.Reset();
+    const U32 uniqueVertexCount = MeshOptimizerTestOptimizer::GenerateVertexRemap(remapList.GetPtr(), nullptr, indexCount, soupPositionList.GetPtr(), indexCount, sizeof(Vector3f));
+    std::cout << "GenerateVertexRemap:\t" << t.GetElapsed().GetMilliseconds() << " ms (" << indexCount << " -> " << uniqueVertexCount << " vertices)" << std::endl;
+
+    // Vertex cache
+    MeshOptimizerTestShuffle(indexList);
+    MeshOptimizerTestOptimizer::VertexCacheStatistics statistics = MeshOptimizerTestOptimizer::AnalyzeVertexCache(indexList.GetPtr(), indexCount, vertexCount);
+    std::cout << "Shuffled:\t\tACMR " << statistics.acmr << " ATVR " << statistics.atvr << std::endl;
+    t.Reset();
+    MeshOptimizerTestOptimizer::OptimizeVertexCache(indexList.GetPtr(), indexList.GetPtr(), indexCount, vertexCount);
+    const D64 cacheTime = t.GetElapsed().GetMilliseconds();
+    statistics = MeshOptimizerTestOptimizer::AnalyzeVertexCache(indexList.GetPtr(), indexCount, vertexCount);
+    std::cout << "OptimizeVertexCache:\t" << cacheTime << " ms\tACMR " << statistics.acmr << " ATVR " << statistics.atvr << std::endl;
+
+    // Overdraw
+    t.Reset();
+    MeshOptimizerTestOptimizer::OptimizeOverdraw(indexList.GetPtr(), indexList.GetPtr(), indexCount, positionList.GetPtr(), vertexCount);
+    const D64 overdrawTime = t.GetElapsed().GetMilliseconds();
+    statistics = MeshOptimizerTestOptimizer::AnalyzeVertexCache(indexList.GetPtr(), indexCount, vertexCount);
+    std::cout << "OptimizeOverdraw:\t" << overdrawTime << " ms\tACMR " << statistics.acmr << " ATVR " << statistics.atvr << std::endl;
+
+    // Vertex fetch
+    t.Reset();
+    MeshOptimizerTestOptimizer::OptimizeVertexFetch(remapList.GetPtr(), indexList.GetPtr(), indexCount, vertexCount);
+    MeshOptimizerTestOptimizer::RemapIndices(indexList.GetPtr(), indexList.GetPtr(), indexCount, remapList.GetPtr());
+    Containers::List<Vector3f> fetchPositionList(vertexCount);
+    fetchPositionList.SetCount(vertexCount);
+    MeshOptimizerTestOptimizer::RemapVertices(fetchPositionList.GetPtr(), positionList.GetPtr(), vertexCount, remapList.GetPtr());
+    std::cout << "OptimizeVertexFetch:\t" << t.GetElapsed().GetMilliseconds() << " ms" << std::endl << std::endl;
+
+    // Simplification
+    Containers::List<U32> simplifiedIndexList(indexCount);
+    simplifiedIndexList.SetCount(indexCount);
+    const U32 ratios[3] = { 50, 10, 1 };
+    for (U32 i = 0; i < 3; ++i)
+    {
+      F32 error = 0.0f;
+      t.Reset();
+      const U32 simplifiedIndexCount = MeshOptimizerTestOptimizer::Simplify(simplifiedIndexList.GetPtr(), indexList.GetPtr(), indexCount, fetchPositionList.GetPtr(), vertexCount, (indexCount / 300) * 3 * ratios[i], 1.0f, &error);
+      std::cout << "Simplify " << ratios[i] << "%:\t\t" << t.GetElapsed().GetMilliseconds() << " ms\t" << simplifiedIndexCount / 3 << " triangles (error " << error << ")" << std::endl;
+    }
+
+    // Level of detail chain (each level halves the previous one) selected by projected error
+    const U32 kLodCount = 8;
+    Containers::List<U32> lodIndexList(indexList);
+    U32 lodTriangleCounts[kLodCount] = { indexCount / 3 };
+    F32 lodErrors[kLodCount] = { 0.0f };
+    U32 lodCount = 1;
+    U32 lodStartIndex = 0;
+    U32 lodIndexCount = indexCount;
+    t.Reset();
+    for (; lodCount < kLodCount; ++lodCount)
+    {
+      F32 error = 0.0f;
+      const U32 simplifiedIndexCount = MeshOptimizerTestOptimizer::Simplify(simplifiedIndexList.GetPtr(), &lodIndexList[lodStartIndex], lodIndexCount, fetchPositionList.GetPtr(), vertexCount, (lodIndexCount / 6) * 3, 0.05f, &error);
+      if (simplifiedIndexCount * 10 > lodIndexCount * 9) break;
+
+      lodStartIndex = static_cast<U32>(lodIndexList.GetCount());
+      lodIndexCount = simplifiedIndexCount;
+      lodIndexList.PushBack(simplifiedIndexList.GetPtr(), simplifiedIndexCount);
+      lodTriangleCounts[lodCount] = simplifiedIndexCount / 3;
+      lodErrors[lodCount] = lodErrors[lodCount - 1] + error;
+    }
+    std::cout << "Lod chain:\t\t" << t.GetElapsed().GetMilliseconds() << " ms\t" << lodCount << " levels" << std::endl;
+    for (U32 i = 0; i < lodCount; ++i) std::cout << "  Lod " << i << ":\t\t" << lodTriangleCounts[i] << " triangles (error " << lodErrors[i] << ")" << std::endl;
+
+    // Unit spheres seen through a 60 degree perspective at increasing distances (coarsest level within 1/1024 of the
+    // viewport height, as Mesh::SelectLod does)
+    const Matrix4f projectionMatrix = Math::BuildPerspectiveLH(60, 4.0f / 3.0f, 0.1f, 1000.0f);
+    U64 triangleCount = 0;
+    U64 lodTriangleCount = 0;
+    for (U32 i = 0; i < 256; ++i)
+    {
+      const F32 screenSize = Math::GetProjectedSize(projectionMatrix, Math::Sqrt(3.0f), 2.0f + static_cast<F32>(i));
+      U32 lod = 0;
+      while (lod + 1 < lodCount && lodErrors[lod + 1] * screenSize <= 1.0f / 1024.0f) ++lod;
+      triangleCount += lodTriangleCounts[0];
+      lodTriangleCount += lodTriangleCounts[lod];
+    }
+    std::cout << "Lod selection:\t\t" << triangleCount << " -> " << lodTriangleCount << " triangles (256 spheres 2 to 258 units away)" << std::endl;
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
@@ -38,6 +38,24 @@ using namespace E;
 Auxiliary declarations
 ----------------------------------------------------------------------------------------------------------------------*/
 
+#ifndef TEST_OBJECT_COUNT
+#define TEST_OBJECT_COUNT 10000
+#endif
+
+#ifndef TEST_FRAME_COUNT
+#define TEST_FRAME_COUNT 100
+#endif
+
+// Scene object local matrix update using Euler angles in degrees (Scene::ObjectCore approach before quaternions)
+static void QuaternionTestUpdateEulerMatrix(Matrix4f& m, const Vector3f& orientation, const Vector3f& position, const Vector3f& scale)
+{
+  Quatf qRotation;
+  qRotation.SetRotation(Vector3f(Math::Rad(orientation.x), Math::Rad(orientation.y), Math::Rad(orientation.z)));
+  qRotation.GetRotation(m);
+  m.SetTranslation(position);
+  if (scale != 1.0f) m.Scale(scale);
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 TestList methods
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -236,6 +254,49 @@ bool Test::Quaternion::RunFunctionalityTest()
   q3 = Quatf::Slerp(q, q2, .95f);
   E_ASSERT(q3 != q4);
 
+  /*
+  void              GetTransform(Matrix4<T>& m, const Vector3<T>& scale, const Vector3<T>& translation) const;
+  */
+  for (U32 i = 0; i < 100; ++i)
+  {
+    v = Vector3f(
+      Math::Global::GetRandom().GetF32(-180, 180),
+      Math::Global::GetRandom().GetF32(-180, 180),
+      Math::Global::GetRandom().GetF32(-180, 180));
+    Vector3f position(Math::Global::GetRandom().GetF32(-100, 100), Math::Global::GetRandom().GetF32(-100, 100), Math::Global::GetRandom().GetF32(-100, 100));
+    Vector3f scale(Math::Global::GetRandom().GetF32(0.1f, 10), Math::Global::GetRandom().GetF32(0.1f, 10), Math::Global::GetRandom().GetF32(0.1f, 10));
+
+    // The fused version must match the rotation, translation and scale steps exactly
+    Matrix4f m2;
+    QuaternionTestUpdateEulerMatrix(m, v, position, scale);
+    q.SetRotation(Vector3f(Math::Rad(v.x), Math::Rad(v.y), Math::Rad(v.z)));
+    q.GetTransform(m2, scale, position);
+    for (U32 j = 0; j < 16; ++j) E_ASSERT(m[j] == m2[j]);
+
+    // Composition: q2 * q applies q first and then q2 (same as the matrix product of q and q2 matrices)
+    q2.SetRotation(Math::Global::GetRandom().GetF32(-3, 3), Vector3f(0, 1, 0));
+    Matrix4f rotation, rotation2, compositeRotation;
+    q.GetRotation(rotation);
+    q2.GetRotation(rotation2);
+    (q2 * q).GetRotation(compositeRotation);
+    m2 = rotation * rotation2;
+    for (U32 j = 0; j < 16; ++j) E_ASSERT(Math::IsEqual(compositeRotation[j], m2[j], 1e-5f));
+  }
+
+  /*
+  Fast approximations
+  */
+  for (F32 angle = -100.0f; angle < 100.0f; angle += 0.001f)
+  {
+    F32 sin, cos;
+    Math::FastSinCos(angle, sin, cos);
+    E_ASSERT(Math::IsEqual(sin, Math::Sin(angle), 1e-6f) && Math::IsEqual(cos, Math::Cos(angle), 1e-6f));
+  }
+  for (F32 value = 1e-3f; value < 1e3f; value *= 1.001f)
+  {
+    E_ASSERT(Math::IsRelativelyEqual(Math::FastInvSqrt(value), 1.0f / Math::Sqrt(value), 1e-5f));
+  }
+
   return true;
 }
 
@@ -293,5 +354,116 @@ bool Test::Quaternion::RunPerformanceTest()
       Math::IsEqual(rotationMatrix[15], rotationMatrix2[15]));
   }
 
+  /*-------------------------------------------------------------------------------
+  Scene object transform update
+  -------------------------------------------------------------------------------*/
+  std::cout << "Objects: " << TEST_OBJECT_COUNT << " frames: " << TEST_FRAME_COUNT << std::endl;
+  E::Containers::List<Vector3f> orientationList(TEST_OBJECT_COUNT);
+  E::Containers::List<Vector3f> positionList(TEST_OBJECT_COUNT);
+  E::Containers::List<Vector3f> scaleList(TEST_OBJECT_COUNT);
+  E::Containers::List<Quatf> quaternionList(TEST_OBJECT_COUNT);
+  E::Containers::List<Matrix4f> matrixList(TEST_OBJECT_COUNT);
+  for (U32 i = 0; i < TEST_OBJECT_COUNT; ++i)
+  {
+    orientationList.PushBack(Vector3f(
+      Math::Global::GetRandom().GetF32(-180, 180),
+      Math::Global::GetRandom().GetF32(-180, 180),
+      Math::Global::GetRandom().GetF32(-180, 180)));
+    positionList.PushBack(Vector3f(Math::Global::GetRandom().GetF32(-100, 100), 0.0f, Math::Global::GetRandom().GetF32(-100, 100)));
+    scaleList.PushBack(Vector3f(Math::Global::GetRandom().GetF32(0.5f, 2.0f)));
+    quaternionList.PushBack(Quatf());
+    matrixList.PushBack(Matrix4f());
+  }
+  // Frame rotation step (one degree around Y)
+  Quatf stepRotation;
+  stepRotation.SetRotation(Math::Rad(1.0f), Vector3f(0, 1, 0));
+  E::Time::Timer t;
+  F32 checksum = 0.0f;
+
+  // Euler degrees to quaternion to rotation matrix then translation and scaling
+  t.Reset();
+  for (U32 k = 0; k < TEST_FRAME_COUNT; ++k)
+  {
+    for (U32 i = 0; i < TEST_OBJECT_COUNT; ++i)
+    {
+      orientationList[i].y += 1.0f;
+      QuaternionTestUpdateEulerMatrix(matrixList[i], orientationList[i], positionList[i], scaleList[i]);
+    }
+  }
+  F32 eulerTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+  checksum += matrixList[TEST_OBJECT_COUNT - 1][0];
+
+  // Euler degrees to quaternion then fused SRT matrix
+  t.Reset();
+  for (U32 k = 0; k < TEST_FRAME_COUNT; ++k)
+  {
+    for (U32 i = 0; i < TEST_OBJECT_COUNT; ++i)
+    {
+      orientationList[i].y += 1.0f;
+      quaternionList[i].SetRotation(Vector3f(Math::Rad(orientationList[i].x), Math::Rad(orientationList[i].y), Math::Rad(orientationList[i].z)));
+      quaternionList[i].GetTransform(matrixList[i], scaleList[i], positionList[i]);
+    }
+  }
+  F32 fusedTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+  checksum += matrixList[TEST_OBJECT_COUNT - 1][0];
+
+  // Quaternion composition then fused SRT matrix
+  t.Reset();
+  for (U32 k = 0; k < TEST_FRAME_COUNT; ++k)
+  {
+    for (U32 i = 0; i < TEST_OBJECT_COUNT; ++i)
+    {
+      quaternionList[i] = stepRotation * quaternionList[i];
+      quaternionList[i].Normalize();
+      quaternionList[i].GetTransform(matrixList[i], scaleList[i], positionList[i]);
+    }
+  }
+  F32 quaternionTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+  checksum += matrixList[TEST_OBJECT_COUNT - 1][0];
+
+#ifdef E_SETTING_MATH_LOW_PRECISION
+  std::cout << "Math precision: low" << std::endl;
+#else
+  std::cout << "Math precision: default" << std::endl;
+#endif
+  std::cout << "Euler fused transform time [" << fusedTime << " / " << eulerTime << "]\t" << (eulerTime / fusedTime * 100.0) - 100.0 << "% faster" << std::endl;
+  std::cout << "Quaternion transform time [" << quaternionTime << " / " << eulerTime << "]\t" << (eulerTime / quaternionTime * 100.0) - 100.0 << "% faster" << std::endl;
+
+  /*-------------------------------------------------------------------------------
+  Fast approximations
+  -------------------------------------------------------------------------------*/
+  const U32 angleCount = TEST_OBJECT_COUNT * TEST_FRAME_COUNT;
+  F32 sinSum = 0.0f, cosSum = 0.0f;
+  t.Reset();
+  for (U32 i = 0; i < angleCount; ++i)
+  {
+    F32 angle = static_cast<F32>(i) * 1e-4f;
+    sinSum += Math::Sin(angle);
+    cosSum += Math::Cos(angle);
+  }
+  F32 sinCosTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+  t.Reset();
+  for (U32 i = 0; i < angleCount; ++i)
+  {
+    F32 sin, cos, angle = static_cast<F32>(i) * 1e-4f;
+    Math::FastSinCos(angle, sin, cos);
+    sinSum += sin;
+    cosSum += cos;
+  }
+  F32 fastSinCosTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+  checksum += sinSum + cosSum;
+  std::cout << "FastSinCos time [" << fastSinCosTime << " / " << sinCosTime << "]\t" << (sinCosTime / fastSinCosTime * 100.0) - 100.0 << "% faster" << std::endl;
+
+  F32 invSqrtSum = 0.0f;
+  t.Reset();
+  for (U32 i = 1; i <= angleCount; ++i) invSqrtSum += 1.0f / Math::Sqrt(static_cast<F32>(i));
+  F32 invSqrtTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+  t.Reset();
+  for (U32 i = 1; i <= angleCount; ++i) invSqrtSum += Math::FastInvSqrt(static_cast<F32>(i));
+  F32 fastInvSqrtTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+  checksum += invSqrtSum;
+  std::cout << "FastInvSqrt time [" << fastInvSqrtTime << " / " << invSqrtTime << "]\t" << (invSqrtTime / fastInvSqrtTime * 100.0) - 100.0 << "% faster" << std::endl;
+  std::cout << "Checksum: " << checksum << std::endl;
+
   return true;
 }
@@ -0,0 +1,265 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Random.cpp
+This file defines E::Math::RandomNumberGenerator and E::Math::RandomStream test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+#ifndef TEST_RANDOM_COUNT
+#define TEST_RANDOM_COUNT 10000000
+#endif
+
+#ifndef TEST_RANDOM_BUCKET_COUNT
+#define TEST_RANDOM_BUCKET_COUNT 16
+#endif
+
+static const U32 kRandomTestSeed = 120120;
+
+/**
+Returns true if the values (in [0, TEST_RANDOM_BUCKET_COUNT)) are evenly distributed (within 5%).
+*/
+static bool RandomTestIsUniform(const U32* pValues, size_t count)
+{
+  size_t bucketList[TEST_RANDOM_BUCKET_COUNT] = {};
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (pValues[i] >= TEST_RANDOM_BUCKET_COUNT) return false;
+    ++bucketList[pValues[i]];
+  }
+  const D64 expected = static_cast<D64>(count) / TEST_RANDOM_BUCKET_COUNT;
+  for (U32 i = 0; i < TEST_RANDOM_BUCKET_COUNT; ++i)
+  {
+    if (Math::Abs(static_cast<D64>(bucketList[i]) - expected) > expected * 0.05) return false;
+  }
+  return true;
+}
+
+static void RandomTestPrintRate(const char* pName, D64 milliseconds)
+{
+  std::cout << pName << ":\t" << static_cast<D64>(TEST_RANDOM_COUNT) / (milliseconds * 1000.0) << " M numbers/s" << std::endl;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TestRandom methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::Random::Run()
+{
+  try
+  {
+    std::cout << "[Test::Random::Run] using " << TEST_RANDOM_COUNT << " numbers" << std::endl;
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::Random::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::Random::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::Random::RunFunctionalityTest()
+{
+  try
+  {
+    std::cout << "[Test::Random::RunFunctionalityTest]" << std::endl;
+
+    /*-----------------------------------------------------------------
+    Mersenne Twister: array versions match the single calls
+    -----------------------------------------------------------------*/
+    // Sizes crossing several state vector regenerations and SIMD remainders
+    const size_t sizeList[] = { 0, 1, 3, 4, 5, 623, 624, 625, 1000, 2500 };
+    E::Containers::List<U32> valueList(2500);
+    E::Containers::List<F32> floatList(2500);
+    valueList.SetCount(2500);
+    floatList.SetCount(2500);
+    Math::RandomNumberGenerator generatorA;
+    Math::RandomNumberGenerator generatorB;
+    generatorA.SetSeed(kRandomTestSeed);
+    generatorB.SetSeed(kRandomTestSeed);
+    for (size_t s = 0; s < sizeof(sizeList) / sizeof(size_t); ++s)
+    {
+      const size_t size = sizeList[s];
+      generatorA.GetU32(valueList.GetPtr(), size, 1000);
+      for (size_t i = 0; i < size; ++i) E_ASSERT(valueList[i] == generatorB.GetU32(1000));
+      generatorA.GetU32(valueList.GetPtr(), size, 1024);
+      for (size_t i = 0; i < size; ++i) E_ASSERT(valueList[i] == generatorB.GetU32(1024));
+      generatorA.GetF32(floatList.GetPtr(), size, -10.0f, 10.0f);
+      for (size_t i = 0; i < size; ++i) E_ASSERT(floatList[i] == generatorB.GetF32(-10.0f, 10.0f));
+    }
+    // Range 0 does not advance the generator
+    generatorA.GetU32(valueList.GetPtr(), 10, 0);
+    E_ASSERT(valueList[0] == 0 && valueList[9] == 0 && generatorA.GetU32(1000) == generatorB.GetU32(1000));
+
+    // Uninitialized generators use the default seed
+    Math::RandomNumberGenerator generatorC;
+    Math::RandomNumberGenerator generatorD;
+    generatorC.GetU32(valueList.GetPtr(), 700, 0xFFFFFFFF);
+    for (size_t i = 0; i < 700; ++i) E_ASSERT(valueList[i] == generatorD.GetU32(0xFFFFFFFF));
+
+    /*-----------------------------------------------------------------
+    RandomStream
+    -----------------------------------------------------------------*/
+    Math::RandomStream streamA(kRandomTestSeed);
+    Math::RandomStream streamB(kRandomTestSeed);
+    Math::RandomStream streamC(streamA);
+    streamC.Jump();
+    Math::RandomStream streamD(kRandomTestSeed, 1);
+    for (U32 i = 0; i < 1000; ++i)
+    {
+      const U64 value = streamA.GetU64();
+      E_ASSERT(value == streamB.GetU64());
+      E_ASSERT(streamC.GetU64() == streamD.GetU64());
+    }
+    // Jumped streams do not overlap the original one (within the tested length)
+    Math::RandomStream streamE(kRandomTestSeed);
+    Math::RandomStream streamF(kRandomTestSeed, 1);
+    U32 matchCount = 0;
+    for (U32 i = 0; i < 1000; ++i) matchCount += (streamE.GetU64() == streamF.GetU64()) ? 1 : 0;
+    E_ASSERT(matchCount == 0);
+
+    // Array versions match the single calls
+    for (size_t s = 0; s < sizeof(sizeList) / sizeof(size_t); ++s)
+    {
+      const size_t size = sizeList[s];
+      streamA.GetU32(valueList.GetPtr(), size, 1000);
+      for (size_t i = 0; i < size; ++i) E_ASSERT(valueList[i] == streamB.GetU32(1000));
+      streamA.GetF32(floatList.GetPtr(), size, -10.0f, 10.0f);
+      for (size_t i = 0; i < size; ++i) E_ASSERT(floatList[i] == streamB.GetF32(-10.0f, 10.0f));
+    }
+
+    // Ranges & distribution
+    E::Containers::List<U32> bucketValueList(100000);
+    bucketValueList.SetCount(100000);
+    streamA.GetU32(bucketValueList.GetPtr(), bucketValueList.GetCount(), TEST_RANDOM_BUCKET_COUNT);
+    E_ASSERT(RandomTestIsUniform(bucketValueList.GetPtr(), bucketValueList.GetCount()));
+    for (size_t i = 0; i < bucketValueList.GetCount(); ++i) bucketValueList[i] = static_cast<U32>(streamA.GetF32() * TEST_RANDOM_BUCKET_COUNT);
+    E_ASSERT(RandomTestIsUniform(bucketValueList.GetPtr(), bucketValueList.GetCount()));
+    for (U32 i = 0; i < 10000; ++i)
+    {
+      const I32 value = streamA.GetI32(-5, 5);
+      E_ASSERT(value >= -5 && value < 5);
+      const F32 f = streamA.GetF32();
+      E_ASSERT(f >= 0.0f && f < 1.0f);
+      E_ASSERT(streamA.GetU32(3) < 3);
+    }
+    E_ASSERT(streamA.GetI32(7, 7) == 7 && streamA.GetU32(0) == 0);
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+bool Test::Random::RunPerformanceTest()
+{
+  try
+  {
+    std::cout << "[Test::Random::RunPerformanceTest]" << std::endl << std::endl;
+
+    E::Time::Timer t;
+    E::Containers::List<U32> valueList(TEST_RANDOM_COUNT);
+    E::Containers::List<F32> floatList(TEST_RANDOM_COUNT);
+    valueList.SetCount(TEST_RANDOM_COUNT);
+    floatList.SetCount(TEST_RANDOM_COUNT);
+    U64 checksum = 0;
+
+    /*-----------------------------------------------------------------
+    Mersenne Twister
+    -----------------------------------------------------------------*/
+    Math::RandomNumberGenerator generator;
+    generator.SetSeed(kRandomTestSeed);
+    t.Reset();
+    for (size_t i = 0; i < TEST_RANDOM_COUNT; ++i) valueList[i] = generator.GetU32(1000);
+    RandomTestPrintRate("RandomNumberGenerator GetU32", t.GetElapsed().GetMilliseconds());
+    checksum += valueList[TEST_RANDOM_COUNT - 1];
+    t.Reset();
+    generator.GetU32(valueList.GetPtr(), TEST_RANDOM_COUNT, 1000);
+    RandomTestPrintRate("RandomNumberGenerator GetU32 array", t.GetElapsed().GetMilliseconds());
+    checksum += valueList[TEST_RANDOM_COUNT - 1];
+    t.Reset();
+    generator.GetU32(valueList.GetPtr(), TEST_RANDOM_COUNT, 1024);
+    RandomTestPrintRate("RandomNumberGenerator GetU32 array (power of 2)", t.GetElapsed().GetMilliseconds());
+    checksum += valueList[TEST_RANDOM_COUNT - 1];
+    t.Reset();
+    for (size_t i = 0; i < TEST_RANDOM_COUNT; ++i) floatList[i] = generator.GetF32(-1.0f, 1.0f);
+    RandomTestPrintRate("RandomNumberGenerator GetF32", t.GetElapsed().GetMilliseconds());
+    checksum += static_cast<U64>(floatList[TEST_RANDOM_COUNT - 1] * 1000.0f);
+    t.Reset();
+    generator.GetF32(floatList.GetPtr(), TEST_RANDOM_COUNT, -1.0f, 1.0f);
+    RandomTestPrintRate("RandomNumberGenerator GetF32 array", t.GetElapsed().GetMilliseconds());
+    checksum += static_cast<U64>(floatList[TEST_RANDOM_COUNT - 1] * 1000.0f);
+    std::cout << std::endl;
+
+    /*-----------------------------------------------------------------
+    RandomStream
+    -----------------------------------------------------------------*/
+    Math::RandomStream stream(kRandomTestSeed);
+    t.Reset();
+    for (size_t i = 0; i < TEST_RANDOM_COUNT; ++i) valueList[i] = stream.GetU32(1000);
+    RandomTestPrintRate("RandomStream GetU32", t.GetElapsed().GetMilliseconds());
+    checksum += valueList[TEST_RANDOM_COUNT - 1];
+    t.Reset();
+    stream.GetU32(valueList.GetPtr(), TEST_RANDOM_COUNT, 1000);
+    RandomTestPrintRate("RandomStream GetU32 array", t.GetElapsed().GetMilliseconds());
+    checksum += valueList[TEST_RANDOM_COUNT - 1];
+    t.Reset();
+    stream.GetF32(floatList.GetPtr(), TEST_RANDOM_COUNT, -1.0f, 1.0f);
+    RandomTestPrintRate("RandomStream GetF32 array", t.GetElapsed().GetMilliseconds());
+    checksum += static_cast<U64>(floatList[TEST_RANDOM_COUNT - 1] * 1000.0f);
+    t.Reset();
+    for (size_t i = 0; i < TEST_RANDOM_COUNT; ++i) checksum += stream.GetU64();
+    RandomTestPrintRate("RandomStream GetU64", t.GetElapsed().GetMilliseconds());
+    t.Reset();
+    for (U32 i = 0; i < 1000; ++i) stream.Jump();
+    checksum += stream.GetU64();
+    std::cout << "RandomStream Jump (x1000):\t" << t.GetElapsed().GetMilliseconds() << " ms" << std::endl;
+
+    std::cout << std::endl << "Checksum: " << checksum << std::endl;
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
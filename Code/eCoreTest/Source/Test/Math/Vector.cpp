@@ -38,6 +38,28 @@ using namespace E;
 Auxiliary declarations
 ----------------------------------------------------------------------------------------------------------------------*/
 
+#ifndef TEST_VECTOR_SIZE
+#define TEST_VECTOR_SIZE 1000000
+#endif
+
+#ifndef TEST_VECTOR_ITERATION_COUNT
+#define TEST_VECTOR_ITERATION_COUNT 20
+#endif
+
+static Vector4f VectorTestGetRandom()
+{
+  return Vector4f(
+    Math::Global::GetRandom().GetF32(-100.0f, 100.0f), 
+    Math::Global::GetRandom().GetF32(-100.0f, 100.0f), 
+    Math::Global::GetRandom().GetF32(-100.0f, 100.0f), 
+    Math::Global::GetRandom().GetF32(-100.0f, 100.0f));
+}
+
+static bool VectorTestIsExact(const Vector4f& v, F32 x, F32 y, F32 z, F32 w)
+{
+  return v.x == x && v.y == y && v.z == z && v.w == w;
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 TestList methods
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -409,12 +431,128 @@ bool Test::Vector::RunFunctionalityTest()
   ss << "Min: " << v4fMin.x << "," << v4fMin.y << "," << v4fMin.z << "," << v4fMin.w << " Max: " << v4fMax.x << "," << v4fMax.y << "," << v4fMax.z << "," << v4fMax.w;
   std::cout << ss.GetPtr() << std::endl;
 
+  /*-------------------------------------------------------------------------------
+  Vector4 F32 SIMD specializations (results must match the scalar operations)
+  -------------------------------------------------------------------------------*/
+  for (U32 i = 0; i < 1000; ++i)
+  {
+    Vector4f a = VectorTestGetRandom();
+    Vector4f b = VectorTestGetRandom();
+    F32 s = Math::Global::GetRandom().GetF32(0.5f, 2.0f);
+    E_ASSERT(VectorTestIsExact(a + b, a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w));
+    E_ASSERT(VectorTestIsExact(a - b, a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w));
+    E_ASSERT(VectorTestIsExact(a * b, a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w));
+    E_ASSERT(VectorTestIsExact(a / b, a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w));
+    E_ASSERT(VectorTestIsExact(a + s, a.x + s, a.y + s, a.z + s, a.w + s));
+    E_ASSERT(VectorTestIsExact(a * s, a.x * s, a.y * s, a.z * s, a.w * s));
+    E_ASSERT(VectorTestIsExact(a / s, a.x / s, a.y / s, a.z / s, a.w / s));
+    E_ASSERT(VectorTestIsExact(-a, -a.x, -a.y, -a.z, -a.w));
+    Vector4f c = a;
+    c += b;
+    c *= s;
+    c -= a;
+    E_ASSERT(VectorTestIsExact(c, (a.x + b.x) * s - a.x, (a.y + b.y) * s - a.y, (a.z + b.z) * s - a.z, (a.w + b.w) * s - a.w));
+    E_ASSERT(Vector4f::Dot(a, b) == a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w);
+    E_ASSERT(a.GetLengthSquared() == a.x * a.x + a.y * a.y + a.z * a.z + a.w * a.w);
+    E_ASSERT(VectorTestIsExact(Vector4f::Min(a, b), Math::Min(a.x, b.x), Math::Min(a.y, b.y), Math::Min(a.z, b.z), Math::Min(a.w, b.w)));
+    E_ASSERT(VectorTestIsExact(Vector4f::Max(a, b), Math::Max(a.x, b.x), Math::Max(a.y, b.y), Math::Max(a.z, b.z), Math::Max(a.w, b.w)));
+  }
+
+  // MinMax against a scalar search (odd count to cover the remainder)
+  v4fList.Clear();
+  for (U32 i = 0; i < 1001; ++i) v4fList.PushBack(VectorTestGetRandom());
+  Vector4f::MinMax(v4fMin, v4fMax, v4fList.GetPtr(), static_cast<U32>(v4fList.GetCount()));
+  Vector4f scalarMin = v4fList[0];
+  Vector4f scalarMax = v4fList[0];
+  for (U32 i = 1; i < v4fList.GetCount(); ++i)
+  {
+    for (U32 j = 0; j < 4; ++j)
+    {
+      scalarMin[j] = Math::Min(scalarMin[j], v4fList[i][j]);
+      scalarMax[j] = Math::Max(scalarMax[j], v4fList[i][j]);
+    }
+  }
+  E_ASSERT(VectorTestIsExact(v4fMin, scalarMin.x, scalarMin.y, scalarMin.z, scalarMin.w));
+  E_ASSERT(VectorTestIsExact(v4fMax, scalarMax.x, scalarMax.y, scalarMax.z, scalarMax.w));
+
   return true;
 }
 
 bool Test::Vector::RunPerformanceTest()
 {
   std::cout << "[Test::Vector::RunPerformanceTest]" << std::endl;
+  std::cout << "Vectors: " << TEST_VECTOR_SIZE << " iterations: " << TEST_VECTOR_ITERATION_COUNT << std::endl << std::endl;
+
+  E::Containers::List<Vector4f> aList(TEST_VECTOR_SIZE);
+  E::Containers::List<Vector4f> bList(TEST_VECTOR_SIZE);
+  E::Containers::List<Vector4f> resultList(TEST_VECTOR_SIZE);
+  for (U32 i = 0; i < TEST_VECTOR_SIZE; ++i)
+  {
+    aList.PushBack(VectorTestGetRandom());
+    bList.PushBack(VectorTestGetRandom());
+    resultList.PushBack(Vector4f());
+  }
+  const Vector4f* pA = aList.GetPtr();
+  const Vector4f* pB = bList.GetPtr();
+  Vector4f* pResult = resultList.GetPtr();
+  E::Time::Timer t;
+
+  /*-----------------------------------------------------------------
+  Multiply-add (r = a * b + a)
+  -----------------------------------------------------------------*/
+  t.Reset();
+  for (U32 k = 0; k < TEST_VECTOR_ITERATION_COUNT; ++k)
+  {
+    for (U32 i = 0; i < TEST_VECTOR_SIZE; ++i)
+    {
+      Vector4f& r = pResult[i];
+      r.x = pA[i].x * pB[i].x + pA[i].x;
+      r.y = pA[i].y * pB[i].y + pA[i].y;
+      r.z = pA[i].z * pB[i].z + pA[i].z;
+      r.w = pA[i].w * pB[i].w + pA[i].w;
+    }
+  }
+  F32 scalarTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+  F32 scalarChecksum = pResult[TEST_VECTOR_SIZE / 2].x;
+
+  t.Reset();
+  for (U32 k = 0; k < TEST_VECTOR_ITERATION_COUNT; ++k)
+  {
+    for (U32 i = 0; i < TEST_VECTOR_SIZE; ++i) pResult[i] = pA[i] * pB[i] + pA[i];
+  }
+  F32 vectorTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+  E_ASSERT(scalarChecksum == pResult[TEST_VECTOR_SIZE / 2].x);
+  std::cout << "Multiply-add time [" << vectorTime << " / " << scalarTime << "]\t" << (scalarTime / vectorTime * 100.0) - 100.0 << "% faster (" 
+    << static_cast<D64>(TEST_VECTOR_SIZE) * TEST_VECTOR_ITERATION_COUNT / vectorTime / 1000.0 << " M vectors/s)" << std::endl;
+
+  /*-----------------------------------------------------------------
+  MinMax
+  -----------------------------------------------------------------*/
+  Vector4f scalarMin, scalarMax;
+  t.Reset();
+  for (U32 k = 0; k < TEST_VECTOR_ITERATION_COUNT; ++k)
+  {
+    // Each iteration skips one more vector so the loop can not be hoisted
+    scalarMin = scalarMax = pA[k];
+    for (U32 i = k + 1; i < TEST_VECTOR_SIZE; ++i)
+    {
+      for (U32 j = 0; j < 4; ++j)
+      {
+        if (pA[i][j] > scalarMax[j]) scalarMax[j] = pA[i][j];
+        if (pA[i][j] < scalarMin[j]) scalarMin[j] = pA[i][j];
+      }
+    }
+  }
+  scalarTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+  Vector4f vectorMin, vectorMax;
+  t.Reset();
+  for (U32 k = 0; k < TEST_VECTOR_ITERATION_COUNT; ++k) Vector4f::MinMax(vectorMin, vectorMax, pA + k, TEST_VECTOR_SIZE - k);
+  vectorTime = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+  E_ASSERT(VectorTestIsExact(vectorMin, scalarMin.x, scalarMin.y, scalarMin.z, scalarMin.w));
+  E_ASSERT(VectorTestIsExact(vectorMax, scalarMax.x, scalarMax.y, scalarMax.z, scalarMax.w));
+  std::cout << "MinMax time [" << vectorTime << " / " << scalarTime << "]\t" << (scalarTime / vectorTime * 100.0) - 100.0 << "% faster (checksum " 
+    << scalarMin.x + scalarMax.x << " / " << vectorMin.x + vectorMax.x << ")" << std::endl;
 
   return true;
 }
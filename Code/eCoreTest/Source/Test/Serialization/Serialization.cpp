@@ -31,11 +31,32 @@ This file defines Serialization test functions.
 */
 
 #include <CoreTestPch.h>
+#include <psapi.h>
+#include <sstream>
+
+#pragma comment(lib, "psapi.lib")
 
 using namespace E;
 using namespace E::Serialization;
 using namespace std;
 
+/*----------------------------------------------------------------------------------------------------------------------
+Test macros
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Stands for the performance test array value count
+#define TEST_SERIALIZATION_VALUE_COUNT 1048576
+// Stands for the performance test blob size in bytes
+#define TEST_SERIALIZATION_BLOB_SIZE 67108864
+// Stands for the performance test text value count (stream based reads copy the remaining buffer per value)
+#define TEST_SERIALIZATION_TEXT_VALUE_COUNT 16384
+// Stands for the functionality test random number count
+#define TEST_SERIALIZATION_NUMBER_COUNT 100000
+// Stands for the XML streaming test record count, record group size & record array value count (about 500 MB of text)
+#define TEST_SERIALIZATION_XML_RECORD_COUNT 46080
+#define TEST_SERIALIZATION_XML_GROUP_SIZE 256
+#define TEST_SERIALIZATION_XML_VALUE_COUNT 1024
+
 /*----------------------------------------------------------------------------------------------------------------------
 Class definitions
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -89,6 +110,269 @@ struct XmlNodeB
   }
 };
 
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary functions
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Stands for the array & block test data (ISerializer contract items 3 & 4). Floating point lists include values
+// without an exact short representation, scientific notation and non finite values so formatting differences show up
+static const U16 kSerializationTestU16List[] = { 0, 1, 0x1234, 0xffff };
+static const U32 kSerializationTestU32List[] = { 0, 1, 0x12345678, 0xffffffff };
+static const U64 kSerializationTestU64List[] = { 0, 1, 0x123456789abcdef0ULL, 0xffffffffffffffffULL };
+static const F32 kSerializationTestF32List[] = { 0.0f, -1.5f, 1024.25f, 0.125f, 0.1f, 1e21f, std::numeric_limits<F32>::infinity() };
+static const D64 kSerializationTestD64List[] = { 0.0, -1.5, 1024.25, 0.125, 0.1, 1e21, -std::numeric_limits<D64>::infinity() };
+static const size_t kSerializationTestFloatCount = sizeof(kSerializationTestF32List) / sizeof(F32);
+static const Byte kSerializationTestBlock[] = { 0x00, 0x7f, 0x80, 0xff, 0x12, 0xab };
+
+static void SerializationTestWriteArrays(ISerializer& serializer)
+{
+  const U16* u16List = kSerializationTestU16List;
+  const U32* u32List = kSerializationTestU32List;
+  const U64* u64List = kSerializationTestU64List;
+  const F32* f32List = kSerializationTestF32List;
+  const D64* d64List = kSerializationTestD64List;
+  const Byte* block = kSerializationTestBlock;
+
+  serializer.BeginTag("u16");
+  serializer.Write(u16List, 4);
+  serializer.EndTag();
+  serializer.BeginTag("u32");
+  serializer.Write(u32List, 4);
+  serializer.EndTag();
+  serializer.BeginTag("u64");
+  serializer.Write(u64List, 4);
+  serializer.EndTag();
+  serializer.BeginTag("f32");
+  serializer.Write(f32List, kSerializationTestFloatCount);
+  serializer.EndTag();
+  serializer.BeginTag("d64");
+  serializer.Write(d64List, kSerializationTestFloatCount);
+  serializer.EndTag();
+  serializer.BeginTag("block");
+  serializer.WriteBlock(block, sizeof(kSerializationTestBlock));
+  serializer.EndTag();
+  // Empty arrays must not write anything
+  serializer.Write(f32List, 0);
+}
+
+static bool SerializationTestReadArrays(ISerializer& deserializer)
+{
+  const U16* u16List = kSerializationTestU16List;
+  const U32* u32List = kSerializationTestU32List;
+  const U64* u64List = kSerializationTestU64List;
+  const F32* f32List = kSerializationTestF32List;
+  const D64* d64List = kSerializationTestD64List;
+  const Byte* block = kSerializationTestBlock;
+
+  U16 u16Result[4] = {};
+  U32 u32Result[4] = {};
+  U64 u64Result[4] = {};
+  F32 f32Result[kSerializationTestFloatCount] = {};
+  D64 d64Result[kSerializationTestFloatCount] = {};
+  Byte blockResult[sizeof(kSerializationTestBlock)] = {};
+
+  deserializer.BeginTag("u16");
+  deserializer.Read(u16Result, 4);
+  deserializer.EndTag();
+  deserializer.BeginTag("u32");
+  deserializer.Read(u32Result, 4);
+  deserializer.EndTag();
+  deserializer.BeginTag("u64");
+  deserializer.Read(u64Result, 4);
+  deserializer.EndTag();
+  deserializer.BeginTag("f32");
+  deserializer.Read(f32Result, kSerializationTestFloatCount);
+  deserializer.EndTag();
+  deserializer.BeginTag("d64");
+  deserializer.Read(d64Result, kSerializationTestFloatCount);
+  deserializer.EndTag();
+  deserializer.BeginTag("block");
+  deserializer.ReadBlock(blockResult, sizeof(kSerializationTestBlock));
+  deserializer.EndTag();
+
+  for (U32 i = 0; i < 4; ++i)
+  {
+    if (u16Result[i] != u16List[i] || u32Result[i] != u32List[i] || u64Result[i] != u64List[i]) return false;
+  }
+  for (U32 i = 0; i < kSerializationTestFloatCount; ++i)
+  {
+    if (f32Result[i] != f32List[i] || d64Result[i] != d64List[i]) return false;
+  }
+  for (U32 i = 0; i < sizeof(kSerializationTestBlock); ++i)
+  {
+    if (blockResult[i] != block[i]) return false;
+  }
+  return true;
+}
+
+static F32 SerializationTestGetMegabytesPerSecond(size_t size, const E::Time::Timer& t)
+{
+  D64 seconds = Math::Max(t.GetElapsed().GetMilliseconds(), 1e-3) / 1000.0;
+  return static_cast<F32>(size / (1024.0 * 1024.0) / seconds);
+}
+
+static F32 SerializationTestGetMegavaluesPerSecond(size_t count, const E::Time::Timer& t)
+{
+  D64 seconds = Math::Max(t.GetElapsed().GetMilliseconds(), 1e-3) / 1000.0;
+  return static_cast<F32>(count / 1e6 / seconds);
+}
+
+// Formats and parses back a number checking the parsed length and the bit pattern (so -0 and nan are covered)
+template <typename T>
+static bool SerializationTestIsNumberRoundTrip(T v, const char* pExpected = nullptr)
+{
+  char buffer[Text::kMaxNumberLength];
+  const size_t length = Text::FormatNumber(buffer, v);
+  if (pExpected && (length != Text::GetLength(pExpected) || memcmp(buffer, pExpected, length) != 0)) return false;
+
+  T result;
+  if (Text::ParseNumber(result, buffer, length) != length) return false;
+  return memcmp(&result, &v, sizeof(T)) == 0 || (v != v && result != result);
+}
+
+// Stands for the previous StringSerializer number serialization (a string stream per value)
+template <typename T>
+static void SerializationTestStreamWrite(E::StringBuffer& buffer, T v, int precision)
+{
+  std::ostringstream oss;
+  oss << std::fixed << std::setprecision(precision) << v << ' ';
+  buffer << oss.str().c_str();
+}
+
+template <typename T>
+static void SerializationTestStreamRead(const E::StringBuffer& buffer, size_t& position, T& v)
+{
+  std::istringstream iss(std::string(buffer.GetPtr() + position, buffer.GetLength() - position));
+  iss >> v;
+  position += static_cast<size_t>(iss.tellg()) + 1;
+}
+
+template <typename T>
+static void SerializationTestTextBenchmark(const char* pName, const E::Containers::List<T>& valueList, int precision)
+{
+  const size_t count = valueList.GetCount();
+  E::Containers::List<T> resultList(count);
+  resultList.SetCount(count);
+  E::Time::Timer t;
+
+  E::StringBuffer buffer;
+  for (size_t i = 0; i < count; ++i) SerializationTestStreamWrite(buffer, valueList[i], precision);
+  const F32 streamWriteRate = SerializationTestGetMegavaluesPerSecond(count, t);
+  t.Reset();
+  size_t position = 0;
+  for (size_t i = 0; i < count; ++i) SerializationTestStreamRead(buffer, position, resultList[i]);
+  const F32 streamReadRate = SerializationTestGetMegavaluesPerSecond(count, t);
+
+  StringSerializer ss;
+  t.Reset();
+  for (size_t i = 0; i < count; ++i) ss << valueList[i];
+  const F32 writeRate = SerializationTestGetMegavaluesPerSecond(count, t);
+  t.Reset();
+  for (size_t i = 0; i < count; ++i) ss >> resultList[i];
+  const F32 readRate = SerializationTestGetMegavaluesPerSecond(count, t);
+  for (size_t i = 0; i < count; ++i) E_ASSERT(resultList[i] == valueList[i]);
+
+  std::cout << "StringSerializer " << pName << " operator<<: " << writeRate << " Mvalues/s (string stream " << streamWriteRate << " Mvalues/s)" << std::endl;
+  std::cout << "StringSerializer " << pName << " operator>>: " << readRate << " Mvalues/s (string stream " << streamReadRate << " Mvalues/s)" << std::endl;
+}
+
+// Stands for the process memory usage (the working set) in MB. The process peak working set is not used as earlier
+// tests set it beyond the XML streaming test usage, so the test samples the working set instead.
+static F32 SerializationTestGetMegabytes()
+{
+  PROCESS_MEMORY_COUNTERS memoryCounters;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &memoryCounters, sizeof(memoryCounters))) return 0.0f;
+  return static_cast<F32>(memoryCounters.WorkingSetSize / (1024.0 * 1024.0));
+}
+
+static bool SerializationTestIsSameFile(const FilePath& filePath, const FilePath& otherFilePath)
+{
+  FileSystem::Archive archive, otherArchive;
+  if (!archive.Open(filePath) || !otherArchive.Open(otherFilePath)) return false;
+
+  char buffer[4096], otherBuffer[4096];
+  for (;;)
+  {
+    const size_t length = archive.Read(buffer, sizeof(buffer));
+    if (otherArchive.Read(otherBuffer, sizeof(otherBuffer)) != length || memcmp(buffer, otherBuffer, length) != 0) return false;
+    if (length < sizeof(buffer)) return true;
+  }
+}
+
+// Serializes the XML streaming test document: groups of records holding an identifier, a name and an F32 array
+static void SerializationTestWriteRecords(XmlSerializer& serializer, const F32* pValues, F32& peakMegabytes)
+{
+  E::StringBuffer name;
+  serializer.BeginTag("records");
+  for (U32 i = 0; i < TEST_SERIALIZATION_XML_RECORD_COUNT; ++i)
+  {
+    if (i % TEST_SERIALIZATION_XML_GROUP_SIZE == 0)
+    {
+      peakMegabytes = Math::Max(peakMegabytes, SerializationTestGetMegabytes());
+      if (i) serializer.EndTag();
+      name.Clear();
+      name << "group" << i / TEST_SERIALIZATION_XML_GROUP_SIZE;
+      serializer.BeginTag(name);
+    }
+    name.Clear();
+    name << "record" << i % TEST_SERIALIZATION_XML_GROUP_SIZE;
+    serializer.BeginTag(name);
+    serializer.BeginTag("id");
+    serializer << static_cast<I64>(i) * 84089;
+    serializer.EndTag();
+    serializer.BeginTag("name");
+    serializer << name;
+    serializer.EndTag();
+    serializer.BeginTag("values");
+    serializer.Write(pValues + i % TEST_SERIALIZATION_XML_VALUE_COUNT, TEST_SERIALIZATION_XML_VALUE_COUNT);
+    serializer.EndTag();
+    serializer.EndTag();
+  }
+  serializer.EndTag();
+  serializer.EndTag();
+}
+
+static bool SerializationTestReadRecords(XmlSerializer& deserializer, const F32* pValues, F32& peakMegabytes)
+{
+  E::StringBuffer name, recordName;
+  E::Containers::List<F32> valueList(TEST_SERIALIZATION_XML_VALUE_COUNT);
+  valueList.SetCount(TEST_SERIALIZATION_XML_VALUE_COUNT);
+  bool isValid = true;
+
+  deserializer.BeginTag("records");
+  for (U32 i = 0; i < TEST_SERIALIZATION_XML_RECORD_COUNT; ++i)
+  {
+    if (i % TEST_SERIALIZATION_XML_GROUP_SIZE == 0)
+    {
+      peakMegabytes = Math::Max(peakMegabytes, SerializationTestGetMegabytes());
+      if (i) deserializer.EndTag();
+      name.Clear();
+      name << "group" << i / TEST_SERIALIZATION_XML_GROUP_SIZE;
+      deserializer.BeginTag(name);
+    }
+    name.Clear();
+    name << "record" << i % TEST_SERIALIZATION_XML_GROUP_SIZE;
+    I64 id = 0;
+    deserializer.BeginTag(name);
+    deserializer.BeginTag("id");
+    deserializer >> id;
+    deserializer.EndTag();
+    deserializer.BeginTag("name");
+    deserializer >> recordName;
+    deserializer.EndTag();
+    deserializer.BeginTag("values");
+    deserializer.Read(valueList.GetPtr(), TEST_SERIALIZATION_XML_VALUE_COUNT);
+    deserializer.EndTag();
+    deserializer.EndTag();
+
+    isValid &= (id == static_cast<I64>(i) * 84089 && recordName == name);
+    isValid &= (memcmp(valueList.GetPtr(), pValues + i % TEST_SERIALIZATION_XML_VALUE_COUNT, TEST_SERIALIZATION_XML_VALUE_COUNT * sizeof(F32)) == 0);
+  }
+  deserializer.EndTag();
+  deserializer.EndTag();
+  return isValid;
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 TestList methods
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -316,6 +600,225 @@ bool Test::Serialization::RunFunctionalityTest()
   sz.Save("../../../Bin/xmlFile.xml");
   std::cout << std::endl;
 
+  /*----------------------------------------------------------------------------------------------------------------------
+  Array & block serialization
+  ----------------------------------------------------------------------------------------------------------------------*/
+
+  ByteSerializer arrayAr;
+  SerializationTestWriteArrays(arrayAr);
+  E_ASSERT(SerializationTestReadArrays(arrayAr));
+  E_ASSERT(arrayAr.GetLength() == 4 * (2 + 4 + 8) + kSerializationTestFloatCount * (4 + 8) + 6);
+
+  // Arrays share the big endian encoding of the scalar operators
+  arrayAr.SetBegin();
+  U16 u16Value = 0;
+  for (U32 i = 0; i < 4; ++i) arrayAr >> u16Value;
+  E_ASSERT(u16Value == 0xffff);
+  const Byte* pBytes = arrayAr.GetPtr() + 4 * 2;
+  E_ASSERT(pBytes[8] == 0x12 && pBytes[9] == 0x34 && pBytes[10] == 0x56 && pBytes[11] == 0x78);
+
+  StringSerializer arraySs;
+  SerializationTestWriteArrays(arraySs);
+  E_ASSERT(SerializationTestReadArrays(arraySs));
+  std::cout << "[" << arraySs.GetPtr() << "]" << std::endl;
+
+  XmlSerializer arraySz;
+  SerializationTestWriteArrays(arraySz);
+  E_ASSERT(SerializationTestReadArrays(arraySz));
+  std::cout << std::endl;
+
+  /*----------------------------------------------------------------------------------------------------------------------
+  XmlSerializer streaming
+  ----------------------------------------------------------------------------------------------------------------------*/
+
+  const FilePath xmlDocumentFilePath("../../../Bin/xmlDocumentFile.xml");
+  const FilePath xmlStreamFilePath("../../../Bin/xmlStreamFile.xml");
+  const char* pEscapedString = "<Escaped & \"quoted\"\nmultiline text>";
+
+  // The same data serialized to a document & streamed (both outputs must match)
+  XmlSerializer documentSz;
+  documentSz.BeginTag("stream");
+  E_SERIALIZE(documentSz, b, b);
+  E_SERIALIZE(documentSz, b2, b2);
+  documentSz.BeginTag("numbers");
+  documentSz.BeginTag("i64");
+  documentSz << Math::NumericLimits<I64>::Min();
+  documentSz.EndTag();
+  documentSz.BeginTag("u64");
+  documentSz << Math::NumericLimits<U64>::Max();
+  documentSz.EndTag();
+  documentSz.BeginTag("d64");
+  documentSz << 0.1 + 0.2;
+  documentSz.EndTag();
+  documentSz.BeginTag("string");
+  documentSz << pEscapedString;
+  documentSz.EndTag();
+  documentSz.EndTag();
+  SerializationTestWriteArrays(documentSz);
+  documentSz.EndTag();
+  documentSz.Save(xmlDocumentFilePath.GetPtr());
+
+  FileSystem::Archive xmlArchive;
+  XmlSerializer streamSz;
+  E_ASSERT(xmlArchive.Open(xmlStreamFilePath, FileSystem::Archive::eOpenModeWrite));
+  streamSz.BeginStream(xmlArchive, XmlSerializer::eStreamModeWrite);
+  streamSz.BeginTag("stream");
+  E_SERIALIZE(streamSz, b, b);
+  E_SERIALIZE(streamSz, b2, b2);
+  streamSz.BeginTag("numbers");
+  streamSz.BeginTag("i64");
+  streamSz << Math::NumericLimits<I64>::Min();
+  streamSz.EndTag();
+  streamSz.BeginTag("u64");
+  streamSz << Math::NumericLimits<U64>::Max();
+  streamSz.EndTag();
+  streamSz.BeginTag("d64");
+  streamSz << 0.1 + 0.2;
+  streamSz.EndTag();
+  streamSz.BeginTag("string");
+  streamSz << pEscapedString;
+  streamSz.EndTag();
+  streamSz.EndTag();
+  SerializationTestWriteArrays(streamSz);
+  // EndStream closes the stream tag
+  streamSz.EndStream();
+  xmlArchive.Close();
+  E_ASSERT(SerializationTestIsSameFile(xmlDocumentFilePath, xmlStreamFilePath));
+
+  // Pull reading of the streamed document (skipping b and reading a missing tag)
+  XmlNodeB streamB2;
+  I64 i64Stream = 0;
+  U64 u64Stream = 0;
+  D64 d64Stream = 0.0;
+  E::StringBuffer stringStream;
+  I32 missingValue = 1;
+  E_ASSERT(xmlArchive.Open(xmlStreamFilePath));
+  streamSz.BeginStream(xmlArchive, XmlSerializer::eStreamModeRead);
+  streamSz.BeginTag("stream");
+  E_DESERIALIZE(streamSz, streamB2, b2);
+  streamSz.BeginTag("numbers");
+  E_DESERIALIZE(streamSz, i64Stream, i64);
+  E_DESERIALIZE(streamSz, u64Stream, u64);
+  E_DESERIALIZE(streamSz, d64Stream, d64);
+  E_DESERIALIZE(streamSz, stringStream, string);
+  E_DESERIALIZE(streamSz, missingValue, missing);
+  streamSz.EndTag();
+  E_ASSERT(SerializationTestReadArrays(streamSz));
+  streamSz.EndTag();
+  streamSz.EndStream();
+  xmlArchive.Close();
+  E_ASSERT(streamB2.c == b2.c && streamB2.a.f == b2.a.f && streamB2.a.i == b2.a.i && streamB2.a.s == b2.a.s);
+  E_ASSERT(streamB2.s == b2.s && streamB2.b == b2.b);
+  E_ASSERT(i64Stream == Math::NumericLimits<I64>::Min() && u64Stream == Math::NumericLimits<U64>::Max());
+  E_ASSERT(d64Stream == 0.1 + 0.2 && stringStream == pEscapedString && missingValue == 0);
+
+  // Loading the streamed document
+  XmlNodeB loadB;
+  E_ASSERT(documentSz.Load(xmlStreamFilePath.GetPtr()));
+  documentSz.BeginTag("stream");
+  E_DESERIALIZE(documentSz, loadB, b);
+  documentSz.BeginTag("numbers");
+  E_DESERIALIZE(documentSz, stringStream, string);
+  documentSz.EndTag();
+  E_ASSERT(SerializationTestReadArrays(documentSz));
+  documentSz.EndTag();
+  E_ASSERT(loadB.c == b.c && loadB.a.f == b.a.f && loadB.a.i == b.a.i && loadB.s == b.s && loadB.b == b.b);
+  E_ASSERT(stringStream == pEscapedString);
+
+  /*----------------------------------------------------------------------------------------------------------------------
+  Number formatting & parsing
+  ----------------------------------------------------------------------------------------------------------------------*/
+
+  // Integers (limits & digit pair boundaries)
+  E_ASSERT(SerializationTestIsNumberRoundTrip(static_cast<I64>(0), "0"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(static_cast<I64>(-7), "-7"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(static_cast<I64>(100), "100"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(static_cast<U64>(4294967296ULL), "4294967296"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(Math::NumericLimits<I64>::Min(), "-9223372036854775808"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(Math::NumericLimits<I64>::Max(), "9223372036854775807"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(Math::NumericLimits<U64>::Max(), "18446744073709551615"));
+
+  // Floating point values (shortest representation & notation ranges)
+  E_ASSERT(SerializationTestIsNumberRoundTrip(0.0, "0"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(-0.0, "-0"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(0.1, "0.1"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(0.1f, "0.1"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(1102.343f, "1102.343"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(0.1 + 0.2, "0.30000000000000004"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(1.5e-7, "1.5e-7"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(0.000001, "0.000001"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(1e20, "100000000000000000000"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(1e21, "1e21"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(Math::NumericLimits<D64>::Max(), "1.7976931348623157e308"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(Math::NumericLimits<F32>::Max(), "3.4028235e38"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(4.9406564584124654e-324, "5e-324"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(std::numeric_limits<D64>::infinity(), "inf"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(-std::numeric_limits<F32>::infinity(), "-inf"));
+  E_ASSERT(SerializationTestIsNumberRoundTrip(std::numeric_limits<D64>::quiet_NaN(), "nan"));
+
+  // Random bit patterns (all exponents) & random values in a typical range
+  for (U32 i = 0; i < TEST_SERIALIZATION_NUMBER_COUNT; ++i)
+  {
+    const U64 bits = (static_cast<U64>(Math::Global::GetRandom().GetU32(Math::NumericLimits<U32>::Max())) << 32) | Math::Global::GetRandom().GetU32(Math::NumericLimits<U32>::Max());
+    D64 d;
+    F32 f;
+    const U32 bits32 = static_cast<U32>(bits);
+    memcpy(&d, &bits, sizeof(d));
+    memcpy(&f, &bits32, sizeof(f));
+    E_ASSERT(SerializationTestIsNumberRoundTrip(d));
+    E_ASSERT(SerializationTestIsNumberRoundTrip(f));
+    E_ASSERT(SerializationTestIsNumberRoundTrip(static_cast<I64>(bits)));
+    E_ASSERT(SerializationTestIsNumberRoundTrip(Math::Global::GetRandom().GetF32(-1000.0f, 1000.0f)));
+  }
+
+  // Parsing (partial tokens, other notations & invalid numbers)
+  D64 d64Value = 0.0;
+  I64 i64Number = 0;
+  U64 u64Number = 0;
+  E_ASSERT(Text::ParseNumber(d64Value, "-.5e+3 ", 7) == 6 && d64Value == -500.0);
+  E_ASSERT(Text::ParseNumber(d64Value, "2e", 2) == 1 && d64Value == 2.0);
+  E_ASSERT(Text::ParseNumber(d64Value, "123456789012345678901234567890", 30) == 30 && d64Value == 1.2345678901234568e29);
+  E_ASSERT(Text::ParseNumber(d64Value, "1e400", 5) == 5 && d64Value == std::numeric_limits<D64>::infinity());
+  E_ASSERT(Text::ParseNumber(d64Value, "1.5", 1) == 1 && d64Value == 1.0);
+  E_ASSERT(Text::ParseNumber(d64Value, " 1", 2) == 0);
+  E_ASSERT(Text::ParseNumber(d64Value, "e5", 2) == 0);
+  E_ASSERT(Text::ParseNumber(i64Number, "-9223372036854775809", 20) == 0);
+  E_ASSERT(Text::ParseNumber(u64Number, "18446744073709551616", 20) == 0);
+  E_ASSERT(Text::ParseNumber(u64Number, "-1", 2) == 0);
+
+  /*----------------------------------------------------------------------------------------------------------------------
+  ByteReader
+  ----------------------------------------------------------------------------------------------------------------------*/
+
+  // Arrays & blocks decoded in place from a ByteSerializer buffer
+  ByteReader reader(arrayAr.GetPtr(), arrayAr.GetLength());
+  E_ASSERT(SerializationTestReadArrays(reader));
+  E_ASSERT(reader.IsEnd());
+
+  // Zero copy block access
+  reader.SetBegin();
+  reader.Ignore(4 * (2 + 4 + 8) + kSerializationTestFloatCount * (4 + 8));
+  const Byte* pBlock = reader.ReadBlock(6);
+  E_ASSERT(pBlock == arrayAr.GetPtr() + 4 * (2 + 4 + 8) + kSerializationTestFloatCount * (4 + 8) && pBlock[3] == 0xff);
+
+  // ISerializer deserialization through custom class operators
+  ByteSerializer nodeAr;
+  XmlNodeA nodeA, nodeA2;
+  nodeA.i = -2202;
+  nodeA.f = 1102.343f;
+  nodeA.s = "A static string";
+  nodeAr << nodeA << "A wonderful string!" << true << static_cast<I64>(-84089);
+
+  ByteReader nodeReader(nodeAr.GetPtr(), nodeAr.GetLength());
+  I64 i64Value = 0;
+  nodeReader >> nodeA2;
+  nodeReader >> s;
+  nodeReader >> flag;
+  nodeReader >> i64Value;
+  E_ASSERT(nodeA2.i == nodeA.i && nodeA2.f == nodeA.f && nodeA2.s == nodeA.s);
+  E_ASSERT(s == "A wonderful string!" && flag && i64Value == -84089);
+  E_ASSERT(nodeReader.IsEnd() && nodeReader.GetRemainingLength() == 0);
+
   return true;
 }
 
@@ -323,5 +826,163 @@ bool Test::Serialization::RunPerformanceTest()
 {
   std::cout << "[Test::Serialization::RunPerformanceTest]" << std::endl;
 
+  E::Containers::List<F32> fList(TEST_SERIALIZATION_VALUE_COUNT);
+  fList.SetCount(TEST_SERIALIZATION_VALUE_COUNT);
+  for (size_t i = 0; i < TEST_SERIALIZATION_VALUE_COUNT; ++i) fList[i] = Math::Global::GetRandom().GetF32();
+  E::Containers::List<F32> resultList(TEST_SERIALIZATION_VALUE_COUNT);
+  resultList.SetCount(TEST_SERIALIZATION_VALUE_COUNT);
+  const size_t size = TEST_SERIALIZATION_VALUE_COUNT * sizeof(F32);
+
+  std::cout << std::endl;
+  E::Time::Timer t;
+
+  // ByteSerializer value by value
+  ByteSerializer ar;
+  for (size_t i = 0; i < TEST_SERIALIZATION_VALUE_COUNT; ++i) ar << fList[i];
+  std::cout << "ByteSerializer F32 operator<<: " << SerializationTestGetMegabytesPerSecond(size, t) << " MB/s" << std::endl;
+  t.Reset();
+  for (size_t i = 0; i < TEST_SERIALIZATION_VALUE_COUNT; ++i) ar >> resultList[i];
+  std::cout << "ByteSerializer F32 operator>>: " << SerializationTestGetMegabytesPerSecond(size, t) << " MB/s" << std::endl;
+  for (size_t i = 0; i < TEST_SERIALIZATION_VALUE_COUNT; ++i) E_ASSERT(resultList[i] == fList[i]);
+
+  // ByteSerializer arrays
+  ar.Clear();
+  t.Reset();
+  ar.Write(fList.GetPtr(), TEST_SERIALIZATION_VALUE_COUNT);
+  std::cout << "ByteSerializer F32 Write: " << SerializationTestGetMegabytesPerSecond(size, t) << " MB/s" << std::endl;
+  t.Reset();
+  ar.Read(resultList.GetPtr(), TEST_SERIALIZATION_VALUE_COUNT);
+  std::cout << "ByteSerializer F32 Read: " << SerializationTestGetMegabytesPerSecond(size, t) << " MB/s" << std::endl;
+  for (size_t i = 0; i < TEST_SERIALIZATION_VALUE_COUNT; ++i) E_ASSERT(resultList[i] == fList[i]);
+
+  // ByteSerializer raw blocks
+  ar.Clear();
+  t.Reset();
+  ar.WriteBlock(fList.GetPtr(), size);
+  std::cout << "ByteSerializer WriteBlock: " << SerializationTestGetMegabytesPerSecond(size, t) << " MB/s" << std::endl;
+  t.Reset();
+  ar.ReadBlock(resultList.GetPtr(), size);
+  std::cout << "ByteSerializer ReadBlock: " << SerializationTestGetMegabytesPerSecond(size, t) << " MB/s" << std::endl;
+  for (size_t i = 0; i < TEST_SERIALIZATION_VALUE_COUNT; ++i) E_ASSERT(resultList[i] == fList[i]);
+
+  // StringSerializer arrays (a sixteenth of the values as text formatting is much slower)
+  StringSerializer ss;
+  t.Reset();
+  ss.Write(fList.GetPtr(), TEST_SERIALIZATION_VALUE_COUNT / 16);
+  std::cout << "StringSerializer F32 Write: " << SerializationTestGetMegabytesPerSecond(size / 16, t) << " MB/s" << std::endl;
+  t.Reset();
+  ss.Read(resultList.GetPtr(), TEST_SERIALIZATION_VALUE_COUNT / 16);
+  std::cout << "StringSerializer F32 Read: " << SerializationTestGetMegabytesPerSecond(size / 16, t) << " MB/s" << std::endl;
+  for (size_t i = 0; i < TEST_SERIALIZATION_VALUE_COUNT / 16; ++i) E_ASSERT(resultList[i] == fList[i]);
+
+  // StringSerializer value by value vs the previous string stream implementation
+  E::Containers::List<I64> i64TextList(TEST_SERIALIZATION_TEXT_VALUE_COUNT);
+  E::Containers::List<F32> f32TextList(TEST_SERIALIZATION_TEXT_VALUE_COUNT);
+  E::Containers::List<D64> d64TextList(TEST_SERIALIZATION_TEXT_VALUE_COUNT);
+  for (size_t i = 0; i < TEST_SERIALIZATION_TEXT_VALUE_COUNT; ++i)
+  {
+    i64TextList.PushBack(static_cast<I64>(Math::Global::GetRandom().GetI32(Math::NumericLimits<I32>::Min(), Math::NumericLimits<I32>::Max())) * 84089);
+    // Values with at most 5 decimals so the previous fixed precision formatting reads them back exactly
+    f32TextList.PushBack(static_cast<F32>(Math::Global::GetRandom().GetI32(-1 << 20, 1 << 20)) / 32.0f);
+    d64TextList.PushBack(static_cast<D64>(Math::Global::GetRandom().GetI32(Math::NumericLimits<I32>::Min(), Math::NumericLimits<I32>::Max())) / 128.0);
+  }
+  std::cout << std::endl;
+  SerializationTestTextBenchmark("I64", i64TextList, 0);
+  SerializationTestTextBenchmark("F32", f32TextList, 5);
+  SerializationTestTextBenchmark("D64", d64TextList, 7);
+  std::cout << std::endl;
+
+  // Blob deserialization: a mapped file copied into a ByteSerializer and read back vs decoded in place by a ByteReader
+  const FilePath blobFilePath("../../../Bin/serializationBlobFile.bin");
+  const size_t blobValueCount = (TEST_SERIALIZATION_BLOB_SIZE - sizeof(U64)) / sizeof(F32);
+  E::Containers::List<F32> blobList(blobValueCount);
+  blobList.SetCount(blobValueCount);
+  for (size_t i = 0; i < blobValueCount; ++i) blobList[i] = static_cast<F32>(i);
+  {
+    ByteSerializer blobAr;
+    blobAr << static_cast<U64>(blobValueCount);
+    blobAr.Write(blobList.GetPtr(), blobValueCount);
+    FileSystem::MappedFile blobFile;
+    E_ASSERT(blobFile.Open(blobFilePath, FileSystem::MappedFile::eOpenModeReadWrite, blobAr.GetLength()));
+    Memory::Copy(blobFile.GetPtr(), blobAr.GetPtr(), blobAr.GetLength());
+  }
+
+  FileSystem::MappedFile blob;
+  E_ASSERT(blob.Open(blobFilePath));
+  blob.SetAccessHint(FileSystem::MappedFile::eAccessHintSequential);
+  U64 blobCount = 0;
+  t.Reset();
+  ByteSerializer copyAr;
+  copyAr.WriteBlock(blob.GetPtr(), blob.GetSize());
+  copyAr >> blobCount;
+  copyAr.Read(blobList.GetPtr(), static_cast<size_t>(blobCount));
+  std::cout << "ByteSerializer blob copy & Read: " << SerializationTestGetMegabytesPerSecond(blob.GetSize(), t) << " MB/s" << std::endl;
+  copyAr.Clear();
+
+  t.Reset();
+  ByteReader blobReader(blob.GetPtr(), blob.GetSize());
+  blobReader >> blobCount;
+  blobReader.Read(blobList.GetPtr(), static_cast<size_t>(blobCount));
+  std::cout << "ByteReader blob Read: " << SerializationTestGetMegabytesPerSecond(blob.GetSize(), t) << " MB/s" << std::endl;
+  for (size_t i = 0; i < blobValueCount; ++i) E_ASSERT(blobList[i] == static_cast<F32>(i));
+
+  t.Reset();
+  blobReader.SetBegin();
+  blobReader >> blobCount;
+  const Byte* pBlob = blobReader.ReadBlock(static_cast<size_t>(blobCount) * sizeof(F32));
+  std::cout << "ByteReader blob ReadBlock (zero copy): " << t.GetElapsed().GetMilliseconds() << " ms" << std::endl;
+  E_ASSERT(pBlob == blob.GetPtr() + sizeof(U64) && blobReader.IsEnd());
+  std::cout << std::endl;
+  blob.Close();
+  FileSystem::File::Destroy(blobFilePath);
+  blobList.Clear();
+  blobList.Compact();
+
+  // XmlSerializer streaming vs document (memory usage is sampled once per record group)
+  const FilePath xmlFilePath("../../../Bin/xmlPerformanceFile.xml");
+  FileSystem::File::Info xmlFileInfo;
+  FileSystem::Archive xmlArchive;
+  const F32 baseMegabytes = SerializationTestGetMegabytes();
+  F32 streamPeakMegabytes = baseMegabytes;
+  F32 documentPeakMegabytes = baseMegabytes;
+
+  XmlSerializer xmlSz;
+  t.Reset();
+  xmlArchive.Open(xmlFilePath, FileSystem::Archive::eOpenModeWrite);
+  xmlSz.BeginStream(xmlArchive, XmlSerializer::eStreamModeWrite);
+  SerializationTestWriteRecords(xmlSz, fList.GetPtr(), streamPeakMegabytes);
+  xmlSz.EndStream();
+  xmlArchive.Close();
+  const D64 streamWriteTime = t.GetElapsed().GetMilliseconds();
+  E_ASSERT(FileSystem::File::GetInfo(xmlFilePath, xmlFileInfo));
+  const size_t xmlSize = xmlFileInfo.byteSize;
+  std::cout << "XmlSerializer document size: " << xmlSize / (1024 * 1024) << " MB" << std::endl;
+  std::cout << "XmlSerializer stream write: " << SerializationTestGetMegabytesPerSecond(xmlSize, t) << " MB/s (" << streamWriteTime << " ms)" << std::endl;
+
+  t.Reset();
+  xmlArchive.Open(xmlFilePath);
+  xmlSz.BeginStream(xmlArchive, XmlSerializer::eStreamModeRead);
+  E_ASSERT(SerializationTestReadRecords(xmlSz, fList.GetPtr(), streamPeakMegabytes));
+  xmlSz.EndStream();
+  xmlArchive.Close();
+  std::cout << "XmlSerializer stream read: " << SerializationTestGetMegabytesPerSecond(xmlSize, t) << " MB/s" << std::endl;
+
+  t.Reset();
+  SerializationTestWriteRecords(xmlSz, fList.GetPtr(), documentPeakMegabytes);
+  xmlSz.Save(xmlFilePath.GetPtr());
+  std::cout << "XmlSerializer document write & Save: " << SerializationTestGetMegabytesPerSecond(xmlSize, t) << " MB/s" << std::endl;
+  documentPeakMegabytes = Math::Max(documentPeakMegabytes, SerializationTestGetMegabytes());
+  xmlSz.Clear();
+
+  t.Reset();
+  E_ASSERT(xmlSz.Load(xmlFilePath.GetPtr()));
+  E_ASSERT(SerializationTestReadRecords(xmlSz, fList.GetPtr(), documentPeakMegabytes));
+  std::cout << "XmlSerializer document Load & read: " << SerializationTestGetMegabytesPerSecond(xmlSize, t) << " MB/s" << std::endl;
+  xmlSz.Clear();
+
+  std::cout << "XmlSerializer stream peak memory: +" << streamPeakMegabytes - baseMegabytes << " MB" << std::endl;
+  std::cout << "XmlSerializer document peak memory: +" << documentPeakMegabytes - baseMegabytes << " MB" << std::endl;
+  std::cout << std::endl;
+
   return true;
 }
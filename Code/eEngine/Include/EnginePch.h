@@ -40,10 +40,18 @@ This file defines includes all the headers required by the Engine library for pr
 #include <Application/InputManager.h>
 #include <Assertion/Assert.h>
 #include <Containers/Queue.h>
+#include <Containers/SlotMap.h>
+#include <Containers/SmallList.h>
+#include <FileSystem/DerivedDataCache.h>
 #include <FileSystem/File.h>
+#include <FileSystem/MappedFile.h>
+#include <FileSystem/VirtualFileSystem.h>
 #include <Math/Algorithm.h>
+#include <Math/Batch.h>
 #include <Math/Comparison.h>
+#include <Math/LooseOctree.h>
 #include <Math/Matrix4.h>
+#include <Math/MeshOptimizer.h>
 #include <Math/Projection.h>
 #include <Math/Quaternion.h>
 #include <Math/Vector3.h>
@@ -73,6 +81,7 @@ This file defines includes all the headers required by the Engine library for pr
 #include <Graphics/Scene/IShadowComponent.h>
 #include <Graphics/Scene/IMesh.h>
 #include <Graphics/Scene/MeshBuffer.h>
+#include <Graphics/Scene/MeshFile.h>
 #include <Graphics/Scene/Scene.h>
 #include <Graphics/Scene/CameraHandler.h>
 
@@ -30,7 +30,9 @@ DEALINGS IN THE SOFTWARE.
 /** @file Frustum.h
 This file contains the declaration of the Frustum class. Frustum class represents the camera viewable space defined by
 6 planes. This space is called frustum and its used to discard non viewable geometry each frame, lowering the GPU 
-geometry load.
+geometry load. CullBoxes and CullSpheres test structure of arrays bounds in groups of 8 (see Math::Batch) and write a
+visibility bitmask, optionally reusing a per group plane cache between frames. GetScreenSize returns the projected
+height of a bounding sphere as a fraction of the viewport height, which drives the mesh level of detail selection.
 */
 
 #ifndef E3_FRUSTUM_H
@@ -75,16 +77,25 @@ public:
 
   // Accessors
   const Spheref&  GetBoundingSphere() const;
+  const Vector3f& GetEyePosition() const;
   const Matrix4f& GetInverseProjectionMatrix() const;
+  const Planef*   GetPlanes() const;
+  F32             GetScreenSize(const Vector3f& center, F32 radius) const;
   const Matrix4f& GetViewProjectionMatrix() const;
   bool		        IsInside(const Vector3f& point, F32 radius = 0.0f) const;
 
   // Methods
+  void            CullBoxes(U32* pResult, const F32* pCenterX, const F32* pCenterY, const F32* pCenterZ, const F32* pExtentX,
+                    const F32* pExtentY, const F32* pExtentZ, size_t count, U8* pPlaneCache = nullptr) const;
+  void            CullSpheres(U32* pResult, const F32* pX, const F32* pY, const F32* pZ, const F32* pRadius, size_t count,
+                    U8* pPlaneCache = nullptr) const;
   void		        Update(const Matrix4f& viewMatrix, const Matrix4f& projectionMatrix);
 
 private:
   Matrix4f	      mViewProjectionMatrix;
   Matrix4f	      mInverseProjectionMatrix;
+  Matrix4f	      mProjectionMatrix;
+  Vector3f        mEyePosition;
   Planef		      mPlanes[ePlaneCount];
   Vector3f        mPoints[ePointCount];
   Spheref         mBoundingSphere;
@@ -31,6 +31,7 @@ This file defines the IMesh interface.
 #ifndef E3_IMESH_H
 #define E3_IMESH_H
 
+#include <Graphics/Frustum.h>
 #include <Graphics/Scene/IMaterial.h>
 #include <Graphics/Scene/IObject.h>
 
@@ -42,6 +43,15 @@ namespace Scene
 {
 /*----------------------------------------------------------------------------------------------------------------------
 IMesh
+
+Please note that this class has the following usage contract:
+
+1. GenerateLods must be called after creating the mesh and before loading it. Level of detail 0 is the full mesh and
+SelectLod picks the coarsest level whose error projected on the frustum viewport stays below 1/1024 of the viewport
+height (about a pixel). Disabled level of detail selection always renders level 0.
+2. CreateFromFile maps mesh files (see MeshFile) and uploads their packed vertex and index data as is, so they ignore
+SetVertexType and GenerateLods (levels of detail are generated by MeshFile::Convert). Any other model file is imported
+and optimized, unless the derived data cache already holds the result for its content (see MeshFile::Import).
 ----------------------------------------------------------------------------------------------------------------------*/
 class IMesh : public IObject
 {
@@ -57,7 +67,12 @@ public:
 
   // Accessors
   virtual U32                       GetID() const = 0;
+  virtual U32                       GetLod() const = 0;
+  virtual U32                       GetLodCount() const = 0;
   virtual const IMaterialInstance&  GetMaterial() const = 0;
+  virtual U32                       GetTriangleCount() const = 0;
+  virtual bool                      IsLodEnabled() const = 0;
+  virtual void                      SetLodEnabled(bool enabled) = 0;
   virtual void                      SetMaterial(IMaterialInstance material) = 0;
   virtual void                      SetShader(const String& shaderTechniqueName) = 0;
   virtual void                      SetVertexType(VertexType vertexType) = 0;
@@ -70,6 +85,8 @@ public:
   virtual void                      CreateQuad(F32 width, F32 height) = 0;
   virtual void                      CreateSphere(F32 radius, U32 sliceCount, U32 stackCount) = 0;
   virtual void                      CreateTriangle(F32 length) = 0;
+  virtual U32                       GenerateLods(U32 lodCount) = 0;
+  virtual void                      SelectLod(const Frustum& frustum) = 0;
 };
 
 /*----------------------------------------------------------------------------------------------------------------------
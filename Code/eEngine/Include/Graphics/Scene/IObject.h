@@ -53,7 +53,6 @@ typedef Memory::GCRef<IObject>           IObjectInstance;
 typedef Memory::GCRef<IObjectComponent>  IObjectComponentInstance;
 typedef Memory::GCRef<IObjectGroup>      IObjectGroupInstance;
 typedef Containers::List<IObjectInstance>            IObjectInstanceList;
-typedef Containers::List<IObjectComponentInstance>   IObjectComponentInstanceList;
 
 /*----------------------------------------------------------------------------------------------------------------------
 IObjectComponent
@@ -93,6 +92,14 @@ public:
   virtual void                        OnUpdate(const TimeValue& deltaTime) = 0;
 };
 
+/*----------------------------------------------------------------------------------------------------------------------
+IObject list types
+
+Objects hold a few children and at most one component per type, hence both lists keep their elements inline.
+----------------------------------------------------------------------------------------------------------------------*/
+typedef Containers::SmallList<IObjectInstance, 4>                                               IObjectChildrenList;
+typedef Containers::SmallList<IObjectComponentInstance, IObjectComponent::eComponentTypeCount>  IObjectComponentInstanceList;
+
 /*----------------------------------------------------------------------------------------------------------------------
 IRenderable
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -106,6 +113,16 @@ public:
 
 /*----------------------------------------------------------------------------------------------------------------------
 ITransformable
+
+Please note that this class has the following usage contract: 
+
+1. Orientation can be set either as Euler angles in degrees (SetOrientation / Rotate(Vector3f)) or natively as a unit
+quaternion (SetRotation / Rotate(Quatf)). The quaternion methods avoid any trigonometric evaluation.
+2. Euler methods rebuild the rotation from the accumulated Euler angles, discarding any previous quaternion rotation.
+GetOrientation only describes the object rotation while Euler methods are used, GetRotation always does.
+3. GetBounds returns the object world axis aligned bounds, refreshed on Update together with the world matrix.
+IsWorldMatrixChanged returns true if the last Update modified the world matrix (hence the bounds) so that spatial
+structures only need to be updated for moving objects.
 ----------------------------------------------------------------------------------------------------------------------*/
 class ITransformable
 {
@@ -113,16 +130,21 @@ public:
   virtual                 ~ITransformable() {}
 
   // Methods
+  virtual const Box3f&    GetBounds() const = 0;
   virtual const Vector3f&	GetOrientation() const = 0;
   virtual const Vector3f&	GetPosition() const = 0;
+  virtual const Quatf&    GetRotation() const = 0;
   virtual const Vector3f& GetScale() const = 0;
   virtual const Matrix4f& GetWorldMatrix() const = 0;
+  virtual bool            IsWorldMatrixChanged() const = 0;
   virtual void			      SetOrientation(const Vector3f& v) = 0;
   virtual void			      SetPosition(const Vector3f& v) = 0;
+  virtual void            SetRotation(const Quatf& q) = 0;
   virtual void			      SetScale(const Vector3f& v) = 0;
 
   virtual void            ClearTransform() = 0;
   virtual void			      Rotate(const Vector3f& v) = 0;
+  virtual void			      Rotate(const Quatf& q) = 0;
   virtual void			      Scale(const Vector3f& v) = 0;
   virtual void			      Translate(const Vector3f& v) = 0;
 };
@@ -157,7 +179,7 @@ public:
   virtual                                           ~IObject() {}
 
   // Accessors
-  virtual const IObjectInstanceList&           GetChildrenList() const = 0;
+  virtual const IObjectChildrenList&           GetChildrenList() const = 0;
   virtual const IObjectComponentInstance&      GetComponent(IObjectComponent::ComponentType type) const = 0;
   virtual const IObjectComponentInstanceList&  GetComponentList() const = 0;
   virtual const IObjectInstance&               GetParent() const = 0;
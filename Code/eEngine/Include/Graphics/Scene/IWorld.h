@@ -30,6 +30,7 @@ This file defines the IWorld interface.
 #ifndef E3_IWORLD_H
 #define E3_IWORLD_H
 
+#include <Graphics/Frustum.h>
 #include <Graphics/Scene/IObject.h>
 
 namespace E 
@@ -40,14 +41,25 @@ namespace Scene
 {
 /*----------------------------------------------------------------------------------------------------------------------
 WorldState
+
+Loaded objects are kept in slot maps: iteration is contiguous while loading / unloading an object is O(1).
 ----------------------------------------------------------------------------------------------------------------------*/
+typedef Containers::SlotMap<IObjectInstance> IObjectInstanceSlotMap;
+
 struct WorldState
 {  
-  IObjectInstanceList objectList[IObject::eObjectTypeCount];
+  IObjectInstanceSlotMap objectList[IObject::eObjectTypeCount];
 };
 
 /*----------------------------------------------------------------------------------------------------------------------
 IWorld
+
+Please note that this class has the following usage contract: 
+
+1. Loaded objects are spatially indexed by their world bounds (see ITransformable::GetBounds). The index is updated on
+Update for the objects whose world matrix changed.
+2. Query appends the loaded objects of the given type whose bounds overlap the given volume to the result list (the 
+result list is not cleared). Frustum queries are conservative: objects near the frustum corners may be reported.
 ----------------------------------------------------------------------------------------------------------------------*/
 class IWorld
 {
@@ -59,6 +71,9 @@ public:
 
   // Methods
   virtual void	            Load(const IObjectInstance& object) = 0;
+  virtual void              Query(IObject::ObjectType type, const Box3f& box, IObjectInstanceList& result) const = 0;
+  virtual void              Query(IObject::ObjectType type, const Spheref& sphere, IObjectInstanceList& result) const = 0;
+  virtual void              Query(IObject::ObjectType type, const Frustum& frustum, IObjectInstanceList& result) const = 0;
   virtual void              Unload() = 0;
   virtual void	            Unload(const IObjectInstance& object) = 0;
   virtual void              Update(const TimeValue& deltaTime) = 0;
@@ -45,15 +45,29 @@ namespace Scene
 {
 /*----------------------------------------------------------------------------------------------------------------------
 MeshBuffer
+
+Please note that this struct has the following usage contract:
+
+1. Level of detail index ranges (see MeshHelper::GenerateLods) are appended to indexList and all of them reference the
+same vertex lists. An empty lodList stands for a single level of detail covering the whole indexList. Lod errors are
+relative to the mesh extent (largest bounding box side).
 ----------------------------------------------------------------------------------------------------------------------*/
 struct MeshBuffer
 {
+  struct Lod
+  {
+    U32 startIndex;
+    U32 indexCount;
+    F32 error;
+  };
+
   Containers::List<Vector3f>  positionList;
   Containers::List<Vector2f>  texCoordList;
   Containers::List<Vector3f>  normalList;
   Containers::List<Vector4f>  tangentList;
   Containers::List<Color>     colorList;
   Containers::List<U32>       indexList;
+  Containers::List<Lod>       lodList;
   VertexPrimitive primitive;
 
   void Add(const Vector3f& position, const Color& color)
@@ -85,6 +99,7 @@ struct MeshBuffer
     tangentList.Clear();
     colorList.Clear();
     indexList.Clear();
+    lodList.Clear();
   }
 };
 }
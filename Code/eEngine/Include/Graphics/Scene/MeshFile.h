@@ -0,0 +1,135 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file MeshFile.h
+This file declares the MeshFile binary mesh format. MeshFile stores meshes in their GPU vertex layouts so they can be
+memory mapped and uploaded without parsing or per vertex conversion.
+*/
+
+#ifndef E3_MESH_FILE_H
+#define E3_MESH_FILE_H
+
+#include <Graphics/Scene/IMesh.h>
+#include <Graphics/Scene/MeshBuffer.h>
+#include <Math/Box3.h>
+
+namespace E
+{
+namespace Graphics
+{
+namespace Scene
+{
+/*----------------------------------------------------------------------------------------------------------------------
+MeshFile
+
+Please note that this namespace has the following usage contract:
+
+1. A mesh file is a Header followed by a table of sectionCount Section entries. Each section references a blob of
+elementCount elements of elementSize bytes through an offset relative to the file start, aligned to kAlignment bytes.
+Unknown section types are skipped so sections can be added without breaking older readers, while any layout change of
+the existing ones must increase kVersion.
+2. Vertices are stored in the Vertex.h layout of the header vertex type (compressed layouts use half precision) with a
+zero meshID, indices are 32 bit and a LOD section stores MeshBuffer::Lod ranges. Data is stored in native byte order:
+mesh files are platform specific caches generated by Convert or Save and not interchange files.
+3. Read does not copy or patch the data (mapped files are read only): it validates the header and the section bounds and
+resolves section offsets to pointers into the supplied buffer, so the View is only valid while that buffer lives.
+Index values are not validated.
+4. Import keeps the mesh buffers it produces in the derived data cache (see FileSystem::DerivedDataCache) when it is
+open, keyed by the model file content and lodCount, so importing an unchanged model again skips assimp and the
+optimization. Files referenced by the model file (e.g. external buffers) are not part of the key.
+----------------------------------------------------------------------------------------------------------------------*/
+namespace MeshFile
+{
+  static const U32  kMagic = 0x534d3345; // "E3MS"
+  static const U32  kVersion = 1;
+  static const U32  kAlignment = 16;
+  static const char kExtension[] = ".e3mesh";
+
+  enum SectionType
+  {
+    eSectionTypeVertices,
+    eSectionTypeIndices,
+    eSectionTypeLods,
+    eSectionTypeBounds,
+    eSectionTypeCount
+  };
+
+  struct Header
+  {
+    U32 magic;
+    U32 version;
+    U32 vertexType;
+    U32 sectionCount;
+    U64 fileSize;
+  };
+
+  struct Section
+  {
+    U32 type;
+    U32 elementSize;
+    U64 elementCount;
+    U64 offset;
+  };
+
+  struct View
+  {
+    View()
+      : vertexType(IMesh::eVertexTypeAutomatic)
+      , pVertices(nullptr)
+      , vertexCount(0)
+      , vertexSize(0)
+      , pIndices(nullptr)
+      , indexCount(0)
+      , pLods(nullptr)
+      , lodCount(0)
+      , pBounds(nullptr) {}
+
+    IMesh::VertexType       vertexType;
+    const void*             pVertices;
+    U32                     vertexCount;
+    U32                     vertexSize;
+    const U32*              pIndices;
+    U32                     indexCount;
+    const MeshBuffer::Lod*  pLods;
+    U32                     lodCount;
+    const Box3f*            pBounds;
+  };
+
+  // Imports a model file and saves it as a mesh file
+  E_API bool Convert(const FilePath& sourceFilePath, const FilePath& targetFilePath, U32 lodCount = 1);
+  // Imports a model file (any format supported by assimp), optimizes it and generates up to lodCount levels of detail
+  E_API bool Import(MeshBuffer& meshBuffer, const FilePath& sourceFilePath, U32 lodCount = 1);
+  E_API bool IsMeshFile(const FilePath& filePath);
+  E_API bool Read(View& view, const void* pData, size_t size);
+  E_API bool Save(const FilePath& filePath, const MeshBuffer& meshBuffer);
+}
+}
+}
+}
+
+#endif
@@ -79,6 +79,11 @@ const Spheref& Graphics::Frustum::GetBoundingSphere() const
   return mBoundingSphere;
 }
 
+const Vector3f& Graphics::Frustum::GetEyePosition() const
+{
+  return mEyePosition;
+}
+
 const Matrix4f& Graphics::Frustum::GetViewProjectionMatrix() const
 {
   return mViewProjectionMatrix;
@@ -89,6 +94,16 @@ const Matrix4f& Graphics::Frustum::GetInverseProjectionMatrix() const
   return mInverseProjectionMatrix;
 }
 
+const Planef* Graphics::Frustum::GetPlanes() const
+{
+  return mPlanes;
+}
+
+F32 Graphics::Frustum::GetScreenSize(const Vector3f& center, F32 radius) const
+{
+  return Math::GetProjectedSize(mProjectionMatrix, radius, (center - mEyePosition).GetLength());
+}
+
 bool Graphics::Frustum::IsInside(const Vector3f& point, F32 radius /* = 0.0f */) const
 {
 	// Check if the point is inside all 6 frustum planes
@@ -108,6 +123,18 @@ Implementation based on: Fast Extraction of Viewing Frustum Planes from the Worl
 by Gil Gribb and Klaus Hartmann 
 ----------------------------------------------------------------------------------------------------------------------*/
 
+void Graphics::Frustum::CullBoxes(U32* pResult, const F32* pCenterX, const F32* pCenterY, const F32* pCenterZ, const F32* pExtentX,
+  const F32* pExtentY, const F32* pExtentZ, size_t count, U8* pPlaneCache /* = nullptr */) const
+{
+  Math::Batch::CullBoxes(pResult, mPlanes, ePlaneCount, pCenterX, pCenterY, pCenterZ, pExtentX, pExtentY, pExtentZ, count, pPlaneCache);
+}
+
+void Graphics::Frustum::CullSpheres(U32* pResult, const F32* pX, const F32* pY, const F32* pZ, const F32* pRadius, size_t count,
+  U8* pPlaneCache /* = nullptr */) const
+{
+  Math::Batch::CullSpheres(pResult, mPlanes, ePlaneCount, pX, pY, pZ, pRadius, count, pPlaneCache);
+}
+
 void Graphics::Frustum::Update(const Matrix4f& viewMatrix, const Matrix4f& projectionMatrix)
 {
 	// Compute view projection matrix
@@ -156,6 +183,10 @@ void Graphics::Frustum::Update(const Matrix4f& viewMatrix, const Matrix4f& proje
     mViewProjectionMatrix[15] - mViewProjectionMatrix[14]);
 	mPlanes[ePlaneFar].Normalize();
 
+  // Store the projection and the eye position (view matrix inverse translation) for screen size queries
+  mProjectionMatrix = projectionMatrix;
+  mEyePosition = Matrix4f::Invert(viewMatrix).GetTranslation();
+
   // Compute inverse
   mInverseProjectionMatrix = Matrix4f::Invert(mViewProjectionMatrix);
   // Compute frustum points
@@ -140,6 +140,14 @@ void Graphics::Scene::ForwardRenderer::Render(const IViewInstance& view, const I
   mIntraFrameConstantBuffer->GetBuffer()->Clear();
   mTransformBuffer->GetBuffer()->Clear();
 
+  // Select mesh levels of detail from the view camera (shadow passes reuse them)
+  const Frustum& frustum = mView->GetViewState().camera->GetFrustum();
+  for (auto it = begin(mWorld->GetWorldState().objectList[IObject::eObjectTypeMesh]); it != end(mWorld->GetWorldState().objectList[IObject::eObjectTypeMesh]); ++it)
+  {
+    IMeshInstance mesh = *it;
+    mesh->SelectLod(frustum);
+  }
+
   if (
     mWorld->GetWorldState().objectList[IObject::eObjectTypeLight].IsEmpty() &&
     mWorld->GetWorldState().objectList[IObject::eObjectTypeLightPoint].IsEmpty() &&
@@ -37,11 +37,6 @@ This file defines the Mesh class.
 
 using namespace E;
 
-/*----------------------------------------------------------------------------------------------------------------------
-SceneManager assertion messages
-----------------------------------------------------------------------------------------------------------------------*/
-#define E_ASSERT_MSG_MESH_VERTEX_TYPE_HANDLER_MISSING    "There is no vertex handler for the supplied vertex type"
-
 /*----------------------------------------------------------------------------------------------------------------------
 Mesh auxiliary
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -58,6 +53,9 @@ const E::Graphics::IVertexLayout::Descriptor kDefaultVertexLayoutTable[] =
   E::Graphics::CompressedPositionTextureNormalVertex::GetVertexLayoutDescriptor()
 };
 
+// Maximum level of detail error as a fraction of the viewport height
+const F32 kMeshLodScreenError = 1.0f / 1024.0f;
+
 /*----------------------------------------------------------------------------------------------------------------------
 Mesh initialization & finalization
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -72,6 +70,9 @@ Graphics::Scene::Mesh::Mesh()
   , mMaterialBuffer(mRenderManager->GetResourceBuffer(eResourceBufferIDMaterial))
   , mMaterial(Global::GetSceneManager()->GetDefaultMaterial())
   , mMeshID(static_cast<U32>(-1))
+  , mStartIndex(0)
+  , mLod(0)
+  , mLodEnabled(true)
   , mCustomVertexType(eVertexTypeAutomatic) {}
 #pragma warning(pop)
 
@@ -84,11 +85,36 @@ U32 Graphics::Scene::Mesh::GetID() const
   return mMeshID;
 }
 
+U32 Graphics::Scene::Mesh::GetLod() const
+{
+  return mLod;
+}
+
+U32 Graphics::Scene::Mesh::GetLodCount() const
+{
+  return mMeshBuffer.lodList.IsEmpty() ? 1 : static_cast<U32>(mMeshBuffer.lodList.GetCount());
+}
+
 const Graphics::Scene::IMaterialInstance& Graphics::Scene::Mesh::GetMaterial() const
 {
   return mMaterial;
 }
 
+U32 Graphics::Scene::Mesh::GetTriangleCount() const
+{
+  return mDrawState.indexCount / 3;
+}
+
+bool Graphics::Scene::Mesh::IsLodEnabled() const
+{
+  return mLodEnabled;
+}
+
+void Graphics::Scene::Mesh::SetLodEnabled(bool enabled)
+{
+  mLodEnabled = enabled;
+}
+
 void Graphics::Scene::Mesh::SetMaterial(IMaterialInstance material)
 {
   mMaterial = material;
@@ -118,51 +144,72 @@ void Graphics::Scene::Mesh::Clear()
 
 void Graphics::Scene::Mesh::CreateCube(F32 length)
 {
+  CloseMeshFile();
   MeshHelper::CreateCube(mMeshBuffer, length);
 }
 
 void Graphics::Scene::Mesh::CreateCylinder(F32 topRadius, F32 bottomRadius, F32 height, U32 sliceCount, U32 stackCount)
 {
+  CloseMeshFile();
   MeshHelper::CreateCylinder(mMeshBuffer, topRadius, bottomRadius, height, sliceCount, stackCount);
+  MeshHelper::Optimize(mMeshBuffer);
 }
 
 bool Graphics::Scene::Mesh::CreateFromFile(const FilePath& filePath)
 {
-  Assimp::Importer assimpImporter;
-  const aiScene* pAssimpScene = assimpImporter.ReadFile(
-    filePath.GetPtr(),
-    aiProcess_CalcTangentSpace |
-    aiProcess_Triangulate |
-    aiProcess_JoinIdenticalVertices |
-    aiProcess_SortByPType);
+  CloseMeshFile();
+  mMeshBuffer.Clear();
 
-  if (pAssimpScene == nullptr) return false;
+  if (!MeshFile::IsMeshFile(filePath))
+  {
+    // Model files are imported and optimized unless the derived data cache holds the result (see MeshFile::Import)
+    return MeshFile::Import(mMeshBuffer, filePath);
+  }
 
-  E_ASSERT_TODO;
+  // Mesh files are mapped and their vertex and index data is used in place
+  if (!mMeshFile.Open(filePath)) return false;
+  if (!MeshFile::Read(mMeshFileView, mMeshFile.GetPtr(), mMeshFile.GetSize()))
+  {
+    mMeshFile.Close();
+    return false;
+  }
+  if (mMeshFileView.lodCount) mMeshBuffer.lodList.PushBack(mMeshFileView.pLods, mMeshFileView.lodCount);
 
   return true;
 }
 
 void Graphics::Scene::Mesh::CreateQuad(F32 length)
 {
+  CloseMeshFile();
   MeshHelper::CreateQuad(mMeshBuffer, length, length);
 }
 
 void Graphics::Scene::Mesh::CreateQuad(F32 width, F32 height)
 {
+  CloseMeshFile();
   MeshHelper::CreateQuad(mMeshBuffer, width, height);
 }
 
 void Graphics::Scene::Mesh::CreateSphere(F32 radius, U32 sliceCount, U32 stackCount)
 {
+  CloseMeshFile();
   MeshHelper::CreateSphere(mMeshBuffer, radius, sliceCount, stackCount);
+  MeshHelper::Optimize(mMeshBuffer);
 }
 
 void Graphics::Scene::Mesh::CreateTriangle(F32 length)
 {
+  CloseMeshFile();
   MeshHelper::CreateTriangle(mMeshBuffer, length);
 }
 
+U32 Graphics::Scene::Mesh::GenerateLods(U32 lodCount)
+{
+  // Mesh file levels of detail are generated on conversion
+  if (mMeshFile.IsOpen()) return GetLodCount();
+  return MeshHelper::GenerateLods(mMeshBuffer, lodCount);
+}
+
 void Graphics::Scene::Mesh::Load()
 {
   // Get a mesh ID
@@ -171,6 +218,17 @@ void Graphics::Scene::Mesh::Load()
   LoadVertexState();
   LoadMaterial();
   LoadDrawState();
+  // Set local bounds (spatial queries use the object world bounds)
+  if (mMeshFile.IsOpen())
+  {
+    mCore.SetLocalBounds(*mMeshFileView.pBounds);
+  }
+  else if (!mMeshBuffer.positionList.IsEmpty())
+  {
+    Box3f bounds;
+    bounds.SetPoints(mMeshBuffer.positionList.GetPtr(), static_cast<U32>(mMeshBuffer.positionList.GetCount()));
+    mCore.SetLocalBounds(bounds);
+  }
   // Load core object
   mCore.Load();
 }
@@ -198,6 +256,23 @@ void Graphics::Scene::Mesh::Render()
   mCore.RenderChildren();
 }
 
+void Graphics::Scene::Mesh::SelectLod(const Frustum& frustum)
+{
+  U32 lod = 0;
+  if (mLodEnabled && mMeshBuffer.lodList.GetCount() > 1)
+  {
+    // Lod errors are relative to the mesh extent so they are scaled by the projected bounds size
+    const Box3f& bounds = mCore.GetBounds();
+    const F32 screenSize = frustum.GetScreenSize(bounds.GetCenter(), bounds.GetExtents().GetLength());
+    while (lod + 1 < mMeshBuffer.lodList.GetCount() && mMeshBuffer.lodList[lod + 1].error * screenSize <= kMeshLodScreenError) ++lod;
+  }
+  if (lod == mLod) return;
+
+  mLod = lod;
+  mDrawState.indexCount = mMeshBuffer.lodList[mLod].indexCount;
+  mDrawState.startIndex = mStartIndex + mMeshBuffer.lodList[mLod].startIndex;
+}
+
 void Graphics::Scene::Mesh::Update(const TimeValue& deltaTime)
 {
   // Update only active camera
@@ -208,14 +283,27 @@ void Graphics::Scene::Mesh::Update(const TimeValue& deltaTime)
 Mesh private methods
 ----------------------------------------------------------------------------------------------------------------------*/
 
+void Graphics::Scene::Mesh::CloseMeshFile()
+{
+  if (!mMeshFile.IsOpen()) return;
+
+  mMeshFile.Close();
+  mMeshFileView = MeshFile::View();
+  mMeshBuffer.lodList.Clear();
+}
+
 void Graphics::Scene::Mesh::LoadDrawState()
 {
   // Configure draw state
   mDrawState.vertexPrimitive = eVertexPrimitiveTriangleList;
-  mDrawState.vertexCount = static_cast<U32>(mMeshBuffer.positionList.GetCount());
+  mDrawState.vertexCount = mMeshFile.IsOpen() ? mMeshFileView.vertexCount : static_cast<U32>(mMeshBuffer.positionList.GetCount());
   mDrawState.startVertex = mVertexArray.vertexBuffer->GetCount() - mDrawState.vertexCount;
-  mDrawState.indexCount = static_cast<U32>(mMeshBuffer.indexList.GetCount());
-  mDrawState.startIndex = mVertexArray.indexBuffer->GetCount() - mDrawState.indexCount;
+  const U32 indexCount = mMeshFile.IsOpen() ? mMeshFileView.indexCount : static_cast<U32>(mMeshBuffer.indexList.GetCount());
+  mStartIndex = mVertexArray.indexBuffer->GetCount() - indexCount;
+  // Draw the selected level of detail range (the whole index list when there are no levels of detail)
+  mLod = Math::Min(mLod, GetLodCount() - 1);
+  mDrawState.indexCount = mMeshBuffer.lodList.IsEmpty() ? indexCount : mMeshBuffer.lodList[mLod].indexCount;
+  mDrawState.startIndex = mStartIndex + (mMeshBuffer.lodList.IsEmpty() ? 0 : mMeshBuffer.lodList[mLod].startIndex);
 }
 
 void Graphics::Scene::Mesh::LoadMaterial()
@@ -249,26 +337,23 @@ void Graphics::Scene::Mesh::LoadVertexState()
   mVertexArray.indexBuffer = mRenderManager->GetDevice()->CreateBuffer(indexBufferDescriptor);
   E_ASSERT_PTR(mVertexArray.indexBuffer);
 
-  // Add vertex data
-  switch (vertexType)
+  // Add vertex & index data
+  if (mMeshFile.IsOpen())
   {
-  case eVertexTypePosition: UpdatePositionVertexData();
-    break;
-  case eVertexTypePositionTexture: UpdateCompressedPositionTextureVertexData();
-    break;
-  case eVertexTypePositionNormal: UpdateCompressedPositionNormalVertexData();
-    break;
-  case eVertexTypePositionTextureNormal: UpdateCompressedPositionTextureNormalVertexData();
-    break;
-  default:
-    E_ASSERT_ALWAYS(E_ASSERT_MSG_MESH_VERTEX_TYPE_HANDLER_MISSING);
+    UpdateMeshFileVertexData();
+    mVertexArray.indexBuffer->Add(mMeshFileView.pIndices, mMeshFileView.indexCount);
+  }
+  else
+  {
+    UpdateVertexData(vertexType);
+    if (mMeshBuffer.indexList.GetCount()) mVertexArray.indexBuffer->Add(mMeshBuffer.indexList.GetPtr(), static_cast<U32>(mMeshBuffer.indexList.GetCount()));
   }
-  // Add index data
-  if (mMeshBuffer.indexList.GetCount()) mVertexArray.indexBuffer->Add(mMeshBuffer.indexList.GetPtr(), static_cast<U32>(mMeshBuffer.indexList.GetCount()));
 }
 
 Graphics::Scene::IMesh::VertexType Graphics::Scene::Mesh::SelectVertexType()
 {
+  // Mesh file vertices are already packed
+  if (mMeshFile.IsOpen()) return mMeshFileView.vertexType;
   if (mCustomVertexType != eVertexTypeAutomatic) return mCustomVertexType;
   E_ASSERT_PTR(mMaterial);
 
@@ -285,61 +370,28 @@ Graphics::Scene::IMesh::VertexType Graphics::Scene::Mesh::SelectVertexType()
 
 }
 
-void Graphics::Scene::Mesh::UpdateCompressedPositionNormalVertexData()
+void Graphics::Scene::Mesh::UpdateMeshFileVertexData()
 {
-  CompressedPositionNormalVertex vertex;
-  const IBufferInstance& vertexBuffer = mVertexArray.vertexBuffer;
-  for (U32 i = 0; i < mMeshBuffer.positionList.GetCount(); ++i)
-  {
-    vertex.position = mMeshBuffer.positionList[i];
-    vertex.meshID = mMeshID;
-    vertex.normal.x = Math::Half(mMeshBuffer.normalList[i].x);
-    vertex.normal.y = Math::Half(mMeshBuffer.normalList[i].y);
-    vertex.normal.z = Math::Half(mMeshBuffer.normalList[i].z);
-    vertexBuffer->Add(&vertex, 1);
-  }
-}
-
-void Graphics::Scene::Mesh::UpdateCompressedPositionTextureNormalVertexData()
-{
-  CompressedPositionTextureNormalVertex vertex;
-  const IBufferInstance& vertexBuffer = mVertexArray.vertexBuffer;
-  for (U32 i = 0; i < mMeshBuffer.positionList.GetCount(); ++i)
-  {
-    vertex.position = mMeshBuffer.positionList[i];
-    vertex.meshID = mMeshID;
-    vertex.texCoord.x = Math::Half(mMeshBuffer.texCoordList[i].x);
-    vertex.texCoord.y = Math::Half(mMeshBuffer.texCoordList[i].y);
-    vertex.normal.x = Math::Half(mMeshBuffer.normalList[i].x);
-    vertex.normal.y = Math::Half(mMeshBuffer.normalList[i].y);
-    vertex.normal.z = Math::Half(mMeshBuffer.normalList[i].z);
-    vertexBuffer->Add(&vertex, 1);
-  }
-}
-
-void Graphics::Scene::Mesh::UpdateCompressedPositionTextureVertexData()
-{
-  CompressedPositionTextureVertex vertex;
-  const IBufferInstance& vertexBuffer = mVertexArray.vertexBuffer;
-  for (U32 i = 0; i < mMeshBuffer.positionList.GetCount(); ++i)
-  {
-    vertex.position = mMeshBuffer.positionList[i];
-    vertex.meshID = mMeshID;
-    vertex.texCoord.x = Math::Half(mMeshBuffer.texCoordList[i].x);
-    vertex.texCoord.y = Math::Half(mMeshBuffer.texCoordList[i].y);
-    vertexBuffer->Add(&vertex, 1);
-  }
+  // Mesh file vertices only need the mesh ID (stored as zero) to be stamped on a copy of the mapped data
+  const size_t vertexSize = mMeshFileView.vertexSize;
+  const size_t vertexDataSize = vertexSize * mMeshFileView.vertexCount;
+  Containers::List<Byte> vertexData(vertexDataSize);
+  vertexData.SetCount(vertexDataSize);
+  Memory::Copy(vertexData.GetPtr(), static_cast<const Byte*>(mMeshFileView.pVertices), vertexDataSize);
+  Byte* pMeshID = vertexData.GetPtr() + offsetof(PositionVertex, meshID);
+  for (U32 i = 0; i < mMeshFileView.vertexCount; ++i, pMeshID += vertexSize) Memory::Copy(pMeshID, reinterpret_cast<const Byte*>(&mMeshID), sizeof(U32));
+  mVertexArray.vertexBuffer->Add(vertexData.GetPtr(), mMeshFileView.vertexCount);
 }
 
-void Graphics::Scene::Mesh::UpdatePositionVertexData()
+void Graphics::Scene::Mesh::UpdateVertexData(VertexType vertexType)
 {
-  PositionColorVertex vertex;
-  const IBufferInstance& vertexBuffer = mVertexArray.vertexBuffer;
-
-  for (U32 i = 0; i < mMeshBuffer.positionList.GetCount(); ++i)
-  {
-    vertex.position = mMeshBuffer.positionList[i];
-    vertex.meshID = mMeshID;
-    vertexBuffer->Add(&vertex, 1);
-  }
+  const size_t vertexCount = mMeshBuffer.positionList.GetCount();
+  if (vertexCount == 0) return;
+
+  // Pack the whole vertex array and add it at once (zeroed first as packing leaves some fields unset, e.g. half normal w)
+  Containers::List<Byte> vertexData(vertexCount * MeshHelper::GetVertexSize(vertexType));
+  vertexData.SetCount(vertexCount * MeshHelper::GetVertexSize(vertexType));
+  Memory::Zero(vertexData.GetPtr(), vertexData.GetCount());
+  MeshHelper::PackVertices(vertexData.GetPtr(), mMeshBuffer, vertexType, mMeshID);
+  mVertexArray.vertexBuffer->Add(vertexData.GetPtr(), static_cast<U32>(vertexCount));
 }
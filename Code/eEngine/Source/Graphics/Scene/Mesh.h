@@ -55,7 +55,12 @@ public:
 
   // Accessors
   U32                       GetID() const;
+  U32                       GetLod() const;
+  U32                       GetLodCount() const;
   const IMaterialInstance&  GetMaterial() const;
+  U32                       GetTriangleCount() const;
+  bool                      IsLodEnabled() const;
+  void                      SetLodEnabled(bool enabled);
   void                      SetMaterial(IMaterialInstance material);
   void                      SetShader(const String& shaderTechniqueName);
   void                      SetVertexType(VertexType vertexType);
@@ -69,8 +74,10 @@ public:
   void                      CreateQuad(F32 width, F32 height);
   void                      CreateSphere(F32 radius, U32 sliceCount, U32 stackCount);
   void                      CreateTriangle(F32 length);
+  U32                       GenerateLods(U32 lodCount);
   void                      Load();
   void                      Render();
+  void                      SelectLod(const Frustum& frustum);
   void                      Unload();
   void                      Update(const TimeValue& deltaTime);
 
@@ -85,17 +92,21 @@ private:
   IShaderInstance           mShader;
   IMaterialInstance         mMaterial;
   U32                       mMeshID;
+  U32                       mStartIndex;
+  U32                       mLod;
+  bool                      mLodEnabled;
   String                    mCustomShaderName;
   VertexType                mCustomVertexType;
+  FileSystem::MappedFile    mMeshFile;
+  MeshFile::View            mMeshFileView;
 
+  void                      CloseMeshFile();
   void                      LoadDrawState();
   void                      LoadMaterial();
   void                      LoadVertexState();
   VertexType                SelectVertexType();
-  void                      UpdateCompressedPositionNormalVertexData();
-  void                      UpdateCompressedPositionTextureNormalVertexData();
-  void                      UpdateCompressedPositionTextureVertexData();
-  void                      UpdatePositionVertexData();
+  void                      UpdateMeshFileVertexData();
+  void                      UpdateVertexData(VertexType vertexType);
 
   void                      ValidateMeshBuffer();
   
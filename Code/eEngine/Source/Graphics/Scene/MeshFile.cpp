@@ -0,0 +1,312 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file MeshFile.cpp
+This file defines the MeshFile binary mesh format.
+*/
+
+#include <EnginePch.h>
+#include "MeshHelper.h"
+#include <fstream>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+MeshFile auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline size_t MeshFileAlign(size_t offset)
+{
+  return (offset + Graphics::Scene::MeshFile::kAlignment - 1) & ~static_cast<size_t>(Graphics::Scene::MeshFile::kAlignment - 1);
+}
+
+Graphics::Scene::IMesh::VertexType MeshFileGetVertexType(const Graphics::Scene::MeshBuffer& meshBuffer)
+{
+  if (meshBuffer.normalList.GetCount())
+  {
+    return meshBuffer.texCoordList.GetCount() ? Graphics::Scene::IMesh::eVertexTypePositionTextureNormal : Graphics::Scene::IMesh::eVertexTypePositionNormal;
+  }
+  return meshBuffer.texCoordList.GetCount() ? Graphics::Scene::IMesh::eVertexTypePositionTexture : Graphics::Scene::IMesh::eVertexTypePosition;
+}
+
+// Version of the mesh buffers Import keeps in the derived data cache (increase it whenever Import output changes)
+const U32 kMeshFileImportCacheVersion = 1;
+
+template <typename T>
+inline void MeshFileWriteList(Containers::List<Byte>& data, const Containers::List<T>& list)
+{
+  const U64 count = list.GetCount();
+  data.PushBack(reinterpret_cast<const Byte*>(&count), sizeof(U64));
+  if (count) data.PushBack(reinterpret_cast<const Byte*>(list.GetPtr()), list.GetCount() * sizeof(T));
+}
+
+template <typename T>
+inline bool MeshFileReadList(Containers::List<T>& list, const Byte*& pData, const Byte* pEnd)
+{
+  U64 count;
+  if (static_cast<size_t>(pEnd - pData) < sizeof(U64)) return false;
+  Memory::Copy(reinterpret_cast<Byte*>(&count), pData, sizeof(U64));
+  pData += sizeof(U64);
+  if (count > static_cast<size_t>(pEnd - pData) / sizeof(T)) return false;
+
+  const size_t size = static_cast<size_t>(count);
+  list.EnsureSize(size);
+  list.SetCount(size);
+  if (size) Memory::Copy(reinterpret_cast<Byte*>(list.GetPtr()), pData, size * sizeof(T));
+  pData += size * sizeof(T);
+  return true;
+}
+
+// Cached mesh buffers are the mesh buffer lists (element count followed by the elements) and the primitive
+void MeshFileWriteMeshBuffer(Containers::List<Byte>& data, const Graphics::Scene::MeshBuffer& meshBuffer)
+{
+  data.Clear();
+  data.EnsureSize(7 * sizeof(U64) + sizeof(U32) +
+    meshBuffer.positionList.GetCount() * sizeof(Vector3f) +
+    meshBuffer.texCoordList.GetCount() * sizeof(Vector2f) +
+    meshBuffer.normalList.GetCount() * sizeof(Vector3f) +
+    meshBuffer.tangentList.GetCount() * sizeof(Vector4f) +
+    meshBuffer.colorList.GetCount() * sizeof(Graphics::Color) +
+    meshBuffer.indexList.GetCount() * sizeof(U32) +
+    meshBuffer.lodList.GetCount() * sizeof(Graphics::Scene::MeshBuffer::Lod));
+  MeshFileWriteList(data, meshBuffer.positionList);
+  MeshFileWriteList(data, meshBuffer.texCoordList);
+  MeshFileWriteList(data, meshBuffer.normalList);
+  MeshFileWriteList(data, meshBuffer.tangentList);
+  MeshFileWriteList(data, meshBuffer.colorList);
+  MeshFileWriteList(data, meshBuffer.indexList);
+  MeshFileWriteList(data, meshBuffer.lodList);
+  const U32 primitive = meshBuffer.primitive;
+  data.PushBack(reinterpret_cast<const Byte*>(&primitive), sizeof(U32));
+}
+
+bool MeshFileReadMeshBuffer(Graphics::Scene::MeshBuffer& meshBuffer, const Containers::List<Byte>& data)
+{
+  const Byte* pData = data.GetPtr();
+  const Byte* pEnd = pData + data.GetCount();
+  U32 primitive;
+  if (!MeshFileReadList(meshBuffer.positionList, pData, pEnd) ||
+      !MeshFileReadList(meshBuffer.texCoordList, pData, pEnd) ||
+      !MeshFileReadList(meshBuffer.normalList, pData, pEnd) ||
+      !MeshFileReadList(meshBuffer.tangentList, pData, pEnd) ||
+      !MeshFileReadList(meshBuffer.colorList, pData, pEnd) ||
+      !MeshFileReadList(meshBuffer.indexList, pData, pEnd) ||
+      !MeshFileReadList(meshBuffer.lodList, pData, pEnd) ||
+      static_cast<size_t>(pEnd - pData) != sizeof(U32))
+  {
+    meshBuffer.Clear();
+    return false;
+  }
+  Memory::Copy(reinterpret_cast<Byte*>(&primitive), pData, sizeof(U32));
+  meshBuffer.primitive = static_cast<Graphics::VertexPrimitive>(primitive);
+  return true;
+}
+
+void MeshFileSetSection(Graphics::Scene::MeshFile::Section& section, Graphics::Scene::MeshFile::SectionType type, size_t elementSize, size_t elementCount)
+{
+  section.type = type;
+  section.elementSize = static_cast<U32>(elementSize);
+  section.elementCount = elementCount;
+  section.offset = 0;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+MeshFile methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Graphics::Scene::MeshFile::Convert(const FilePath& sourceFilePath, const FilePath& targetFilePath, U32 lodCount /* = 1 */)
+{
+  MeshBuffer meshBuffer;
+  return Import(meshBuffer, sourceFilePath, lodCount) && Save(targetFilePath, meshBuffer);
+}
+
+bool Graphics::Scene::MeshFile::Import(MeshBuffer& meshBuffer, const FilePath& sourceFilePath, U32 lodCount /* = 1 */)
+{
+  // Imported mesh buffers are kept in the derived data cache, keyed by the model file content and the import settings
+  FileSystem::DerivedDataCache& derivedDataCache = FileSystem::Global::GetDerivedDataCache();
+  Containers::List<Byte> data;
+  U64 cacheKey = 0;
+  const bool useCache = derivedDataCache.IsOpen() && FileSystem::Global::GetVirtualFileSystem().Read(sourceFilePath, data);
+  if (useCache)
+  {
+    String processing;
+    processing.Print("MeshFile::Import|%u|lods=%u", kMeshFileImportCacheVersion, lodCount);
+    cacheKey = FileSystem::DerivedDataCache::GetKey(data.GetPtr(), data.GetCount(), processing.GetPtr());
+    if (derivedDataCache.Get(cacheKey, data) && MeshFileReadMeshBuffer(meshBuffer, data)) return true;
+  }
+
+  if (!MeshHelper::Import(meshBuffer, sourceFilePath)) return false;
+
+  MeshHelper::Optimize(meshBuffer);
+  if (lodCount > 1) MeshHelper::GenerateLods(meshBuffer, lodCount);
+  if (useCache)
+  {
+    MeshFileWriteMeshBuffer(data, meshBuffer);
+    derivedDataCache.Put(cacheKey, data.GetPtr(), data.GetCount());
+  }
+  return true;
+}
+
+bool Graphics::Scene::MeshFile::IsMeshFile(const FilePath& filePath)
+{
+  const size_t extensionLength = sizeof(kExtension) - 1;
+  const size_t length = filePath.GetLength();
+  if (length < extensionLength) return false;
+
+  // Extensions are case insensitive
+  const char* pExtension = filePath.GetPtr() + length - extensionLength;
+  for (size_t i = 0; i < extensionLength; ++i)
+  {
+    if (tolower(static_cast<unsigned char>(pExtension[i])) != kExtension[i]) return false;
+  }
+  return true;
+}
+
+bool Graphics::Scene::MeshFile::Read(View& view, const void* pData, size_t size)
+{
+  view = View();
+  if (pData == nullptr || size < sizeof(Header)) return false;
+
+  const Byte* pBytes = static_cast<const Byte*>(pData);
+  const Header& header = *reinterpret_cast<const Header*>(pBytes);
+  if (header.magic != kMagic ||
+      header.version != kVersion ||
+      header.fileSize != size ||
+      header.vertexType >= IMesh::eVertexTypeAutomatic ||
+      header.sectionCount > (size - sizeof(Header)) / sizeof(Section)) return false;
+
+  // Resolve section offsets
+  const Section* pSections = reinterpret_cast<const Section*>(pBytes + sizeof(Header));
+  const IMesh::VertexType vertexType = static_cast<IMesh::VertexType>(header.vertexType);
+  for (U32 i = 0; i < header.sectionCount; ++i)
+  {
+    const Section& section = pSections[i];
+    if (section.offset % kAlignment ||
+        section.offset > size ||
+        (section.elementSize && section.elementCount > (size - section.offset) / section.elementSize) ||
+        section.elementCount > 0xffffffff) return false;
+
+    const void* pSectionData = pBytes + section.offset;
+    const U32 elementCount = static_cast<U32>(section.elementCount);
+    switch (section.type)
+    {
+    case eSectionTypeVertices:
+      if (section.elementSize != MeshHelper::GetVertexSize(vertexType)) return false;
+      view.pVertices = pSectionData;
+      view.vertexCount = elementCount;
+      view.vertexSize = section.elementSize;
+      break;
+    case eSectionTypeIndices:
+      if (section.elementSize != sizeof(U32)) return false;
+      view.pIndices = static_cast<const U32*>(pSectionData);
+      view.indexCount = elementCount;
+      break;
+    case eSectionTypeLods:
+      if (section.elementSize != sizeof(MeshBuffer::Lod)) return false;
+      view.pLods = static_cast<const MeshBuffer::Lod*>(pSectionData);
+      view.lodCount = elementCount;
+      break;
+    case eSectionTypeBounds:
+      if (section.elementSize != sizeof(Box3f) || elementCount != 1) return false;
+      view.pBounds = static_cast<const Box3f*>(pSectionData);
+      break;
+    default:
+      break;
+    }
+  }
+  if (view.vertexCount == 0 || view.indexCount == 0 || view.pBounds == nullptr)
+  {
+    view = View();
+    return false;
+  }
+
+  // Level of detail ranges must be contained in the index list
+  for (U32 i = 0; i < view.lodCount; ++i)
+  {
+    if (view.pLods[i].startIndex > view.indexCount || view.pLods[i].indexCount > view.indexCount - view.pLods[i].startIndex)
+    {
+      view = View();
+      return false;
+    }
+  }
+  view.vertexType = vertexType;
+
+  return true;
+}
+
+bool Graphics::Scene::MeshFile::Save(const FilePath& filePath, const MeshBuffer& meshBuffer)
+{
+  const size_t vertexCount = meshBuffer.positionList.GetCount();
+  const size_t indexCount = meshBuffer.indexList.GetCount();
+  if (vertexCount == 0 || indexCount == 0) return false;
+
+  // Set up the section table
+  const IMesh::VertexType vertexType = MeshFileGetVertexType(meshBuffer);
+  Section sectionTable[eSectionTypeCount];
+  MeshFileSetSection(sectionTable[eSectionTypeVertices], eSectionTypeVertices, MeshHelper::GetVertexSize(vertexType), vertexCount);
+  MeshFileSetSection(sectionTable[eSectionTypeIndices], eSectionTypeIndices, sizeof(U32), indexCount);
+  MeshFileSetSection(sectionTable[eSectionTypeLods], eSectionTypeLods, sizeof(MeshBuffer::Lod), meshBuffer.lodList.GetCount());
+  MeshFileSetSection(sectionTable[eSectionTypeBounds], eSectionTypeBounds, sizeof(Box3f), 1);
+  // Lay out the section blobs after the header and the section table
+  size_t offset = sizeof(Header) + sizeof(sectionTable);
+  for (U32 i = 0; i < eSectionTypeCount; ++i)
+  {
+    offset = MeshFileAlign(offset);
+    sectionTable[i].offset = offset;
+    offset += static_cast<size_t>(sectionTable[i].elementSize * sectionTable[i].elementCount);
+  }
+
+  Header header;
+  header.magic = kMagic;
+  header.version = kVersion;
+  header.vertexType = vertexType;
+  header.sectionCount = eSectionTypeCount;
+  header.fileSize = offset;
+
+  // Build the file image (padding is zeroed so identical meshes produce identical files)
+  Containers::List<Byte> data(offset);
+  data.SetCount(offset);
+  Memory::Zero(data.GetPtr(), offset);
+  Memory::Copy(data.GetPtr(), reinterpret_cast<const Byte*>(&header), sizeof(Header));
+  Memory::Copy(data.GetPtr() + sizeof(Header), reinterpret_cast<const Byte*>(sectionTable), sizeof(sectionTable));
+  MeshHelper::PackVertices(data.GetPtr() + sectionTable[eSectionTypeVertices].offset, meshBuffer, vertexType, 0);
+  Memory::Copy(reinterpret_cast<U32*>(data.GetPtr() + sectionTable[eSectionTypeIndices].offset), meshBuffer.indexList.GetPtr(), indexCount);
+  if (!meshBuffer.lodList.IsEmpty())
+  {
+    Memory::Copy(reinterpret_cast<MeshBuffer::Lod*>(data.GetPtr() + sectionTable[eSectionTypeLods].offset), meshBuffer.lodList.GetPtr(), meshBuffer.lodList.GetCount());
+  }
+  Box3f bounds;
+  bounds.SetPoints(meshBuffer.positionList.GetPtr(), static_cast<U32>(vertexCount));
+  Memory::Copy(reinterpret_cast<Box3f*>(data.GetPtr() + sectionTable[eSectionTypeBounds].offset), &bounds);
+
+  std::ofstream fileStream(filePath.GetPtr(), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!fileStream.is_open()) return false;
+  fileStream.write(reinterpret_cast<const char*>(data.GetPtr()), static_cast<std::streamsize>(offset));
+
+  return fileStream.good();
+}
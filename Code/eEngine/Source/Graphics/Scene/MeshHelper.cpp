@@ -39,6 +39,11 @@ Implementation portions: Copyright (C) Frank D. Luna, 2008
 
 using namespace E;
 
+/*----------------------------------------------------------------------------------------------------------------------
+MeshHelper assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_MESH_HELPER_VERTEX_TYPE_HANDLER_MISSING "There is no vertex handler for the supplied vertex type"
+
 /*----------------------------------------------------------------------------------------------------------------------
 Auxiliary
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -46,6 +51,11 @@ Auxiliary
 void BuildCylinderBottomCap(Graphics::Scene::MeshBuffer& meshBuffer, F32 radius, F32 height, U32 sliceCount);
 void BuildCylinderTopCap(Graphics::Scene::MeshBuffer& meshBuffer, F32 radius, F32 height, U32 sliceCount);
 void BuildCylinderStacks(Graphics::Scene::MeshBuffer& meshBuffer, F32 topRadius, F32 bottomRadius, F32 height, U32 sliceCount, U32 stackCount);
+template <typename T>
+T* PackVertexPositions(void* pVertices, const Graphics::Scene::MeshBuffer& meshBuffer, U32 meshID);
+template <typename T>
+void RemapVertexList(Containers::List<T>& vertexList, const U32* pRemap, U32 uniqueVertexCount);
+void RemapVertexLists(Graphics::Scene::MeshBuffer& meshBuffer, const U32* pRemap, U32 uniqueVertexCount);
 
 /*----------------------------------------------------------------------------------------------------------------------
 MeshHelper methods
@@ -210,6 +220,200 @@ void Graphics::Scene::MeshHelper::CreateTriangle(Graphics::Scene::MeshBuffer& me
   meshBuffer.Add(Vector3f( r,   -r, 0.0f), Graphics::Color::eBlue);
 }
 
+Math::MeshOptimizer::VertexCacheStatistics Graphics::Scene::MeshHelper::Optimize(Graphics::Scene::MeshBuffer& meshBuffer, U32 cacheSize /* = Math::MeshOptimizer::kDefaultCacheSize */)
+{
+  const U32 vertexCount = static_cast<U32>(meshBuffer.positionList.GetCount());
+  if (vertexCount == 0) return Math::MeshOptimizer::VertexCacheStatistics();
+
+  // Previous levels of detail are discarded (vertices are reordered)
+  if (!meshBuffer.lodList.IsEmpty())
+  {
+    meshBuffer.indexList.SetCount(meshBuffer.lodList[0].indexCount);
+    meshBuffer.lodList.Clear();
+  }
+
+  // Non indexed meshes are indexed in vertex order
+  if (meshBuffer.indexList.IsEmpty())
+  {
+    meshBuffer.indexList.Reserve(vertexCount);
+    for (U32 i = 0; i < vertexCount; ++i) meshBuffer.indexList.PushBack(i);
+  }
+  U32* pIndices = meshBuffer.indexList.GetPtr();
+  const U32 indexCount = static_cast<U32>(meshBuffer.indexList.GetCount());
+
+  // Weld vertices: interleave the available attributes so that only fully identical vertices are merged
+  const size_t vertexSize = sizeof(Vector3f) +
+    (meshBuffer.texCoordList.IsEmpty() ? 0 : sizeof(Vector2f)) +
+    (meshBuffer.normalList.IsEmpty() ? 0 : sizeof(Vector3f)) +
+    (meshBuffer.tangentList.IsEmpty() ? 0 : sizeof(Vector4f)) +
+    (meshBuffer.colorList.IsEmpty() ? 0 : sizeof(Color));
+  Containers::List<Byte> vertexDataList(vertexCount * vertexSize);
+  vertexDataList.SetCount(vertexCount * vertexSize);
+  Byte* pVertexData = vertexDataList.GetPtr();
+  for (U32 i = 0; i < vertexCount; ++i)
+  {
+    memcpy(pVertexData, &meshBuffer.positionList[i], sizeof(Vector3f));
+    pVertexData += sizeof(Vector3f);
+    if (!meshBuffer.texCoordList.IsEmpty()) { memcpy(pVertexData, &meshBuffer.texCoordList[i], sizeof(Vector2f)); pVertexData += sizeof(Vector2f); }
+    if (!meshBuffer.normalList.IsEmpty()) { memcpy(pVertexData, &meshBuffer.normalList[i], sizeof(Vector3f)); pVertexData += sizeof(Vector3f); }
+    if (!meshBuffer.tangentList.IsEmpty()) { memcpy(pVertexData, &meshBuffer.tangentList[i], sizeof(Vector4f)); pVertexData += sizeof(Vector4f); }
+    if (!meshBuffer.colorList.IsEmpty()) { memcpy(pVertexData, &meshBuffer.colorList[i], sizeof(Color)); pVertexData += sizeof(Color); }
+  }
+
+  Containers::List<U32> remapList(vertexCount);
+  remapList.SetCount(vertexCount);
+  U32 uniqueVertexCount = Math::MeshOptimizer::GenerateVertexRemap(remapList.GetPtr(), pIndices, indexCount, vertexDataList.GetPtr(), vertexCount, vertexSize);
+  Math::MeshOptimizer::RemapIndices(pIndices, pIndices, indexCount, remapList.GetPtr());
+  RemapVertexLists(meshBuffer, remapList.GetPtr(), uniqueVertexCount);
+
+  // Reorder triangles for the post transform vertex cache and then for overdraw
+  Math::MeshOptimizer::OptimizeVertexCache(pIndices, pIndices, indexCount, uniqueVertexCount, cacheSize);
+  Math::MeshOptimizer::OptimizeOverdraw(pIndices, pIndices, indexCount, meshBuffer.positionList.GetPtr(), uniqueVertexCount, 1.05f, cacheSize);
+
+  // Reorder vertices in first use order
+  uniqueVertexCount = Math::MeshOptimizer::OptimizeVertexFetch(remapList.GetPtr(), pIndices, indexCount, uniqueVertexCount);
+  Math::MeshOptimizer::RemapIndices(pIndices, pIndices, indexCount, remapList.GetPtr());
+  RemapVertexLists(meshBuffer, remapList.GetPtr(), uniqueVertexCount);
+
+  return Math::MeshOptimizer::AnalyzeVertexCache(pIndices, indexCount, uniqueVertexCount, cacheSize);
+}
+
+U32 Graphics::Scene::MeshHelper::GenerateLods(Graphics::Scene::MeshBuffer& meshBuffer, U32 lodCount, F32 targetError /* = 0.05f */, U32 cacheSize /* = Math::MeshOptimizer::kDefaultCacheSize */)
+{
+  const U32 vertexCount = static_cast<U32>(meshBuffer.positionList.GetCount());
+  if (!meshBuffer.lodList.IsEmpty())
+  {
+    meshBuffer.indexList.SetCount(meshBuffer.lodList[0].indexCount);
+    meshBuffer.lodList.Clear();
+  }
+  const U32 indexCount = static_cast<U32>(meshBuffer.indexList.GetCount());
+  if (indexCount == 0) return 0;
+
+  // The first level of detail is the source mesh
+  MeshBuffer::Lod lod;
+  lod.startIndex = 0;
+  lod.indexCount = indexCount;
+  lod.error = 0.0f;
+  meshBuffer.lodList.PushBack(lod);
+
+  Containers::List<U32> lodIndexList(indexCount);
+  lodIndexList.SetCount(indexCount);
+  for (U32 i = 1; i < lodCount; ++i)
+  {
+    const MeshBuffer::Lod previousLod = meshBuffer.lodList[i - 1];
+    F32 error = 0.0f;
+    const U32 lodIndexCount = Math::MeshOptimizer::Simplify(lodIndexList.GetPtr(), &meshBuffer.indexList[previousLod.startIndex],
+      previousLod.indexCount, meshBuffer.positionList.GetPtr(), vertexCount, (previousLod.indexCount / 6) * 3, targetError, &error);
+    // Stop when locked seams and boundaries (or the target error) prevent a significant reduction
+    if (lodIndexCount * 10 > previousLod.indexCount * 9) break;
+
+    Math::MeshOptimizer::OptimizeVertexCache(lodIndexList.GetPtr(), lodIndexList.GetPtr(), lodIndexCount, vertexCount, cacheSize);
+    // Errors are measured against the previous level of detail so they are accumulated
+    lod.startIndex = static_cast<U32>(meshBuffer.indexList.GetCount());
+    lod.indexCount = lodIndexCount;
+    lod.error = previousLod.error + error;
+    meshBuffer.indexList.PushBack(lodIndexList.GetPtr(), lodIndexCount);
+    meshBuffer.lodList.PushBack(lod);
+  }
+
+  return static_cast<U32>(meshBuffer.lodList.GetCount());
+}
+
+size_t Graphics::Scene::MeshHelper::GetVertexSize(IMesh::VertexType vertexType)
+{
+  switch (vertexType)
+  {
+  case IMesh::eVertexTypePosition: return sizeof(PositionColorVertex);
+  case IMesh::eVertexTypePositionTexture: return sizeof(CompressedPositionTextureVertex);
+  case IMesh::eVertexTypePositionNormal: return sizeof(CompressedPositionNormalVertex);
+  case IMesh::eVertexTypePositionTextureNormal: return sizeof(CompressedPositionTextureNormalVertex);
+  default: return 0;
+  }
+}
+
+bool Graphics::Scene::MeshHelper::Import(Graphics::Scene::MeshBuffer& meshBuffer, const FilePath& filePath)
+{
+  meshBuffer.Clear();
+
+  // Node transforms are baked into the vertices and all the meshes are merged into a single triangle list
+  Assimp::Importer assimpImporter;
+  const aiScene* pAssimpScene = assimpImporter.ReadFile(
+    filePath.GetPtr(),
+    aiProcess_Triangulate |
+    aiProcess_JoinIdenticalVertices |
+    aiProcess_SortByPType |
+    aiProcess_GenSmoothNormals |
+    aiProcess_PreTransformVertices);
+
+  if (pAssimpScene == nullptr) return false;
+
+  // Texture coordinates are only kept when every mesh has them (vertex lists must have the same count)
+  bool hasTexCoords = pAssimpScene->mNumMeshes > 0;
+  for (U32 i = 0; i < pAssimpScene->mNumMeshes; ++i)
+  {
+    const aiMesh* pAssimpMesh = pAssimpScene->mMeshes[i];
+    if (pAssimpMesh->mPrimitiveTypes == aiPrimitiveType_TRIANGLE && !pAssimpMesh->HasTextureCoords(0)) hasTexCoords = false;
+  }
+
+  for (U32 i = 0; i < pAssimpScene->mNumMeshes; ++i)
+  {
+    // Point and line meshes are split apart by aiProcess_SortByPType
+    const aiMesh* pAssimpMesh = pAssimpScene->mMeshes[i];
+    if (pAssimpMesh->mPrimitiveTypes != aiPrimitiveType_TRIANGLE) continue;
+
+    const U32 baseIndex = static_cast<U32>(meshBuffer.positionList.GetCount());
+    for (U32 j = 0; j < pAssimpMesh->mNumVertices; ++j)
+    {
+      const aiVector3D& position = pAssimpMesh->mVertices[j];
+      const aiVector3D& normal = pAssimpMesh->mNormals[j];
+      meshBuffer.positionList.PushBack(Vector3f(position.x, position.y, position.z));
+      meshBuffer.normalList.PushBack(Vector3f(normal.x, normal.y, normal.z));
+      if (hasTexCoords) meshBuffer.texCoordList.PushBack(Vector2f(pAssimpMesh->mTextureCoords[0][j].x, pAssimpMesh->mTextureCoords[0][j].y));
+    }
+    for (U32 j = 0; j < pAssimpMesh->mNumFaces; ++j)
+    {
+      const aiFace& face = pAssimpMesh->mFaces[j];
+      for (U32 k = 0; k < face.mNumIndices; ++k) meshBuffer.indexList.PushBack(baseIndex + face.mIndices[k]);
+    }
+  }
+
+  return !meshBuffer.indexList.IsEmpty();
+}
+
+void Graphics::Scene::MeshHelper::PackVertices(void* pVertices, const Graphics::Scene::MeshBuffer& meshBuffer, IMesh::VertexType vertexType, U32 meshID)
+{
+  const size_t vertexCount = meshBuffer.positionList.GetCount();
+  if (vertexCount == 0) return;
+
+  switch (vertexType)
+  {
+  case IMesh::eVertexTypePosition: 
+    PackVertexPositions<PositionColorVertex>(pVertices, meshBuffer, meshID);
+    break;
+  case IMesh::eVertexTypePositionTexture:
+    {
+      CompressedPositionTextureVertex* pVertexArray = PackVertexPositions<CompressedPositionTextureVertex>(pVertices, meshBuffer, meshID);
+      Math::Batch::ConvertToHalf(&pVertexArray[0].texCoord.x, sizeof(CompressedPositionTextureVertex), &meshBuffer.texCoordList[0].x, sizeof(Vector2f), 2, vertexCount);
+    }
+    break;
+  case IMesh::eVertexTypePositionNormal:
+    {
+      CompressedPositionNormalVertex* pVertexArray = PackVertexPositions<CompressedPositionNormalVertex>(pVertices, meshBuffer, meshID);
+      Math::Batch::ConvertToHalf(&pVertexArray[0].normal.x, sizeof(CompressedPositionNormalVertex), &meshBuffer.normalList[0].x, sizeof(Vector3f), 3, vertexCount);
+    }
+    break;
+  case IMesh::eVertexTypePositionTextureNormal:
+    {
+      CompressedPositionTextureNormalVertex* pVertexArray = PackVertexPositions<CompressedPositionTextureNormalVertex>(pVertices, meshBuffer, meshID);
+      Math::Batch::ConvertToHalf(&pVertexArray[0].texCoord.x, sizeof(CompressedPositionTextureNormalVertex), &meshBuffer.texCoordList[0].x, sizeof(Vector2f), 2, vertexCount);
+      Math::Batch::ConvertToHalf(&pVertexArray[0].normal.x, sizeof(CompressedPositionTextureNormalVertex), &meshBuffer.normalList[0].x, sizeof(Vector3f), 3, vertexCount);
+    }
+    break;
+  default:
+    E_ASSERT_ALWAYS(E_ASSERT_MSG_MESH_HELPER_VERTEX_TYPE_HANDLER_MISSING);
+  }
+}
+
 
 /*----------------------------------------------------------------------------------------------------------------------
 Auxiliary methods
@@ -344,3 +548,37 @@ void BuildCylinderTopCap(Graphics::Scene::MeshBuffer& meshBuffer, F32 radius, F3
 		meshBuffer.indexList.PushBack(baseIndex + i);
 	}
 }
+
+template <typename T>
+void RemapVertexList(Containers::List<T>& vertexList, const U32* pRemap, U32 uniqueVertexCount)
+{
+  if (vertexList.IsEmpty()) return;
+
+  Containers::List<T> remappedList(uniqueVertexCount);
+  remappedList.SetCount(uniqueVertexCount);
+  Math::MeshOptimizer::RemapVertices(remappedList.GetPtr(), vertexList.GetPtr(), static_cast<U32>(vertexList.GetCount()), pRemap);
+  // Remapped lists never grow (unreferenced vertices are dropped)
+  Memory::Copy(vertexList.GetPtr(), remappedList.GetPtr(), uniqueVertexCount);
+  vertexList.SetCount(uniqueVertexCount);
+}
+
+void RemapVertexLists(Graphics::Scene::MeshBuffer& meshBuffer, const U32* pRemap, U32 uniqueVertexCount)
+{
+  RemapVertexList(meshBuffer.positionList, pRemap, uniqueVertexCount);
+  RemapVertexList(meshBuffer.texCoordList, pRemap, uniqueVertexCount);
+  RemapVertexList(meshBuffer.normalList, pRemap, uniqueVertexCount);
+  RemapVertexList(meshBuffer.tangentList, pRemap, uniqueVertexCount);
+  RemapVertexList(meshBuffer.colorList, pRemap, uniqueVertexCount);
+}
+
+template <typename T>
+T* PackVertexPositions(void* pVertices, const Graphics::Scene::MeshBuffer& meshBuffer, U32 meshID)
+{
+  T* pVertexArray = static_cast<T*>(pVertices);
+  for (size_t i = 0; i < meshBuffer.positionList.GetCount(); ++i)
+  {
+    pVertexArray[i].position = meshBuffer.positionList[i];
+    pVertexArray[i].meshID = meshID;
+  }
+  return pVertexArray;
+}
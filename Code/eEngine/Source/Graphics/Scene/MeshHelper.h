@@ -50,6 +50,17 @@ namespace MeshHelper
   void CreateQuad(Graphics::Scene::MeshBuffer& meshBuffer, F32 width, F32 height);
   void CreateSphere(Graphics::Scene::MeshBuffer& meshBuffer, F32 radius, U32 sliceCount, U32 stackCount);
   void CreateTriangle(Graphics::Scene::MeshBuffer& meshBuffer, F32 length);
+  // Welds identical vertices and reorders triangles (vertex cache & overdraw) and vertices (fetch) of a triangle list
+  Math::MeshOptimizer::VertexCacheStatistics Optimize(Graphics::Scene::MeshBuffer& meshBuffer, U32 cacheSize = Math::MeshOptimizer::kDefaultCacheSize);
+  // Appends up to lodCount - 1 simplified index ranges (each one halving the previous one) to an optimized mesh
+  U32 GenerateLods(Graphics::Scene::MeshBuffer& meshBuffer, U32 lodCount, F32 targetError = 0.05f, U32 cacheSize = Math::MeshOptimizer::kDefaultCacheSize);
+  // Returns the size of the (compressed) Vertex.h layout used for a vertex type
+  size_t GetVertexSize(IMesh::VertexType vertexType);
+  // Imports and merges the triangle meshes of a model file (any format supported by assimp)
+  bool Import(Graphics::Scene::MeshBuffer& meshBuffer, const FilePath& filePath);
+  // Packs the mesh vertices into a vertex type layout array (pVertices requires GetVertexSize(vertexType) * vertex count bytes,
+  // zeroed beforehand as fields without mesh data, e.g. the vertex color or the half normal w, are not written)
+  void PackVertices(void* pVertices, const Graphics::Scene::MeshBuffer& meshBuffer, IMesh::VertexType vertexType, U32 meshID);
 }
 }
 }
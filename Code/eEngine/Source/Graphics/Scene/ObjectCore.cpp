@@ -60,6 +60,8 @@ Graphics::Scene::ObjectCore::ObjectCore(IObject* pOwner)
 : //mRenderCommand()
  mScale(1.0f, 1.0f, 1.0f)
 , mOwner(pOwner)
+, mLocalMatrixDirtyFlag(true)
+, mWorldMatrixChangedFlag(false)
 {
 //  mRenderCommand.pipelineState = Graphics::Global::GetRenderManager()->GetDefaultRenderState();
 }
@@ -68,7 +70,12 @@ Graphics::Scene::ObjectCore::ObjectCore(IObject* pOwner)
 ObjectCore accessors
 ----------------------------------------------------------------------------------------------------------------------*/
 
-const Graphics::Scene::IObjectInstanceList& Graphics::Scene::ObjectCore::GetChildrenList() const
+const Box3f& Graphics::Scene::ObjectCore::GetBounds() const
+{
+  return mBounds;
+}
+
+const Graphics::Scene::IObjectChildrenList& Graphics::Scene::ObjectCore::GetChildrenList() const
 {
   return mChildrenList;
 }
@@ -101,6 +108,12 @@ const Vector3f&	Graphics::Scene::ObjectCore::GetPosition() const
 {
   return mPosition;
 }
+
+const Quatf& Graphics::Scene::ObjectCore::GetRotation() const
+{
+  return mRotation;
+}
+
 /*
 const Graphics::RenderCommand& Graphics::Scene::ObjectCore::GetRenderCommand() const
 {
@@ -127,10 +140,23 @@ const Matrix4f& Graphics::Scene::ObjectCore::GetWorldMatrix() const
   return mWorldMatrix;
 }
 
+bool Graphics::Scene::ObjectCore::IsWorldMatrixChanged() const
+{
+  return mWorldMatrixChangedFlag;
+}
+
+void Graphics::Scene::ObjectCore::SetLocalBounds(const Box3f& bounds)
+{
+  mLocalBounds = bounds;
+  // Force a bounds update on the next Update
+  mLocalMatrixDirtyFlag = true;
+}
+
 void Graphics::Scene::ObjectCore::SetOrientation(const Vector3f& v)
 {
   mOrientation = v;
   ClampOrientationAngles(mOrientation);
+  UpdateRotation();
 }
 
 void Graphics::Scene::ObjectCore::SetParent(const IObjectInstance& parent)
@@ -139,7 +165,7 @@ void Graphics::Scene::ObjectCore::SetParent(const IObjectInstance& parent)
   bool validOperation = false;
   if (parent)
   {
-    IObjectInstanceList childrenList = parent->GetChildrenList();
+    const IObjectChildrenList& childrenList = parent->GetChildrenList();
     for (auto it = begin(childrenList); it != end(childrenList); ++it)
     {
       if (mOwner == (*it).GetPtr())
@@ -152,7 +178,7 @@ void Graphics::Scene::ObjectCore::SetParent(const IObjectInstance& parent)
   else
   {
     validOperation = true;
-    IObjectInstanceList childrenList = mParent->GetChildrenList();
+    const IObjectChildrenList& childrenList = mParent->GetChildrenList();
     for (auto it = begin(childrenList); it != end(childrenList); ++it)
     {
       if (mOwner == (*it).GetPtr())
@@ -165,16 +191,26 @@ void Graphics::Scene::ObjectCore::SetParent(const IObjectInstance& parent)
   E_ASSERT_MSG(validOperation, E_ASSERT_MSG_SCENE_OBJECT_CORE_MANUAL_PARENT_SET);
   #endif
   mParent = parent;
+  // The world matrix depends on the parent
+  mLocalMatrixDirtyFlag = true;
 }
 
 void Graphics::Scene::ObjectCore::SetPosition(const Vector3f& v)
 {
   mPosition = v;
+  mLocalMatrixDirtyFlag = true;
+}
+
+void Graphics::Scene::ObjectCore::SetRotation(const Quatf& q)
+{
+  mRotation = q;
+  mLocalMatrixDirtyFlag = true;
 }
 
 void Graphics::Scene::ObjectCore::SetScale(const Vector3f& v)
 {
   mScale = v;
+  mLocalMatrixDirtyFlag = true;
 }
 
 void Graphics::Scene::ObjectCore::SetTag(const String& tag)
@@ -204,7 +240,9 @@ void Graphics::Scene::ObjectCore::ClearTransform()
 {
   mPosition.SetZero();
   mOrientation.SetZero();
+  mRotation.SetIdentity();
   mScale.Set(1.0f);
+  mLocalMatrixDirtyFlag = true;
 }
 
 void Graphics::Scene::ObjectCore::Load()
@@ -260,16 +298,29 @@ void Graphics::Scene::ObjectCore::Rotate(const Vector3f& v)
 {
   mOrientation += v;
   ClampOrientationAngles(mOrientation);
+  UpdateRotation();
+}
+
+void Graphics::Scene::ObjectCore::Rotate(const Quatf& q)
+{
+  // Apply q after the current rotation (row vectors: current rotation matrix * q rotation matrix)
+  Quatf rotation(q);
+  mRotation = rotation * mRotation;
+  // Prevent drift when composing many rotations
+  mRotation.Normalize();
+  mLocalMatrixDirtyFlag = true;
 }
 
 void Graphics::Scene::ObjectCore::Scale(const Vector3f& v)
 {
   mScale *= v;
+  mLocalMatrixDirtyFlag = true;
 }
 
 void Graphics::Scene::ObjectCore::Translate(const Vector3f& v)
 {
   mPosition += v;
+  mLocalMatrixDirtyFlag = true;
 }
 
 void Graphics::Scene::ObjectCore::Unload()
@@ -284,9 +335,14 @@ void Graphics::Scene::ObjectCore::Unload()
 
 void Graphics::Scene::ObjectCore::Update(const TimeValue& deltaTime)
 {
-  // Update local  and world matrices
-  UpdateLocalMatrix();
-  mWorldMatrix = (mParent) ? mLocalMatrix * mParent->GetWorldMatrix() : mLocalMatrix;
+  // Update local and world matrices (and bounds) only if the local or the parent world matrix changed
+  mWorldMatrixChangedFlag = mLocalMatrixDirtyFlag || (mParent && mParent->IsWorldMatrixChanged());
+  if (mWorldMatrixChangedFlag)
+  {
+    if (mLocalMatrixDirtyFlag) UpdateLocalMatrix();
+    mWorldMatrix = (mParent) ? mLocalMatrix * mParent->GetWorldMatrix() : mLocalMatrix;
+    UpdateBounds();
+  }
   // Trigger component update
   for (auto it = begin(mComponentList); it != end(mComponentList); ++it) (*it)->OnUpdate(deltaTime);
   // Update children
@@ -297,20 +353,35 @@ void Graphics::Scene::ObjectCore::Update(const TimeValue& deltaTime)
 ObjectCore private methods
 ------------------------------------------------------------------------------------------------------------------------*/
 
+void Graphics::Scene::ObjectCore::UpdateBounds()
+{
+  if (mLocalBounds.IsEmpty())
+  {
+    Vector3f position = mWorldMatrix.GetTranslation();
+    mBounds = Box3f(position, position);
+  }
+  else
+  {
+    mBounds = mLocalBounds;
+    mBounds.Transform(mWorldMatrix);
+  }
+}
+
 void Graphics::Scene::ObjectCore::UpdateLocalMatrix()
 {
   // Transformation order is SRT which in row major / row vectors is :
   // scaleMatrix * rotationMatrix * translationMatrix
-  Quatf qRotation;
-  qRotation.SetRotation(Vector3f(
+  mRotation.GetTransform(mLocalMatrix, mScale, mPosition);
+  mLocalMatrixDirtyFlag = false;
+}
+
+void Graphics::Scene::ObjectCore::UpdateRotation()
+{
+  mRotation.SetRotation(Vector3f(
     Math::Rad(mOrientation.x),
     Math::Rad(mOrientation.y),
     Math::Rad(mOrientation.z)));
-  qRotation.GetRotation(mLocalMatrix);
-  // Update translation
-  mLocalMatrix.SetTranslation(mPosition);
-  // Update scaling
-  if (mScale != 1.0f) mLocalMatrix.Scale(mScale);
+  mLocalMatrixDirtyFlag = true;
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
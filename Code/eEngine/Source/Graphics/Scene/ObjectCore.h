@@ -40,19 +40,23 @@ This file declares the ObjectCore class.
 E_GRAPHICS_DEFINE_SCENE_OBJECT_COMMON (class definition helper)
 ----------------------------------------------------------------------------------------------------------------------*/
 #define E_GRAPHICS_DEFINE_SCENE_OBJECT_COMMON(objectTypeID, core) \
-  const IObjectInstanceList&          GetChildrenList() const                                   { return core.GetChildrenList(); } \
+  const Box3f&                        GetBounds() const                                         { return core.GetBounds(); } \
+  const IObjectChildrenList&          GetChildrenList() const                                   { return core.GetChildrenList(); } \
   const IObjectComponentInstance&     GetComponent(IObjectComponent::ComponentType type) const  { return core.GetComponent(type); } \
   const IObjectComponentInstanceList& GetComponentList() const                                  { return core.GetComponentList(); } \
   IObject::ObjectType                 GetObjectType() const                                     { return objectTypeID; } \
   const Vector3f&	                    GetOrientation() const                                    { return core.GetOrientation(); } \
   const IObjectInstance&              GetParent() const                                         { return core.GetParent(); } \
   const Vector3f&	                    GetPosition() const                                       { return core.GetPosition(); } \
+  const Quatf&	                      GetRotation() const                                       { return core.GetRotation(); } \
   const Vector3f&                     GetScale() const                                          { return core.GetScale(); } \
   const String&			                  GetTag() const                                            { return core.GetTag(); } \
   const Matrix4f&			                GetWorldMatrix() const                                { return core.GetWorldMatrix(); } \
+  bool                                IsWorldMatrixChanged() const                              { return core.IsWorldMatrixChanged(); } \
   void			                          SetOrientation(const Vector3f& v)                         { core.SetOrientation(v); } \
   void			                          SetParent(const IObjectInstance& parent)                  { core.SetParent(parent); } \
   void			                          SetPosition(const Vector3f& v)                            { core.SetPosition(v); } \
+  void			                          SetRotation(const Quatf& q)                               { core.SetRotation(q); } \
   void			                          SetScale(const Vector3f& v)                               { core.SetScale(v); } \
   void							                  SetTag(const String& tag)                                 { core.SetTag(tag); } \
   void							                  AddChild(const IObjectInstance& child)                          { core.AddChild(child); } \
@@ -63,6 +67,7 @@ E_GRAPHICS_DEFINE_SCENE_OBJECT_COMMON (class definition helper)
   void							                  RemoveComponent(IObjectComponent::ComponentType type)     { core.RemoveComponent(type); } \
   void					                      RemoveComponents()                                        { core.RemoveComponents(); } \
   void			                          Rotate(const Vector3f& v)                                 { core.Rotate(v); } \
+  void			                          Rotate(const Quatf& q)                                    { core.Rotate(q); } \
   void			                          Scale(const Vector3f& v)                                  { core.Scale(v); } \
   void			                          Translate(const Vector3f& v)                              { core.Translate(v); } \
 
@@ -81,6 +86,11 @@ Please note that this class has the following usage contract:
 2. ObjectCore uses SetParent to track parent-child relationships however, this method should not be used by client 
 code. AddChild / RemoveChild / RemoveChildren should be used for that purpose instead (ObjectCore will assert 
 otherwise).
+3. The local matrix is only rebuilt on Update when the position, rotation or scale changed since the previous update.
+Euler orientations are converted to a quaternion when set, so there are no trigonometric evaluations per frame.
+4. The world matrix and bounds are only recomputed on Update when the local matrix or the parent world matrix changed.
+The parent is expected to be updated before its children (ObjectCore updates the children after its owner). Objects
+without local bounds (see SetLocalBounds) are bounded by their world position.
 ----------------------------------------------------------------------------------------------------------------------*/
 class ObjectCore
 {
@@ -88,18 +98,23 @@ public:
   ObjectCore(IObject* pOwner);
 
   // Accessors
-  const IObjectInstanceList&           GetChildrenList() const;
+  const IObjectChildrenList&           GetChildrenList() const;
   const IObjectComponentInstance&      GetComponent(IObjectComponent::ComponentType type) const;
+  const Box3f&                              GetBounds() const;
   const IObjectComponentInstanceList&  GetComponentList() const;
   const Vector3f&	                          GetOrientation() const;
   const IObjectInstance&               GetParent() const;
   const Vector3f&	                          GetPosition() const;
+  const Quatf&                              GetRotation() const;
   const Vector3f&                           GetScale() const;
   const String&				                      GetTag() const;
   const Matrix4f&                           GetWorldMatrix() const;
+  bool                                      IsWorldMatrixChanged() const;
+  void                                      SetLocalBounds(const Box3f& bounds);
   void			                                SetOrientation(const Vector3f& v);
   void                                      SetParent(const IObjectInstance& parent);
   void			                                SetPosition(const Vector3f& v);
+  void                                      SetRotation(const Quatf& q);
   void			                                SetScale(const Vector3f& v);
   void							                        SetTag(const String& tag);
 
@@ -114,6 +129,7 @@ public:
   void					                            RemoveComponents();
   void					                            RenderChildren();
   void			                                Rotate(const Vector3f& v);
+  void			                                Rotate(const Quatf& q);
   void			                                Scale(const Vector3f& v);
   void			                                Translate(const Vector3f& v);      
   void			                                Unload();
@@ -125,15 +141,22 @@ private:
   String						                  mTag;
   Matrix4f                            mLocalMatrix;
   Matrix4f                            mWorldMatrix;
+  Box3f                               mLocalBounds;
+  Box3f                               mBounds;
   Vector3f		                        mPosition;
   Vector3f		                        mOrientation;
+  Quatf                               mRotation;
   Vector3f				                    mScale;
-  IObjectInstanceList            mChildrenList;
+  IObjectChildrenList            mChildrenList;
   IObjectComponentInstanceList   mComponentList;
   IObjectStaticPtr               mOwner;
   IObjectInstance                mParent;
+  bool                                mLocalMatrixDirtyFlag;
+  bool                                mWorldMatrixChangedFlag;
 
+  void                                UpdateBounds();
   void                                UpdateLocalMatrix();
+  void                                UpdateRotation();
 
   E_DISABLE_COPY_AND_ASSSIGNMENT(ObjectCore)
 }; 
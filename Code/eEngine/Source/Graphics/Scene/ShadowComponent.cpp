@@ -113,6 +113,6 @@ void Graphics::Scene::ShadowComponent::OnUnload()
 void Graphics::Scene::ShadowComponent::OnUpdate(const TimeValue& deltaTime)
 {
   mLightCamera->SetPosition(mOwner->GetPosition());
-  mLightCamera->SetOrientation(mOwner->GetOrientation());
+  mLightCamera->SetRotation(mOwner->GetRotation());
   mLightCamera->Update(deltaTime);
 }
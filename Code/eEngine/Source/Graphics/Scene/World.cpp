@@ -42,11 +42,21 @@ World assertion messages
 #define E_ASSERT_MSG_WORLD_OBJECT_LOADED              "Parameter object is already loaded"
 #define E_ASSERT_MSG_WORLD_OBJECT_NOT_LOADED          "Parameter object is not loaded"
 
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+// Spatial index root cell (objects outside it are still indexed, although not subdivided)
+const F32 kWorldOctreeHalfSize = 4096.0f;
+const U32 kWorldOctreeDepth = 8;
+
 /*----------------------------------------------------------------------------------------------------------------------
 World initialization & finalization
 ----------------------------------------------------------------------------------------------------------------------*/
 
-Graphics::Scene::World::World() {}
+Graphics::Scene::World::World()
+{
+  for (U32 i = 0; i < IObject::eObjectTypeCount; ++i) mObjectOctree[i].Reset(Vector3f(), kWorldOctreeHalfSize, kWorldOctreeDepth);
+}
 
 /*----------------------------------------------------------------------------------------------------------------------
 World accessors
@@ -62,10 +72,13 @@ World methods
 ----------------------------------------------------------------------------------------------------------------------*/
 void Graphics::Scene::World::Load(const IObjectInstance& object)
 {
-  if (mWorldState.objectList[object->GetObjectType()].FindValue(object) == nullptr)
+  if (!mObjectHandleMap.HasKey(object.GetPtr()))
   {
     object->Load();
-    mWorldState.objectList[object->GetObjectType()].PushBack(object);
+    ObjectHandle handle;
+    handle.stateHandle = mWorldState.objectList[object->GetObjectType()].Insert(object);
+    handle.octreeHandle = mObjectOctree[object->GetObjectType()].Insert(object, object->GetBounds());
+    mObjectHandleMap.Insert(object.GetPtr(), handle);
   }
   else
   {
@@ -75,23 +88,48 @@ void Graphics::Scene::World::Load(const IObjectInstance& object)
   }
 }
 
+void Graphics::Scene::World::Query(IObject::ObjectType type, const Box3f& box, IObjectInstanceList& result) const
+{
+  mObjectOctree[type].Query(box, result);
+}
+
+void Graphics::Scene::World::Query(IObject::ObjectType type, const Spheref& sphere, IObjectInstanceList& result) const
+{
+  mObjectOctree[type].Query(sphere, result);
+}
+
+void Graphics::Scene::World::Query(IObject::ObjectType type, const Frustum& frustum, IObjectInstanceList& result) const
+{
+  mObjectOctree[type].Query(frustum.GetPlanes(), Frustum::ePlaneCount, result);
+}
+
 void Graphics::Scene::World::Unload()
 {
   for (U32 i = 0; i < IObject::eObjectTypeCount; ++i)
   {
     for (auto it = begin(mWorldState.objectList[i]); it != end(mWorldState.objectList[i]); ++it) (*it)->Unload();
     mWorldState.objectList[i].Clear();
+    mObjectOctree[i].Clear();
   }
+  mObjectHandleMap.Clear();
 }
 
 void Graphics::Scene::World::Unload(const IObjectInstance& object)
 {
+  ObjectHandleMap::Pair* pPair = mObjectHandleMap.FindPair(object.GetPtr());
+  if (pPair)
+  {
+    mWorldState.objectList[object->GetObjectType()].Remove(pPair->second.stateHandle);
+    mObjectOctree[object->GetObjectType()].Remove(pPair->second.octreeHandle);
+    mObjectHandleMap.RemovePair(pPair);
+    object->Unload();
+  }
+  else
+  {
 #ifdef E_DEBUG
-  E_ASSERT_MSG(mWorldState.objectList[object->GetObjectType()].RemoveIfFast(object), E_ASSERT_MSG_WORLD_OBJECT_NOT_LOADED);
-#else
-  mWorldState.objectList[object->GetObjectType()].RemoveIfFast(object);
-  object->Unload();
+    E_ASSERT_ALWAYS(E_ASSERT_MSG_WORLD_OBJECT_NOT_LOADED);
 #endif
+  }
 }
 
 void Graphics::Scene::World::Update(const TimeValue& deltaTime)
@@ -101,4 +139,17 @@ void Graphics::Scene::World::Update(const TimeValue& deltaTime)
   {
     for (auto it = begin(mWorldState.objectList[i]); it != end(mWorldState.objectList[i]); ++it) (*it)->Update(deltaTime);
   }
+
+  // Update the spatial index of moved objects (once all of them are updated, as children are updated by their parents)
+  for (U32 i = 0; i < IObject::eObjectTypeCount; ++i)
+  {
+    for (auto it = begin(mWorldState.objectList[i]); it != end(mWorldState.objectList[i]); ++it)
+    {
+      if ((*it)->IsWorldMatrixChanged())
+      {
+        const ObjectHandleMap::Pair* pPair = mObjectHandleMap.FindPair(it->GetPtr());
+        mObjectOctree[i].Update(pPair->second.octreeHandle, (*it)->GetBounds());
+      }
+    }
+  }
 }
@@ -51,12 +51,26 @@ public:
 
   // Methods
   void				        Load(const IObjectInstance& object);
+  void                Query(IObject::ObjectType type, const Box3f& box, IObjectInstanceList& result) const;
+  void                Query(IObject::ObjectType type, const Spheref& sphere, IObjectInstanceList& result) const;
+  void                Query(IObject::ObjectType type, const Frustum& frustum, IObjectInstanceList& result) const;
   void                Unload();
   void				        Unload(const IObjectInstance& object);
   void                Update(const TimeValue& deltaTime);
   
 private:
+  struct ObjectHandle
+  {
+    Containers::SlotMapHandle stateHandle;
+    Containers::SlotMapHandle octreeHandle;
+  };
+
+  typedef Containers::Map<const IObject*, ObjectHandle> ObjectHandleMap;
+  typedef Math::LooseOctree<IObjectInstance>            ObjectOctree;
+
   WorldState          mWorldState;
+  ObjectHandleMap     mObjectHandleMap;
+  ObjectOctree        mObjectOctree[IObject::eObjectTypeCount];
 
   E_DISABLE_COPY_AND_ASSSIGNMENT(World)
 };
@@ -43,7 +43,9 @@ This file defines includes all the headers required by the Engine test applicati
 #include <Application/Application.h>
 #include <Application/InputManager.h>
 #include <Assertion/Exception.h>
+#include <FileSystem/DerivedDataCache.h>
 #include <FileSystem/File.h>
+#include <FileSystem/VirtualFileSystem.h>
 #include <Math/Matrix4.h>
 #include <Math/Quaternion.h>
 #include <Math/Projection.h>
@@ -93,6 +95,7 @@ This file defines includes all the headers required by the Engine test applicati
 #include "LightSpotSample.h"
 #include "LightSpotShadowSample.h"
 #include "LightShadowSample.h"
+#include "LodSample.h"
 
 /*----------------------------------------------------------------------------------------------------------------------
 [EngineTest]
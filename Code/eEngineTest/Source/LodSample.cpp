@@ -0,0 +1,121 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Engine
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file LodSample.cpp
+This file defines the LodSample class. A field of high resolution spheres is rendered with level of detail selection
+enabled or disabled (L key) and the drawn triangle count and average frame time are sent to the debug output every
+second.
+*/
+
+#include <EngineTestPch.h>
+
+using namespace E;
+using namespace E::Graphics::Scene;
+
+/*----------------------------------------------------------------------------------------------------------------------
+LodSample methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void LodSample::Load(IViewInstance window)
+{
+  mView = window;
+
+  // Create elements
+  mCamera = mSceneManager->CreateObject(IObject::eObjectTypeCamera);
+  
+  mCamera->Translate(Vector3f(0.0f, 20.0f, -60.0f));
+  ILogicComponentInstance cameraLogicComponent = mSceneManager->CreateComponent(IObjectComponent::eComponentTypeLogic);
+  mCameraHandler.SetCamera(mCamera);
+  mCameraHandler.SetSpeed(100.0f);
+  mCameraHandler.SetSensitivity(0.015f);
+  cameraLogicComponent->SetHandler(mCameraHandlerOwner);
+  mCamera->AddComponent(cameraLogicComponent);
+  mView->SetCamera(mCamera);
+  
+  // Spheres get further from the camera row by row
+  U32 rowCount = 16;
+  U32 colCount = 16;
+  F32 offset = 20.0f;
+  F32 offsetX = -offset * (colCount - 1) * 0.5f;
+  
+  IMaterialInstance sphereMaterial = mSceneManager->CreateMaterial();
+  sphereMaterial->SetDiffuseColor(Graphics::Color(0.85f, 0.0f, 0.0f));
+  for (U32 i = 0; i < colCount; ++i)
+  {
+    for (U32 j = 0; j < rowCount; ++j)
+    {
+      IMeshInstance sphere = mSceneManager->CreateObject(IObject::eObjectTypeMesh);
+      sphere->CreateSphere(6.0f, 128, 128);
+      sphere->GenerateLods(8);
+      sphere->SetLodEnabled(mLodEnabled);
+      sphere->Translate(Vector3f(offsetX + i * offset, 0.0f, j * offset));
+      sphere->SetMaterial(sphereMaterial);
+      mSceneManager->GetWorld()->Load(sphere);
+      mMeshList.PushBack(sphere);
+    }
+  }
+
+  mTimer.Reset();
+  mFrameCount = 0;
+}
+
+void LodSample::Unload()
+{
+  mMeshList.Clear();
+  SampleBase::Unload();
+}
+
+void LodSample::Update()
+{
+  // Toggle level of detail selection
+  bool lodKeyDown = mInputManager.IsKeyDown('L');
+  if (lodKeyDown && !mLodKeyDown)
+  {
+    mLodEnabled = !mLodEnabled;
+    for (size_t i = 0; i < mMeshList.GetCount(); ++i) mMeshList[i]->SetLodEnabled(mLodEnabled);
+    mTimer.Reset();
+    mFrameCount = 0;
+  }
+  mLodKeyDown = lodKeyDown;
+
+  // Report the triangles drawn in the last frame and the average frame time
+  ++mFrameCount;
+  if (mTimer.GetElapsed().GetMilliseconds() >= 1000.0)
+  {
+    U32 triangleCount = 0;
+    for (size_t i = 0; i < mMeshList.GetCount(); ++i) triangleCount += mMeshList[i]->GetTriangleCount();
+
+    StringBuffer sb;
+    sb << "[LodSample] lod " << (mLodEnabled ? "enabled" : "disabled") << ": " << triangleCount << " triangles, " <<
+      mTimer.GetElapsed().GetMilliseconds() / mFrameCount << " ms per frame\n";
+    E_DEBUG_OUTPUT(sb.GetPtr());
+
+    mTimer.Reset();
+    mFrameCount = 0;
+  }
+}
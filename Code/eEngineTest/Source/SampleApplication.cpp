@@ -46,6 +46,7 @@ SampleApplication::SampleApplication()
 SampleApplication::~SampleApplication()
 {
   mSceneManager->Finalize();
+  FileSystem::Global::GetDerivedDataCache().Close();
 }
 
 void SampleApplication::Initialize(U32 width, U32 height)
@@ -56,6 +57,11 @@ void SampleApplication::Initialize(U32 width, U32 height)
   renderSettings.shaderFolder = "Shaders\\";
   renderSettings.textureFolder = "Textures\\";
   renderSettings.verticalSync = true;
+  // Data is read from the data pack file when there is one (see ePacker), from loose files otherwise
+  FileSystem::Global::GetVirtualFileSystem().Mount("..\\..\\..\\Data.epk", renderSettings.dataRootDirectory);
+  // Processed data (imported meshes and compiled shaders) is kept in the derived data cache, so only the first run
+  // (or a run after the data changes) does the processing.
+  FileSystem::Global::GetDerivedDataCache().Open("..\\..\\..\\Cache", 256 << 20);
 
   // Initialize scene manager
   mSceneManager->Initialize();
@@ -94,6 +100,7 @@ void SampleApplication::Initialize(U32 width, U32 height)
   mSampleList.PushBack(&mLightSpotSample);
   mSampleList.PushBack(&mLightSpotShadowSample);
   mSampleList.PushBack(&mLightShadowSample);
+  mSampleList.PushBack(&mLodSample);
 
   // Load start sample
   E_ASSERT(mCurrentSampleIndex < mSampleList.GetCount());
@@ -69,6 +69,7 @@ namespace E
     LightSpotSample                   mLightSpotSample;
     LightSpotShadowSample             mLightSpotShadowSample;
     LightShadowSample            mLightShadowSample;
+    LodSample                         mLodSample;
     // Callback methods
     void                                  OnEvent(const Application::FocusEvent& event);
     void                                  OnEvent(const Application::FocusLostEvent& event);
@@ -40,7 +40,9 @@ This file defines includes all the headers required by the GpuDevice library for
 #include <Base.h>
 #include <Assertion/Assert.h>
 #include <Containers/DynamicArray.h>
+#include <FileSystem/DerivedDataCache.h>
 #include <FileSystem/File.h>
+#include <FileSystem/VirtualFileSystem.h>
 #include <Memory/GarbageCollection.h>
 #include <Singleton.h>
 #include <Text/String.h>
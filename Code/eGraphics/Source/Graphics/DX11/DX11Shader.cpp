@@ -30,7 +30,6 @@ This file defines the DX11Shader class.
 #include <GraphicsPch.h>
 #include "DX11Shader.h"
 #include "DX11Core.h"
-#include <fstream>
 
 using namespace E;
 
@@ -79,18 +78,11 @@ public:
     FileSystem::Path filePath = mRootDirectory;
     if (filePath.GetLength()) filePath.Append("\\", 1);
     filePath.Append(pFileName, Text::GetLength(pFileName));
-    // Retrieve file info
-    if (!FileSystem::File::GetInfo(filePath.GetPtr(), mFileInfo)) return S_FALSE;
-    // Read file
-    std::ifstream ifstream(filePath.GetPtr(), std::ios::in);
-    E_ASSERT(ifstream.is_open());
-    mFileData.Reserve(mFileInfo.byteSize);
-    ifstream.read(mFileData.GetPtr(), mFileInfo.byteSize);
-    E_ASSERT(ifstream.gcount() <= Math::NumericLimits<U32>::Max());
-    U32 readSize = static_cast<U32>(ifstream.gcount());
-    mFileData[readSize] = 0;
+    // Read file (from a mounted pack file if packed)
+    if (!FileSystem::Global::GetVirtualFileSystem().Read(filePath, mFileData)) return S_FALSE;
+    E_ASSERT(mFileData.GetCount() <= Math::NumericLimits<U32>::Max());
     *ppData = mFileData.GetPtr();
-    *pBytes = readSize;
+    *pBytes = static_cast<U32>(mFileData.GetCount());
 
     return S_OK;
   }
@@ -99,8 +91,7 @@ public:
 
 private:
   FilePath                        mRootDirectory;
-  Containers::DynamicArray<char>  mFileData;
-  FileInfo                        mFileInfo;
+  Containers::List<Byte>          mFileData;
 } ;//gDX11ShaderIncludeHandler;
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -159,44 +150,83 @@ bool Graphics::DX11Shader::Initialize(const Descriptor& desc)
       StringBuffer shaderVersion(kHlslShaderVersionPrefixTable[i]);
       shaderVersion << mDescriptor.modelVersion << kHlslShaderVersionEnding;
 
-      // Compile shader file
+      // Compile shader file (read from a mounted pack file if packed)
       ID3D11Device* pDXDevice = GDXDevice;
       ID3D10Blob*	pCompiledShader = nullptr;
       ID3D10Blob*	pErrorMessage = nullptr;
+      const void* pByteCode = nullptr;
+      size_t byteCodeSize = 0;
+      Containers::List<Byte> shaderData;
+      Containers::List<Byte> cachedByteCode;
+      if (FileSystem::Global::GetVirtualFileSystem().Read(mDescriptor.stages[i].filePath, shaderData))
+      {
+        // Compiled shaders are kept in the derived data cache, keyed by the preprocessed shader (includes and macros
+        // resolved), the entry point and the shader version
+        FileSystem::DerivedDataCache& derivedDataCache = FileSystem::Global::GetDerivedDataCache();
+        ID3D10Blob* pPreprocessedShader = nullptr;
+        U64 cacheKey = 0;
+        const bool cached = derivedDataCache.IsOpen() && D3DPreprocess(
+          shaderData.GetPtr(),
+          shaderData.GetCount(),
+          mDescriptor.stages[i].filePath.GetPtr(),
+          dxShaderMacroList.GetPtr(),
+          &shaderIncludeHandle,
+          &pPreprocessedShader,
+          nullptr) == S_OK;
+        if (cached)
+        {
+          StringBuffer processing("DX11Shader|");
+          processing << mDescriptor.stages[i].entryPoint.GetPtr() << "|" << shaderVersion.GetPtr();
+          cacheKey = FileSystem::DerivedDataCache::GetKey(pPreprocessedShader->GetBufferPointer(), pPreprocessedShader->GetBufferSize(), processing.GetPtr());
+          Win32::ReleaseCom(pPreprocessedShader);
+          if (derivedDataCache.Get(cacheKey, cachedByteCode))
+          {
+            pByteCode = cachedByteCode.GetPtr();
+            byteCodeSize = cachedByteCode.GetCount();
+          }
+        }
+
+        if (pByteCode == nullptr && D3DCompile(
+          shaderData.GetPtr(),
+          shaderData.GetCount(),
+          mDescriptor.stages[i].filePath.GetPtr(),
+          dxShaderMacroList.GetPtr(),
+          &shaderIncludeHandle,
+          mDescriptor.stages[i].entryPoint.GetPtr(),
+          shaderVersion.GetPtr(),
+          0,
+          0,
+          &pCompiledShader,
+          &pErrorMessage) == S_OK)
+        {
+          pByteCode = pCompiledShader->GetBufferPointer();
+          byteCodeSize = pCompiledShader->GetBufferSize();
+          if (cached) derivedDataCache.Put(cacheKey, pByteCode, byteCodeSize);
+        }
+      }
 
-      WFilePath wfilePath;
-      Text::Utf8ToWide(wfilePath, mDescriptor.stages[i].filePath); 
-	  if (D3DCompileFromFile(
-		  wfilePath.GetPtr(),
-		  dxShaderMacroList.GetPtr(),
-		  &shaderIncludeHandle,
-		  mDescriptor.stages[i].entryPoint.GetPtr(),
-		  shaderVersion.GetPtr(),
-		  0,
-		  0,
-		  &pCompiledShader,
-		  &pErrorMessage) == S_OK)
+	    if (pByteCode)
 	    {
         HRESULT hr = 0;
         switch (i)
         {
         case eStageVertex:
-          hr = pDXDevice->CreateVertexShader(pCompiledShader->GetBufferPointer(), pCompiledShader->GetBufferSize(), nullptr, &mpDXVertexShader);
+          hr = pDXDevice->CreateVertexShader(pByteCode, byteCodeSize, nullptr, &mpDXVertexShader);
           break;
         case eStageHull:
-          hr = pDXDevice->CreateHullShader(pCompiledShader->GetBufferPointer(), pCompiledShader->GetBufferSize(), nullptr, &mpDXHullShader);
+          hr = pDXDevice->CreateHullShader(pByteCode, byteCodeSize, nullptr, &mpDXHullShader);
           break;
         case eStageDomain:
-          hr = pDXDevice->CreateDomainShader(pCompiledShader->GetBufferPointer(), pCompiledShader->GetBufferSize(), nullptr, &mpDXDomainShader);
+          hr = pDXDevice->CreateDomainShader(pByteCode, byteCodeSize, nullptr, &mpDXDomainShader);
           break;
         case eStageGeometry:
-          hr = pDXDevice->CreateGeometryShader(pCompiledShader->GetBufferPointer(), pCompiledShader->GetBufferSize(), nullptr, &mpDXGeometryShader);
+          hr = pDXDevice->CreateGeometryShader(pByteCode, byteCodeSize, nullptr, &mpDXGeometryShader);
           break;
         case eStagePixel:
-          hr = pDXDevice->CreatePixelShader(pCompiledShader->GetBufferPointer(), pCompiledShader->GetBufferSize(), nullptr, &mpDXPixelShader);
+          hr = pDXDevice->CreatePixelShader(pByteCode, byteCodeSize, nullptr, &mpDXPixelShader);
           break;
         case eStageCompute:
-          hr = pDXDevice->CreateComputeShader(pCompiledShader->GetBufferPointer(), pCompiledShader->GetBufferSize(), nullptr, &mpDXComputeShader);
+          hr = pDXDevice->CreateComputeShader(pByteCode, byteCodeSize, nullptr, &mpDXComputeShader);
           break;
         }
         E_ASSERT(hr == S_OK);
@@ -175,6 +175,13 @@ bool Graphics::DX11Texture2D::Initialize(const Descriptor& desc)
 
 bool Graphics::DX11Texture2D::Initialize(const FilePath& filePath)
 {
+  FileSystem::VirtualFileSystem& vfs = FileSystem::Global::GetVirtualFileSystem();
+  if (vfs.IsPacked(filePath))
+  {
+    Containers::List<Byte> data;
+    return vfs.Read(filePath, data) && CreateTexture2DFromMemory(data.GetPtr(), data.GetCount());
+  }
+
   WFilePath filePathWstr;
   Text::Utf8ToWide(filePathWstr, filePath);
   return CreateTexture2DFromFile(filePathWstr);
@@ -335,6 +342,25 @@ bool Graphics::DX11Texture2D::CreateTexture2DFromFile(const WFilePath& wfilePath
       return false;
   }
 
+  InitializeFileDescriptor();
+  return true;
+}
+
+bool Graphics::DX11Texture2D::CreateTexture2DFromMemory(const Byte* pData, size_t size)
+{
+  // Same as CreateTexture2DFromFile for file data already in memory (e.g. read from a pack file)
+  if (DirectX::CreateDDSTextureFromMemoryEx(GDXDevice, GDXDeviceContext, pData, size, 0, D3D11_USAGE_DEFAULT, D3D11_BIND_SHADER_RESOURCE, 0, 0, true, (ID3D11Resource**)&mpDXTexture, &mpDXShaderResourceView) != S_OK)
+  {
+    if (DirectX::CreateWICTextureFromMemoryEx(GDXDevice, GDXDeviceContext, pData, size, 0, D3D11_USAGE_DEFAULT, D3D11_BIND_SHADER_RESOURCE, 0, 0, true, (ID3D11Resource**)&mpDXTexture, &mpDXShaderResourceView) != S_OK)
+      return false;
+  }
+
+  InitializeFileDescriptor();
+  return true;
+}
+
+void Graphics::DX11Texture2D::InitializeFileDescriptor()
+{
   D3D11_TEXTURE2D_DESC dxTextureDesc;
   mpDXTexture->GetDesc(&dxTextureDesc);
   mDescriptor.type = ITexture2D::eTypeFile;
@@ -357,8 +383,6 @@ bool Graphics::DX11Texture2D::CreateTexture2DFromFile(const WFilePath& wfilePath
   E_ASSERT_MSG(
     mDescriptor.format != ITexture2D::eFormatCount, 
     E_ASSERT_MSG_DX11_TEXTURE_2D_FORMAT_UNKNOWN);
-
-  return true;
 }
 
 bool Graphics::DX11Texture2D::CreateTexture2DFromViewport(IViewportInstance viewport)
@@ -42,6 +42,7 @@ DX11Texture2D
 Please note that this set of macros has the following usage contract:
 
 1. File textures are not gamma corrected (the color value is linear not sRGB).
+2. File textures found in a mounted pack file (see FileSystem::VirtualFileSystem) are created from memory.
 ----------------------------------------------------------------------------------------------------------------------*/
 class DX11Texture2D : public ITexture2D
 {
@@ -70,9 +71,11 @@ private:
 
   bool                                CreateTexture2D(const Descriptor& desc);
   bool                                CreateTexture2DFromFile(const WFilePath& wfilePath);
+  bool                                CreateTexture2DFromMemory(const Byte* pData, size_t size);
   bool                                CreateTexture2DFromViewport(IViewportInstance viewport);
   bool                                CreateShaderResourceView(const Descriptor& desc);
   bool                                CreateUnorderedAccessView(const Descriptor& desc);
+  void                                InitializeFileDescriptor();
 
   E_DISABLE_COPY_AND_ASSSIGNMENT(DX11Texture2D);
 };
@@ -0,0 +1,151 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 18-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Main.cpp
+This file defines the eMeshConverter entry point. eMeshConverter converts model files (any format supported by assimp)
+into mesh files (see MeshFile) and benchmarks loading both of them.
+*/
+
+#include <Base.h>
+#include <FileSystem/MappedFile.h>
+#include <Time/Timer.h>
+#include <Graphics/Device.h>
+#include <Graphics/Render.h>
+#include <Graphics/Scene/MeshFile.h>
+#include <iostream>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+
+static const char kMeshConverterUsage[] = "Usage: eMeshConverter [-lods <count>] [-benchmark] <source file> [<target file>]";
+static const char kMeshConverterBenchmarkFilePath[] = "..\\..\\..\\Data\\Models\\Fokker\\fokker.obj";
+static const U32  kMeshConverterBenchmarkRunCount = 10;
+
+static void MeshConverterBenchmark(const FilePath& sourceFilePath, const FilePath& targetFilePath, U32 lodCount)
+{
+  E::Time::Timer t;
+  std::cout << "[MeshConverter::Benchmark] " << sourceFilePath.GetPtr() << std::endl;
+
+  // Model file: assimp import, welding and optimization (what Mesh::CreateFromFile does for model files)
+  U32 vertexCount = 0;
+  t.Reset();
+  for (U32 i = 0; i < kMeshConverterBenchmarkRunCount; ++i)
+  {
+    Graphics::Scene::MeshBuffer meshBuffer;
+    if (!Graphics::Scene::MeshFile::Import(meshBuffer, sourceFilePath, lodCount)) return;
+    vertexCount = static_cast<U32>(meshBuffer.positionList.GetCount());
+  }
+  const D64 importTime = t.GetElapsed().GetMilliseconds() / kMeshConverterBenchmarkRunCount;
+
+  // Mesh file: mapping, validation and a pass over the vertex and index data (the upload copy)
+  U32 checksum = 0;
+  t.Reset();
+  for (U32 i = 0; i < kMeshConverterBenchmarkRunCount; ++i)
+  {
+    FileSystem::MappedFile meshFile;
+    Graphics::Scene::MeshFile::View view;
+    if (!meshFile.Open(targetFilePath) || !Graphics::Scene::MeshFile::Read(view, meshFile.GetPtr(), meshFile.GetSize())) return;
+    const U32* pVertexData = static_cast<const U32*>(view.pVertices);
+    for (U32 j = 0; j < view.vertexCount * view.vertexSize / sizeof(U32); ++j) checksum += pVertexData[j];
+    for (U32 j = 0; j < view.indexCount; ++j) checksum += view.pIndices[j];
+  }
+  const D64 mapTime = t.GetElapsed().GetMilliseconds() / kMeshConverterBenchmarkRunCount;
+
+  std::cout << "Vertex count: " << vertexCount << " (checksum " << checksum << ")" << std::endl;
+  std::cout << "Model file import: " << importTime << " ms" << std::endl;
+  std::cout << "Mesh file mapping: " << mapTime << " ms (x" << importTime / Math::Max(mapTime, 1e-3) << ")" << std::endl;
+}
+
+static FilePath MeshConverterGetTargetFilePath(const FilePath& sourceFilePath)
+{
+  // Replace the source extension (if any) with the mesh file one
+  FilePath targetFilePath(sourceFilePath);
+  for (size_t i = targetFilePath.GetLength(); i > 0; --i)
+  {
+    const char c = targetFilePath[i - 1];
+    if (c == '\\' || c == '/') break;
+    if (c == '.')
+    {
+      targetFilePath.SetLength(i - 1);
+      break;
+    }
+  }
+  targetFilePath += Graphics::Scene::MeshFile::kExtension;
+  return targetFilePath;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Main
+----------------------------------------------------------------------------------------------------------------------*/
+
+int main(int argc, char* argv[])
+{
+  U32 lodCount = 1;
+  bool benchmark = false;
+  FilePath sourceFilePath;
+  FilePath targetFilePath;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const String argument(argv[i]);
+    if (argument == "-benchmark") benchmark = true;
+    else if (argument == "-lods" && i + 1 < argc) lodCount = static_cast<U32>(atoi(argv[++i]));
+    else if (sourceFilePath.GetLength() == 0) sourceFilePath = argv[i];
+    else if (targetFilePath.GetLength() == 0) targetFilePath = argv[i];
+    else
+    {
+      std::cout << kMeshConverterUsage << std::endl;
+      return 1;
+    }
+  }
+  // Benchmark the sample model when no source file is supplied
+  if (sourceFilePath.GetLength() == 0)
+  {
+    if (!benchmark)
+    {
+      std::cout << kMeshConverterUsage << std::endl;
+      return 1;
+    }
+    sourceFilePath = kMeshConverterBenchmarkFilePath;
+  }
+  if (targetFilePath.GetLength() == 0) targetFilePath = MeshConverterGetTargetFilePath(sourceFilePath);
+
+  if (!Graphics::Scene::MeshFile::Convert(sourceFilePath, targetFilePath, Math::Max(lodCount, 1U)))
+  {
+    std::cout << "Unable to convert " << sourceFilePath.GetPtr() << std::endl;
+    return 1;
+  }
+  std::cout << sourceFilePath.GetPtr() << " -> " << targetFilePath.GetPtr() << std::endl;
+
+  if (benchmark) MeshConverterBenchmark(sourceFilePath, targetFilePath, Math::Max(lodCount, 1U));
+
+  return 0;
+}
@@ -0,0 +1,162 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elas Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 19-Oct-2026 by Elas Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Main.cpp
+This file defines the ePacker entry point. ePacker packs a directory tree (e.g. the Data directory) into a pack file
+(see PackFile) and benchmarks loading the packed files against loading them as loose files.
+*/
+
+#include <Base.h>
+#include <FileSystem/DirectoryScanner.h>
+#include <FileSystem/PackFile.h>
+#include <FileSystem/VirtualFileSystem.h>
+#include <Text/String.h>
+#include <Time/Timer.h>
+#include <iostream>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary
+----------------------------------------------------------------------------------------------------------------------*/
+
+static const char kPackerUsage[] = "Usage: ePacker [-nocompress] [-benchmark] <source directory> [<pack file>]";
+static const char kPackerBenchmarkDirectory[] = "..\\..\\..\\Data";
+static const U32  kPackerBenchmarkRunCount = 3;
+
+static D64 PackerLoad(FileSystem::VirtualFileSystem& vfs, const FilePath& sourceDirectory, const FileSystem::PathList& pathList, size_t& loadSize)
+{
+  E::Time::Timer t;
+  Containers::List<Byte> data;
+  loadSize = 0;
+  for (size_t i = 0; i < pathList.GetCount(); ++i)
+  {
+    FilePath filePath(sourceDirectory);
+    filePath += '/';
+    filePath += pathList[i];
+    if (vfs.Read(filePath, data)) loadSize += data.GetCount();
+  }
+  return t.GetElapsed().GetMilliseconds();
+}
+
+static void PackerBenchmark(const FilePath& sourceDirectory, const FilePath& packFilePath, const FileSystem::PathList& pathList)
+{
+  std::cout << "[Packer::Benchmark] " << sourceDirectory.GetPtr() << std::endl;
+
+  // The first run stands for a cold load and the next ones for warm loads. Flush the OS file cache (e.g. reboot) before
+  // running the benchmark to measure a truly cold load: otherwise the files read by the packer are already cached.
+  FileSystem::VirtualFileSystem vfs;
+  for (U32 i = 0; i < kPackerBenchmarkRunCount; ++i)
+  {
+    size_t looseSize = 0;
+    const D64 looseTime = PackerLoad(vfs, sourceDirectory, pathList, looseSize);
+
+    E::Time::Timer t;
+    size_t packedSize = 0;
+    if (!vfs.Mount(packFilePath, sourceDirectory)) return;
+    const D64 packedTime = t.GetElapsed().GetMilliseconds() + PackerLoad(vfs, sourceDirectory, pathList, packedSize);
+    vfs.UnmountAll();
+
+    std::cout << (i ? "Warm" : "Cold") << " load (" << pathList.GetCount() << " files, " << looseSize << " bytes): ";
+    std::cout << "loose files " << looseTime << " ms, pack file " << packedTime << " ms (x" << looseTime / Math::Max(packedTime, 1e-3) << ")" << std::endl;
+  }
+}
+
+static bool PackerGetPathList(const FilePath& sourceDirectory, FileSystem::PathList& pathList)
+{
+  // Pack files store the file paths relative to the source directory
+  FileSystem::DirectoryScanner scanner;
+  if (!scanner.Scan(sourceDirectory)) return false;
+
+  const FileSystem::DirectoryScanner::RecordList& recordList = scanner.GetRecordList();
+  for (size_t i = 0; i < recordList.GetCount(); ++i)
+  {
+    if ((recordList[i].info.flags & FileSystem::File::eFlagFile) == 0) continue;
+    const FilePath filePath = scanner.GetPath(recordList[i]);
+    pathList.PushBack(FilePath(filePath.GetPtr() + sourceDirectory.GetLength() + 1));
+  }
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Main
+----------------------------------------------------------------------------------------------------------------------*/
+
+int main(int argc, char* argv[])
+{
+  bool benchmark = false;
+  bool compress = true;
+  FilePath sourceDirectory;
+  FilePath packFilePath;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const String argument(argv[i]);
+    if (argument == "-benchmark") benchmark = true;
+    else if (argument == "-nocompress") compress = false;
+    else if (sourceDirectory.GetLength() == 0) sourceDirectory = argv[i];
+    else if (packFilePath.GetLength() == 0) packFilePath = argv[i];
+    else
+    {
+      std::cout << kPackerUsage << std::endl;
+      return 1;
+    }
+  }
+  // Benchmark the data directory when no source directory is supplied
+  if (sourceDirectory.GetLength() == 0)
+  {
+    if (!benchmark)
+    {
+      std::cout << kPackerUsage << std::endl;
+      return 1;
+    }
+    sourceDirectory = kPackerBenchmarkDirectory;
+  }
+  while (sourceDirectory.GetLength() > 1 && (sourceDirectory[sourceDirectory.GetLength() - 1] == '\\' || sourceDirectory[sourceDirectory.GetLength() - 1] == '/'))
+  {
+    sourceDirectory.SetLength(sourceDirectory.GetLength() - 1);
+  }
+  if (packFilePath.GetLength() == 0)
+  {
+    packFilePath = sourceDirectory;
+    packFilePath += FileSystem::PackFile::kExtension;
+  }
+
+  E::Time::Timer t;
+  FileSystem::PathList pathList;
+  if (!PackerGetPathList(sourceDirectory, pathList) || !FileSystem::PackFile::Create(packFilePath, sourceDirectory, pathList, compress))
+  {
+    std::cout << "Unable to pack " << sourceDirectory.GetPtr() << std::endl;
+    return 1;
+  }
+  std::cout << sourceDirectory.GetPtr() << " -> " << packFilePath.GetPtr() << " (" << pathList.GetCount() << " files, " << t.GetElapsed().GetMilliseconds() << " ms)" << std::endl;
+
+  if (benchmark) PackerBenchmark(sourceDirectory, packFilePath, pathList);
+
+  return 0;
+}